@@ -364,11 +364,16 @@ class TestGeometrySceneGraph(unittest.TestCase):
             point_stiffness=9,
         )
         param_init_scene_graph = mut.SceneGraphConfig(
-            default_proximity_properties=param_init_props)
+            default_proximity_properties=param_init_props,
+            hydroelastic_num_threads=2,
+            hydroelastic_coherence_margin=0.01)
         # Spot-check that at least some value got passed through.
         got_props = param_init_scene_graph.default_proximity_properties
         self.assertEqual(got_props.relaxation_time, None)
         self.assertEqual(got_props.point_stiffness, 9)
+        self.assertEqual(param_init_scene_graph.hydroelastic_num_threads, 2)
+        self.assertEqual(
+            param_init_scene_graph.hydroelastic_coherence_margin, 0.01)
 
     @numpy_compare.check_all_types
     def test_scene_graph_renderer_with_context(self, T):
@@ -5,6 +5,7 @@
 #include "drake/bindings/pydrake/pydrake_pybind.h"
 #include "drake/common/default_scalars.h"
 #include "drake/multibody/fem/deformable_body_config.h"
+#include "drake/multibody/fem/fem_solver_statistics.h"
 
 namespace drake {
 namespace pydrake {
@@ -24,6 +25,29 @@ void DoScalarIndependentDefinitions(py::module m) {
         .value("kCorotated", Class::kCorotated, cls_doc.kCorotated.doc)
         .value("kLinear", Class::kLinear, cls_doc.kLinear.doc);
   }
+
+  {
+    using Class = FemSolverStatistics;
+    constexpr auto& cls_doc = doc.FemSolverStatistics;
+    py::class_<Class>(m, "FemSolverStatistics", cls_doc.doc)
+        .def(py::init<>())
+        .def("Reset", &Class::Reset, cls_doc.Reset.doc)
+        .def_readwrite("num_iterations", &Class::num_iterations,
+            cls_doc.num_iterations.doc)
+        .def_readwrite("num_tangent_updates", &Class::num_tangent_updates,
+            cls_doc.num_tangent_updates.doc)
+        .def_readwrite("num_rejected_iterations",
+            &Class::num_rejected_iterations,
+            cls_doc.num_rejected_iterations.doc)
+        .def_readwrite("num_conjugate_gradient_iterations",
+            &Class::num_conjugate_gradient_iterations,
+            cls_doc.num_conjugate_gradient_iterations.doc)
+        .def_readwrite("num_unconverged_conjugate_gradient_solves",
+            &Class::num_unconverged_conjugate_gradient_solves,
+            cls_doc.num_unconverged_conjugate_gradient_solves.doc)
+        .def_readwrite("residual_norms", &Class::residual_norms,
+            cls_doc.residual_norms.doc);
+  }
 }
 
 template <typename T>
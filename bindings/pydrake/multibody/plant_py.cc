@@ -524,6 +524,16 @@ void DoScalarDependentDefinitions(py::module m, T) {
             },
             py::arg("context"), py::arg("body"),
             cls_doc.EvalBodyPoseInWorld.doc)
+        .def(
+            "CalcBodyPosesInWorldBatch",
+            [](const Class* self, const Context<T>& context,
+                const Eigen::Ref<const MatrixX<T>>& q) {
+              BodyPosesBatch<T> X_WB_batch;
+              self->CalcBodyPosesInWorldBatch(context, q, &X_WB_batch);
+              return X_WB_batch;
+            },
+            py::arg("context"), py::arg("q"),
+            cls_doc.CalcBodyPosesInWorldBatch.doc)
         .def(
             "EvalBodySpatialAccelerationInWorld",
             [](const Class* self, const Context<T>& context,
@@ -555,6 +565,22 @@ void DoScalarDependentDefinitions(py::module m, T) {
             py::arg("context"), py::arg("with_respect_to"), py::arg("frame_B"),
             py::arg("p_BoBp_B"), py::arg("frame_A"), py::arg("frame_E"),
             cls_doc.CalcJacobianSpatialVelocity.doc)
+        .def(
+            "CalcJacobiansSpatialVelocity",
+            [](const Class* self, const Context<T>& context,
+                JacobianWrtVariable with_respect_to,
+                const std::vector<const Frame<T>*>& frames_B,
+                const std::vector<Matrix3X<T>>& p_BoBi_B_list,
+                const Frame<T>& frame_A, const Frame<T>& frame_E) {
+              std::vector<MatrixX<T>> Js_V_ABi_E_list;
+              self->CalcJacobiansSpatialVelocity(context, with_respect_to,
+                  frames_B, p_BoBi_B_list, frame_A, frame_E,
+                  &Js_V_ABi_E_list);
+              return Js_V_ABi_E_list;
+            },
+            py::arg("context"), py::arg("with_respect_to"),
+            py::arg("frames_B"), py::arg("p_BoBi_B_list"), py::arg("frame_A"),
+            py::arg("frame_E"), cls_doc.CalcJacobiansSpatialVelocity.doc)
         .def(
             "CalcJacobianAngularVelocity",
             [](const Class* self, const Context<T>& context,
@@ -615,9 +641,52 @@ void DoScalarDependentDefinitions(py::module m, T) {
         .def("CalcInverseDynamics", &Class::CalcInverseDynamics,
             py::arg("context"), py::arg("known_vdot"),
             py::arg("external_forces"), cls_doc.CalcInverseDynamics.doc)
+        .def(
+            "CalcInverseDynamicsDerivatives",
+            [](const Class* self, const Context<T>& context,
+                const VectorX<T>& known_vdot,
+                const MultibodyForces<T>& external_forces) {
+              const int nq = self->num_positions();
+              const int nv = self->num_velocities();
+              MatrixX<T> dtau_dq(nv, nq);
+              MatrixX<T> dtau_dv(nv, nv);
+              self->CalcInverseDynamicsDerivatives(
+                  context, known_vdot, external_forces, &dtau_dq, &dtau_dv);
+              return std::make_tuple(dtau_dq, dtau_dv);
+            },
+            py::arg("context"), py::arg("known_vdot"),
+            py::arg("external_forces"),
+            (std::string(cls_doc.CalcInverseDynamicsDerivatives.doc) +
+                "\n\n"
+                "In Python, the derivatives are returned as the tuple "
+                "``(dtau_dq, dtau_dv)``.")
+                .c_str())
+        .def(
+            "CalcForwardDynamicsDerivatives",
+            [](const Class* self, const Context<T>& context,
+                const MultibodyForces<T>& applied_forces) {
+              const int nq = self->num_positions();
+              const int nv = self->num_velocities();
+              VectorX<T> vdot(nv);
+              MatrixX<T> dvdot_dq(nv, nq);
+              MatrixX<T> dvdot_dv(nv, nv);
+              MatrixX<T> dvdot_dtau(nv, nv);
+              self->CalcForwardDynamicsDerivatives(context, applied_forces,
+                  &vdot, &dvdot_dq, &dvdot_dv, &dvdot_dtau);
+              return std::make_tuple(vdot, dvdot_dq, dvdot_dv, dvdot_dtau);
+            },
+            py::arg("context"), py::arg("applied_forces"),
+            (std::string(cls_doc.CalcForwardDynamicsDerivatives.doc) +
+                "\n\n"
+                "In Python, the results are returned as the tuple "
+                "``(vdot, dvdot_dq, dvdot_dv, dvdot_dtau)``.")
+                .c_str())
         .def("CalcForceElementsContribution",
             &Class::CalcForceElementsContribution, py::arg("context"),
             py::arg("forces"), cls_doc.CalcForceElementsContribution.doc)
+        .def("AdvanceDiscreteSteps", &Class::AdvanceDiscreteSteps,
+            py::arg("context"), py::arg("num_steps"),
+            cls_doc.AdvanceDiscreteSteps.doc)
         .def("GetPositionLowerLimits", &Class::GetPositionLowerLimits,
             cls_doc.GetPositionLowerLimits.doc)
         .def("GetPositionUpperLimits", &Class::GetPositionUpperLimits,
@@ -654,6 +723,14 @@ void DoScalarDependentDefinitions(py::module m, T) {
               return H;
             },
             py::arg("context"), cls_doc.CalcMassMatrix.doc)
+        .def(
+            "CalcBranchInducedMassMatrix",
+            [](const Class* self, const Context<T>& context) {
+              BranchInducedSparseMatrix<T> M;
+              self->CalcBranchInducedMassMatrix(context, &M);
+              return M;
+            },
+            py::arg("context"), cls_doc.CalcBranchInducedMassMatrix.doc)
         .def(
             "CalcBiasSpatialAcceleration",
             [](const Class* self, const systems::Context<T>& context,
@@ -1135,6 +1212,23 @@ void DoScalarDependentDefinitions(py::module m, T) {
         .def("get_sap_near_rigid_threshold",
             &Class::get_sap_near_rigid_threshold,
             cls_doc.get_sap_near_rigid_threshold.doc)
+        .def("set_hydroelastic_max_quadrature_points_per_surface",
+            &Class::set_hydroelastic_max_quadrature_points_per_surface,
+            py::arg("max_num_points"),
+            cls_doc.set_hydroelastic_max_quadrature_points_per_surface.doc)
+        .def("get_hydroelastic_max_quadrature_points_per_surface",
+            &Class::get_hydroelastic_max_quadrature_points_per_surface,
+            cls_doc.get_hydroelastic_max_quadrature_points_per_surface.doc)
+        .def("set_sap_island_parallelism", &Class::set_sap_island_parallelism,
+            py::arg("parallelism"), cls_doc.set_sap_island_parallelism.doc)
+        .def("get_sap_island_parallelism", &Class::get_sap_island_parallelism,
+            cls_doc.get_sap_island_parallelism.doc)
+        .def("set_sap_linear_solver_parallelism",
+            &Class::set_sap_linear_solver_parallelism, py::arg("parallelism"),
+            cls_doc.set_sap_linear_solver_parallelism.doc)
+        .def("get_sap_linear_solver_parallelism",
+            &Class::get_sap_linear_solver_parallelism,
+            cls_doc.get_sap_linear_solver_parallelism.doc)
         .def_static("GetDefaultContactSurfaceRepresentation",
             &Class::GetDefaultContactSurfaceRepresentation,
             py::arg("time_step"),
@@ -1152,6 +1246,23 @@ void DoScalarDependentDefinitions(py::module m, T) {
         .def("get_adjacent_bodies_collision_filters",
             &Class::get_adjacent_bodies_collision_filters,
             cls_doc.get_adjacent_bodies_collision_filters.doc)
+        .def("set_tree_parallelism", &Class::set_tree_parallelism,
+            py::arg("parallelism"), cls_doc.set_tree_parallelism.doc)
+        .def("get_tree_parallelism", &Class::get_tree_parallelism,
+            cls_doc.get_tree_parallelism.doc)
+        .def("set_incremental_kinematics", &Class::set_incremental_kinematics,
+            py::arg("incremental"), cls_doc.set_incremental_kinematics.doc)
+        .def("get_incremental_kinematics", &Class::get_incremental_kinematics,
+            cls_doc.get_incremental_kinematics.doc)
+        .def("GetIncrementalKinematicsStatistics",
+            &Class::GetIncrementalKinematicsStatistics, py::arg("context"),
+            cls_doc.GetIncrementalKinematicsStatistics.doc)
+        .def("set_forward_dynamics_algorithm",
+            &Class::set_forward_dynamics_algorithm, py::arg("algorithm"),
+            cls_doc.set_forward_dynamics_algorithm.doc)
+        .def("get_forward_dynamics_algorithm",
+            &Class::get_forward_dynamics_algorithm,
+            cls_doc.get_forward_dynamics_algorithm.doc)
         .def("deformable_model", &Class::deformable_model,
             py_rvp::reference_internal, cls_doc.deformable_model.doc)
         .def("mutable_deformable_model", &Class::mutable_deformable_model,
@@ -1530,6 +1641,7 @@ PYBIND11_MODULE(plant, m) {
 
   py::module::import("pydrake.geometry");
   py::module::import("pydrake.math");
+  py::module::import("pydrake.multibody.fem");
   py::module::import("pydrake.multibody.math");
   py::module::import("pydrake.multibody.tree");
   py::module::import("pydrake.systems.framework");
@@ -1629,6 +1741,30 @@ PYBIND11_MODULE(plant, m) {
         .value("kLagged", Class::kLagged, cls_doc.kLagged.doc);
   }
 
+  {
+    using Class = ForwardDynamicsAlgorithm;
+    constexpr auto& cls_doc = doc.ForwardDynamicsAlgorithm;
+    py::enum_<Class>(m, "ForwardDynamicsAlgorithm", cls_doc.doc)
+        .value("kArticulatedBody", Class::kArticulatedBody,
+            cls_doc.kArticulatedBody.doc)
+        .value("kMassMatrix", Class::kMassMatrix, cls_doc.kMassMatrix.doc);
+  }
+
+  {
+    using Class = IncrementalKinematicsStatistics;
+    constexpr auto& cls_doc = doc.IncrementalKinematicsStatistics;
+    py::class_<Class>(m, "IncrementalKinematicsStatistics", cls_doc.doc)
+        .def(py::init<>())
+        .def_readwrite("num_evaluations", &Class::num_evaluations,
+            cls_doc.num_evaluations.doc)
+        .def_readwrite("num_full_updates", &Class::num_full_updates,
+            cls_doc.num_full_updates.doc)
+        .def_readwrite("num_nodes_updated", &Class::num_nodes_updated,
+            cls_doc.num_nodes_updated.doc)
+        .def_readwrite("num_nodes_reused", &Class::num_nodes_reused,
+            cls_doc.num_nodes_reused.doc);
+  }
+
   {
     using Class = MultibodyPlantConfig;
     constexpr auto& cls_doc = doc.MultibodyPlantConfig;
@@ -1661,6 +1797,34 @@ PYBIND11_MODULE(plant, m) {
         .def("SetWallBoundaryCondition", &Class::SetWallBoundaryCondition,
             py::arg("id"), py::arg("p_WQ"), py::arg("n_W"),
             cls_doc.SetWallBoundaryCondition.doc)
+        .def("SetParallelism", &Class::SetParallelism,
+            py::arg("parallelism"), cls_doc.SetParallelism.doc)
+        .def("parallelism", &Class::parallelism, cls_doc.parallelism.doc)
+        .def("SetUseMatrixFreeSolver", &Class::SetUseMatrixFreeSolver,
+            py::arg("id"), py::arg("use_matrix_free"),
+            cls_doc.SetUseMatrixFreeSolver.doc)
+        .def("UsesMatrixFreeSolver", &Class::UsesMatrixFreeSolver,
+            py::arg("id"), cls_doc.UsesMatrixFreeSolver.doc)
+        .def("SetTangentRefreshInterval", &Class::SetTangentRefreshInterval,
+            py::arg("id"), py::arg("interval"),
+            cls_doc.SetTangentRefreshInterval.doc)
+        .def("GetTangentRefreshInterval", &Class::GetTangentRefreshInterval,
+            py::arg("id"), cls_doc.GetTangentRefreshInterval.doc)
+        .def("SetLaggedTangentResidualRatio",
+            &Class::SetLaggedTangentResidualRatio, py::arg("id"),
+            py::arg("ratio"), cls_doc.SetLaggedTangentResidualRatio.doc)
+        .def("GetLaggedTangentResidualRatio",
+            &Class::GetLaggedTangentResidualRatio, py::arg("id"),
+            cls_doc.GetLaggedTangentResidualRatio.doc)
+        .def(
+            "GetFemSolverStatistics",
+            [](const Class* self, const Context<T>& context,
+                DeformableBodyId id) {
+              // Return a copy, since the cached value may be overwritten.
+              return self->GetFemSolverStatistics(context, id);
+            },
+            py::arg("context"), py::arg("id"),
+            cls_doc.GetFemSolverStatistics.doc)
         .def("GetDiscreteStateIndex", &Class::GetDiscreteStateIndex,
             py::arg("id"), cls_doc.GetDiscreteStateIndex.doc)
         .def("GetReferencePositions", &Class::GetReferencePositions,
@@ -5,6 +5,7 @@ from pydrake.autodiffutils import AutoDiffXd
 from pydrake.multibody.fem import (
     MaterialModel,
     DeformableBodyConfig_,
+    FemSolverStatistics,
 )
 
 
@@ -35,3 +36,17 @@ class TestMultibodyFem(unittest.TestCase):
         for model in models:
             dut.set_material_model(model)
             self.assertEqual(dut.material_model(), model)
+
+    def test_fem_solver_statistics(self):
+        dut = FemSolverStatistics()
+        self.assertEqual(dut.num_iterations, 0)
+        self.assertEqual(dut.num_tangent_updates, 0)
+        self.assertEqual(dut.num_rejected_iterations, 0)
+        self.assertEqual(dut.num_conjugate_gradient_iterations, 0)
+        self.assertEqual(dut.num_unconverged_conjugate_gradient_solves, 0)
+        self.assertEqual(dut.residual_norms, [])
+        dut.num_iterations = 2
+        dut.residual_norms = [1.0, 0.1]
+        dut.Reset()
+        self.assertEqual(dut.num_iterations, 0)
+        self.assertEqual(dut.residual_norms, [])
@@ -15,12 +15,16 @@ from pydrake.symbolic import Expression, Variable
 from pydrake.lcm import DrakeLcm
 from pydrake.math import RigidTransform
 from pydrake.multibody.fem import (
-    DeformableBodyConfig_
+    DeformableBodyConfig_,
+    FemSolverStatistics,
 )
 from pydrake.multibody.tree import (
     BallRpyJoint_,
     Body_,  # dispreferred alias for RigidBody_
     BodyIndex,
+    BodyPosesBatch_,
+    BranchInducedLtdlFactorization_,
+    BranchInducedSparseMatrix_,
     CalcSpatialInertia,
     MultibodyConstraintId,
     DoorHinge_,
@@ -84,6 +88,8 @@ from pydrake.multibody.plant import (
     DiscreteContactSolver,
     ExternallyAppliedSpatialForce_,
     ExternallyAppliedSpatialForceMultiplexer_,
+    ForwardDynamicsAlgorithm,
+    IncrementalKinematicsStatistics,
     MultibodyPlant,
     MultibodyPlant_,
     MultibodyPlantConfig,
@@ -98,7 +104,7 @@ from pydrake.multibody.benchmarks.acrobot import (
     MakeAcrobotPlant,
 )
 from pydrake.common.cpp_param import List
-from pydrake.common import FindResourceOrThrow
+from pydrake.common import FindResourceOrThrow, Parallelism
 from pydrake.common.deprecation import install_numpy_warning_filters
 from pydrake.common.eigen_geometry import Quaternion_
 from pydrake.common.test_utilities import numpy_compare
@@ -1274,6 +1280,18 @@ class TestPlant(unittest.TestCase):
             self.assert_sane(Js_V_ABp_E)
 
             self.assertEqual(Js_V_ABp_E.shape, (6, nw))
+            p_BoBi_B = np.array([[0.0, 0.1], [0.0, 0.2], [0.0, 0.3]])
+            Js_V_ABi_E_list = plant.CalcJacobiansSpatialVelocity(
+                context=context, with_respect_to=wrt,
+                frames_B=[base_frame, world_frame],
+                p_BoBi_B_list=[p_BoBi_B, np.zeros((3, 0))],
+                frame_A=world_frame, frame_E=world_frame)
+            self.assertEqual(len(Js_V_ABi_E_list), 2)
+            self.assertEqual(Js_V_ABi_E_list[0].shape, (12, nw))
+            self.assertEqual(Js_V_ABi_E_list[1].shape, (0, nw))
+            numpy_compare.assert_float_allclose(
+                Js_V_ABi_E_list[0][:6, :], numpy_compare.to_float(Js_V_ABp_E),
+                atol=1e-14)
             Js_w_AB_E = plant.CalcJacobianAngularVelocity(
                 context=context, with_respect_to=wrt, frame_B=base_frame,
                 frame_A=world_frame, frame_E=world_frame)
@@ -1390,6 +1408,53 @@ class TestPlant(unittest.TestCase):
         M = SpatialInertia_[T](1, [0, 0, 0], UnitInertia_[T](1, 1, 1))
         base.SetSpatialInertiaInBodyFrame(context=context, M_Bo_B=M)
 
+    @numpy_compare.check_all_types
+    def test_body_poses_in_world_batch(self, T):
+        plant_f = MultibodyPlant_[float](0.0)
+        file_name = FindResourceOrThrow(
+            "drake/bindings/pydrake/multibody/test/double_pendulum.sdf")
+        Parser(plant_f).AddModels(file_name)
+        plant_f.Finalize()
+        plant = to_type(plant_f, T)
+        context = plant.CreateDefaultContext()
+        nq = plant.num_positions()
+        num_configurations = 3
+        q = np.array([[T(0.1 * (i + 1) * (k - 1)) for k in
+                       range(num_configurations)] for i in range(nq)])
+
+        X_WB_batch = plant.CalcBodyPosesInWorldBatch(context=context, q=q)
+        self.assertIsInstance(X_WB_batch, BodyPosesBatch_[T])
+        self.assertEqual(X_WB_batch.num_bodies(), plant.num_bodies())
+        self.assertEqual(X_WB_batch.num_configurations(), num_configurations)
+        for k in range(num_configurations):
+            plant.SetPositions(context, q[:, k])
+            for index in range(plant.num_bodies()):
+                body = plant.get_body(BodyIndex(index))
+                X_WB_expected = plant.EvalBodyPoseInWorld(context, body)
+                X_WB = X_WB_batch.GetPose(body_index=body.index(), k=k)
+                numpy_compare.assert_float_allclose(
+                    numpy_compare.to_float(X_WB.GetAsMatrix4()),
+                    numpy_compare.to_float(X_WB_expected.GetAsMatrix4()),
+                    atol=1e-14)
+        self.assertEqual(
+            X_WB_batch.translations(body_index=BodyIndex(0)).shape,
+            (num_configurations, 3))
+        self.assertEqual(
+            X_WB_batch.rotations(body_index=BodyIndex(0)).shape,
+            (num_configurations, 9))
+
+        # Exercise the remaining BodyPosesBatch API.
+        batch = BodyPosesBatch_[T](num_bodies=2, num_configurations=1)
+        batch.SetPose(body_index=BodyIndex(1), k=0,
+                      X_WB=RigidTransform_[T](p=[1.0, 2.0, 3.0]))
+        numpy_compare.assert_float_equal(
+            batch.GetPose(body_index=BodyIndex(1), k=0).translation(),
+            np.array([1.0, 2.0, 3.0]))
+        batch.Resize(num_bodies=3, num_configurations=4)
+        self.assertEqual(batch.num_bodies(), 3)
+        self.assertEqual(batch.num_configurations(), 4)
+        self.assertEqual(BodyPosesBatch_[T]().num_bodies(), 0)
+
     @numpy_compare.check_all_types
     def test_multibody_state_access(self, T):
         MultibodyPlant = MultibodyPlant_[T]
@@ -2804,6 +2869,28 @@ class TestPlant(unittest.TestCase):
         self.assert_sane(M)
         self.assertTrue(Cv.shape == (2, ))
         self.assert_sane(Cv, nonzero=False)
+
+        # Mass matrix with branch-induced sparsity and its factorization.
+        M_sparse = plant.CalcBranchInducedMassMatrix(context=context)
+        self.assertIsInstance(M_sparse, BranchInducedSparseMatrix_[T])
+        self.assertEqual(M_sparse.size(), 2)
+        self.assertEqual(M_sparse.parents(), [-1, 0])
+        self.assertEqual(M_sparse.parent(i=1), 0)
+        self.assertEqual(M_sparse.depth(i=1), 1)
+        self.assertEqual(M_sparse.num_stored_entries(), 3)
+        self.assertTrue(M_sparse.IsStored(i=1, j=0))
+        numpy_compare.assert_float_allclose(
+            M_sparse.MakeDenseMatrix(), numpy_compare.to_float(M),
+            atol=1e-14)
+        M_ltdl = BranchInducedLtdlFactorization_[T](H=M_sparse)
+        self.assertEqual(M_ltdl.size(), 2)
+        self.assertEqual(M_ltdl.factors().size(), 2)
+        x = M_ltdl.Solve(b=M.dot(np.array([T(1.0), T(2.0)])))
+        numpy_compare.assert_float_allclose(x, [1.0, 2.0], atol=1e-12)
+        M_ltdl.Factor(H=M_sparse)
+        M_sparse.SetZero()
+        self.assertEqual(BranchInducedSparseMatrix_[T]().size(), 0)
+        self.assertEqual(BranchInducedLtdlFactorization_[T]().size(), 0)
         nv = plant.num_velocities()
         vd_d = np.zeros(nv)
         tau = plant.CalcInverseDynamics(
@@ -2883,6 +2970,31 @@ class TestPlant(unittest.TestCase):
             link2.GetForceInWorld(context, forces).get_coeffs()),
             2 * F_expected)
 
+    @numpy_compare.check_nonsymbolic_types
+    def test_dynamics_derivatives(self, T):
+        plant = to_type(MakeAcrobotPlant(AcrobotParameters(), True), T)
+        context = plant.CreateDefaultContext()
+        plant.SetPositions(context, [0.1, 0.2])
+        plant.SetVelocities(context, [0.3, -0.4])
+        nq = plant.num_positions()
+        nv = plant.num_velocities()
+        forces = MultibodyForces_[T](plant=plant)
+
+        dtau_dq, dtau_dv = plant.CalcInverseDynamicsDerivatives(
+            context=context, known_vdot=np.zeros(nv), external_forces=forces)
+        self.assertEqual(dtau_dq.shape, (nv, nq))
+        self.assertEqual(dtau_dv.shape, (nv, nv))
+
+        vdot, dvdot_dq, dvdot_dv, dvdot_dtau = (
+            plant.CalcForwardDynamicsDerivatives(
+                context=context, applied_forces=forces))
+        self.assertEqual(vdot.shape, (nv,))
+        self.assertEqual(dvdot_dq.shape, (nv, nq))
+        self.assertEqual(dvdot_dv.shape, (nv, nv))
+        M = numpy_compare.to_float(plant.CalcMassMatrix(context))
+        numpy_compare.assert_float_allclose(
+            dvdot_dtau, np.linalg.inv(M), atol=1e-12)
+
     @numpy_compare.check_nonsymbolic_types
     def test_contact(self, T):
         # PenetrationAsPointPair has been bound for non-symbolic types only.
@@ -2967,6 +3079,15 @@ class TestPlant(unittest.TestCase):
         plant.set_sap_near_rigid_threshold(near_rigid_threshold=0.03)
         plant.get_discrete_contact_solver()
 
+    def test_hydroelastic_max_quadrature_points_per_surface(self):
+        plant = MultibodyPlant_[float](0.1)
+        self.assertEqual(
+            plant.get_hydroelastic_max_quadrature_points_per_surface(), 0)
+        plant.set_hydroelastic_max_quadrature_points_per_surface(
+            max_num_points=16)
+        self.assertEqual(
+            plant.get_hydroelastic_max_quadrature_points_per_surface(), 16)
+
     def test_contact_surface_representation(self):
         for time_step in [0.0, 0.1]:
             plant = MultibodyPlant_[float](time_step)
@@ -2990,6 +3111,70 @@ class TestPlant(unittest.TestCase):
             self.assertEqual(plant.get_adjacent_bodies_collision_filters(),
                              value)
 
+    def test_sap_island_parallelism(self):
+        plant = MultibodyPlant_[float](0.0)
+        self.assertEqual(plant.get_sap_island_parallelism().num_threads(), 1)
+        plant.set_sap_island_parallelism(parallelism=Parallelism(2))
+        self.assertEqual(plant.get_sap_island_parallelism().num_threads(), 2)
+
+    def test_sap_linear_solver_parallelism(self):
+        plant = MultibodyPlant_[float](0.0)
+        self.assertEqual(
+            plant.get_sap_linear_solver_parallelism().num_threads(), 1)
+        plant.set_sap_linear_solver_parallelism(parallelism=Parallelism(2))
+        self.assertEqual(
+            plant.get_sap_linear_solver_parallelism().num_threads(), 2)
+
+    def test_tree_parallelism(self):
+        plant = MultibodyPlant_[float](0.0)
+        self.assertEqual(plant.get_tree_parallelism().num_threads(), 1)
+        plant.set_tree_parallelism(parallelism=Parallelism(3))
+        self.assertEqual(plant.get_tree_parallelism().num_threads(), 3)
+
+    def test_incremental_kinematics(self):
+        plant = MakeAcrobotPlant(AcrobotParameters(), True)
+        self.assertFalse(plant.get_incremental_kinematics())
+        plant.set_incremental_kinematics(incremental=True)
+        self.assertTrue(plant.get_incremental_kinematics())
+        context = plant.CreateDefaultContext()
+        stats = plant.GetIncrementalKinematicsStatistics(context=context)
+        self.assertIsInstance(stats, IncrementalKinematicsStatistics)
+        self.assertEqual(stats.num_evaluations, 1)
+        self.assertEqual(stats.num_full_updates, 1)
+        self.assertEqual(stats.num_nodes_updated, plant.num_bodies() - 1)
+        self.assertEqual(stats.num_nodes_reused, 0)
+        # Changing only the elbow angle lets the upper link be reused.
+        plant.SetPositions(context, [0.0, 0.5])
+        stats = plant.GetIncrementalKinematicsStatistics(context=context)
+        self.assertEqual(stats.num_evaluations, 2)
+        self.assertEqual(stats.num_full_updates, 1)
+        self.assertGreater(stats.num_nodes_reused, 0)
+        self.assertEqual(IncrementalKinematicsStatistics().num_evaluations,
+                         0)
+
+    def test_forward_dynamics_algorithm(self):
+        plant = MultibodyPlant_[float](0.0)
+        self.assertEqual(plant.get_forward_dynamics_algorithm(),
+                         ForwardDynamicsAlgorithm.kArticulatedBody)
+        plant.set_forward_dynamics_algorithm(
+            algorithm=ForwardDynamicsAlgorithm.kMassMatrix)
+        self.assertEqual(plant.get_forward_dynamics_algorithm(),
+                         ForwardDynamicsAlgorithm.kMassMatrix)
+
+    def test_advance_discrete_steps(self):
+        plant = MultibodyPlant_[float](0.01)
+        body = plant.AddRigidBody(
+            name="body",
+            M_BBo_B=SpatialInertia_[float].SolidSphereWithMass(
+                mass=1.0, radius=0.1))
+        plant.Finalize()
+        context = plant.CreateDefaultContext()
+        plant.AdvanceDiscreteSteps(context=context, num_steps=10)
+        self.assertAlmostEqual(context.get_time(), 0.1)
+        v_WB = plant.EvalBodySpatialVelocityInWorld(
+            context, body).translational()
+        self.assertLess(v_WB[2], 0.0)
+
     def test_contact_results_to_lcm(self):
         # ContactResultsToLcmSystem
         file_name = FindResourceOrThrow(
@@ -3298,6 +3483,15 @@ class TestPlant(unittest.TestCase):
         geometry_id = dut.GetGeometryId(body_id)
         self.assertEqual(dut.GetBodyId(geometry_id), body_id)
         dut.SetWallBoundaryCondition(body_id, [1, 1, -1], [0, 0, 1])
+        dut.SetParallelism(parallelism=Parallelism(2))
+        self.assertEqual(dut.parallelism().num_threads(), 2)
+        self.assertFalse(dut.UsesMatrixFreeSolver(body_id))
+        dut.SetUseMatrixFreeSolver(id=body_id, use_matrix_free=True)
+        self.assertTrue(dut.UsesMatrixFreeSolver(body_id))
+        dut.SetTangentRefreshInterval(id=body_id, interval=3)
+        self.assertEqual(dut.GetTangentRefreshInterval(body_id), 3)
+        dut.SetLaggedTangentResidualRatio(id=body_id, ratio=0.25)
+        self.assertEqual(dut.GetLaggedTangentResidualRatio(body_id), 0.25)
 
         # Verify that a body has been added to the model.
         self.assertEqual(dut.num_bodies(), 1)
@@ -3319,3 +3513,8 @@ class TestPlant(unittest.TestCase):
         # Ensure we can simulate this system.
         simulator = Simulator_[float](diagram)
         simulator.AdvanceTo(0.01)
+        plant_context = plant.GetMyContextFromRoot(simulator.get_context())
+        stats = deformable_model.GetFemSolverStatistics(
+            context=plant_context, id=body_id)
+        self.assertIsInstance(stats, FemSolverStatistics)
+        self.assertGreater(stats.num_conjugate_gradient_iterations, 0)
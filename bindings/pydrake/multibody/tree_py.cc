@@ -14,6 +14,8 @@
 #include "drake/bindings/pydrake/pydrake_pybind.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/tree/ball_rpy_joint.h"
+#include "drake/multibody/tree/body_poses_batch.h"
+#include "drake/multibody/tree/branch_induced_sparse_matrix.h"
 #include "drake/multibody/tree/door_hinge.h"
 #include "drake/multibody/tree/force_element.h"
 #include "drake/multibody/tree/frame.h"
@@ -1137,6 +1139,74 @@ void DoScalarDependentDefinitions(py::module m, T) {
             cls_doc.AddInForces.doc);
     DefCopyAndDeepCopy(&cls);
   }
+
+  // BodyPosesBatch
+  {
+    using Class = BodyPosesBatch<T>;
+    constexpr auto& cls_doc = doc.BodyPosesBatch;
+    auto cls = DefineTemplateClassWithDefault<Class>(
+        m, "BodyPosesBatch", param, cls_doc.doc);
+    cls  // BR
+        .def(py::init<>(), cls_doc.ctor.doc_0args)
+        .def(py::init<int, int>(), py::arg("num_bodies"),
+            py::arg("num_configurations"), cls_doc.ctor.doc_2args)
+        .def("num_bodies", &Class::num_bodies, cls_doc.num_bodies.doc)
+        .def("num_configurations", &Class::num_configurations,
+            cls_doc.num_configurations.doc)
+        .def("Resize", &Class::Resize, py::arg("num_bodies"),
+            py::arg("num_configurations"), cls_doc.Resize.doc)
+        .def("translations", &Class::translations, py::arg("body_index"),
+            cls_doc.translations.doc)
+        .def("rotations", &Class::rotations, py::arg("body_index"),
+            cls_doc.rotations.doc)
+        .def("GetPose", &Class::GetPose, py::arg("body_index"), py::arg("k"),
+            cls_doc.GetPose.doc)
+        .def("SetPose", &Class::SetPose, py::arg("body_index"), py::arg("k"),
+            py::arg("X_WB"), cls_doc.SetPose.doc);
+    DefCopyAndDeepCopy(&cls);
+  }
+
+  // BranchInducedSparseMatrix
+  {
+    using Class = BranchInducedSparseMatrix<T>;
+    constexpr auto& cls_doc = doc.BranchInducedSparseMatrix;
+    auto cls = DefineTemplateClassWithDefault<Class>(
+        m, "BranchInducedSparseMatrix", param, cls_doc.doc);
+    cls  // BR
+        .def(py::init<>(), cls_doc.ctor.doc_0args)
+        .def(py::init<std::vector<int>>(), py::arg("parents"),
+            cls_doc.ctor.doc_1args)
+        .def("size", &Class::size, cls_doc.size.doc)
+        .def("parents", &Class::parents, cls_doc.parents.doc)
+        .def("parent", &Class::parent, py::arg("i"), cls_doc.parent.doc)
+        .def("depth", &Class::depth, py::arg("i"), cls_doc.depth.doc)
+        .def("num_stored_entries", &Class::num_stored_entries,
+            cls_doc.num_stored_entries.doc)
+        .def("IsStored", &Class::IsStored, py::arg("i"), py::arg("j"),
+            cls_doc.IsStored.doc)
+        .def("SetZero", &Class::SetZero, cls_doc.SetZero.doc)
+        .def("MakeDenseMatrix", &Class::MakeDenseMatrix,
+            cls_doc.MakeDenseMatrix.doc);
+    DefCopyAndDeepCopy(&cls);
+  }
+
+  // BranchInducedLtdlFactorization
+  {
+    using Class = BranchInducedLtdlFactorization<T>;
+    constexpr auto& cls_doc = doc.BranchInducedLtdlFactorization;
+    auto cls = DefineTemplateClassWithDefault<Class>(
+        m, "BranchInducedLtdlFactorization", param, cls_doc.doc);
+    cls  // BR
+        .def(py::init<>(), cls_doc.ctor.doc_0args)
+        .def(py::init<const BranchInducedSparseMatrix<T>&>(), py::arg("H"),
+            cls_doc.ctor.doc_1args)
+        .def("Factor", &Class::Factor, py::arg("H"), cls_doc.Factor.doc)
+        .def("size", &Class::size, cls_doc.size.doc)
+        .def("factors", &Class::factors, py_rvp::reference_internal,
+            cls_doc.factors.doc)
+        .def("Solve", &Class::Solve, py::arg("b"), cls_doc.Solve.doc);
+    DefCopyAndDeepCopy(&cls);
+  }
   // NOLINTNEXTLINE(readability/fn_size)
 }
 }  // namespace
@@ -26,10 +26,12 @@
 
 #include <cmath>
 #include <limits>
+#include <type_traits>
 
 #include "drake/common/cond.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/dummy_value.h"
+#include "drake/common/fmt_ostream.h"
 
 namespace Eigen {
 
@@ -148,6 +150,42 @@ pow(const Eigen::AutoDiffScalar<DerTypeA>& base,
           x_to_the_y * log(x) * ygrad);
 }
 
+/// Overloads atan2 for autodiff scalars whose partials have a fixed size or
+/// a fixed maximum size, such as AutoDiffd and AutoDiffUpTo. Eigen's generic
+/// atan2 always returns partials in a heap-allocated Eigen::VectorXd, which
+/// would both allocate and fail to match the argument types in expressions
+/// such as if_then_else(). This overload, which is preferred over Eigen's
+/// since it is more constrained, returns the arguments' plain type instead.
+template <typename DerTypeA, typename DerTypeB>
+  requires(std::is_same_v<
+               typename internal::remove_all<DerTypeA>::type::PlainObject,
+               typename internal::remove_all<DerTypeB>::type::PlainObject> &&
+           internal::remove_all<DerTypeA>::type::PlainObject::
+                   MaxSizeAtCompileTime != Eigen::Dynamic)
+Eigen::AutoDiffScalar<
+    typename internal::remove_all<DerTypeA>::type::PlainObject>
+atan2(const Eigen::AutoDiffScalar<DerTypeA>& a,
+      const Eigen::AutoDiffScalar<DerTypeB>& b) {
+  using std::atan2;
+  Eigen::AutoDiffScalar<
+      typename internal::remove_all<DerTypeA>::type::PlainObject>
+      result;
+  result.value() = atan2(a.value(), b.value());
+  // If (squared_hypot == 0) the derivative is undefined and the following
+  // results in a NaN. Constants may have empty partials.
+  const double squared_hypot = a.value() * a.value() + b.value() * b.value();
+  if (b.derivatives().size() == 0) {
+    result.derivatives() = a.derivatives() * (b.value() / squared_hypot);
+  } else if (a.derivatives().size() == 0) {
+    result.derivatives() = b.derivatives() * (-a.value() / squared_hypot);
+  } else {
+    result.derivatives() =
+        (a.derivatives() * b.value() - a.value() * b.derivatives()) /
+        squared_hypot;
+  }
+  return result;
+}
+
 }  // namespace Eigen
 
 namespace drake {
@@ -217,3 +255,8 @@ cond(bool f_cond, const Eigen::AutoDiffScalar<DerType>& e_then, Rest... rest) {
 }
 
 }  // namespace drake
+
+namespace fmt {
+template <>
+struct formatter<drake::AutoDiffUpTo16d> : drake::ostream_formatter {};
+}  // namespace fmt
@@ -105,6 +105,30 @@ extern template SomeType<::drake::symbolic::Expression>;
 extern template SomeType<double>; \
 extern template SomeType<::drake::AutoDiffXd>;
 
+/// Defines template instantiations for drake::AutoDiffUpTo16d, in addition to
+/// the default scalars. This should only be used in .cc files, never in .h
+/// files.
+///
+/// drake::AutoDiffUpTo16d is not one of the default scalars. It stores its
+/// partials inline rather than on the heap, which makes it much cheaper than
+/// drake::AutoDiffXd when gradients are only needed with respect to a
+/// handful of variables. Only Drake's kinematics math classes, such as
+/// drake::math::RigidTransform, drake::math::RotationMatrix and
+/// drake::multibody::SpatialInertia, are instantiated for it; systems such as
+/// drake::multibody::MultibodyPlant are not. The inverse kinematics position
+/// and orientation constraints can produce their gradients in it from a
+/// MultibodyPlant<double>, see
+/// drake::multibody::PositionConstraint::EvalFixedSizeAutoDiff().
+#define DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF( \
+    SomeType) \
+template SomeType<::drake::AutoDiffUpTo16d>;
+
+/// Declares that template instantiations exist for drake::AutoDiffUpTo16d.
+/// This should only be used in .h files, never in .cc files.
+#define DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF( \
+    SomeType) \
+extern template SomeType<::drake::AutoDiffUpTo16d>;
+
 /// @}
 
 /// @name Function template instantiation macros
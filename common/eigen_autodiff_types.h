@@ -35,4 +35,20 @@ using AutoDiffVecd = Eigen::Matrix<AutoDiffd<num_vars>, rows, 1>;
 /// vector of partials.
 typedef AutoDiffVecd<Eigen::Dynamic, Eigen::Dynamic> AutoDiffVecXd;
 
+/// An autodiff variable with a dynamic number of partials, up to
+/// `max_num_vars`. Unlike AutoDiffXd, the partials are stored inline so that
+/// creating, copying and operating on these scalars never allocates heap
+/// memory.
+template <int max_num_vars>
+using AutoDiffUpTo = Eigen::AutoDiffScalar<
+    Eigen::Matrix<double, Eigen::Dynamic, 1, 0, max_num_vars, 1>>;
+
+/// An autodiff variable with up to 16 partials, enough for the gradients with
+/// respect to the configuration of, e.g., a floating base and a 7-DoF arm.
+/// Drake's kinematics math classes (e.g., math::RigidTransform and
+/// multibody::SpatialInertia) are instantiated for this scalar in addition to
+/// the @ref default_scalars, and the inverse kinematics position and
+/// orientation constraints can evaluate their gradients in it.
+using AutoDiffUpTo16d = AutoDiffUpTo<16>;
+
 }  // namespace drake
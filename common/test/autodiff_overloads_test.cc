@@ -1,3 +1,4 @@
+#include <limits>
 #include <type_traits>
 
 #include <Eigen/Dense>
@@ -431,6 +432,37 @@ GTEST_TEST(AutodiffOverloadsTest, DummyValue2) {
   EXPECT_TRUE(std::isnan(derivatives(1)));
 }
 
+// Eigen's atan2() always returns partials in an Eigen::VectorXd. Verify that
+// our overload preserves the partials' type when it has a fixed (maximum)
+// size, with the same values.
+GTEST_TEST(AutodiffOverloadsTest, Atan2FixedSize) {
+  const AutoDiffUpTo16d y(0.3, Eigen::Vector3d(1.0, 2.0, 0.0));
+  const AutoDiffUpTo16d x(-0.7, Eigen::Vector3d(0.0, -1.0, 3.0));
+  static_assert(std::is_same_v<decltype(atan2(y, x)), AutoDiffUpTo16d>);
+  static_assert(std::is_same_v<decltype(atan2(-y, x)), AutoDiffUpTo16d>);
+  static_assert(std::is_same_v<decltype(atan2(AutoDiffd<2>(), AutoDiffd<2>())),
+                               AutoDiffd<2>>);
+
+  const AutoDiffXd y_xd(y.value(), y.derivatives());
+  const AutoDiffXd x_xd(x.value(), x.derivatives());
+  const AutoDiffUpTo16d result = atan2(y, x);
+  const AutoDiffXd expected = atan2(y_xd, x_xd);
+  EXPECT_EQ(result.value(), expected.value());
+  EXPECT_TRUE(CompareMatrices(result.derivatives(), expected.derivatives(),
+                              4 * std::numeric_limits<double>::epsilon()));
+
+  // Constants have no partials.
+  const AutoDiffUpTo16d constant(2.0);
+  EXPECT_TRUE(CompareMatrices(
+      atan2(y, constant).derivatives(),
+      atan2(y_xd, AutoDiffXd(2.0)).derivatives(),
+      4 * std::numeric_limits<double>::epsilon()));
+  EXPECT_TRUE(CompareMatrices(
+      atan2(constant, x).derivatives(),
+      atan2(AutoDiffXd(2.0), x_xd).derivatives(),
+      4 * std::numeric_limits<double>::epsilon()));
+}
+
 }  // namespace
 }  // namespace common
 }  // namespace drake
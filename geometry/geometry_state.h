@@ -705,6 +705,35 @@ class GeometryState {
 
   //@}
 
+  /** @name Hydroelastic parallelism */
+  //@{
+
+  /** Sets the parallelism used to compute hydroelastic contact surfaces. See
+   SceneGraphConfig::hydroelastic_num_threads. */
+  void set_hydroelastic_parallelism(Parallelism parallelism) {
+    geometry_engine_->set_hydroelastic_parallelism(parallelism);
+  }
+
+  /** Returns the parallelism used to compute hydroelastic contact surfaces. */
+  Parallelism hydroelastic_parallelism() const {
+    return geometry_engine_->hydroelastic_parallelism();
+  }
+
+  /** Sets the margin used to reuse the candidates of mesh-mesh hydroelastic
+   contact between queries. See SceneGraphConfig::hydroelastic_coherence_margin.
+   */
+  void set_hydroelastic_coherence_margin(double margin) {
+    geometry_engine_->set_hydroelastic_coherence_margin(margin);
+  }
+
+  /** Returns the margin used to reuse the candidates of mesh-mesh
+   hydroelastic contact between queries. */
+  double hydroelastic_coherence_margin() const {
+    return geometry_engine_->hydroelastic_coherence_margin();
+  }
+
+  //@}
+
  private:
   // GeometryState of one scalar type is friends with all other scalar types.
   template <typename>
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <stack>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/proximity/aabb.h"
+#include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/obb.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* Returns a copy of `bv` whose half widths are increased by `padding`.  */
+inline Aabb PadBoundingVolume(const Aabb& bv, double padding) {
+  return Aabb(bv.center(),
+              bv.half_width() + Vector3<double>::Constant(padding));
+}
+
+/* Returns a copy of `bv` whose half widths are increased by `padding`.  */
+inline Obb PadBoundingVolume(const Obb& bv, double padding) {
+  return Obb(bv.pose(), bv.half_width() + Vector3<double>::Constant(padding));
+}
+
+/* %BvhCandidateCache exploits temporal coherence in repeated collision queries
+ between the same two bounding volume hierarchies, A and B, at slowly changing
+ relative poses X_AB.
+
+ The cache stores the pairs of leaf nodes found by a traversal of the two
+ hierarchies in which the bounding volumes of B are padded by a `margin`. Any
+ point of B moves, relative to A, by at most
+
+     d = |p_AB − p_AB₀| + ‖R_AB − R_AB₀‖⋅r_B
+
+ with X_AB₀ the pose of the traversal and r_B the radius of a sphere about Bo
+ enclosing all bounding volumes of B. While d ≤ margin, the stored leaf pairs
+ contain all the leaf pairs the unpadded traversal at X_AB would find, so that
+ Collide() only needs to test the stored leaf pairs, skipping the traversal.
+ Once the motion exceeds the margin, the cache is rebuilt with a new (padded)
+ traversal at the current pose.
+
+ The cache refers to the nodes of the hierarchies it was built with, and it is
+ rebuilt whenever Collide() is invoked on different hierarchies. The caller
+ must make sure that the hierarchies are not modified nor destroyed while the
+ cache is in use, since a new hierarchy at the address of an old one would not
+ be detected.
+
+ @tparam BvhA  The type of Bvh for A.
+ @tparam BvhB  The type of Bvh for B.  */
+template <class BvhA, class BvhB>
+class BvhCandidateCache {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BvhCandidateCache);
+
+  using NodeA = typename BvhA::NodeType;
+  using NodeB = typename BvhB::NodeType;
+
+  /* Constructs an empty cache.
+   @pre margin > 0.  */
+  explicit BvhCandidateCache(double margin) : margin_(margin) {
+    DRAKE_DEMAND(margin > 0);
+  }
+
+  double margin() const { return margin_; }
+
+  /* Drop-in replacement for bvh_A.Collide(bvh_B, X_AB, callback). The callback
+   is invoked for the element pairs of every leaf pair Bvh::Collide() would
+   report and in the same order. It can additionally be invoked for element
+   pairs of leaves whose bounding volumes overlap even though the bounding
+   volumes of some of their ancestors do not. Since elements are contained in
+   the bounding volumes of all of their ancestors, such pairs of elements never
+   intersect.
+
+   @returns `true` if the leaf pairs stored by a previous call were reused,
+   `false` if the hierarchies had to be traversed.  */
+  bool Collide(const BvhA& bvh_A, const BvhB& bvh_B,
+               const math::RigidTransformd& X_AB, BvttCallback callback) {
+    const bool reused = CanReuse(bvh_A, bvh_B, X_AB);
+    if (!reused) Rebuild(bvh_A, bvh_B, X_AB);
+
+    for (const auto& [node_a, node_b] : leaf_pairs_) {
+      if (!BvTypeA::HasOverlap(node_a->bv(), node_b->bv(), X_AB)) {
+        continue;
+      }
+      const int num_a_elements = node_a->num_element_indices();
+      const int num_b_elements = node_b->num_element_indices();
+      for (int a = 0; a < num_a_elements; ++a) {
+        for (int b = 0; b < num_b_elements; ++b) {
+          const BvttCallbackResult result =
+              callback(node_a->element_index(a), node_b->element_index(b));
+          if (result == BvttCallbackResult::Terminate) return reused;
+        }
+      }
+    }
+    return reused;
+  }
+
+  /* Returns the number of leaf pairs currently stored.  */
+  int num_leaf_pairs() const { return static_cast<int>(leaf_pairs_.size()); }
+
+ private:
+  using BvTypeA = std::decay_t<decltype(std::declval<const NodeA&>().bv())>;
+
+  // Returns true if the stored leaf pairs are valid for the given query.
+  bool CanReuse(const BvhA& bvh_A, const BvhB& bvh_B,
+                const math::RigidTransformd& X_AB) const {
+    if (&bvh_A != bvh_A_ || &bvh_B != bvh_B_) return false;
+    const double translation =
+        (X_AB.translation() - X_AB0_.translation()).norm();
+    // The Frobenius norm bounds the induced 2-norm of the rotation change.
+    const double rotation =
+        (X_AB.rotation().matrix() - X_AB0_.rotation().matrix()).norm();
+    return translation + rotation * radius_B_ <= margin_;
+  }
+
+  // Traverses the hierarchies at X_AB with the bounding volumes of B padded
+  // by the margin, storing every leaf pair found.
+  void Rebuild(const BvhA& bvh_A, const BvhB& bvh_B,
+               const math::RigidTransformd& X_AB) {
+    if (&bvh_B != bvh_B_) radius_B_ = CalcRadius(bvh_B.root_node());
+    bvh_A_ = &bvh_A;
+    bvh_B_ = &bvh_B;
+    X_AB0_ = X_AB;
+    leaf_pairs_.clear();
+
+    // Same traversal order as Bvh::Collide().
+    using NodePair = std::pair<const NodeA*, const NodeB*>;
+    std::stack<NodePair, std::vector<NodePair>> node_pairs;
+    node_pairs.emplace(&bvh_A.root_node(), &bvh_B.root_node());
+    while (!node_pairs.empty()) {
+      const auto [node_a, node_b] = node_pairs.top();
+      node_pairs.pop();
+
+      if (!BvTypeA::HasOverlap(node_a->bv(),
+                               PadBoundingVolume(node_b->bv(), margin_),
+                               X_AB)) {
+        continue;
+      }
+
+      if (node_a->is_leaf() && node_b->is_leaf()) {
+        leaf_pairs_.emplace_back(node_a, node_b);
+      } else if (node_b->is_leaf()) {
+        node_pairs.emplace(&node_a->left(), node_b);
+        node_pairs.emplace(&node_a->right(), node_b);
+      } else if (node_a->is_leaf()) {
+        node_pairs.emplace(node_a, &node_b->left());
+        node_pairs.emplace(node_a, &node_b->right());
+      } else {
+        node_pairs.emplace(&node_a->left(), &node_b->left());
+        node_pairs.emplace(&node_a->right(), &node_b->left());
+        node_pairs.emplace(&node_a->left(), &node_b->right());
+        node_pairs.emplace(&node_a->right(), &node_b->right());
+      }
+    }
+  }
+
+  // Returns the radius of a sphere about the origin of the hierarchy's frame
+  // that encloses the bounding volumes of `node` and all of its descendants.
+  static double CalcRadius(const NodeB& node) {
+    double radius = 0;
+    std::stack<const NodeB*, std::vector<const NodeB*>> nodes;
+    nodes.push(&node);
+    while (!nodes.empty()) {
+      const NodeB* n = nodes.top();
+      nodes.pop();
+      radius = std::max(
+          radius, n->bv().center().norm() + n->bv().half_width().norm());
+      if (!n->is_leaf()) {
+        nodes.push(&n->left());
+        nodes.push(&n->right());
+      }
+    }
+    return radius;
+  }
+
+  double margin_{};
+  const BvhA* bvh_A_{};
+  const BvhB* bvh_B_{};
+  double radius_B_{};
+  // The pose X_AB₀ of the last traversal.
+  math::RigidTransformd X_AB0_;
+  std::vector<std::pair<const NodeA*, const NodeB*>> leaf_pairs_;
+};
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
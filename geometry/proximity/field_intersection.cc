@@ -156,7 +156,9 @@ void VolumeIntersector<MeshBuilder, BvType>::IntersectFields(
     const Bvh<BvType, VolumeMesh<double>>& bvh1_N,
     const math::RigidTransform<T>& X_MN,
     std::unique_ptr<MeshType>* surface_01_M,
-    std::unique_ptr<FieldType>* e_01_M) {
+    std::unique_ptr<FieldType>* e_01_M,
+    BvhCandidateCache<Bvh<BvType, VolumeMesh<double>>,
+                      Bvh<BvType, VolumeMesh<double>>>* candidate_cache) {
   DRAKE_DEMAND(surface_01_M != nullptr);
   DRAKE_DEMAND(e_01_M != nullptr);
   surface_01_M->reset();
@@ -170,7 +172,11 @@ void VolumeIntersector<MeshBuilder, BvType>::IntersectFields(
     candidate_tetrahedra.emplace_back(tet0, tet1);
     return BvttCallbackResult::Continue;
   };
-  bvh0_M.Collide(bvh1_N, convert_to_double(X_MN), callback);
+  if (candidate_cache != nullptr) {
+    candidate_cache->Collide(bvh0_M, bvh1_N, convert_to_double(X_MN), callback);
+  } else {
+    bvh0_M.Collide(bvh1_N, convert_to_double(X_MN), callback);
+  }
 
   MeshBuilder builder_M;
   const math::RotationMatrix<T> R_NM = X_MN.rotation().inverse();
@@ -242,7 +248,9 @@ void HydroelasticVolumeIntersector<MeshBuilder>::IntersectCompliantVolumes(
     const VolumeMeshFieldLinear<double, double>& field1_N,
     const Bvh<Obb, VolumeMesh<double>>& bvh1_N,
     const math::RigidTransform<T>& X_WN,
-    std::unique_ptr<ContactSurface<T>>* contact_surface_W) {
+    std::unique_ptr<ContactSurface<T>>* contact_surface_W,
+    BvhCandidateCache<Bvh<Obb, VolumeMesh<double>>,
+                      Bvh<Obb, VolumeMesh<double>>>* candidate_cache) {
   const math::RigidTransform<T> X_MN = X_WM.InvertAndCompose(X_WN);
 
   // The computation will be in Frame M and then transformed to the world frame.
@@ -250,7 +258,7 @@ void HydroelasticVolumeIntersector<MeshBuilder>::IntersectCompliantVolumes(
   std::unique_ptr<typename MeshBuilder::FieldType> field01_M;
   VolumeIntersector<MeshBuilder, Obb> volume_intersector;
   volume_intersector.IntersectFields(field0_M, bvh0_M, field1_N, bvh1_N, X_MN,
-                                     &surface01_M, &field01_M);
+                                     &surface01_M, &field01_M, candidate_cache);
 
   if (surface01_M == nullptr) return;
 
@@ -302,16 +310,20 @@ std::unique_ptr<ContactSurface<T>> ComputeContactSurfaceFromCompliantVolumes(
     const VolumeMeshFieldLinear<double, double>& field1_N,
     const Bvh<Obb, VolumeMesh<double>>& bvh1_N,
     const math::RigidTransform<T>& X_WN,
-    HydroelasticContactRepresentation representation) {
+    HydroelasticContactRepresentation representation,
+    BvhCandidateCache<Bvh<Obb, VolumeMesh<double>>,
+                      Bvh<Obb, VolumeMesh<double>>>* candidate_cache) {
   std::unique_ptr<ContactSurface<T>> contact_surface_W;
   if (representation == HydroelasticContactRepresentation::kTriangle) {
     HydroelasticVolumeIntersector<TriMeshBuilder<T>>()
         .IntersectCompliantVolumes(id0, field0_M, bvh0_M, X_WM, id1, field1_N,
-                                   bvh1_N, X_WN, &contact_surface_W);
+                                   bvh1_N, X_WN, &contact_surface_W,
+                                   candidate_cache);
   } else {
     HydroelasticVolumeIntersector<PolyMeshBuilder<T>>()
         .IntersectCompliantVolumes(id0, field0_M, bvh0_M, X_WM, id1, field1_N,
-                                   bvh1_N, X_WN, &contact_surface_W);
+                                   bvh1_N, X_WN, &contact_surface_W,
+                                   candidate_cache);
   }
   return contact_surface_W;
 }
@@ -5,6 +5,7 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/bvh_candidate_cache.h"
 #include "drake/geometry/proximity/obb.h"
 #include "drake/geometry/proximity/plane.h"
 #include "drake/geometry/proximity/volume_mesh.h"
@@ -148,15 +149,24 @@ class VolumeIntersector {
                         of increasing field0 and decreasing field1.
    @param[out] e_01_M   The scalar field on the contact surface, expressed in
                         frame M.
+   @param[in, out] candidate_cache  If not null, the candidate pairs of
+                        tetrahedra are found with this cache instead of a full
+                        traversal of the two hierarchies. It must be used only
+                        with `bvh0_M` and `bvh1_N`. The results do not depend
+                        on it.
    @note  The output surface mesh may have duplicate vertices.
    */
-  void IntersectFields(const VolumeMeshFieldLinear<double, double>& field0_M,
-                       const Bvh<BvType, VolumeMesh<double>>& bvh0_M,
-                       const VolumeMeshFieldLinear<double, double>& field1_N,
-                       const Bvh<BvType, VolumeMesh<double>>& bvh1_N,
-                       const math::RigidTransform<T>& X_MN,
-                       std::unique_ptr<MeshType>* surface_01_M,
-                       std::unique_ptr<FieldType>* e_01_M);
+  void IntersectFields(
+      const VolumeMeshFieldLinear<double, double>& field0_M,
+      const Bvh<BvType, VolumeMesh<double>>& bvh0_M,
+      const VolumeMeshFieldLinear<double, double>& field1_N,
+      const Bvh<BvType, VolumeMesh<double>>& bvh1_N,
+      const math::RigidTransform<T>& X_MN,
+      std::unique_ptr<MeshType>* surface_01_M,
+      std::unique_ptr<FieldType>* e_01_M,
+      BvhCandidateCache<Bvh<BvType, VolumeMesh<double>>,
+                        Bvh<BvType, VolumeMesh<double>>>* candidate_cache =
+          nullptr);
 
   /* Returns the index of tetrahedron in the first mesh containing the
    i-th contact polygon.
@@ -231,7 +241,10 @@ class HydroelasticVolumeIntersector {
    @param[out] contact_surface_W   The contact surface, whose type (e.g.,
                          triangles or polygons) depends on the type parameter
                          MeshBuilder. It is expressed in World frame.
-                         If there is no contact, nullptr is returned.  */
+                         If there is no contact, nullptr is returned.
+   @param[in, out] candidate_cache  Optional cache of candidate pairs of
+                         tetrahedra for `bvh0_M` and `bvh1_N`. See
+                         VolumeIntersector::IntersectFields().  */
   void IntersectCompliantVolumes(
       GeometryId id0, const VolumeMeshFieldLinear<double, double>& field0_M,
       const Bvh<Obb, VolumeMesh<double>>& bvh0_M,
@@ -239,7 +252,10 @@ class HydroelasticVolumeIntersector {
       const VolumeMeshFieldLinear<double, double>& field1_N,
       const Bvh<Obb, VolumeMesh<double>>& bvh1_N,
       const math::RigidTransform<T>& X_WN,
-      std::unique_ptr<ContactSurface<T>>* contact_surface_W);
+      std::unique_ptr<ContactSurface<T>>* contact_surface_W,
+      BvhCandidateCache<Bvh<Obb, VolumeMesh<double>>,
+                        Bvh<Obb, VolumeMesh<double>>>* candidate_cache =
+          nullptr);
 };
 
 /* Computes the contact surface between two compliant hydroelastic geometries
@@ -260,6 +276,9 @@ class HydroelasticVolumeIntersector {
  @param[in] X_WN       The pose of the second geometry in World.
  @param[in] representation  The preferred representation of each contact
                             polygon.
+ @param[in, out] candidate_cache  Optional cache of candidate pairs of
+                       tetrahedra for `bvh0_M` and `bvh1_N`. See
+                       VolumeIntersector::IntersectFields().
 
  @returns the contact surface between the two geometries (see ContactSurface)
           in the requested representation. It is expressed in World frame.
@@ -280,7 +299,9 @@ std::unique_ptr<ContactSurface<T>> ComputeContactSurfaceFromCompliantVolumes(
     const VolumeMeshFieldLinear<double, double>& field1_N,
     const Bvh<Obb, VolumeMesh<double>>& bvh1_N,
     const math::RigidTransform<T>& X_WN,
-    HydroelasticContactRepresentation representation);
+    HydroelasticContactRepresentation representation,
+    BvhCandidateCache<Bvh<Obb, VolumeMesh<double>>,
+                      Bvh<Obb, VolumeMesh<double>>>* candidate_cache = nullptr);
 
 }  // namespace internal
 }  // namespace geometry
@@ -1,5 +1,6 @@
 #include "drake/geometry/proximity/hydroelastic_calculator.h"
 
+#include <unordered_set>
 #include <utility>
 
 #include <fmt/format.h>
@@ -20,7 +21,8 @@ std::unique_ptr<ContactSurface<T>> CalcRigidCompliant(
     const SoftGeometry& soft, const math::RigidTransform<T>& X_WS,
     GeometryId id_S, const RigidGeometry& rigid,
     const math::RigidTransform<T>& X_WR, GeometryId id_R,
-    HydroelasticContactRepresentation representation) {
+    HydroelasticContactRepresentation representation,
+    VolumeSurfaceCandidateCache* candidate_cache) {
   if (soft.is_half_space() || rigid.is_half_space()) {
     if (soft.is_half_space()) {
       DRAKE_DEMAND(!rigid.is_half_space());
@@ -47,7 +49,8 @@ std::unique_ptr<ContactSurface<T>> CalcRigidCompliant(
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R = rigid.bvh();
 
     return ComputeContactSurfaceFromSoftVolumeRigidSurface(
-        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR, representation);
+        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR, representation,
+        candidate_cache);
   }
 }
 
@@ -56,7 +59,8 @@ std::unique_ptr<ContactSurface<T>> CalcCompliantCompliant(
     const SoftGeometry& compliant_F, const math::RigidTransform<T>& X_WF,
     GeometryId id_F, const SoftGeometry& compliant_G,
     const math::RigidTransform<T>& X_WG, GeometryId id_G,
-    HydroelasticContactRepresentation representation) {
+    HydroelasticContactRepresentation representation,
+    VolumeVolumeCandidateCache* candidate_cache) {
   DRAKE_DEMAND(!compliant_F.is_half_space() && !compliant_G.is_half_space());
 
   const VolumeMeshFieldLinear<double, double>& field_F =
@@ -67,7 +71,33 @@ std::unique_ptr<ContactSurface<T>> CalcCompliantCompliant(
   const Bvh<Obb, VolumeMesh<double>>& bvh_G = compliant_G.bvh();
 
   return ComputeContactSurfaceFromCompliantVolumes(
-      id_F, field_F, bvh_F, X_WF, id_G, field_G, bvh_G, X_WG, representation);
+      id_F, field_F, bvh_F, X_WF, id_G, field_G, bvh_G, X_WG, representation,
+      candidate_cache);
+}
+
+CandidateCaches::CandidateCaches(double margin) : margin_(margin) {
+  DRAKE_DEMAND(margin > 0);
+}
+
+CandidateCaches::Entry& CandidateCaches::GetEntry(GeometryId id_A,
+                                                  GeometryId id_B) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::unique_ptr<Entry>& entry = entries_[SortedPair<GeometryId>(id_A, id_B)];
+  if (entry == nullptr) entry = std::make_unique<Entry>();
+  return *entry;
+}
+
+void CandidateCaches::RemoveAllExcept(
+    const std::vector<SortedPair<GeometryId>>& pairs) {
+  const std::unordered_set<SortedPair<GeometryId>> keep(pairs.begin(),
+                                                        pairs.end());
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (keep.contains(it->first)) {
+      ++it;
+    } else {
+      it = entries_.erase(it);
+    }
+  }
 }
 
 template <typename T>
@@ -118,6 +148,17 @@ ContactCalculator<T>::MaybeMakeContactSurface(GeometryId id_A,
     }
 
     // Compliant mesh vs. compliant mesh.
+    if (candidate_caches_ != nullptr) {
+      CandidateCaches::Entry& entry = candidate_caches_->GetEntry(id_A, id_B);
+      std::lock_guard<std::mutex> lock(entry.mutex);
+      if (!entry.volume_volume.has_value()) {
+        entry.volume_volume.emplace(candidate_caches_->margin());
+      }
+      std::unique_ptr<ContactSurface<T>> surface = CalcCompliantCompliant(
+          soft_A, X_WGs_.at(id_A), id_A, soft_B, X_WGs_.at(id_B), id_B,
+          representation_, &*entry.volume_volume);
+      return {ContactSurfaceResult::kCalculated, std::move(surface)};
+    }
     std::unique_ptr<ContactSurface<T>> surface =
         CalcCompliantCompliant(soft_A, X_WGs_.at(id_A), id_A, soft_B,
                                X_WGs_.at(id_B), id_B, representation_);
@@ -144,6 +185,21 @@ ContactCalculator<T>::MaybeMakeContactSurface(GeometryId id_A,
   const math::RigidTransform<T>& X_WS = X_WGs_.at(id_S);
   const math::RigidTransform<T>& X_WR = X_WGs_.at(id_R);
 
+  // Only mesh-mesh contact traverses bounding volume hierarchies of both
+  // geometries, so only it benefits from the candidate caches.
+  if (candidate_caches_ != nullptr && !soft.is_half_space() &&
+      !rigid.is_half_space()) {
+    CandidateCaches::Entry& entry = candidate_caches_->GetEntry(id_S, id_R);
+    std::lock_guard<std::mutex> lock(entry.mutex);
+    if (!entry.volume_surface.has_value()) {
+      entry.volume_surface.emplace(candidate_caches_->margin());
+    }
+    std::unique_ptr<ContactSurface<T>> surface =
+        CalcRigidCompliant(soft, X_WS, id_S, rigid, X_WR, id_R,
+                           representation_, &*entry.volume_surface);
+    return {ContactSurfaceResult::kCalculated, std::move(surface)};
+  }
+
   std::unique_ptr<ContactSurface<T>> surface =
       CalcRigidCompliant(soft, X_WS, id_S, rigid, X_WR, id_R, representation_);
 
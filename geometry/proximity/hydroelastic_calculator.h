@@ -1,11 +1,17 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include <fcl/fcl.h>
 
+#include "drake/common/drake_copyable.h"
+#include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/proximity/bvh_candidate_cache.h"
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 #include "drake/geometry/query_results/contact_surface.h"
 #include "drake/math/rigid_transform.h"
@@ -15,25 +21,94 @@ namespace geometry {
 namespace internal {
 namespace hydroelastic {
 
+/* The cache of candidate tetrahedron-triangle pairs between a compliant mesh
+ and a rigid mesh.  */
+using VolumeSurfaceCandidateCache =
+    BvhCandidateCache<Bvh<Obb, VolumeMesh<double>>,
+                      Bvh<Obb, TriangleSurfaceMesh<double>>>;
+
+/* The cache of candidate tetrahedron-tetrahedron pairs between two compliant
+ meshes.  */
+using VolumeVolumeCandidateCache =
+    BvhCandidateCache<Bvh<Obb, VolumeMesh<double>>,
+                      Bvh<Obb, VolumeMesh<double>>>;
+
 /* Computes ContactSurface using the algorithm appropriate to the Shape types
  represented by the given `compliant` and `rigid` geometries.
+ @param candidate_cache  If not null, it is used to find the candidate pairs
+                         of elements when both geometries are meshes. It is
+                         unused if either geometry is a half space.
  @pre The geometries are not *both* half spaces.  */
 template <typename T>
 std::unique_ptr<ContactSurface<T>> CalcRigidCompliant(
     const SoftGeometry& soft, const math::RigidTransform<T>& X_WS,
     GeometryId id_S, const RigidGeometry& rigid,
     const math::RigidTransform<T>& X_WR, GeometryId id_R,
-    HydroelasticContactRepresentation representation);
+    HydroelasticContactRepresentation representation,
+    VolumeSurfaceCandidateCache* candidate_cache = nullptr);
 
 /* Computes ContactSurface using the algorithm appropriate to the Shape types
  represented by the given `compliant` geometries.
+ @param candidate_cache  If not null, it is used to find the candidate pairs
+                         of tetrahedra.
  @pre None of the geometries are half spaces. */
 template <typename T>
 std::unique_ptr<ContactSurface<T>> CalcCompliantCompliant(
     const SoftGeometry& compliant_F, const math::RigidTransform<T>& X_WF,
     GeometryId id_F, const SoftGeometry& compliant_G,
     const math::RigidTransform<T>& X_WG, GeometryId id_G,
-    HydroelasticContactRepresentation representation);
+    HydroelasticContactRepresentation representation,
+    VolumeVolumeCandidateCache* candidate_cache = nullptr);
+
+/* %CandidateCaches stores, per pair of geometries, the candidate pairs of
+ elements found by the last traversal of their bounding volume hierarchies, so
+ that subsequent contact queries at nearby poses can skip the traversal. See
+ BvhCandidateCache.
+
+ Entries are created on demand by GetEntry(), which can be invoked
+ concurrently. All other mutating methods must not be invoked concurrently
+ with any other method. The entries refer to the hydroelastic representations
+ they were built with; the caller must Clear() the caches whenever those
+ representations change.  */
+class CandidateCaches {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CandidateCaches);
+
+  /* The caches of a single pair of geometries. At most one of the caches is
+   in use, depending on the hydroelastic types of the geometries. Whoever uses
+   the caches must hold the `mutex`.  */
+  struct Entry {
+    std::mutex mutex;
+    std::optional<VolumeSurfaceCandidateCache> volume_surface;
+    std::optional<VolumeVolumeCandidateCache> volume_volume;
+  };
+
+  /* Constructs empty caches whose entries use the given `margin`.
+   @pre margin > 0.  */
+  explicit CandidateCaches(double margin);
+
+  double margin() const { return margin_; }
+
+  /* Returns the entry for the pair (id_A, id_B), regardless of order, creating
+   an empty one if needed. The returned reference remains valid until the entry
+   is removed.  */
+  Entry& GetEntry(GeometryId id_A, GeometryId id_B);
+
+  /* Removes the entries for all pairs of geometries not in `pairs`.  */
+  void RemoveAllExcept(const std::vector<SortedPair<GeometryId>>& pairs);
+
+  /* Removes all entries.  */
+  void Clear() { entries_.clear(); }
+
+  /* Returns the number of entries.  */
+  int size() const { return static_cast<int>(entries_.size()); }
+
+ private:
+  double margin_{};
+  // Guards the creation of new entries.
+  std::mutex mutex_;
+  std::unordered_map<SortedPair<GeometryId>, std::unique_ptr<Entry>> entries_;
+};
 
 /* Enumerate the various results of attempting to make a contact surface. */
 enum class ContactSurfaceResult {
@@ -86,14 +161,18 @@ class ContactCalculator {
                                   the contact surface. See
                                   @ref contact_surface_discrete_representation
                                   "contact surface representation" for more
-                                  details. */
+                                  details.
+   @param candidate_caches        If not null, the caches of candidate element
+                                  pairs used for mesh-mesh contact. Aliased. */
   ContactCalculator(
       const std::unordered_map<GeometryId, math::RigidTransform<T>>* X_WGs,
       const Geometries* geometries,
-      HydroelasticContactRepresentation representation)
+      HydroelasticContactRepresentation representation,
+      CandidateCaches* candidate_caches = nullptr)
       : X_WGs_(*X_WGs),
         geometries_(*geometries),
-        representation_(representation) {
+        representation_(representation),
+        candidate_caches_(candidate_caches) {
     DRAKE_DEMAND(X_WGs != nullptr);
     DRAKE_DEMAND(geometries != nullptr);
   }
@@ -123,6 +202,9 @@ class ContactCalculator {
 
   /* The requested mesh representation type. */
   const HydroelasticContactRepresentation representation_;
+
+  /* The optional caches of candidate element pairs.  */
+  CandidateCaches* const candidate_caches_;
 };
 
 }  // namespace hydroelastic
@@ -293,18 +293,24 @@ void SurfaceVolumeIntersector<MeshBuilder, BvType>::SampleVolumeFieldOnSurface(
     const TriangleSurfaceMesh<double>& surface_N,
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_N,
     const math::RigidTransform<T>& X_MN,
-    const bool filter_face_normal_along_field_gradient) {
+    const bool filter_face_normal_along_field_gradient,
+    BvhCandidateCache<Bvh<BvType, VolumeMesh<double>>,
+                      Bvh<Obb, TriangleSurfaceMesh<double>>>* candidate_cache) {
   // Builds the intersection mesh represented in M's frame.
   MeshBuilder builder_M;
   const math::RigidTransform<double>& X_MN_d = convert_to_double(X_MN);
 
   std::vector<std::pair<int, int>> candidate_tet_tri_pairs;
-  bvh_M.Collide(bvh_N, X_MN_d,
-                [&candidate_tet_tri_pairs](
-                    int tet_index, int tri_index) -> BvttCallbackResult {
-                  candidate_tet_tri_pairs.emplace_back(tet_index, tri_index);
-                  return BvttCallbackResult::Continue;
-                });
+  auto callback = [&candidate_tet_tri_pairs](
+                      int tet_index, int tri_index) -> BvttCallbackResult {
+    candidate_tet_tri_pairs.emplace_back(tet_index, tri_index);
+    return BvttCallbackResult::Continue;
+  };
+  if (candidate_cache != nullptr) {
+    candidate_cache->Collide(bvh_M, bvh_N, X_MN_d, callback);
+  } else {
+    bvh_M.Collide(bvh_N, X_MN_d, callback);
+  }
 
   for (const auto& [tet_index, tri_index] : candidate_tet_tri_pairs) {
     CalcContactPolygon(volume_field_M, surface_N, X_MN, X_MN_d, &builder_M,
@@ -387,7 +393,9 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
     const TriangleSurfaceMesh<double>& mesh_R,
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R,
     const math::RigidTransform<T>& X_WR,
-    HydroelasticContactRepresentation representation) {
+    HydroelasticContactRepresentation representation,
+    BvhCandidateCache<Bvh<Obb, VolumeMesh<double>>,
+                      Bvh<Obb, TriangleSurfaceMesh<double>>>* candidate_cache) {
   auto process_intersection =
       [&X_WS, id_S,
        id_R](auto&& intersector_in) -> std::unique_ptr<ContactSurface<T>> {
@@ -426,12 +434,16 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
 
   if (representation == HydroelasticContactRepresentation::kTriangle) {
     SurfaceVolumeIntersector<TriMeshBuilder<T>, Obb> intersector;
-    intersector.SampleVolumeFieldOnSurface(field_S, bvh_S, mesh_R, bvh_R, X_SR);
+    intersector.SampleVolumeFieldOnSurface(field_S, bvh_S, mesh_R, bvh_R, X_SR,
+                                           true /* filter face normals */,
+                                           candidate_cache);
     return process_intersection(intersector);
   } else {
     // Polygon.
     SurfaceVolumeIntersector<PolyMeshBuilder<T>, Obb> intersector;
-    intersector.SampleVolumeFieldOnSurface(field_S, bvh_S, mesh_R, bvh_R, X_SR);
+    intersector.SampleVolumeFieldOnSurface(field_S, bvh_S, mesh_R, bvh_R, X_SR,
+                                           true /* filter face normals */,
+                                           candidate_cache);
     return process_intersection(intersector);
   }
 }
@@ -8,6 +8,7 @@
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/bvh_candidate_cache.h"
 #include "drake/geometry/proximity/contact_surface_utility.h"
 #include "drake/geometry/proximity/polygon_surface_mesh.h"
 #include "drake/geometry/proximity/polygon_surface_mesh_field.h"
@@ -154,6 +155,10 @@ class SurfaceVolumeIntersector {
        If true, allow only contact polygons whose face normals are "along"
        the direction of field gradient vectors. See
        IsFaceNormalAlongPressureGradient().
+   @param[in, out] candidate_cache
+       If not null, the candidate tetrahedron-triangle pairs are found with
+       this cache instead of a full traversal of the two hierarchies. It must
+       be used only with `bvh_M` and `bvh_N`. The results do not depend on it.
    @note
        The output surface mesh (see mutable_mesh() and release_mesh()) may
        have duplicate vertices.
@@ -164,7 +169,10 @@ class SurfaceVolumeIntersector {
       const TriangleSurfaceMesh<double>& surface_N,
       const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_N,
       const math::RigidTransform<T>& X_MN,
-      bool filter_face_normal_along_field_gradient = true);
+      bool filter_face_normal_along_field_gradient = true,
+      BvhCandidateCache<Bvh<BvType, VolumeMesh<double>>,
+                        Bvh<Obb, TriangleSurfaceMesh<double>>>*
+          candidate_cache = nullptr);
 
   bool has_intersection() const { return mesh_M_ != nullptr; }
 
@@ -416,6 +424,10 @@ class SurfaceVolumeIntersector {
      The pose of the rigid frame R in the world frame W.
  @param[in] representation
      The preferred representation of each contact polygon.
+ @param[in, out] candidate_cache
+     If not null, the candidate tetrahedron-triangle pairs are found with this
+     cache. It must be used only with `bvh_S` and `bvh_R`. See
+     SurfaceVolumeIntersector::SampleVolumeFieldOnSurface().
  @return
      The contact surface between M and N. Geometries S and R map to M and N
      with a consistent mapping (as documented in ContactSurface) but without any
@@ -449,7 +461,10 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
     const TriangleSurfaceMesh<double>& mesh_R,
     const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_R,
     const math::RigidTransform<T>& X_WR,
-    HydroelasticContactRepresentation representation);
+    HydroelasticContactRepresentation representation,
+    BvhCandidateCache<Bvh<Obb, VolumeMesh<double>>,
+                      Bvh<Obb, TriangleSurfaceMesh<double>>>* candidate_cache =
+        nullptr);
 
 }  // namespace internal
 }  // namespace geometry
@@ -0,0 +1,165 @@
+#include "drake/geometry/proximity/bvh_candidate_cache.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/geometry/proximity/triangle_surface_mesh.h"
+#include "drake/geometry/proximity/volume_mesh.h"
+#include "drake/geometry/shape_specification.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::AngleAxisd;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+
+using ElementPairs = std::vector<std::pair<int, int>>;
+using VolumeBvh = Bvh<Obb, VolumeMesh<double>>;
+using SurfaceBvh = Bvh<Obb, TriangleSurfaceMesh<double>>;
+
+// Returns the element pairs reported by a callback invoked by `collide`.
+template <typename CollideFunction>
+ElementPairs CollectPairs(CollideFunction collide) {
+  ElementPairs pairs;
+  collide([&pairs](int a, int b) {
+    pairs.emplace_back(a, b);
+    return BvttCallbackResult::Continue;
+  });
+  return pairs;
+}
+
+// Returns the subset of `pairs` that is also in `reference`, keeping the
+// order of `pairs`.
+ElementPairs Intersect(const ElementPairs& pairs,
+                       const ElementPairs& reference) {
+  ElementPairs result;
+  for (const auto& pair : pairs) {
+    if (std::find(reference.begin(), reference.end(), pair) !=
+        reference.end()) {
+      result.push_back(pair);
+    }
+  }
+  return result;
+}
+
+class BvhCandidateCacheTest : public ::testing::Test {
+ protected:
+  BvhCandidateCacheTest()
+      : mesh_A_(MakeSphereVolumeMesh<double>(
+            Sphere(1.0), 0.5, TessellationStrategy::kDenseInteriorVertices)),
+        mesh_B_(MakeSphereSurfaceMesh<double>(Sphere(1.0), 0.5)),
+        bvh_A_(mesh_A_),
+        bvh_B_(mesh_B_) {}
+
+  // Returns the element pairs reported by Bvh::Collide().
+  ElementPairs ExpectedPairs(const RigidTransformd& X_AB) const {
+    return CollectPairs([&](BvttCallback callback) {
+      bvh_A_.Collide(bvh_B_, X_AB, callback);
+    });
+  }
+
+  // Returns the element pairs reported by `cache` and whether they were
+  // reused.
+  std::pair<ElementPairs, bool> CachedPairs(
+      BvhCandidateCache<VolumeBvh, SurfaceBvh>* cache,
+      const RigidTransformd& X_AB) const {
+    bool reused{};
+    ElementPairs pairs = CollectPairs([&](BvttCallback callback) {
+      reused = cache->Collide(bvh_A_, bvh_B_, X_AB, callback);
+    });
+    return {std::move(pairs), reused};
+  }
+
+  const VolumeMesh<double> mesh_A_;
+  const TriangleSurfaceMesh<double> mesh_B_;
+  const VolumeBvh bvh_A_;
+  const SurfaceBvh bvh_B_;
+};
+
+// The first query traverses the hierarchies and reports the same pairs as
+// Bvh::Collide(), in the same order.
+TEST_F(BvhCandidateCacheTest, FirstQueryMatchesCollide) {
+  BvhCandidateCache<VolumeBvh, SurfaceBvh> cache(0.05);
+  EXPECT_EQ(cache.margin(), 0.05);
+  EXPECT_EQ(cache.num_leaf_pairs(), 0);
+
+  const RigidTransformd X_AB(Vector3d(1.5, 0.2, 0.1));
+  const ElementPairs expected = ExpectedPairs(X_AB);
+  ASSERT_GT(expected.size(), 0);
+  const auto [pairs, reused] = CachedPairs(&cache, X_AB);
+  EXPECT_FALSE(reused);
+  EXPECT_GT(cache.num_leaf_pairs(), 0);
+  EXPECT_EQ(Intersect(pairs, expected), expected);
+}
+
+// Motions within the margin reuse the stored leaf pairs, and still report
+// every pair Bvh::Collide() would, in the same order. Larger motions rebuild.
+TEST_F(BvhCandidateCacheTest, ReuseWithinMargin) {
+  const double kMargin = 0.05;
+  BvhCandidateCache<VolumeBvh, SurfaceBvh> cache(kMargin);
+  const RigidTransformd X_AB0(Vector3d(1.5, 0.2, 0.1));
+  CachedPairs(&cache, X_AB0);
+  const int num_leaf_pairs = cache.num_leaf_pairs();
+
+  // A small translation followed by a small rotation, both within the margin
+  // relative to X_AB0.
+  for (const RigidTransformd& X_AB :
+       {RigidTransformd(X_AB0.translation() + Vector3d(0.02, -0.01, 0)),
+        RigidTransformd(RotationMatrixd(AngleAxisd(0.01, Vector3d::UnitZ())),
+                        X_AB0.translation())}) {
+    const ElementPairs expected = ExpectedPairs(X_AB);
+    const auto [pairs, reused] = CachedPairs(&cache, X_AB);
+    EXPECT_TRUE(reused);
+    EXPECT_EQ(cache.num_leaf_pairs(), num_leaf_pairs);
+    EXPECT_EQ(Intersect(pairs, expected), expected);
+  }
+
+  // A translation larger than the margin forces a new traversal.
+  const RigidTransformd X_AB1(X_AB0.translation() + Vector3d(-0.2, 0, 0));
+  const ElementPairs expected = ExpectedPairs(X_AB1);
+  const auto [pairs, reused] = CachedPairs(&cache, X_AB1);
+  EXPECT_FALSE(reused);
+  EXPECT_EQ(Intersect(pairs, expected), expected);
+}
+
+// Querying different hierarchies forces a new traversal.
+TEST_F(BvhCandidateCacheTest, RebuildForDifferentBvh) {
+  BvhCandidateCache<VolumeBvh, SurfaceBvh> cache(0.05);
+  const RigidTransformd X_AB(Vector3d(1.5, 0.2, 0.1));
+  CachedPairs(&cache, X_AB);
+
+  const SurfaceBvh other_bvh_B(mesh_B_);
+  bool reused = cache.Collide(bvh_A_, other_bvh_B, X_AB, [](int, int) {
+    return BvttCallbackResult::Continue;
+  });
+  EXPECT_FALSE(reused);
+  reused = cache.Collide(bvh_A_, other_bvh_B, X_AB, [](int, int) {
+    return BvttCallbackResult::Continue;
+  });
+  EXPECT_TRUE(reused);
+}
+
+// The callback can terminate the query early.
+TEST_F(BvhCandidateCacheTest, Terminate) {
+  BvhCandidateCache<VolumeBvh, SurfaceBvh> cache(0.05);
+  const RigidTransformd X_AB(Vector3d(1.5, 0.2, 0.1));
+  int count = 0;
+  cache.Collide(bvh_A_, bvh_B_, X_AB, [&count](int, int) {
+    ++count;
+    return BvttCallbackResult::Terminate;
+  });
+  EXPECT_EQ(count, 1);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
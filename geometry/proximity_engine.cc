@@ -1,8 +1,10 @@
 #include "drake/geometry/proximity_engine.h"
 
 #include <algorithm>
+#include <exception>
 #include <filesystem>
 #include <limits>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -285,6 +287,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     BuildTreeFromReference(other.anchored_tree_, object_map, &anchored_tree_);
 
     collision_filter_ = other.collision_filter_;
+    hydroelastic_parallelism_ = other.hydroelastic_parallelism_;
+    // The cached candidates refer to the other engine's hydroelastic
+    // representations; this copy starts with empty caches.
+    set_hydroelastic_coherence_margin(other.hydroelastic_coherence_margin());
   }
 
   // Only the copy constructor is used to facilitate copying of the parent
@@ -317,6 +323,9 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     engine->geometries_for_deformable_contact_ =
         this->geometries_for_deformable_contact_;
     engine->distance_tolerance_ = this->distance_tolerance_;
+    engine->hydroelastic_parallelism_ = this->hydroelastic_parallelism_;
+    engine->set_hydroelastic_coherence_margin(
+        this->hydroelastic_coherence_margin());
 
     return engine;
   }
@@ -388,6 +397,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     hydroelastic_geometries_.RemoveGeometry(id);
     hydroelastic_geometries_.MaybeAddGeometry(geometry.shape(), id,
                                               new_properties);
+    ClearCandidateCaches();
     const RigidTransformd X_WG = GetX_WG(id, geometry.is_dynamic());
     geometries_for_deformable_contact_.RemoveGeometry(id);
     geometries_for_deformable_contact_.MaybeAddRigidGeometry(
@@ -418,6 +428,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       RemoveGeometry(id, &anchored_tree_, &anchored_objects_);
     }
     hydroelastic_geometries_.RemoveGeometry(id);
+    ClearCandidateCaches();
     geometries_for_deformable_contact_.RemoveGeometry(id);
   }
 
@@ -444,6 +455,27 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   double distance_tolerance() const { return distance_tolerance_; }
 
+  void set_hydroelastic_parallelism(Parallelism parallelism) {
+    hydroelastic_parallelism_ = parallelism;
+  }
+
+  Parallelism hydroelastic_parallelism() const {
+    return hydroelastic_parallelism_;
+  }
+
+  void set_hydroelastic_coherence_margin(double margin) {
+    DRAKE_DEMAND(margin >= 0);
+    if (margin > 0) {
+      candidate_caches_ = make_unique<hydroelastic::CandidateCaches>(margin);
+    } else {
+      candidate_caches_.reset();
+    }
+  }
+
+  double hydroelastic_coherence_margin() const {
+    return candidate_caches_ == nullptr ? 0.0 : candidate_caches_->margin();
+  }
+
   // TODO(SeanCurtis-TRI): I could do things here differently a number of ways:
   //  1. I could make this move semantics (or swap semantics).
   //  2. I could simply have a method that returns a mutable reference to such
@@ -480,6 +512,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   void ProcessHydroelastic(const Shape& shape, void* user_data) {
     const ReifyData& data = *static_cast<ReifyData*>(user_data);
     hydroelastic_geometries_.MaybeAddGeometry(shape, data.id, data.properties);
+    ClearCandidateCaches();
   }
 
   // Attempts to process the declared geometry into a rigid representation for
@@ -707,24 +740,34 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       HydroelasticContactRepresentation representation,
       const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
     std::vector<SortedPair<GeometryId>> candidates = FindCollisionCandidates();
+    if (candidate_caches_ != nullptr) {
+      candidate_caches_->RemoveAllExcept(candidates);
+    }
 
     vector<ContactSurface<T>> surfaces;
     // All these quantities are aliased in the calculator.
     hydroelastic::ContactCalculator<T> calculator{
-        &X_WGs, &hydroelastic_geometries_, representation};
+        &X_WGs, &hydroelastic_geometries_, representation,
+        candidate_caches_.get()};
 
-    // As a suggestion to future thread parallelizers, make available a fully
-    // allocated and prepared vector for results of the parallelizable step.
+    // Each candidate pair writes only to its own entries, so pairs can be
+    // processed concurrently. Failures are reported afterwards, in candidate
+    // order, so that the same pair is reported regardless of the parallelism.
     vector<std::unique_ptr<ContactSurface<T>>> surface_ptrs(candidates.size());
-    // TODO(rpoyner-tri): try some thread parallelism here.
-    for (int k = 0; k < ssize(candidates); ++k) {
+    vector<ContactSurfaceResult> results(candidates.size());
+    ForEachCandidate(ssize(candidates), [&](int k) {
       const auto& [id0, id1] = candidates[k];
       auto [result, surface] = calculator.MaybeMakeContactSurface(id0, id1);
-      if (ContactSurfaceFailed(result)) {
-        ThrowOnFailedResult(result, GetFclPtr(id0), GetFclPtr(id1));
-      } else if (surface != nullptr) {
+      results[k] = result;
+      if (!ContactSurfaceFailed(result)) {
         surface_ptrs[k] = std::move(surface);
       }
+    });
+    for (int k = 0; k < ssize(candidates); ++k) {
+      if (ContactSurfaceFailed(results[k])) {
+        const auto& [id0, id1] = candidates[k];
+        ThrowOnFailedResult(results[k], GetFclPtr(id0), GetFclPtr(id1));
+      }
     }
     SortCullFlatten<std::unique_ptr<ContactSurface<T>>>(&surface_ptrs,
                                                         &surfaces);
@@ -742,20 +785,23 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     DRAKE_DEMAND(point_pairs != nullptr);
 
     std::vector<SortedPair<GeometryId>> candidates = FindCollisionCandidates();
+    if (candidate_caches_ != nullptr) {
+      candidate_caches_->RemoveAllExcept(candidates);
+    }
 
     // All these quantities are aliased.
     hydroelastic::ContactCalculator<T> calculator{
-        &X_WGs, &hydroelastic_geometries_, representation};
+        &X_WGs, &hydroelastic_geometries_, representation,
+        candidate_caches_.get()};
     penetration_as_point_pair::CallbackData<T> point_data{&collision_filter_,
                                                           &X_WGs, point_pairs};
 
-    // As a suggestion to future thread parallelizers, make available fully
-    // allocated and prepared vectors for results of the parallelizable steps.
+    // Each candidate pair writes only to its own entries, so pairs can be
+    // processed concurrently.
     vector<std::unique_ptr<ContactSurface<T>>> surface_ptrs(candidates.size());
     vector<std::optional<PenetrationAsPointPair<T>>> point_pair_maybes(
         candidates.size());
-    // TODO(rpoyner-tri): try some thread parallelism here.
-    for (int k = 0; k < ssize(candidates); ++k) {
+    ForEachCandidate(ssize(candidates), [&](int k) {
       const auto& [id0, id1] = candidates[k];
       auto [result, surface] = calculator.MaybeMakeContactSurface(id0, id1);
       if (ContactSurfaceFailed(result)) {
@@ -767,7 +813,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       } else if (surface != nullptr) {
         surface_ptrs[k] = std::move(surface);
       }
-    }
+    });
     SortCullFlatten<std::unique_ptr<ContactSurface<T>>>(&surface_ptrs,
                                                         surfaces);
     SortCullFlatten<std::optional<PenetrationAsPointPair<T>>>(
@@ -879,6 +925,42 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   template <typename>
   friend class ProximityEngine;
 
+  // The cached candidates refer to the hydroelastic representations, so they
+  // must be discarded whenever a representation is added, removed or replaced.
+  void ClearCandidateCaches() {
+    if (candidate_caches_ != nullptr) candidate_caches_->Clear();
+  }
+
+  // Invokes `process(k)` for each k in [0, num_candidates), concurrently when
+  // hydroelastic_parallelism_ allows more than one thread. `process` must be
+  // safe to invoke concurrently for distinct values of k. If any invocation
+  // throws, the exception from the smallest k is rethrown once all candidates
+  // have been processed.
+  template <typename Process>
+  void ForEachCandidate(int num_candidates, const Process& process) const {
+    const int num_threads =
+        std::min(hydroelastic_parallelism_.num_threads(), num_candidates);
+    if (num_threads <= 1) {
+      for (int k = 0; k < num_candidates; ++k) process(k);
+      return;
+    }
+    // Exceptions must not escape the parallel region.
+    vector<std::exception_ptr> errors(num_candidates);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+    for (int k = 0; k < num_candidates; ++k) {
+      try {
+        process(k);
+      } catch (...) {
+        errors[k] = std::current_exception();
+      }
+    }
+    for (const std::exception_ptr& error : errors) {
+      if (error) std::rethrow_exception(error);
+    }
+  }
+
   // @returns fully-typed FCL collision object pointer for `id`.
   // @pre IsRegisteredAsRigid(id) == true
   CollisionObjectd* GetFclPtr(GeometryId id) const {
@@ -1037,6 +1119,15 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // @see ProximityEngine::set_distance_tolerance() for more details.
   double distance_tolerance_{1E-6};
 
+  // The parallelism used to compute hydroelastic contact surfaces.
+  // @see ProximityEngine::set_hydroelastic_parallelism() for more details.
+  Parallelism hydroelastic_parallelism_{Parallelism::None()};
+
+  // The caches of candidate element pairs for mesh-mesh hydroelastic contact,
+  // or null if disabled. They are updated by the (const) contact queries.
+  // @see ProximityEngine::set_hydroelastic_coherence_margin() for more details.
+  std::unique_ptr<hydroelastic::CandidateCaches> candidate_caches_;
+
   // All of the hydroelastic representations of supported geometries -- this
   // can get quite large based on mesh resolution.
   hydroelastic::Geometries hydroelastic_geometries_;
@@ -1159,6 +1250,27 @@ double ProximityEngine<T>::distance_tolerance() const {
   return impl_->distance_tolerance();
 }
 
+template <typename T>
+void ProximityEngine<T>::set_hydroelastic_parallelism(
+    Parallelism parallelism) {
+  impl_->set_hydroelastic_parallelism(parallelism);
+}
+
+template <typename T>
+Parallelism ProximityEngine<T>::hydroelastic_parallelism() const {
+  return impl_->hydroelastic_parallelism();
+}
+
+template <typename T>
+void ProximityEngine<T>::set_hydroelastic_coherence_margin(double margin) {
+  impl_->set_hydroelastic_coherence_margin(margin);
+}
+
+template <typename T>
+double ProximityEngine<T>::hydroelastic_coherence_margin() const {
+  return impl_->hydroelastic_coherence_margin();
+}
+
 template <typename T>
 template <typename U>
 std::unique_ptr<ProximityEngine<U>> ProximityEngine<T>::ToScalarType() const {
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "drake/common/autodiff.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
@@ -174,6 +175,28 @@ class ProximityEngine {
 
   double distance_tolerance() const;
 
+  /* Sets the parallelism used to compute hydroelastic contact surfaces in
+   ComputeContactSurfaces() and ComputeContactSurfacesWithFallback(). With more
+   than one thread, the candidate geometry pairs are processed concurrently.
+   The results (including their order) do not depend on this setting. Defaults
+   to Parallelism::None(). */
+  void set_hydroelastic_parallelism(Parallelism parallelism);
+
+  Parallelism hydroelastic_parallelism() const;
+
+  /* Sets the margin (in meters) used to reuse, across calls to
+   ComputeContactSurfaces() and ComputeContactSurfacesWithFallback(), the
+   candidate element pairs found for mesh-mesh hydroelastic contact. The
+   bounding volume hierarchies of a geometry pair are traversed with bounding
+   volumes inflated by this margin, and the result is reused until the
+   relative motion of the pair exceeds the margin. A larger margin leads to
+   fewer traversals but more candidates per query. The results do not depend
+   on this setting. A margin of zero (the default) disables the reuse.
+   @pre margin >= 0.  */
+  void set_hydroelastic_coherence_margin(double margin);
+
+  double hydroelastic_coherence_margin() const;
+
   //@}
 
   /* Updates the poses for all of the _dynamic_ geometries in the engine.
@@ -146,6 +146,10 @@ class SceneGraph<T>::Hub {
       // Our cache was out-of-date, so we need to refresh it.
       auto result = std::make_unique<GeometryState<T>>(model_);
       result->ApplyProximityDefaults(config_.default_proximity_properties);
+      result->set_hydroelastic_parallelism(
+          Parallelism(config_.hydroelastic_num_threads));
+      result->set_hydroelastic_coherence_margin(
+          config_.hydroelastic_coherence_margin);
       augmented_model_cache_ =
           std::make_unique<const GeometryState<T>>(*result);
       return result;
@@ -96,6 +96,14 @@ void DefaultProximityProperties::ValidateOrThrow() const {
 
 void SceneGraphConfig::ValidateOrThrow() const {
   default_proximity_properties.ValidateOrThrow();
+  if (hydroelastic_num_threads < 1) {
+    throw std::logic_error(fmt::format(
+        "Invalid scene graph configuration: 'hydroelastic_num_threads' ({}) "
+        "must be a positive value.",
+        hydroelastic_num_threads));
+  }
+  ThrowUnlessAbsentOr("hydroelastic_coherence_margin",
+                      hydroelastic_coherence_margin, kNonNegativeFinite);
 }
 
 }  // namespace geometry
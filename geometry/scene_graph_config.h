@@ -111,12 +111,31 @@ struct SceneGraphConfig {
   template <typename Archive>
   void Serialize(Archive* a) {
     a->Visit(DRAKE_NVP(default_proximity_properties));
+    a->Visit(DRAKE_NVP(hydroelastic_num_threads));
+    a->Visit(DRAKE_NVP(hydroelastic_coherence_margin));
   }
 
   /** Provides SceneGraph-wide contact material values to use when none have
   been otherwise specified. */
   DefaultProximityProperties default_proximity_properties;
 
+  /** The number of threads used to compute hydroelastic contact surfaces,
+  e.g., by QueryObject::ComputeContactSurfaces(). With more than one thread,
+  the candidate geometry pairs are processed concurrently; the results
+  (including their order) are the same regardless of this setting. Must be
+  positive. The default value of 1 computes all pairs serially. */
+  int hydroelastic_num_threads{1};
+
+  /** The margin (in meters) used to reuse the candidate element pairs of
+  mesh-mesh hydroelastic contact between contact queries. The bounding volume
+  hierarchies of each geometry pair are traversed with bounding volumes
+  inflated by this margin, and the candidates found are reused by subsequent
+  queries until the relative motion of the pair exceeds the margin. This
+  benefits simulations whose time steps are small relative to the margin.
+  The resulting contact surfaces are the same regardless of this setting.
+  Must be non-negative. The default value of 0 disables the reuse. */
+  double hydroelastic_coherence_margin{0.0};
+
   /** Throws if the values are inconsistent. */
   void ValidateOrThrow() const;
 };
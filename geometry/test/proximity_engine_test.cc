@@ -2040,6 +2040,65 @@ TEST_F(ProximityEngineHydro, ComputeContactSurfacesResultOrdering) {
   }
 }
 
+// Confirms that computing contact surfaces concurrently gives the same results
+// as computing them serially, and that copies preserve the parallelism.
+TEST_F(ProximityEngineHydro, ComputeContactSurfacesParallel) {
+  EXPECT_EQ(engine_.hydroelastic_parallelism().num_threads(), 1);
+  engine_.UpdateWorldPoses(poses_);
+  const auto expected = engine_.ComputeContactSurfaces(
+      HydroelasticContactRepresentation::kTriangle, poses_);
+  ASSERT_EQ(expected.size(), poses_.size());
+
+  engine_.set_hydroelastic_parallelism(Parallelism(2));
+  const ProximityEngine<double> copy(engine_);
+  EXPECT_EQ(copy.hydroelastic_parallelism().num_threads(), 2);
+  const auto results = copy.ComputeContactSurfaces(
+      HydroelasticContactRepresentation::kTriangle, poses_);
+  ASSERT_EQ(results.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(results[i].id_M(), expected[i].id_M());
+    EXPECT_EQ(results[i].id_N(), expected[i].id_N());
+    EXPECT_EQ(results[i].num_faces(), expected[i].num_faces());
+    EXPECT_EQ(results[i].total_area(), expected[i].total_area());
+  }
+}
+
+// Confirms that reusing the candidates of mesh-mesh contact between queries
+// gives the same results as computing them from scratch, both when the motion
+// stays within the margin and when it exceeds it, and that copies preserve the
+// margin.
+TEST_F(ProximityEngineHydro, ComputeContactSurfacesCoherence) {
+  EXPECT_EQ(engine_.hydroelastic_coherence_margin(), 0);
+  ProximityEngine<double> coherent(engine_);
+  coherent.set_hydroelastic_coherence_margin(0.01);
+  EXPECT_EQ(coherent.hydroelastic_coherence_margin(), 0.01);
+  const ProximityEngine<double> copy(coherent);
+  EXPECT_EQ(copy.hydroelastic_coherence_margin(), 0.01);
+
+  // Small motions, within the margin, followed by a large one.
+  const GeometryId moving_id = poses_.begin()->first;
+  const RigidTransformd X_WG0 = poses_.at(moving_id);
+  for (const double offset : {0.0, 1e-3, 2e-3, 0.05}) {
+    poses_[moving_id] = RigidTransformd(Vector3d(offset, 0, 0)) * X_WG0;
+    engine_.UpdateWorldPoses(poses_);
+    coherent.UpdateWorldPoses(poses_);
+    const auto expected = engine_.ComputeContactSurfaces(
+        HydroelasticContactRepresentation::kTriangle, poses_);
+    const auto results = coherent.ComputeContactSurfaces(
+        HydroelasticContactRepresentation::kTriangle, poses_);
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(results[i].id_M(), expected[i].id_M());
+      EXPECT_EQ(results[i].id_N(), expected[i].id_N());
+      EXPECT_EQ(results[i].num_faces(), expected[i].num_faces());
+      EXPECT_EQ(results[i].total_area(), expected[i].total_area());
+    }
+  }
+
+  coherent.set_hydroelastic_coherence_margin(0);
+  EXPECT_EQ(coherent.hydroelastic_coherence_margin(), 0);
+}
+
 // Confirms that the ComputeContactSurfacesWithFallback() computation returns
 // the same results twice in a row. This test is explicitly required because it
 // is known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -2126,6 +2185,38 @@ TEST_F(ProximityEngineHydroWithFallback,
   }
 }
 
+// Confirms that computing contact surfaces with fallback concurrently gives the
+// same results as computing them serially.
+TEST_F(ProximityEngineHydroWithFallback,
+       ComputeContactSurfacesWithFallbackParallel) {
+  engine_.UpdateWorldPoses(poses_);
+  vector<ContactSurface<double>> expected_surfaces;
+  vector<PenetrationAsPointPair<double>> expected_points;
+  engine_.ComputeContactSurfacesWithFallback(
+      HydroelasticContactRepresentation::kTriangle, poses_, &expected_surfaces,
+      &expected_points);
+
+  engine_.set_hydroelastic_parallelism(Parallelism(2));
+  vector<ContactSurface<double>> surfaces;
+  vector<PenetrationAsPointPair<double>> points;
+  engine_.ComputeContactSurfacesWithFallback(
+      HydroelasticContactRepresentation::kTriangle, poses_, &surfaces,
+      &points);
+
+  ASSERT_EQ(surfaces.size(), expected_surfaces.size());
+  ASSERT_EQ(points.size(), expected_points.size());
+  for (size_t i = 0; i < surfaces.size(); ++i) {
+    EXPECT_EQ(surfaces[i].id_M(), expected_surfaces[i].id_M());
+    EXPECT_EQ(surfaces[i].id_N(), expected_surfaces[i].id_N());
+    EXPECT_EQ(surfaces[i].num_faces(), expected_surfaces[i].num_faces());
+  }
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(points[i].id_A, expected_points[i].id_A);
+    EXPECT_EQ(points[i].id_B, expected_points[i].id_B);
+    EXPECT_EQ(points[i].depth, expected_points[i].depth);
+  }
+}
+
 // These tests validate collisions/distance between spheres. This does *not*
 // test against other geometry types because we assume FCL works. This merely
 // confirms that the ProximityEngine functions provide the correct mapping.
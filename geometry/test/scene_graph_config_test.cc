@@ -1,5 +1,7 @@
 #include "drake/geometry/scene_graph_config.h"
 
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/expect_throws_message.h"
@@ -23,6 +25,8 @@ default_proximity_properties:
   hunt_crossley_dissipation: 7.0
   relaxation_time: 8.0
   point_stiffness: 9.0
+hydroelastic_num_threads: 10
+hydroelastic_coherence_margin: 11.0
 )""";
 
 GTEST_TEST(SceneGraphConfigTest, YamlTest) {
@@ -37,6 +41,8 @@ GTEST_TEST(SceneGraphConfigTest, YamlTest) {
   EXPECT_EQ(props.hunt_crossley_dissipation, 7);
   EXPECT_EQ(props.relaxation_time, 8);
   EXPECT_EQ(props.point_stiffness, 9);
+  EXPECT_EQ(config.hydroelastic_num_threads, 10);
+  EXPECT_EQ(config.hydroelastic_coherence_margin, 11);
   EXPECT_EQ("\n" + SaveYamlString(config), kExampleConfig);
 }
 
@@ -45,6 +51,30 @@ GTEST_TEST(SceneGraphConfigTest, ValidDefault) {
   EXPECT_NO_THROW(kDefault.ValidateOrThrow());
 }
 
+GTEST_TEST(SceneGraphConfigTest, ValidateHydroelasticNumThreads) {
+  SceneGraphConfig config;
+  config.hydroelastic_num_threads = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      config.ValidateOrThrow(),
+      "Invalid scene graph configuration:"
+      " 'hydroelastic_num_threads' \\(0\\) must be a positive value.");
+}
+
+GTEST_TEST(SceneGraphConfigTest, ValidateHydroelasticCoherenceMargin) {
+  SceneGraphConfig config;
+  config.hydroelastic_coherence_margin = -1;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      config.ValidateOrThrow(),
+      "Invalid scene graph configuration:"
+      " 'hydroelastic_coherence_margin' \\(-1\\) must be a non-negative,"
+      " finite value.");
+  config.hydroelastic_coherence_margin =
+      std::numeric_limits<double>::infinity();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      config.ValidateOrThrow(),
+      ".*'hydroelastic_coherence_margin' \\(inf\\).*");
+}
+
 GTEST_TEST(SceneGraphConfigTest, ValidateCompliance) {
   SceneGraphConfig config;
   auto& props = config.default_proximity_properties;
@@ -457,6 +457,42 @@ TEST_F(SceneGraphTest, ApplyConfig) {
   EXPECT_FALSE(props->HasProperty(kHydroGroup, kPointStiffness));
 }
 
+// Tests that the hydroelastic parallelism in the config is applied to the
+// geometry state in newly created contexts.
+TEST_F(SceneGraphTest, ApplyConfigHydroelasticParallelism) {
+  CreateDefaultContext();
+  EXPECT_EQ(SceneGraphTester::GetGeometryState(scene_graph_, *context_)
+                .hydroelastic_parallelism()
+                .num_threads(),
+            1);
+
+  SceneGraphConfig config;
+  config.hydroelastic_num_threads = 3;
+  scene_graph_.set_config(config);
+  CreateDefaultContext();
+  EXPECT_EQ(SceneGraphTester::GetGeometryState(scene_graph_, *context_)
+                .hydroelastic_parallelism()
+                .num_threads(),
+            3);
+}
+
+// Tests that the hydroelastic coherence margin in the config is applied to the
+// geometry state in newly created contexts.
+TEST_F(SceneGraphTest, ApplyConfigHydroelasticCoherenceMargin) {
+  CreateDefaultContext();
+  EXPECT_EQ(SceneGraphTester::GetGeometryState(scene_graph_, *context_)
+                .hydroelastic_coherence_margin(),
+            0);
+
+  SceneGraphConfig config;
+  config.hydroelastic_coherence_margin = 0.02;
+  scene_graph_.set_config(config);
+  CreateDefaultContext();
+  EXPECT_EQ(SceneGraphTester::GetGeometryState(scene_graph_, *context_)
+                .hydroelastic_coherence_margin(),
+            0.02);
+}
+
 template <typename T>
 class TypedSceneGraphTest : public SceneGraphTest {
  public:
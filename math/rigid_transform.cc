@@ -36,6 +36,8 @@ DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS((
     static_cast<std::ostream&(*)(std::ostream&, const RigidTransform<T>&)>(
         &operator<< )
 ));
+template std::ostream& operator<<(std::ostream&,
+                                  const RigidTransform<AutoDiffUpTo16d>&);
 // clang-format on
 
 }  // namespace math
@@ -43,3 +45,5 @@ DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS((
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::math::RigidTransform);
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF(
+    class ::drake::math::RigidTransform);
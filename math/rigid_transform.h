@@ -729,3 +729,5 @@ struct formatter<drake::math::RigidTransform<T>> : drake::ostream_formatter {};
 
 DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::math::RigidTransform);
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF(
+    class ::drake::math::RigidTransform);
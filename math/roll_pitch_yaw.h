@@ -583,3 +583,5 @@ struct formatter<drake::math::RollPitchYaw<T>> : drake::ostream_formatter {};
 
 DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::math::RollPitchYaw);
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF(
+    class ::drake::math::RollPitchYaw);
@@ -414,3 +414,5 @@ Eigen::Quaternion<T> RotationMatrix<T>::ToQuaternion(
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::math::RotationMatrix);
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF(
+    class ::drake::math::RotationMatrix);
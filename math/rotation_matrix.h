@@ -1027,3 +1027,5 @@ double ProjectMatToRotMatWithAxis(const Eigen::Matrix3d& M,
 
 DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class ::drake::math::RotationMatrix);
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF(
+    class ::drake::math::RotationMatrix);
@@ -6,7 +6,9 @@
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/common/test_utilities/limit_malloc.h"
 #include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
 
 namespace drake {
 namespace math {
@@ -932,6 +934,47 @@ GTEST_TEST(RigidTransform, StreamInsertionOperator) {
       Vector3d{-0.1, 0.2, 0.3}, "xyz = -10 20 30");
 }
 
+// RigidTransform supports AutoDiffUpTo16d, whose partials are stored inline.
+// Verify that it computes the same gradients as AutoDiffXd, without any heap
+// allocations.
+GTEST_TEST(RigidTransform, AutoDiffUpTo16d) {
+  const Eigen::Matrix<double, 6, 1> x =
+      (Eigen::Matrix<double, 6, 1>() << 0.2, -0.3, 0.4, 1.0, 2.0, 3.0)
+          .finished();
+  Vector6<AutoDiffUpTo16d> x_fixed;
+  InitializeAutoDiff(x, &x_fixed);
+  const Vector6<AutoDiffXd> x_xd = InitializeAutoDiff(x);
+
+  // Returns X_AC = X_AB * X_BC, with both poses functions of x, together with
+  // its roll-pitch-yaw angles and the inverse of X_AC.
+  auto calc = [](const auto& xx) {
+    using T = typename std::decay_t<decltype(xx)>::Scalar;
+    const RigidTransform<T> X_AB(RollPitchYaw<T>(xx.template head<3>()),
+                                 xx.template tail<3>());
+    const RigidTransform<T> X_BC(
+        RotationMatrix<T>::MakeZRotation(xx(0) * xx(4)),
+        Vector3<T>(xx(5), xx(1), xx(2)));
+    const RigidTransform<T> X_AC = X_AB * X_BC;
+    Eigen::Matrix<T, 18, 1> result;
+    result << Eigen::Map<const Vector<T, 12>>(
+                  X_AC.GetAsMatrix34().data()),
+        RollPitchYaw<T>(X_AC.rotation()).vector(),
+        X_AC.inverse().translation();
+    return result;
+  };
+
+  Eigen::Matrix<AutoDiffUpTo16d, 18, 1> result_fixed;
+  {
+    test::LimitMalloc guard;
+    result_fixed = calc(x_fixed);
+  }
+  const Eigen::Matrix<AutoDiffXd, 18, 1> result_xd = calc(x_xd);
+  EXPECT_TRUE(CompareMatrices(ExtractValue(result_fixed),
+                              ExtractValue(result_xd), 0.0));
+  EXPECT_TRUE(CompareMatrices(ExtractGradient(result_fixed),
+                              ExtractGradient(result_xd), 16 * kEpsilon));
+}
+
 }  // namespace
 }  // namespace math
 }  // namespace drake
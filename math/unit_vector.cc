@@ -81,6 +81,10 @@ void ThrowIfNotUnitVector(const Vector3<T>& unit_vector,
 
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     (&NormalizeOrThrow<T>, &ThrowIfNotUnitVector<T>));
+template Vector3<AutoDiffUpTo16d> NormalizeOrThrow(
+    const Vector3<AutoDiffUpTo16d>&, std::string_view);
+template void ThrowIfNotUnitVector(const Vector3<AutoDiffUpTo16d>&,
+                                   std::string_view, double);
 
 }  // namespace internal
 }  // namespace math
@@ -128,6 +128,42 @@ class Cassie : public benchmark::Fixture {
     }
   }
 
+  // Runs the InverseDynamicsDerivatives benchmark, computing the analytical
+  // derivatives of inverse dynamics with respect to q and v. Compare against
+  // the InverseDynamics case for T=AutoDiffXd with kWantGradX.
+  // NOLINTNEXTLINE(runtime/references)
+  void DoInverseDynamicsDerivatives(benchmark::State& state) {
+    DRAKE_DEMAND(want_grad_vdot(state) == false);
+    DRAKE_DEMAND(want_grad_u(state) == false);
+    MatrixX<T> dtau_dq(nv_, nq_);
+    MatrixX<T> dtau_dv(nv_, nv_);
+    for (auto _ : state) {
+      InvalidateState();
+      plant_->CalcInverseDynamicsDerivatives(*context_, desired_vdot_,
+                                             external_forces_, &dtau_dq,
+                                             &dtau_dv);
+    }
+  }
+
+  // Runs the ForwardDynamicsDerivatives benchmark, computing the analytical
+  // derivatives of forward dynamics with respect to q, v and tau. Compare
+  // against the ForwardDynamics case for T=AutoDiffXd with kWantGradX.
+  // NOLINTNEXTLINE(runtime/references)
+  void DoForwardDynamicsDerivatives(benchmark::State& state) {
+    DRAKE_DEMAND(want_grad_vdot(state) == false);
+    DRAKE_DEMAND(want_grad_u(state) == false);
+    VectorX<T> vdot(nv_);
+    MatrixX<T> dvdot_dq(nv_, nq_);
+    MatrixX<T> dvdot_dv(nv_, nv_);
+    MatrixX<T> dvdot_dtau(nv_, nv_);
+    for (auto _ : state) {
+      InvalidateState();
+      plant_->CalcForwardDynamicsDerivatives(*context_, external_forces_,
+                                             &vdot, &dvdot_dq, &dvdot_dv,
+                                             &dvdot_dtau);
+    }
+  }
+
   // The plant itself.
   const std::unique_ptr<const MultibodyPlant<T>> plant_{MakePlant()};
   const int nq_{plant_->num_positions()};
@@ -290,6 +326,24 @@ BENCHMARK_REGISTER_F(CassieDouble, ForwardDynamics)
   ->Unit(benchmark::kMicrosecond)
   ->Arg(kWantNoGrad);
 
+BENCHMARK_DEFINE_F(CassieDouble, InverseDynamicsDerivatives)
+    // NOLINTNEXTLINE(runtime/references)
+    (benchmark::State& state) {
+  DoInverseDynamicsDerivatives(state);
+}
+BENCHMARK_REGISTER_F(CassieDouble, InverseDynamicsDerivatives)
+  ->Unit(benchmark::kMicrosecond)
+  ->Arg(kWantNoGrad);
+
+BENCHMARK_DEFINE_F(CassieDouble, ForwardDynamicsDerivatives)
+    // NOLINTNEXTLINE(runtime/references)
+    (benchmark::State& state) {
+  DoForwardDynamicsDerivatives(state);
+}
+BENCHMARK_REGISTER_F(CassieDouble, ForwardDynamicsDerivatives)
+  ->Unit(benchmark::kMicrosecond)
+  ->Arg(kWantNoGrad);
+
 // NOLINTNEXTLINE(runtime/references)
 BENCHMARK_DEFINE_F(CassieAutoDiff, MassMatrix)(benchmark::State& state) {
   DoMassMatrix(state);
@@ -0,0 +1,163 @@
+// @file
+// Benchmarks comparing the evaluation of FEM constitutive models one element
+// at a time against the batched evaluation of several single quadrature point
+// elements at once, as done by FemModelImpl. The batched evaluation of the
+// corotated models computes the polar decompositions of the deformation
+// gradients with PolarDecomposeBatch(), which processes
+// kPolarDecomposeBatchSize matrices at once in SIMD lanes, instead of one
+// singular value decomposition per element.
+
+#include <array>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/multibody/fem/corotated_model.h"
+#include "drake/multibody/fem/linear_corotated_model.h"
+#include "drake/multibody/fem/matrix_utilities.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+using Eigen::Matrix3d;
+
+constexpr int kBatchSize = kPolarDecomposeBatchSize;
+constexpr double kYoungsModulus = 1.0e6;
+constexpr double kPoissonsRatio = 0.4;
+
+using Matrix3dBatch = std::array<Matrix3d, kBatchSize>;
+
+// Returns a batch of arbitrary deformation gradients with moderate rotation and
+// stretch, as in a typical deformable body simulation.
+Matrix3dBatch MakeDeformationGradients() {
+  Matrix3dBatch F;
+  for (int k = 0; k < kBatchSize; ++k) {
+    const Matrix3d R =
+        Eigen::AngleAxisd(0.3 * (k + 1), Eigen::Vector3d(1, k, 2).normalized())
+            .toRotationMatrix();
+    // clang-format off
+    const Matrix3d S = (Matrix3d() <<
+        1.1,       0.05 * k,  0.02,
+        0.05 * k,  0.9,       0.03,
+        0.02,      0.03,      1.0 + 0.1 * k).finished();
+    // clang-format on
+    F[k] = R * S;
+  }
+  return F;
+}
+
+class ConstitutiveModelBenchmark : public benchmark::Fixture {
+ public:
+  ConstitutiveModelBenchmark() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+ protected:
+  // Evaluates the data, stress, and stress derivative of the given `Model`
+  // for each element individually.
+  template <template <typename, int> class Model>
+  // NOLINTNEXTLINE(runtime/references)
+  void DoScalarEvaluation(benchmark::State& state) {
+    const Model<double, 1> model(kYoungsModulus, kPoissonsRatio);
+    std::array<typename Model<double, 1>::Data, kBatchSize> data;
+    std::array<Matrix3d, 1> P;
+    std::array<Eigen::Matrix<double, 9, 9>, 1> dPdF;
+    for (auto _ : state) {
+      for (int k = 0; k < kBatchSize; ++k) {
+        data[k].UpdateData({F_[k]}, {F_[k]});
+        model.CalcFirstPiolaStress(data[k], &P);
+        model.CalcFirstPiolaStressDerivative(data[k], &dPdF);
+        benchmark::DoNotOptimize(P);
+        benchmark::DoNotOptimize(dPdF);
+      }
+    }
+  }
+
+  // Evaluates the data, stress, and stress derivative of the given `Model`
+  // for all elements, with their data updated as one batch.
+  template <template <typename, int> class Model>
+  // NOLINTNEXTLINE(runtime/references)
+  void DoBatchedEvaluation(benchmark::State& state) {
+    using Data = typename Model<double, 1>::Data;
+    const Model<double, 1> model(kYoungsModulus, kPoissonsRatio);
+    std::array<Data, kBatchSize> data;
+    std::array<Data*, kBatchSize> data_ptrs;
+    std::array<std::array<Matrix3d, 1>, kBatchSize> F;
+    for (int k = 0; k < kBatchSize; ++k) {
+      data_ptrs[k] = &data[k];
+      F[k] = {F_[k]};
+    }
+    std::array<Matrix3d, 1> P;
+    std::array<Eigen::Matrix<double, 9, 9>, 1> dPdF;
+    for (auto _ : state) {
+      Data::UpdateDataBatch(data_ptrs, F, F);
+      for (int k = 0; k < kBatchSize; ++k) {
+        model.CalcFirstPiolaStress(data[k], &P);
+        model.CalcFirstPiolaStressDerivative(data[k], &dPdF);
+        benchmark::DoNotOptimize(P);
+        benchmark::DoNotOptimize(dPdF);
+      }
+    }
+  }
+
+  const Matrix3dBatch F_{MakeDeformationGradients()};
+};
+
+BENCHMARK_F(ConstitutiveModelBenchmark, PolarDecomposeScalar)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  Matrix3dBatch R, S;
+  for (auto _ : state) {
+    for (int k = 0; k < kBatchSize; ++k) {
+      PolarDecompose<double>(F_[k], &R[k], &S[k]);
+    }
+    benchmark::DoNotOptimize(R);
+    benchmark::DoNotOptimize(S);
+  }
+}
+
+BENCHMARK_F(ConstitutiveModelBenchmark, PolarDecomposeBatch)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  Matrix3dBatch R, S;
+  for (auto _ : state) {
+    PolarDecomposeBatch(F_, &R, &S);
+    benchmark::DoNotOptimize(R);
+    benchmark::DoNotOptimize(S);
+  }
+}
+
+BENCHMARK_F(ConstitutiveModelBenchmark, CorotatedScalar)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  DoScalarEvaluation<CorotatedModel>(state);
+}
+
+BENCHMARK_F(ConstitutiveModelBenchmark, CorotatedBatched)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  DoBatchedEvaluation<CorotatedModel>(state);
+}
+
+BENCHMARK_F(ConstitutiveModelBenchmark, LinearCorotatedScalar)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  DoScalarEvaluation<LinearCorotatedModel>(state);
+}
+
+BENCHMARK_F(ConstitutiveModelBenchmark, LinearCorotatedBatched)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  DoBatchedEvaluation<LinearCorotatedModel>(state);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -0,0 +1,119 @@
+// @file
+// Benchmarks comparing the continuous forward dynamics algorithms offered by
+// MultibodyPlant (see ForwardDynamicsAlgorithm) on serial chains of
+// increasing length. The articulated body algorithm is O(n) in the number of
+// bodies while forming and factorizing the mass matrix is O(n³), though the
+// latter has a smaller constant and may win for short chains.
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using systems::Context;
+
+// Fixture that holds a serial chain of revolute links whose forward dynamics
+// is computed with `algorithm`. The benchmark case's "Arg" sets the number of
+// links.
+template <ForwardDynamicsAlgorithm algorithm>
+class RevoluteChain : public benchmark::Fixture {
+ public:
+  RevoluteChain() { tools::performance::AddMinMaxStatistics(this); }
+
+  // NOLINTNEXTLINE(runtime/references)
+  void SetUp(benchmark::State& state) override {
+    plant_ = MakePlant(state.range(0));
+    context_ = plant_->CreateDefaultContext();
+    // Use a non-zero state so that velocity-dependent terms are exercised.
+    const int nq = plant_->num_positions();
+    const int nv = plant_->num_velocities();
+    plant_->SetPositions(context_.get(), VectorXd::LinSpaced(nq, 0.1, 0.9));
+    plant_->SetVelocities(context_.get(), VectorXd::LinSpaced(nv, -0.5, 0.5));
+  }
+
+  void TearDown(benchmark::State&) override {
+    context_.reset();
+    plant_.reset();
+  }
+
+ protected:
+  // Makes a continuous plant with a chain of `num_links` links, each of them
+  // connected to its parent by a revolute joint. Joint axes alternate so that
+  // the mass matrix is dense.
+  static std::unique_ptr<MultibodyPlant<double>> MakePlant(int num_links) {
+    auto plant = std::make_unique<MultibodyPlant<double>>(0.0);
+    plant->set_forward_dynamics_algorithm(algorithm);
+    const SpatialInertia<double> M_BBo_B =
+        SpatialInertia<double>::SolidBoxWithMass(1.0, 0.05, 0.05, 0.3);
+    const RigidBody<double>* parent = &plant->world_body();
+    for (int i = 0; i < num_links; ++i) {
+      const RigidBody<double>& link =
+          plant->AddRigidBody(fmt::format("link{}", i), M_BBo_B);
+      const Vector3d axis =
+          (i % 2 == 0) ? Vector3d::UnitX() : Vector3d::UnitY();
+      plant->AddJoint<RevoluteJoint>(
+          fmt::format("joint{}", i), *parent,
+          RigidTransformd(Vector3d(0, 0, -0.15)), link,
+          RigidTransformd(Vector3d(0, 0, 0.15)), axis);
+      parent = &link;
+    }
+    plant->Finalize();
+    return plant;
+  }
+
+  // Runs the forward dynamics benchmark.
+  // NOLINTNEXTLINE(runtime/references)
+  void DoForwardDynamics(benchmark::State& state) {
+    for (auto _ : state) {
+      // Invalidate the state rather than disabling the cache so that
+      // intermediate results are reused within each computation, like in
+      // real applications.
+      context_->NoteContinuousStateChange();
+      plant_->EvalTimeDerivatives(*context_);
+    }
+  }
+
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+using ArticulatedBodyChain =
+    RevoluteChain<ForwardDynamicsAlgorithm::kArticulatedBody>;
+using MassMatrixChain = RevoluteChain<ForwardDynamicsAlgorithm::kMassMatrix>;
+
+BENCHMARK_DEFINE_F(ArticulatedBodyChain, ForwardDynamics)
+    // NOLINTNEXTLINE(runtime/references)
+    (benchmark::State& state) {
+  DoForwardDynamics(state);
+}
+BENCHMARK_REGISTER_F(ArticulatedBodyChain, ForwardDynamics)
+    ->Unit(benchmark::kMicrosecond)
+    ->RangeMultiplier(2)
+    ->Range(2, 128);
+
+BENCHMARK_DEFINE_F(MassMatrixChain, ForwardDynamics)
+    // NOLINTNEXTLINE(runtime/references)
+    (benchmark::State& state) {
+  DoForwardDynamics(state);
+}
+BENCHMARK_REGISTER_F(MassMatrixChain, ForwardDynamics)
+    ->Unit(benchmark::kMicrosecond)
+    ->RangeMultiplier(2)
+    ->Range(2, 128);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -0,0 +1,198 @@
+// @file
+// Benchmarks comparing the linear solvers used by SapSolver to compute search
+// directions (see SapHessianFactorizationType) on a large contact problem: a
+// square pile of boxes resting on the ground and pressed against their
+// neighbors. The block sparse Cholesky factorization computes exact Newton
+// directions, though its fill-in grows super-linearly with the size of the
+// grid. The preconditioned conjugate gradient method only computes inexact
+// directions, with a cost per iteration linear in the size of the problem.
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/math/cross_product.h"
+#include "drake/math/rotation_matrix.h"
+#include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
+#include "drake/multibody/contact_solvers/sap/sap_friction_cone_constraint.h"
+#include "drake/multibody/contact_solvers/sap/sap_solver.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+using Eigen::Matrix3d;
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RotationMatrixd;
+using FrictionConeConstraint = SapFrictionConeConstraint<double>;
+
+// Each box is a free body with six velocities, angular velocity first.
+constexpr int kNumBoxVelocities = 6;
+constexpr double kTimeStep = 0.01;
+constexpr double kBoxSize = 0.1;
+
+// Returns the Jacobian J_WC such that v_WC = J_WC⋅V_WB is the velocity of a
+// point C on a box B, at p_BoC_W from the box's origin Bo, expressed in the
+// contact frame with orientation R_WC.
+MatrixXd CalcContactPointJacobian(const Vector3d& p_BoC_W,
+                                  const RotationMatrixd& R_WC) {
+  MatrixXd J(3, kNumBoxVelocities);
+  // v_WC = v_WBo + w_WB × p_BoC = v_WBo − [p_BoC]×⋅w_WB.
+  J.leftCols<3>() = -math::VectorToSkewSymmetric(p_BoC_W);
+  J.rightCols<3>() = Matrix3d::Identity();
+  return R_WC.matrix().transpose() * J;
+}
+
+// Fixture that holds a grid of num_boxes x num_boxes boxes, where num_boxes
+// is the benchmark case's "Arg". Each box is in contact with the ground and
+// with its neighbors along x and y, for a total of 3⋅n²−2⋅n contacts.
+template <SapHessianFactorizationType linear_solver_type>
+class BoxPile : public benchmark::Fixture {
+ public:
+  BoxPile() { tools::performance::AddMinMaxStatistics(this); }
+
+  // NOLINTNEXTLINE(runtime/references)
+  void SetUp(benchmark::State& state) override {
+    problem_ = MakeProblem(state.range(0));
+    SapSolverParameters parameters;
+    parameters.linear_solver_type = linear_solver_type;
+    solver_.set_parameters(parameters);
+  }
+
+  void TearDown(benchmark::State&) override { problem_.reset(); }
+
+ protected:
+  static std::unique_ptr<SapContactProblem<double>> MakeProblem(
+      int num_boxes) {
+    const int num_cliques = num_boxes * num_boxes;
+    const double mass = 0.5;
+    const double inertia = mass * kBoxSize * kBoxSize / 6.0;
+    VectorXd M_diagonal(kNumBoxVelocities);
+    M_diagonal << inertia, inertia, inertia, mass, mass, mass;
+    std::vector<MatrixXd> A(num_cliques, MatrixXd(M_diagonal.asDiagonal()));
+    // Free fall under gravity during a time step.
+    VectorXd v_star = VectorXd::Zero(kNumBoxVelocities * num_cliques);
+    for (int c = 0; c < num_cliques; ++c) {
+      v_star(kNumBoxVelocities * c + 5) = -9.81 * kTimeStep;
+    }
+    auto problem = std::make_unique<SapContactProblem<double>>(
+        kTimeStep, std::move(A), std::move(v_star));
+    // One object per box, plus the ground.
+    const int ground = num_cliques;
+    problem->set_num_objects(num_cliques + 1);
+
+    const FrictionConeConstraint::Parameters parameters{
+        .mu = 0.5, .stiffness = 1.0e5, .dissipation_time_scale = 0.01};
+    const double half_size = 0.5 * kBoxSize;
+    auto box_index = [num_boxes](int i, int j) {
+      return i * num_boxes + j;
+    };
+    // Adds a contact between boxes A and B, with the normal from A into B.
+    auto add_neighbor_contact = [&](int box_A, int box_B,
+                                    const Vector3d& normal) {
+      const RotationMatrixd R_WC =
+          RotationMatrixd::MakeFromOneUnitVector(normal, 2);
+      const Vector3d p_AoC_W = half_size * normal;
+      const Vector3d p_BoC_W = -half_size * normal;
+      problem->AddConstraint(std::make_unique<FrictionConeConstraint>(
+          ContactConfiguration<double>{.objectA = box_A,
+                                       .p_ApC_W = p_AoC_W,
+                                       .objectB = box_B,
+                                       .p_BqC_W = p_BoC_W,
+                                       .phi = -1.0e-4,
+                                       .vn = 0.0,
+                                       .fe = 10.0,
+                                       .R_WC = R_WC},
+          SapConstraintJacobian<double>(
+              box_A, -CalcContactPointJacobian(p_AoC_W, R_WC), box_B,
+              CalcContactPointJacobian(p_BoC_W, R_WC)),
+          parameters));
+    };
+    for (int i = 0; i < num_boxes; ++i) {
+      for (int j = 0; j < num_boxes; ++j) {
+        const int box = box_index(i, j);
+        // Contact with the ground, with normal along +z.
+        const Vector3d p_BoC_W(0.0, 0.0, -half_size);
+        problem->AddConstraint(std::make_unique<FrictionConeConstraint>(
+            ContactConfiguration<double>{.objectA = ground,
+                                         .p_ApC_W = Vector3d::Zero(),
+                                         .objectB = box,
+                                         .p_BqC_W = p_BoC_W,
+                                         .phi = -1.0e-3,
+                                         .vn = 0.0,
+                                         .fe = 1.0e2,
+                                         .R_WC = RotationMatrixd()},
+            SapConstraintJacobian<double>(
+                box, CalcContactPointJacobian(p_BoC_W, RotationMatrixd())),
+            parameters));
+
+        // Contacts with the neighbors along +x and +y.
+        if (i + 1 < num_boxes) {
+          add_neighbor_contact(box, box_index(i + 1, j), Vector3d::UnitX());
+        }
+        if (j + 1 < num_boxes) {
+          add_neighbor_contact(box, box_index(i, j + 1), Vector3d::UnitY());
+        }
+      }
+    }
+    return problem;
+  }
+
+  // Runs the benchmark.
+  // NOLINTNEXTLINE(runtime/references)
+  void DoSolve(benchmark::State& state) {
+    const VectorXd v_guess = VectorXd::Zero(problem_->num_velocities());
+    SapSolverResults<double> results;
+    for (auto _ : state) {
+      const SapSolverStatus status =
+          solver_.SolveWithGuess(*problem_, v_guess, &results);
+      DRAKE_DEMAND(status == SapSolverStatus::kSuccess);
+    }
+    const SapStatistics& stats = solver_.get_statistics();
+    state.counters["newton_iters"] = stats.num_iters;
+    state.counters["cg_iters"] = stats.num_conjugate_gradient_iters;
+  }
+
+  std::unique_ptr<SapContactProblem<double>> problem_;
+  SapSolver<double> solver_;
+};
+
+using CholeskyBoxPile =
+    BoxPile<SapHessianFactorizationType::kBlockSparseCholesky>;
+using ConjugateGradientBoxPile =
+    BoxPile<SapHessianFactorizationType::kPreconditionedConjugateGradient>;
+
+BENCHMARK_DEFINE_F(CholeskyBoxPile, Solve)
+    // NOLINTNEXTLINE(runtime/references)
+    (benchmark::State& state) {
+  DoSolve(state);
+}
+BENCHMARK_REGISTER_F(CholeskyBoxPile, Solve)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(4, 64);
+
+BENCHMARK_DEFINE_F(ConjugateGradientBoxPile, Solve)
+    // NOLINTNEXTLINE(runtime/references)
+    (benchmark::State& state) {
+  DoSolve(state);
+}
+BENCHMARK_REGISTER_F(ConjugateGradientBoxPile, Solve)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(4, 64);
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -1,15 +1,43 @@
 #include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 
 #include <algorithm>
+#include <atomic>
 #include <utility>
 #include <vector>
 
+#include "drake/common/unused.h"
 #include "drake/multibody/contact_solvers/minimum_degree_ordering.h"
 
 namespace drake {
 namespace multibody {
 namespace contact_solvers {
 namespace internal {
+namespace {
+
+/* Invokes calc(j) for each block column j in `level` of the elimination tree,
+ concurrently with up to `max_threads` threads when Drake is built with
+ OpenMP. Since block columns in the same level do not depend on each other,
+ `calc` may only write data owned by column j. `calc` must not throw. */
+template <typename Calc>
+void ForEachColumnInLevel(const std::vector<int>& level, int max_threads,
+                          const Calc& calc) {
+  const int num_columns = ssize(level);
+  const int num_threads = std::min(max_threads, num_columns);
+  unused(num_threads);  // Only used with OpenMP.
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) if (num_threads > 1)
+#endif
+  for (int c = 0; c < num_columns; ++c) {
+    calc(level[c]);
+  }
+}
+
+/* FactorAndCalcSchurComplement() computes a new elimination ordering from
+ scratch once the blocks moved in or out of the eliminated blocks since the
+ last fresh ordering exceed this fraction of all blocks. */
+constexpr double kMaxFractionOfMovedBlocks = 0.1;
+
+}  // namespace
 
 template <typename BlockType>
 BlockSparseCholeskySolver<BlockType>::~BlockSparseCholeskySolver() = default;
@@ -23,6 +51,7 @@ void BlockSparseCholeskySolver<BlockType>::SetMatrix(const SymmetricMatrix& A) {
   BlockSparsityPattern L_block_pattern =
       SymbolicFactor(A, elimination_ordering);
   SetMatrixImpl(A, elimination_ordering, std::move(L_block_pattern));
+  schur_complement_analysis_.reset();
 }
 
 template <typename BlockType>
@@ -35,7 +64,9 @@ void BlockSparseCholeskySolver<BlockType>::UpdateMatrix(
 template <typename BlockType>
 bool BlockSparseCholeskySolver<BlockType>::Factor() {
   DRAKE_THROW_UNLESS(solver_mode_ == SolverMode::kAnalyzed);
-  const bool success = CalcPartialFactorization(0, L_->block_cols());
+  const bool success = parallelism_.num_threads() > 1
+                           ? CalcScheduledFactorization()
+                           : CalcPartialFactorization(0, L_->block_cols());
   solver_mode_ = success ? SolverMode::kFactored : SolverMode::kEmpty;
   return success;
 }
@@ -49,24 +80,14 @@ BlockSparseCholeskySolver<BlockType>::FactorAndCalcSchurComplement(
   const int num_total_blocks = A.block_cols();
   const int num_remaining_blocks = num_total_blocks - num_eliminated_blocks;
   DRAKE_DEMAND(num_remaining_blocks >= 0);
+  SetMatrixForSchurComplement(A, eliminated_blocks);
   if (num_remaining_blocks == 0) {
-    SetMatrix(A);
     const bool success = Factor();
     return success ? std::optional<MatrixX<double>>(MatrixX<double>::Zero(0, 0))
                    : std::nullopt;
   }
-
-  /* The Schur complement of the `eliminated_blocks` appear on the bottom
-   right corner of the matrix under Cholesky factorization when the
-   `eliminated_blocks` have been factorized first with a right-looking
-   Cholesky. So we need an elimination ordering that ensures that the blocks
-   associated with `eliminated_blocks` are eliminated first. There are
-   many ordering that satisfy this requirement, and we look for one that reduces
-   fill-in. */
-  const std::vector<int> elimination_ordering =
-      ComputeMinimumDegreeOrdering(A.sparsity_pattern(), eliminated_blocks);
-  SetMatrixImpl(A, elimination_ordering,
-                SymbolicFactor(A, elimination_ordering));
+  const std::vector<int>& elimination_ordering =
+      schur_complement_analysis_->elimination_ordering;
 
   /* Reset solver mode and exit if factorization of the eliminated blocks fails.
    */
@@ -167,6 +188,71 @@ BlockSparseCholeskySolver<BlockType>::FactorAndCalcSchurComplement(
   return P_inv * permuted_S * P;
 }
 
+template <typename BlockType>
+void BlockSparseCholeskySolver<BlockType>::SetMatrixForSchurComplement(
+    const SymmetricMatrix& A,
+    const std::unordered_set<int>& eliminated_blocks) {
+  const BlockSparsityPattern& A_pattern = A.sparsity_pattern();
+  const int num_blocks = A.block_cols();
+  std::vector<bool> is_eliminated(num_blocks, false);
+  for (int i : eliminated_blocks) {
+    DRAKE_DEMAND(0 <= i && i < num_blocks);
+    is_eliminated[i] = true;
+  }
+
+  if (schur_complement_analysis_.has_value() && L_ != nullptr &&
+      schur_complement_analysis_->A_pattern.block_sizes() ==
+          A_pattern.block_sizes() &&
+      schur_complement_analysis_->A_pattern.neighbors() ==
+          A_pattern.neighbors()) {
+    SchurComplementAnalysis& analysis = *schur_complement_analysis_;
+    int num_moved_blocks = 0;
+    for (int i = 0; i < num_blocks; ++i) {
+      if (is_eliminated[i] != analysis.is_eliminated[i]) ++num_moved_blocks;
+    }
+    if (num_moved_blocks == 0) {
+      UpdateMatrix(A);
+      return;
+    }
+    if (analysis.num_moved_blocks + num_moved_blocks <=
+        kMaxFractionOfMovedBlocks * num_blocks) {
+      /* Move the blocks that are now eliminated ahead of the remaining blocks
+       without changing the relative order within either group. The result is
+       still a valid ordering for computing the Schur complement, and it
+       differs from the previous one only in the moved blocks. */
+      std::stable_partition(analysis.elimination_ordering.begin(),
+                            analysis.elimination_ordering.end(),
+                            [&is_eliminated](int i) {
+                              return is_eliminated[i];
+                            });
+      SetMatrixImpl(A, analysis.elimination_ordering,
+                    SymbolicFactor(A, analysis.elimination_ordering));
+      analysis.is_eliminated = std::move(is_eliminated);
+      analysis.num_moved_blocks += num_moved_blocks;
+      return;
+    }
+  }
+
+  /* The Schur complement of the `eliminated_blocks` appear on the bottom
+   right corner of the matrix under Cholesky factorization when the
+   `eliminated_blocks` have been factorized first with a right-looking
+   Cholesky. So we need an elimination ordering that ensures that the blocks
+   associated with `eliminated_blocks` are eliminated first. There are
+   many ordering that satisfy this requirement, and we look for one that reduces
+   fill-in. */
+  std::vector<int> elimination_ordering =
+      ssize(eliminated_blocks) == num_blocks
+          ? ComputeMinimumDegreeOrdering(A_pattern)
+          : ComputeMinimumDegreeOrdering(A_pattern, eliminated_blocks);
+  SetMatrixImpl(A, elimination_ordering,
+                SymbolicFactor(A, elimination_ordering));
+  schur_complement_analysis_ = SchurComplementAnalysis{
+      .A_pattern = A_pattern,
+      .is_eliminated = std::move(is_eliminated),
+      .elimination_ordering = std::move(elimination_ordering),
+      .num_moved_blocks = 0};
+}
+
 template <typename BlockType>
 VectorX<double> BlockSparseCholeskySolver<BlockType>::Solve(
     const Eigen::Ref<const VectorX<double>>& b) const {
@@ -184,6 +270,12 @@ void BlockSparseCholeskySolver<BlockType>::SolveInPlace(
   VectorX<double> permuted_b(*b);
   scalar_permutation_.Apply(*b, &permuted_b);
 
+  if (parallelism_.num_threads() > 1) {
+    ScheduledSolveInPlace(&permuted_b);
+    scalar_permutation_.ApplyInverse(permuted_b, b);
+    return;
+  }
+
   const BlockSparsityPattern& block_sparsity_pattern = L_->sparsity_pattern();
   const std::vector<int>& block_sizes = block_sparsity_pattern.block_sizes();
   const std::vector<int>& starting_cols = L_->starting_cols();
@@ -257,6 +349,7 @@ void BlockSparseCholeskySolver<BlockType>::SetMatrixImpl(
   /* Third documented responsibility: allocate for `L_` and `L_diag_`. */
   L_ = std::make_unique<LowerTriangularMatrix>(std::move(L_pattern));
   L_diag_.resize(A.block_cols());
+  SetEliminationTreeSchedule();
   /* Fourth documented responsibility: UpdateMatrix. */
   UpdateMatrix(A);
 }
@@ -342,33 +435,41 @@ bool BlockSparseCholeskySolver<BlockType>::CalcPartialFactorization(
                starting_col_block <= L_->block_cols());
   DRAKE_DEMAND(ending_col_block >= 0 && ending_col_block <= L_->block_cols());
   for (int j = starting_col_block; j < ending_col_block; ++j) {
-    /* Update diagonal. */
-    const BlockType& Ajj = L_->diagonal_block(j);
-    L_diag_[j].compute(Ajj);
-    if (L_diag_[j].info() != Eigen::Success) {
+    if (!FactorColumn(j)) {
       return false;
     }
-    L_->SetBlockFlat(0, j, L_diag_[j].matrixL());
-    /* Update L₂₁ column.
-     | a₁₁  *  | = | λ₁₁  0 | * | λ₁₁ᵀ L₂₁ᵀ |
-     | a₂₁ a₂₂ |   | L₂₁ L₂₂|   |  0   L₂₂ᵀ |
-     So we have
-      L₂₁λ₁₁ᵀ = a₂₁, and thus
-      λ₁₁L₂₁ᵀ = a₂₁ᵀ */
-    const std::vector<int>& row_blocks = L_->block_row_indices(j);
-    const auto Ljj = L_diag_[j].matrixL();
-    /* We start from flat = 1 here to skip the j,j diagonal entry. */
-    for (int flat = 1; flat < ssize(row_blocks); ++flat) {
-      const BlockType& Aij = L_->block_flat(flat, j);
-      BlockType Lij = Ljj.solve(Aij.transpose()).transpose();
-      L_->SetBlockFlat(flat, j, std::move(Lij));
-    }
     /* Update L₂₂ according to L₂₂ = a₂₂ - L₂₁⋅L₂₁ᵀ. */
     RightLookingSymmetricRank1Update(j);
   }
   return true;
 }
 
+template <typename BlockType>
+bool BlockSparseCholeskySolver<BlockType>::FactorColumn(int j) {
+  /* Update diagonal. */
+  const BlockType& Ajj = L_->diagonal_block(j);
+  L_diag_[j].compute(Ajj);
+  if (L_diag_[j].info() != Eigen::Success) {
+    return false;
+  }
+  L_->SetBlockFlat(0, j, L_diag_[j].matrixL());
+  /* Update L₂₁ column.
+   | a₁₁  *  | = | λ₁₁  0 | * | λ₁₁ᵀ L₂₁ᵀ |
+   | a₂₁ a₂₂ |   | L₂₁ L₂₂|   |  0   L₂₂ᵀ |
+   So we have
+    L₂₁λ₁₁ᵀ = a₂₁, and thus
+    λ₁₁L₂₁ᵀ = a₂₁ᵀ */
+  const std::vector<int>& row_blocks = L_->block_row_indices(j);
+  const auto Ljj = L_diag_[j].matrixL();
+  /* We start from flat = 1 here to skip the j,j diagonal entry. */
+  for (int flat = 1; flat < ssize(row_blocks); ++flat) {
+    const BlockType& Aij = L_->block_flat(flat, j);
+    BlockType Lij = Ljj.solve(Aij.transpose()).transpose();
+    L_->SetBlockFlat(flat, j, std::move(Lij));
+  }
+  return true;
+}
+
 template <typename BlockType>
 void BlockSparseCholeskySolver<BlockType>::RightLookingSymmetricRank1Update(
     int j) {
@@ -386,6 +487,101 @@ void BlockSparseCholeskySolver<BlockType>::RightLookingSymmetricRank1Update(
   }
 }
 
+template <typename BlockType>
+void BlockSparseCholeskySolver<BlockType>::SetEliminationTreeSchedule() {
+  DRAKE_DEMAND(L_ != nullptr);
+  const int n = L_->block_cols();
+  row_structure_.assign(n, {});
+  /* Since the parent of a block column has a larger index, the height of
+   column k is final by the time k is reached. */
+  std::vector<int> height(n, 0);
+  int max_height = 0;
+  for (int k = 0; k < n; ++k) {
+    const std::vector<int>& blocks_in_col_k = L_->block_row_indices(k);
+    for (int flat = 1; flat < ssize(blocks_in_col_k); ++flat) {
+      row_structure_[blocks_in_col_k[flat]].emplace_back(k, flat);
+    }
+    if (ssize(blocks_in_col_k) > 1) {
+      const int parent = blocks_in_col_k[1];
+      height[parent] = std::max(height[parent], height[k] + 1);
+    }
+    max_height = std::max(max_height, height[k]);
+  }
+  elimination_tree_levels_.assign(n > 0 ? max_height + 1 : 0, {});
+  for (int j = 0; j < n; ++j) {
+    elimination_tree_levels_[height[j]].push_back(j);
+  }
+}
+
+template <typename BlockType>
+bool BlockSparseCholeskySolver<BlockType>::LeftLookingFactorColumn(int j) {
+  /* Gather L(j:, j) -= L(j:, k)⋅L(j, k)ᵀ for each k < j with L(j, k) ≠ 0.
+   These are the same updates RightLookingSymmetricRank1Update(k) applies to
+   column j, in the same order. Since block rows are sorted within a column,
+   the rows i >= j in column k start at the flat index of row j. */
+  for (const auto& [k, flat_jk] : row_structure_[j]) {
+    const std::vector<int>& blocks_in_col_k = L_->block_row_indices(k);
+    const BlockType& B = L_->block_flat(flat_jk, k);
+    for (int l = flat_jk; l < ssize(blocks_in_col_k); ++l) {
+      const int row = blocks_in_col_k[l];
+      const BlockType& A = L_->block_flat(l, k);
+      L_->AddToBlock(row, j, -A * B.transpose());
+    }
+  }
+  return FactorColumn(j);
+}
+
+template <typename BlockType>
+bool BlockSparseCholeskySolver<BlockType>::CalcScheduledFactorization() {
+  DRAKE_THROW_UNLESS(solver_mode() == SolverMode::kAnalyzed);
+  for (const std::vector<int>& level : elimination_tree_levels_) {
+    std::atomic<bool> success{true};
+    ForEachColumnInLevel(level, parallelism_.num_threads(), [&](int j) {
+      if (!LeftLookingFactorColumn(j)) success = false;
+    });
+    if (!success) return false;
+  }
+  return true;
+}
+
+template <typename BlockType>
+void BlockSparseCholeskySolver<BlockType>::ScheduledSolveInPlace(
+    VectorX<double>* permuted_b) const {
+  VectorX<double>& x = *permuted_b;
+  const std::vector<int>& block_sizes = L_->sparsity_pattern().block_sizes();
+  const std::vector<int>& starting_cols = L_->starting_cols();
+  const int num_levels = ssize(elimination_tree_levels_);
+  const int max_threads = parallelism_.num_threads();
+
+  /* Solve Lz = b in place, from the leaves to the root. The j-th block entry
+   only depends on the entries of its descendants. */
+  for (int h = 0; h < num_levels; ++h) {
+    ForEachColumnInLevel(elimination_tree_levels_[h], max_threads, [&](int j) {
+      auto xj = x.segment(starting_cols[j], block_sizes[j]);
+      for (const auto& [k, flat_jk] : row_structure_[j]) {
+        xj.noalias() -= L_->block_flat(flat_jk, k) *
+                        x.segment(starting_cols[k], block_sizes[k]);
+      }
+      L_diag_[j].matrixL().solveInPlace(xj);
+    });
+  }
+
+  /* Solve Lᵀx = z in place, from the root to the leaves. The j-th block entry
+   only depends on the entries of its ancestors. */
+  for (int h = num_levels - 1; h >= 0; --h) {
+    ForEachColumnInLevel(elimination_tree_levels_[h], max_threads, [&](int j) {
+      auto xj = x.segment(starting_cols[j], block_sizes[j]);
+      const auto& blocks_in_col_j = L_->block_row_indices(j);
+      for (int flat = 1; flat < ssize(blocks_in_col_j); ++flat) {
+        const int i = blocks_in_col_j[flat];
+        xj.noalias() -= L_->block_flat(flat, j).transpose() *
+                        x.segment(starting_cols[i], block_sizes[i]);
+      }
+      L_diag_[j].matrixU().solveInPlace(xj);
+    });
+  }
+}
+
 template <typename BlockType>
 void BlockSparseCholeskySolver<BlockType>::PermuteAndCopyToL(
     const SymmetricMatrix& A) {
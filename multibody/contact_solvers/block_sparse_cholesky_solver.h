@@ -3,11 +3,13 @@
 #include <memory>
 #include <optional>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/reset_after_move.h"
 #include "drake/multibody/contact_solvers/block_sparse_lower_triangular_or_symmetric_matrix.h"
 #include "drake/multibody/contact_solvers/sap/partial_permutation.h"
@@ -156,6 +158,20 @@ class BlockSparseCholeskySolver {
    If the fatorization of A is successful, returns the Schur complement
    S = C - BᵀD⁻¹B.
 
+   The symbolic analysis of A (its elimination ordering and the sparsity
+   pattern of L) is reused from the previous call to this function if A has the
+   same sparsity pattern as the matrix in that call, which is the common case
+   when the same matrix is factored repeatedly with new numeric values:
+    - If `eliminated_blocks` is unchanged, only the numeric factorization is
+      performed.
+    - If `eliminated_blocks` changed in a few blocks, the previous elimination
+      ordering is reordered so that the eliminated blocks still come first,
+      keeping their relative order, instead of computing a new minimum degree
+      ordering. Such reorderings may increase the fill-in of L, so the ordering
+      is computed from scratch whenever the blocks reordered this way add up to
+      more than 10% of all blocks.
+   SetMatrix() discards the analysis.
+
    @pre `eliminated_blocks` has all its entries in [0, A.block_cols()).
    @post solver_mode() is SolverMode::kFactored if factorization is successful
    and is SolverMode::kEmpty otherwise. */
@@ -178,6 +194,21 @@ class BlockSparseCholeskySolver {
   /* Returns the current mode of the solver. See SolverMode. */
   SolverMode solver_mode() const { return solver_mode_; }
 
+  /* Sets the degree of parallelism used by Factor() and SolveInPlace(). With
+   more than one thread, the numeric factorization and the triangular solves
+   are scheduled on the elimination tree of L: block columns with the same
+   height in the tree have no dependencies among them and are processed
+   concurrently, from the leaves to the root (and from the root to the leaves
+   for the backward substitution). Updates to each block column are
+   accumulated in the same order as in the serial factorization. Only has an
+   effect when Drake is built with OpenMP, though the scheduled algorithm is
+   used regardless. FactorAndCalcSchurComplement() is always serial. Defaults
+   to Parallelism::None(). */
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /* Returns the degree of parallelism set with set_parallelism(). */
+  Parallelism parallelism() const { return parallelism_; }
+
   /* Returns (the lower triangular) Cholesky factorization matrix L as a
    dense matrix. L is defined by L⋅Lᵀ = P⋅A⋅Pᵀ, where A is the matrix set via
    SetMatrix() or UpdateMatrix() and P is the permutation matrix induced by the
@@ -211,6 +242,15 @@ class BlockSparseCholeskySolver {
                      const std::vector<int>& elimination_ordering,
                      BlockSparsityPattern&& L_pattern);
 
+  /* Helper for FactorAndCalcSchurComplement() to set the matrix A, reusing the
+   symbolic analysis of the previous call when possible (see
+   FactorAndCalcSchurComplement()). On return, `schur_complement_analysis_`
+   describes the analysis of A.
+   @post solver_mode() == SolverMode::kAnalyzed. */
+  void SetMatrixForSchurComplement(
+      const SymmetricMatrix& A,
+      const std::unordered_set<int>& eliminated_blocks);
+
   /* Sets `scalar_permutation_` given the matrix A and the prescribed
    elimination ordering.
    @param[in] A                     The matrix to be factored.
@@ -243,6 +283,34 @@ class BlockSparseCholeskySolver {
    @pre 0 <= j < L.block_cols(). */
   void RightLookingSymmetricRank1Update(int j);
 
+  /* Computes the j-th block column of L, given that the updates from all
+   block columns to the left of j have already been applied to it. Returns
+   false iff the factorization of the diagonal block fails.
+   @pre 0 <= j < L.block_cols(). */
+  bool FactorColumn(int j);
+
+  /* Sets `row_structure_` and `elimination_tree_levels_` from the sparsity
+   pattern of L_.
+   @pre L_ is not nullptr. */
+  void SetEliminationTreeSchedule();
+
+  /* Computes the j-th block column of L given all columns that modify it (its
+   descendants in the elimination tree) are already computed. Only the j-th
+   block column of L_ and L_diag_[j] are written. Returns false iff the
+   factorization of the diagonal block fails.
+   @pre 0 <= j < L.block_cols(). */
+  bool LeftLookingFactorColumn(int j);
+
+  /* Computes the full factorization with the elimination tree schedule,
+   processing each level with up to parallelism_.num_threads() threads.
+   @pre solver_mode() == kAnalyzed. */
+  bool CalcScheduledFactorization();
+
+  /* Solves L⋅Lᵀ⋅x = b in place for the permuted right hand side `b`, with the
+   elimination tree schedule.
+   @pre solver_mode() == kFactored. */
+  void ScheduledSolveInPlace(VectorX<double>* permuted_b) const;
+
   /* Permutes the given matrix A with `block_permutation_` p and set L such that
    the lower triangular part of L satisfies L(p(i), p(j)) = A(i, j).
    @pre SetMarix() has been called. */
@@ -264,6 +332,33 @@ class BlockSparseCholeskySolver {
    index into L_. */
   PartialPermutation scalar_permutation_;
 
+  /* Elimination tree schedule, computed along with the sparsity pattern of
+   L_. `row_structure_[j]` lists the pairs (k, flat) for each block column
+   k < j with a non-zero block L(j, k), in increasing order of k, where flat
+   is the flat index of block row j in block column k. The parent of block
+   column j in the elimination tree is the first off-diagonal block row in
+   that column, and `elimination_tree_levels_[h]` lists the block columns at
+   height h (leaves are at height zero). */
+  std::vector<std::vector<std::pair<int, int>>> row_structure_;
+  std::vector<std::vector<int>> elimination_tree_levels_;
+
+  Parallelism parallelism_{Parallelism::None()};
+
+  /* The symbolic analysis performed in the last call to
+   FactorAndCalcSchurComplement(). It describes `L_` and the permutations
+   unless SetMatrix() has been called since. */
+  struct SchurComplementAnalysis {
+    /* The sparsity pattern of the analyzed matrix. */
+    BlockSparsityPattern A_pattern;
+    /* is_eliminated[i] is true iff block i is among the eliminated blocks. */
+    std::vector<bool> is_eliminated;
+    std::vector<int> elimination_ordering;
+    /* The number of blocks that moved in or out of the eliminated blocks since
+     the elimination ordering was last computed from scratch. */
+    int num_moved_blocks{};
+  };
+  std::optional<SchurComplementAnalysis> schur_complement_analysis_;
+
   reset_after_move<SolverMode> solver_mode_{SolverMode::kEmpty};
 };
 
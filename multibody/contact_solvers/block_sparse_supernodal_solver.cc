@@ -159,6 +159,41 @@ bool BlockSparseSuperNodalSolver::DoSetWeightMatrix(
   return true;
 }
 
+bool BlockSparseSuperNodalSolver::DoUpdateMatrices(
+    int num_jacobian_row_blocks,
+    const std::vector<BlockTriplet>& jacobian_blocks,
+    const std::vector<Eigen::MatrixXd>& mass_matrices) {
+  if (num_jacobian_row_blocks != ssize(row_to_triplet_index_) ||
+      jacobian_blocks.size() != jacobian_blocks_.size() ||
+      mass_matrices.size() != mass_matrices_.size()) {
+    return false;
+  }
+  for (int i = 0; i < ssize(mass_matrices_); ++i) {
+    if (mass_matrices[i].rows() != mass_matrices_[i].rows() ||
+        mass_matrices[i].cols() != mass_matrices_[i].cols()) {
+      return false;
+    }
+  }
+  for (int k = 0; k < ssize(jacobian_blocks_); ++k) {
+    const BlockTriplet& previous = jacobian_blocks_[k];
+    const BlockTriplet& current = jacobian_blocks[k];
+    if (current.row != previous.row || current.col != previous.col ||
+        current.value.rows() != previous.value.rows() ||
+        current.value.cols() != previous.value.cols()) {
+      return false;
+    }
+  }
+  /* The pattern is unchanged, therefore row_to_triplet_index_, H_ and the
+   symbolic factorization in solver_ remain valid. */
+  for (int k = 0; k < ssize(jacobian_blocks_); ++k) {
+    jacobian_blocks_[k].value = jacobian_blocks[k].value;
+  }
+  for (int i = 0; i < ssize(mass_matrices_); ++i) {
+    mass_matrices_[i] = mass_matrices[i];
+  }
+  return true;
+}
+
 bool BlockSparseSuperNodalSolver::DoFactor() {
   return solver_.Factor();
 }
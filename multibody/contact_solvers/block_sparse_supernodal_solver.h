@@ -56,6 +56,20 @@ class BlockSparseSuperNodalSolver final : public SuperNodalSolver {
     return H_->cols();
   }
 
+  /* Since the sparsity pattern of H is fully determined by the block sizes of
+   M and the block indices of J, the elimination ordering and supernodes
+   computed by solver_ at construction remain valid whenever these are
+   unchanged, and only the numerical values are copied. */
+  bool DoUpdateMatrices(
+      int num_jacobian_row_blocks,
+      const std::vector<BlockTriplet>& jacobian_blocks,
+      const std::vector<Eigen::MatrixXd>& mass_matrices) final;
+
+  /* Forwards to BlockSparseCholeskySolver::set_parallelism(). */
+  void DoSetParallelism(Parallelism parallelism) final {
+    solver_.set_parallelism(parallelism);
+  }
+
   /* Matrix H in the sparse system H⋅x = b where H = M + Jᵀ⋅G⋅J. */
   std::unique_ptr<BlockSparseSymmetricMatrix> H_;
   /* The i-th entry contains the indices into `jacobian_blocks_` for the
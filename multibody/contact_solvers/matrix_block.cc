@@ -228,6 +228,12 @@ MatrixX<T> MatrixBlock<T>::MakeDenseMatrix() const {
   return std::get<Block3x3SparseMatrix<T>>(data_).MakeDenseMatrix();
 }
 
+template <typename T>
+MatrixX<T>& MatrixBlock<T>::get_mutable_dense_matrix() {
+  DRAKE_DEMAND(is_dense_);
+  return std::get<MatrixX<T>>(data_);
+}
+
 template <typename T>
 MatrixBlock<T> StackMatrixBlocks(const std::vector<MatrixBlock<T>>& blocks) {
   if (blocks.empty()) {
@@ -101,6 +101,11 @@ class MatrixBlock {
    testing. */
   MatrixX<T> MakeDenseMatrix() const;
 
+  /* Returns a mutable reference to the underlying dense matrix, so that it can
+   be overwritten (and resized) in place, reusing its storage.
+   @pre is_dense() is true. */
+  MatrixX<T>& get_mutable_dense_matrix();
+
   bool operator==(const MatrixBlock<T>&) const = default;
 
  private:
@@ -0,0 +1,195 @@
+#include "drake/multibody/contact_solvers/sap/friction_cone_batch.h"
+
+#include <algorithm>
+
+// This is the magic juju that compiles our impl functions for multiple CPUs.
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "multibody/contact_solvers/sap/friction_cone_batch.cc"  // NOLINT
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include "hwy/foreach_target.h"
+#include "hwy/highway.h"
+#pragma GCC diagnostic pop
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/hwy_dynamic_impl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+namespace HWY_NAMESPACE {
+// The hn namespace holds the CPU-specific function overloads. By defining it
+// using a substitute-able macro, we achieve per-CPU instruction selection.
+namespace hn = hwy::HWY_NAMESPACE;
+
+// Square of the tolerance used by SapFrictionConeConstraint::SoftNorm().
+constexpr double kSoftToleranceSquared = 1.0e-7 * 1.0e-7;
+
+// Loads `count` entries of x starting at index k. Lanes past `count` are zero.
+template <class D>
+HWY_INLINE hn::Vec<D> Load(D d, const VectorX<double>& x, int k, int count) {
+  if (count == static_cast<int>(hn::Lanes(d))) {
+    return hn::LoadU(d, x.data() + k);
+  }
+  return hn::LoadN(d, x.data() + k, count);
+}
+
+// Stores the first `count` lanes of v into x, starting at index k.
+template <class D>
+HWY_INLINE void Store(D d, hn::Vec<D> v, int k, int count, VectorX<double>* x) {
+  if (count == static_cast<int>(hn::Lanes(d))) {
+    hn::StoreU(v, d, x->data() + k);
+  } else {
+    hn::StoreN(v, d, x->data() + k, count);
+  }
+}
+
+// Implements CalcFrictionConeImpulses(). It follows the same sequence of
+// operations as SapFrictionConeConstraint::DoCalcData(), with the branches on
+// the contact mode replaced by masked selections.
+void CalcFrictionConeImpulsesImpl(FrictionConeBatchData* data_ptr) {
+  FrictionConeBatchData& data = *data_ptr;
+  const int size = data.size();
+  const hn::ScalableTag<double> d;
+  const int N = static_cast<int>(hn::Lanes(d));
+  const auto soft_tolerance_squared = hn::Set(d, kSoftToleranceSquared);
+  for (int k = 0; k < size; k += N) {
+    const int count = std::min(N, size - k);
+    const auto mu = Load(d, data.mu, k, count);
+    const auto mu_hat = Load(d, data.mu_hat, k, count);
+    const auto sliding_factor = Load(d, data.sliding_factor, k, count);
+
+    // y = R⁻¹⋅(v̂ − vc), with v̂ = [0, 0, v̂ₙ].
+    const auto y_x = hn::Mul(hn::Neg(Load(d, data.vc_x, k, count)),
+                             Load(d, data.Rt_inv, k, count));
+    const auto y_y = hn::Mul(hn::Neg(Load(d, data.vc_y, k, count)),
+                             Load(d, data.Rt_inv, k, count));
+    const auto y_z = hn::Mul(hn::Sub(Load(d, data.vn_hat, k, count),
+                                     Load(d, data.vc_z, k, count)),
+                             Load(d, data.Rn_inv, k, count));
+    const auto yr = hn::Sqrt(hn::Add(
+        hn::Add(hn::Mul(y_x, y_x), hn::Mul(y_y, y_y)), soft_tolerance_squared));
+
+    // Contact modes, see SapFrictionConeConstraint::CalcContactMode(). For
+    // μ = 0, yr/μ = ∞ (and yr > 0 always).
+    const auto stiction = hn::Le(yr, hn::Mul(mu, y_z));
+    const auto sliding =
+        hn::AndNot(stiction, hn::And(hn::Lt(hn::Mul(hn::Neg(mu_hat), yr), y_z),
+                                     hn::Lt(y_z, hn::Div(yr, mu))));
+
+    // Projection for the sliding mode, γₙ = (yₙ + μ̂⋅yr)/(1 + μ̃²) and
+    // γₜ = μ⋅γₙ⋅t̂, with t̂ = yₜ/yr.
+    const auto gn = hn::Mul(hn::Add(y_z, hn::Mul(mu_hat, yr)), sliding_factor);
+    const auto mu_gn = hn::Mul(mu, gn);
+    const auto gt_x = hn::Mul(mu_gn, hn::Div(y_x, yr));
+    const auto gt_y = hn::Mul(mu_gn, hn::Div(y_y, yr));
+
+    // γ = y in stiction, the projection above when sliding, zero otherwise.
+    Store(d, y_x, k, count, &data.y_x);
+    Store(d, y_y, k, count, &data.y_y);
+    Store(d, y_z, k, count, &data.y_z);
+    Store(d, yr, k, count, &data.yr);
+    Store(d, hn::IfThenElse(stiction, y_x, hn::IfThenElseZero(sliding, gt_x)),
+          k, count, &data.gamma_x);
+    Store(d, hn::IfThenElse(stiction, y_y, hn::IfThenElseZero(sliding, gt_y)),
+          k, count, &data.gamma_y);
+    Store(d, hn::IfThenElse(stiction, y_z, hn::IfThenElseZero(sliding, gn)),
+          k, count, &data.gamma_z);
+  }
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+HWY_AFTER_NAMESPACE();
+
+// This part of the file is only compiled once total, instead of once per CPU.
+#if HWY_ONCE
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+// Create the lookup tables for the per-CPU hwy implementation functions, and
+// required functors that select from the lookup tables.
+HWY_EXPORT(CalcFrictionConeImpulsesImpl);
+struct ChooseBestCalcFrictionConeImpulses {
+  auto operator()() {
+    return HWY_DYNAMIC_POINTER(CalcFrictionConeImpulsesImpl);
+  }
+};
+
+}  // namespace
+
+void FrictionConeBatchData::Resize(int num_constraints) {
+  for (VectorX<double>* x :
+       {&mu, &mu_hat, &sliding_factor, &Rt, &Rn, &Rt_inv, &Rn_inv, &vn_hat,
+        &vc_x, &vc_y, &vc_z, &y_x, &y_y, &y_z, &yr, &gamma_x, &gamma_y,
+        &gamma_z}) {
+    x->resize(num_constraints);
+  }
+}
+
+void CalcFrictionConeImpulses(FrictionConeBatchData* data) {
+  DRAKE_DEMAND(data != nullptr);
+  // Note: LateBoundFunction copies its arguments, hence the pointer.
+  LateBoundFunction<ChooseBestCalcFrictionConeImpulses>::Call(data);
+}
+
+double CalcFrictionConeCost(const FrictionConeBatchData& data) {
+  return 0.5 * (data.Rt.array() * (data.gamma_x.array().square() +
+                                   data.gamma_y.array().square()) +
+                data.Rn.array() * data.gamma_z.array().square())
+                   .sum();
+}
+
+void CalcFrictionConeHessian(const FrictionConeBatchData& data, int k,
+                             MatrixX<double>* G) {
+  DRAKE_DEMAND(G != nullptr);
+  DRAKE_ASSERT(0 <= k && k < data.size());
+  G->resize(3, 3);
+  const double mu = data.mu[k];
+  const double mu_hat = data.mu_hat[k];
+  const double yr = data.yr[k];
+  const double yn = data.y_z[k];
+
+  // Same contact modes as in CalcFrictionConeImpulsesImpl().
+  if (yr <= mu * yn) {
+    // Stiction, G = R⁻¹.
+    G->setZero();
+    G->diagonal() << data.Rt_inv[k], data.Rt_inv[k], data.Rn_inv[k];
+    return;
+  }
+  if (!(-mu_hat * yr < yn && yn < yr / mu)) {
+    // No contact.
+    G->setZero();
+    return;
+  }
+
+  // Sliding. This follows SapFrictionConeConstraint::DoCalcCostHessian(),
+  // computing G = dP/dy⋅R⁻¹.
+  const Vector2<double> that(data.y_x[k] / yr, data.y_y[k] / yr);
+  const Matrix2<double> P = that * that.transpose();
+  const Matrix2<double> Pperp = Matrix2<double>::Identity() - P;
+  const double factor = data.sliding_factor[k];
+  const double gn = data.gamma_z[k];
+  G->topLeftCorner<2, 2>() = mu * (gn / yr * Pperp + mu_hat * factor * P);
+  G->topRightCorner<2, 1>() = mu * factor * that;
+  G->bottomLeftCorner<1, 2>() = mu_hat * factor * that.transpose();
+  (*G)(2, 2) = factor;
+  *G *= Vector3<double>(data.Rt_inv[k], data.Rt_inv[k], data.Rn_inv[k])
+            .asDiagonal();
+}
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+#endif  // HWY_ONCE
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+/* Stores the data of a batch of friction cone constraints (see
+ SapFrictionConeConstraint) as a structure of arrays, so that their projections
+ can be computed with SIMD instructions. The k-th entry of each array
+ corresponds to the k-th constraint in the batch. Vector quantities are
+ expressed in the contact frame C of each constraint, with components x and y
+ tangent to the contact surface and component z along its normal.
+
+ This is used by SapConstraintBundle to evaluate all of the friction cone
+ constraints in a problem at once, rather than one at a time through the
+ SapConstraint interface, since these are typically the vast majority of
+ constraints and they are re-evaluated at each line search iteration. */
+struct FrictionConeBatchData {
+  /* Resizes all arrays to store num_constraints constraints. */
+  void Resize(int num_constraints);
+
+  int size() const { return mu.size(); }
+
+  /* Parameters, constant after SapConstraintBundle::MakeData(). See
+   SapFrictionConeConstraintData for their definitions. */
+  VectorX<double> mu;
+  VectorX<double> mu_hat;
+  VectorX<double> sliding_factor;  // = 1/(1 + μ̃²).
+  VectorX<double> Rt;              // Tangential regularization.
+  VectorX<double> Rn;              // Normal regularization.
+  VectorX<double> Rt_inv;          // = 1/Rt.
+  VectorX<double> Rn_inv;          // = 1/Rn.
+  VectorX<double> vn_hat;          // Normal component of the bias v̂.
+
+  /* Constraint velocities vc, input to CalcFrictionConeImpulses(). */
+  VectorX<double> vc_x;
+  VectorX<double> vc_y;
+  VectorX<double> vc_z;
+
+  /* Outputs of CalcFrictionConeImpulses(): the un-projected impulses
+   y = −R⁻¹⋅(vc−v̂), the soft norm yr of their tangential component and the
+   impulses γ = P(y). */
+  VectorX<double> y_x;
+  VectorX<double> y_y;
+  VectorX<double> y_z;
+  VectorX<double> yr;
+  VectorX<double> gamma_x;
+  VectorX<double> gamma_y;
+  VectorX<double> gamma_z;
+};
+
+/* Computes y, yr and γ in `data` as a function of vc, for all constraints in
+ the batch. Results match SapFrictionConeConstraint::CalcData() up to round-off
+ errors. The computation uses the widest SIMD instructions supported by the
+ CPU, selected at runtime.
+ @pre data is not nullptr. */
+void CalcFrictionConeImpulses(FrictionConeBatchData* data);
+
+/* Returns the cost ℓ = ½⋅γᵀ⋅R⋅γ summed over all constraints in the batch.
+ @pre CalcFrictionConeImpulses() was called on `data`. */
+double CalcFrictionConeCost(const FrictionConeBatchData& data);
+
+/* Computes the Hessian G = −∂γ/∂vc of the k-th constraint in the batch, of size
+ 3x3.
+ @pre CalcFrictionConeImpulses() was called on `data`.
+ @pre G is not nullptr. */
+void CalcFrictionConeHessian(const FrictionConeBatchData& data, int k,
+                             MatrixX<double>* G);
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
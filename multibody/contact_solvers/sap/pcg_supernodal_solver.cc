@@ -0,0 +1,170 @@
+#include "drake/multibody/contact_solvers/sap/pcg_supernodal_solver.h"
+
+#include <string_view>
+#include <vector>
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+template <typename T>
+const T& SafeDereference(std::string_view variable_name, const T* ptr) {
+  if (ptr == nullptr) {
+    throw std::runtime_error(
+        fmt::format("Condition '{} != nullptr' failed.", variable_name));
+  }
+  return *ptr;
+}
+
+}  // namespace
+
+PcgSuperNodalSolver::PcgSuperNodalSolver(const std::vector<MatrixXd>* A,
+                                         const BlockSparseMatrix<double>* J,
+                                         PcgParameters parameters)
+    : A_(SafeDereference("A", A)),
+      J_(SafeDereference("J", J)),
+      parameters_(parameters) {
+  DRAKE_THROW_UNLESS(parameters_.relative_tolerance >= 0.0);
+  DRAKE_THROW_UNLESS(parameters_.max_iterations > 0);
+  DRAKE_THROW_UNLESS(ssize(A_) == J_.block_cols());
+  A_starts_.resize(A_.size());
+  int start = 0;
+  for (int i = 0; i < ssize(A_); ++i) {
+    DRAKE_THROW_UNLESS(A_[i].rows() == A_[i].cols());
+    DRAKE_THROW_UNLESS(A_[i].rows() == J_.block_col_size(i));
+    A_starts_[i] = start;
+    start += A_[i].rows();
+  }
+  P_.resize(A_.size());
+  P_llt_.resize(A_.size());
+}
+
+PcgSuperNodalSolver::~PcgSuperNodalSolver() = default;
+
+bool PcgSuperNodalSolver::DoSetWeightMatrix(
+    const std::vector<MatrixXd>& block_diagonal_G) {
+  // Find the diagonal blocks of G for each block row of J. The partition of
+  // the rows of J induced by G must refine the partition of its block rows.
+  const int num_row_blocks = J_.block_rows();
+  G_ranges_.resize(num_row_blocks);
+  int g = 0;
+  for (int r = 0; r < num_row_blocks; ++r) {
+    const int first = g;
+    int G_rows = 0;
+    while (G_rows < J_.block_row_size(r) && g < ssize(block_diagonal_G)) {
+      G_rows += block_diagonal_G[g++].rows();
+    }
+    if (G_rows != J_.block_row_size(r)) return false;
+    G_ranges_[r] = {first, g - 1};
+  }
+  if (g != ssize(block_diagonal_G)) return false;
+  G_ = block_diagonal_G;
+
+  // Diagonal blocks of H, Pᵢ = Aᵢ + ∑ⱼ Jⱼᵢᵀ⋅Gⱼ⋅Jⱼᵢ, where the sum is over the
+  // block rows j of J with a non-zero block in the i-th block column.
+  for (int i = 0; i < ssize(A_); ++i) {
+    P_[i] = A_[i];
+  }
+  for (const BlockTriplet& triplet : J_.get_blocks()) {
+    const auto [first, last] = G_ranges_[triplet.row];
+    const MatrixBlock<double> GJ =
+        triplet.value.LeftMultiplyByBlockDiagonal(G_, first, last);
+    triplet.value.TransposeAndMultiplyAndAddTo(GJ, &P_[triplet.col]);
+  }
+  return true;
+}
+
+MatrixXd PcgSuperNodalSolver::DoMakeFullMatrix() const {
+  const int nv = DoGetSize();
+  MatrixXd H(nv, nv);
+  VectorXd e = VectorXd::Zero(nv);
+  VectorXd He(nv);
+  for (int i = 0; i < nv; ++i) {
+    e(i) = 1.0;
+    MultiplyByHessian(e, &He);
+    H.col(i) = He;
+    e(i) = 0.0;
+  }
+  return H;
+}
+
+bool PcgSuperNodalSolver::DoFactor() {
+  for (int i = 0; i < ssize(P_); ++i) {
+    P_llt_[i].compute(P_[i]);
+    if (P_llt_[i].info() != Eigen::Success) return false;
+  }
+  return true;
+}
+
+void PcgSuperNodalSolver::MultiplyByHessian(const VectorXd& x,
+                                            VectorXd* y) const {
+  // y = Jᵀ⋅G⋅J⋅x.
+  VectorXd GJx(J_.rows());
+  J_.Multiply(x, &GJx);
+  int offset = 0;
+  for (const MatrixXd& Gi : G_) {
+    const int ni = Gi.rows();
+    GJx.segment(offset, ni) = Gi * GJx.segment(offset, ni);
+    offset += ni;
+  }
+  J_.MultiplyByTranspose(GJx, y);
+
+  // y += A⋅x.
+  for (int i = 0; i < ssize(A_); ++i) {
+    const int ni = A_[i].rows();
+    y->segment(A_starts_[i], ni).noalias() +=
+        A_[i] * x.segment(A_starts_[i], ni);
+  }
+}
+
+void PcgSuperNodalSolver::ApplyPreconditioner(const VectorXd& r,
+                                              VectorXd* z) const {
+  for (int i = 0; i < ssize(P_llt_); ++i) {
+    const int ni = P_[i].rows();
+    z->segment(A_starts_[i], ni) =
+        P_llt_[i].solve(r.segment(A_starts_[i], ni));
+  }
+}
+
+void PcgSuperNodalSolver::DoSolveInPlace(VectorXd* b) const {
+  // Algorithm 9.1 in [Saad, 2003], with zero initial guess.
+  const int nv = DoGetSize();
+  VectorXd& x = *b;
+  VectorXd r = *b;
+  const double tolerance = parameters_.relative_tolerance * r.norm();
+  x.setZero();
+  num_iterations_ = 0;
+  if (r.norm() <= tolerance) return;
+
+  VectorXd z(nv);
+  ApplyPreconditioner(r, &z);
+  VectorXd p = z;
+  VectorXd Hp(nv);
+  double rz = r.dot(z);
+  while (num_iterations_ < parameters_.max_iterations) {
+    MultiplyByHessian(p, &Hp);
+    const double pHp = p.dot(Hp);
+    // Only reached with round-off errors for a non-SPD H. The iterate so far
+    // is the best approximation available.
+    if (!(pHp > 0.0)) break;
+    const double alpha = rz / pHp;
+    x += alpha * p;
+    r -= alpha * Hp;
+    ++num_iterations_;
+    if (r.norm() <= tolerance) break;
+    ApplyPreconditioner(r, &z);
+    const double rz_next = r.dot(z);
+    p = z + (rz_next / rz) * p;
+    rz = rz_next;
+  }
+}
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "drake/multibody/contact_solvers/supernodal_solver.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+// Parameters of the preconditioned conjugate gradient (PCG) method used by
+// PcgSuperNodalSolver.
+struct PcgParameters {
+  // The iteration stops when the residual of H⋅x = b satisfies
+  // ‖b − H⋅x‖ ≤ relative_tolerance⋅‖b‖. For the SAP solver, values much
+  // larger than machine epsilon lead to an inexact Newton method: the search
+  // direction is approximate, though it is always a descent direction.
+  double relative_tolerance{1.0e-3};
+  // Maximum number of PCG iterations. The iteration stops with the best
+  // approximation found so far when reached.
+  int max_iterations{100};
+};
+
+// A class that implements the SuperNodalSolver interface with the
+// preconditioned conjugate gradient method [Saad, 2003], for a Hessian matrix
+// H of the form H = A + Jᵀ⋅G⋅J, where A is referred to as the dynamics
+// matrix and J is the Jacobian matrix. H is never formed, only products H⋅x
+// are computed, with cost linear in the number of non-zeros of A, J and G.
+// Therefore Factor() does not factorize H, but the block-Jacobi
+// preconditioner formed with the diagonal blocks of H, one for each block
+// column of J (for SAP, one for each clique).
+//
+// Since Solve() only approximates the solution to within the tolerances in
+// PcgParameters, this solver trades the accuracy of a direct factorization
+// for memory and speed on very large problems, for which the fill-in of
+// sparse factorizations becomes prohibitive.
+//
+// - [Saad, 2003] Saad, Y., 2003. Iterative methods for sparse linear systems.
+//   Society for Industrial and Applied Mathematics.
+class PcgSuperNodalSolver final : public SuperNodalSolver {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PcgSuperNodalSolver);
+
+  // Constructs a PCG solver for dynamics matrix A and Jacobian matrix J.
+  // This class holds references to matrices A and J, and therefore they must
+  // outlive this object.
+  // @throws std::exception if A or J is nullptr.
+  // @throws std::exception if a block in A is not square.
+  // @throws std::exception if the block columns of J do not match the blocks
+  // of A.
+  // @throws std::exception if parameters.relative_tolerance is negative or
+  // parameters.max_iterations is not positive.
+  // @pre each block in A is SPD.
+  PcgSuperNodalSolver(const std::vector<MatrixX<double>>* A,
+                      const BlockSparseMatrix<double>* J,
+                      PcgParameters parameters = {});
+
+  ~PcgSuperNodalSolver() final;
+
+  const PcgParameters& parameters() const { return parameters_; }
+
+  // Returns the number of PCG iterations performed by the last call to
+  // Solve() or SolveInPlace(), zero if none was made.
+  int num_iterations() const { return num_iterations_; }
+
+ private:
+  // Implementations of SuperNodalSolver NVIs. NVIs perform basic checks.
+  bool DoSetWeightMatrix(
+      const std::vector<Eigen::MatrixXd>& block_diagonal_G) final;
+  Eigen::MatrixXd DoMakeFullMatrix() const final;
+  bool DoFactor() final;
+  void DoSolveInPlace(Eigen::VectorXd* b) const final;
+  int DoGetSize() const final { return J_.cols(); }
+
+  // Computes y = H⋅x.
+  void MultiplyByHessian(const Eigen::VectorXd& x, Eigen::VectorXd* y) const;
+
+  // Computes z = P⁻¹⋅r, with P the block-Jacobi preconditioner.
+  void ApplyPreconditioner(const Eigen::VectorXd& r, Eigen::VectorXd* z) const;
+
+  const std::vector<MatrixX<double>>& A_;
+  const BlockSparseMatrix<double>& J_;
+  PcgParameters parameters_;
+  // The i-th entry stores the first index into the velocities of the i-th
+  // block of A, i.e. the i-th block column of J.
+  std::vector<int> A_starts_;
+  // Copy of the weight matrix G, since products with H need it after
+  // SetWeightMatrix() returns.
+  std::vector<MatrixX<double>> G_;
+  // The i-th entry stores the range [first, last] of indices into G_ for the
+  // diagonal blocks of G that correspond to the i-th block row of J.
+  std::vector<std::pair<int, int>> G_ranges_;
+  // Diagonal blocks of H, one per block column of J, and their factorizations.
+  std::vector<MatrixX<double>> P_;
+  std::vector<Eigen::LLT<MatrixX<double>>> P_llt_;
+  // N.B. Only statistics, results do not depend on it.
+  mutable int num_iterations_{0};
+};
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
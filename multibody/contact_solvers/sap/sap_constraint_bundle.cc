@@ -1,10 +1,12 @@
 #include "drake/multibody/contact_solvers/sap/sap_constraint_bundle.h"
 
+#include <type_traits>
 #include <utility>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/ssize.h"
 #include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
+#include "drake/multibody/contact_solvers/sap/sap_friction_cone_constraint.h"
 
 namespace drake {
 namespace multibody {
@@ -23,13 +25,30 @@ SapConstraintBundle<T>::SapConstraintBundle(
   // the ContactProblemGraph, where constraints between the same
   // pair of cliques are "clustered" together.
   constraints_.reserve(problem->num_constraints());
+  constraint_starts_.reserve(problem->num_constraints());
 
   // Store constraints in the order specified by the graph, i.e. by clusters.
+  int constraint_start = 0;
   for (const ContactProblemGraph::ConstraintCluster& e :
        problem->graph().clusters()) {
     for (int i : e.constraint_index()) {
       const SapConstraint<T>& c = problem->get_constraint(i);
+      const int index = constraints_.size();
+      // Friction cone constraints are batched for T = double only, since
+      // FrictionConeBatchData does not support other scalar types.
+      bool is_batched = false;
+      if constexpr (std::is_same_v<T, double>) {
+        is_batched =
+            dynamic_cast<const SapFrictionConeConstraint<T>*>(&c) != nullptr;
+      }
+      if (is_batched) {
+        friction_cones_.push_back(index);
+      } else {
+        individual_constraints_.push_back(index);
+      }
       constraints_.push_back(&c);
+      constraint_starts_.push_back(constraint_start);
+      constraint_start += c.num_constraint_equations();
     }
   }
 
@@ -114,14 +133,34 @@ SapConstraintBundleData SapConstraintBundle<T>::MakeData(
     const T& time_step, const VectorX<T>& delassus_diagonal) const {
   DRAKE_DEMAND(delassus_diagonal.size() == num_constraint_equations());
   SapConstraintBundleData data;
-  data.reserve(num_constraints());
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
+  data.constraints.reserve(individual_constraints_.size());
+  for (int i : individual_constraints_) {
     const SapConstraint<T>& c = *constraints_[i];
     const int ni = c.num_constraint_equations();
-    const auto wi = delassus_diagonal.segment(constraint_start, ni);
-    data.emplace_back(c.MakeData(time_step, wi));
-    constraint_start += ni;
+    const auto wi = delassus_diagonal.segment(constraint_starts_[i], ni);
+    data.constraints.emplace_back(c.MakeData(time_step, wi));
+  }
+  if constexpr (std::is_same_v<T, double>) {
+    // Copy the parameters computed by each constraint into the batch.
+    FrictionConeBatchData& cones = data.friction_cones;
+    cones.Resize(friction_cones_.size());
+    for (int k = 0; k < ssize(friction_cones_); ++k) {
+      const int i = friction_cones_[k];
+      const auto wi = delassus_diagonal.segment(constraint_starts_[i], 3);
+      const std::unique_ptr<AbstractValue> abstract_data =
+          constraints_[i]->MakeData(time_step, wi);
+      const auto& cone_data =
+          abstract_data->get_value<SapFrictionConeConstraintData<T>>();
+      cones.mu[k] = cone_data.mu();
+      cones.mu_hat[k] = cone_data.mu_hat();
+      cones.sliding_factor[k] =
+          1.0 / (1.0 + cone_data.mu_tilde() * cone_data.mu_tilde());
+      cones.Rt[k] = cone_data.Rt();
+      cones.Rn[k] = cone_data.Rn();
+      cones.Rt_inv[k] = cone_data.R_inv()(0);
+      cones.Rn_inv[k] = cone_data.R_inv()(2);
+      cones.vn_hat[k] = cone_data.v_hat()(2);
+    }
   }
   return data;
 }
@@ -130,45 +169,69 @@ template <typename T>
 void SapConstraintBundle<T>::CalcData(
     const VectorX<T>& vc, SapConstraintBundleData* bundle_data) const {
   DRAKE_DEMAND(bundle_data != nullptr);
-  DRAKE_DEMAND(ssize(*bundle_data) == num_constraints());
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
+  DRAKE_DEMAND(ssize(bundle_data->constraints) ==
+               ssize(individual_constraints_));
+  for (int k = 0; k < ssize(individual_constraints_); ++k) {
+    const int i = individual_constraints_[k];
     const SapConstraint<T>& c = *constraints_[i];
     const int ni = c.num_constraint_equations();
-    const auto vc_i = vc.segment(constraint_start, ni);
-    AbstractValue& data = *(*bundle_data)[i];
+    const auto vc_i = vc.segment(constraint_starts_[i], ni);
+    AbstractValue& data = *bundle_data->constraints[k];
     c.CalcData(vc_i, &data);
-    constraint_start += ni;
+  }
+  if constexpr (std::is_same_v<T, double>) {
+    FrictionConeBatchData& cones = bundle_data->friction_cones;
+    DRAKE_DEMAND(cones.size() == ssize(friction_cones_));
+    for (int k = 0; k < ssize(friction_cones_); ++k) {
+      const int start = constraint_starts_[friction_cones_[k]];
+      cones.vc_x[k] = vc[start];
+      cones.vc_y[k] = vc[start + 1];
+      cones.vc_z[k] = vc[start + 2];
+    }
+    CalcFrictionConeImpulses(&cones);
   }
 }
 
 template <typename T>
 T SapConstraintBundle<T>::CalcCost(
     const SapConstraintBundleData& bundle_data) const {
-  DRAKE_DEMAND(ssize(bundle_data) == num_constraints());
+  DRAKE_DEMAND(ssize(bundle_data.constraints) ==
+               ssize(individual_constraints_));
   T cost = 0.0;
-  for (int i = 0; i < num_constraints(); ++i) {
-    const SapConstraint<T>& c = *constraints_[i];
-    const AbstractValue& data = *bundle_data[i];
+  for (int k = 0; k < ssize(individual_constraints_); ++k) {
+    const SapConstraint<T>& c = *constraints_[individual_constraints_[k]];
+    const AbstractValue& data = *bundle_data.constraints[k];
     cost += c.CalcCost(data);
   }
+  if constexpr (std::is_same_v<T, double>) {
+    cost += CalcFrictionConeCost(bundle_data.friction_cones);
+  }
   return cost;
 }
 
 template <typename T>
 void SapConstraintBundle<T>::CalcImpulses(
     const SapConstraintBundleData& bundle_data, VectorX<T>* gamma) const {
-  DRAKE_DEMAND(ssize(bundle_data) == num_constraints());
+  DRAKE_DEMAND(ssize(bundle_data.constraints) ==
+               ssize(individual_constraints_));
   DRAKE_DEMAND(gamma != nullptr);
   DRAKE_DEMAND(gamma->size() == num_constraint_equations());
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
+  for (int k = 0; k < ssize(individual_constraints_); ++k) {
+    const int i = individual_constraints_[k];
     const SapConstraint<T>& c = *constraints_[i];
     const int ni = c.num_constraint_equations();
-    const AbstractValue& data = *bundle_data[i];
-    auto gamma_i = gamma->segment(constraint_start, ni);
+    const AbstractValue& data = *bundle_data.constraints[k];
+    auto gamma_i = gamma->segment(constraint_starts_[i], ni);
     c.CalcImpulse(data, &gamma_i);
-    constraint_start += ni;
+  }
+  if constexpr (std::is_same_v<T, double>) {
+    const FrictionConeBatchData& cones = bundle_data.friction_cones;
+    for (int k = 0; k < ssize(friction_cones_); ++k) {
+      const int start = constraint_starts_[friction_cones_[k]];
+      (*gamma)[start] = cones.gamma_x[k];
+      (*gamma)[start + 1] = cones.gamma_y[k];
+      (*gamma)[start + 2] = cones.gamma_z[k];
+    }
   }
 }
 
@@ -176,22 +239,20 @@ template <typename T>
 void SapConstraintBundle<T>::CalcImpulsesAndConstraintsHessian(
     const SapConstraintBundleData& bundle_data, VectorX<T>* gamma,
     std::vector<MatrixX<T>>* G) const {
-  DRAKE_DEMAND(ssize(bundle_data) == num_constraints());
-  DRAKE_DEMAND(gamma != nullptr);
-  DRAKE_DEMAND(gamma->size() == num_constraint_equations());
   DRAKE_DEMAND(ssize(*G) == num_constraints());
 
   // The regularizer Hessian is G = d²ℓ/dvc² = dP/dy⋅R⁻¹.
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
-    const SapConstraint<T>& c = *constraints_[i];
-    const int ni = c.num_constraint_equations();
-    const AbstractValue& data = *bundle_data[i];
-    auto gamma_i = gamma->segment(constraint_start, ni);
-    auto& Gi = (*G)[i];
-    c.CalcImpulse(data, &gamma_i);
-    c.CalcCostHessian(data, &Gi);
-    constraint_start += ni;
+  CalcImpulses(bundle_data, gamma);
+  for (int k = 0; k < ssize(individual_constraints_); ++k) {
+    const SapConstraint<T>& c = *constraints_[individual_constraints_[k]];
+    const AbstractValue& data = *bundle_data.constraints[k];
+    c.CalcCostHessian(data, &(*G)[individual_constraints_[k]]);
+  }
+  if constexpr (std::is_same_v<T, double>) {
+    for (int k = 0; k < ssize(friction_cones_); ++k) {
+      CalcFrictionConeHessian(bundle_data.friction_cones, k,
+                              &(*G)[friction_cones_[k]]);
+    }
   }
 }
 
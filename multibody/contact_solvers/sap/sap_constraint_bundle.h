@@ -6,6 +6,7 @@
 #include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/multibody/contact_solvers/block_sparse_matrix.h"
+#include "drake/multibody/contact_solvers/sap/friction_cone_batch.h"
 #include "drake/multibody/contact_solvers/sap/partial_permutation.h"
 #include "drake/multibody/contact_solvers/sap/sap_constraint.h"
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
@@ -15,7 +16,15 @@ namespace multibody {
 namespace contact_solvers {
 namespace internal {
 
-using SapConstraintBundleData = std::vector<std::unique_ptr<AbstractValue>>;
+/* Data used by SapConstraintBundle to store the state of its constraints. */
+struct SapConstraintBundleData {
+  /* Data for the constraints evaluated individually through the SapConstraint
+   interface, in the order they appear in the bundle. */
+  std::vector<std::unique_ptr<AbstractValue>> constraints;
+  /* Data for the friction cone constraints, which for T = double are evaluated
+   as a batch, see FrictionConeBatchData. Empty for other scalar types. */
+  FrictionConeBatchData friction_cones;
+};
 
 /* Given a contact problem, this class provides a representation for the entire
  "bundle" of constraints in the problem. This class re-arranges constraints
@@ -24,6 +33,11 @@ using SapConstraintBundleData = std::vector<std::unique_ptr<AbstractValue>>;
  abstraction, SAP is agnostic to the specific type of constraints in the
  problem, but it only operates on the bundle as a whole.
 
+ Since they are typically the vast majority of constraints, for T = double
+ friction cone constraints (SapFrictionConeConstraint) are not evaluated
+ individually, but as a single batch with SIMD instructions, see
+ FrictionConeBatchData. Results are the same up to round-off errors.
+
  More specifically, the i-th SAP constraint is defined by:
    1. A Jacobian mapping generalized velocities v to constraint velocities vᵢ,
       i.e. vᵢ = Jᵢ⋅v.
@@ -131,6 +145,15 @@ class SapConstraintBundle {
   BlockSparseMatrix<T> J_;
   // Constraint references in the order dictated by the ContactProblemGraph.
   std::vector<const SapConstraint<T>*> constraints_;
+  // The i-th entry stores the index of the first constraint equation of the
+  // i-th constraint in constraints_.
+  std::vector<int> constraint_starts_;
+  // Indices into constraints_ of the constraints evaluated individually, with
+  // data in SapConstraintBundleData::constraints.
+  std::vector<int> individual_constraints_;
+  // Indices into constraints_ of the friction cone constraints, with data in
+  // SapConstraintBundleData::friction_cones. Always empty for T != double.
+  std::vector<int> friction_cones_;
 };
 
 }  // namespace internal
@@ -1,5 +1,7 @@
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
 
+#include <algorithm>
+#include <numeric>
 #include <utility>
 
 #include "drake/common/default_scalars.h"
@@ -37,6 +39,42 @@ SapContactProblem<T>::SapContactProblem(const T& time_step,
   DRAKE_THROW_UNLESS(v_star_.size() == nv_);
 }
 
+template <typename T>
+void SapContactProblem<T>::Reset(const T& time_step,
+                                 const std::vector<MatrixX<T>>& A,
+                                 const VectorX<T>& v_star) {
+  DRAKE_THROW_UNLESS(time_step > 0.0);
+  int nv = 0;
+  for (const MatrixX<T>& Ac : A) {
+    DRAKE_THROW_UNLESS(Ac.rows() == Ac.cols());
+    nv += Ac.rows();
+  }
+  DRAKE_THROW_UNLESS(v_star.size() == nv);
+
+  // Constraints are removed first, since their Jacobians are only consistent
+  // with the cliques being replaced.
+  constraints_.clear();
+  constraint_equations_start_.resize(1);
+  // The graph only allocates when it has constraints or its size changes.
+  if (graph_.num_cliques() != ssize(A) || graph_.num_constraints() > 0) {
+    graph_.ResetNumCliques(ssize(A));
+  }
+
+  time_step_ = time_step;
+  num_objects_ = 0;
+  nv_ = nv;
+  // Assignment to matrices of the same size reuses their storage.
+  A_.resize(A.size());
+  velocities_start_.resize(A.size());
+  int velocities_start = 0;
+  for (int i = 0; i < ssize(A); ++i) {
+    A_[i] = A[i];
+    velocities_start_[i] = velocities_start;
+    velocities_start += A[i].rows();
+  }
+  v_star_ = v_star;
+}
+
 template <typename T>
 void SapContactProblem<T>::set_num_objects(int num_objects) {
   DRAKE_THROW_UNLESS(num_constraints() == 0);
@@ -213,6 +251,118 @@ void SapContactProblem<T>::ExpandContactSolverResults(
       reduced_results.vc, &results->vc);
 }
 
+template <typename T>
+std::vector<std::unique_ptr<SapContactProblem<T>>>
+SapContactProblem<T>::MakeIslands(std::vector<ReducedMapping>* mappings) const {
+  DRAKE_THROW_UNLESS(mappings != nullptr);
+
+  // Find the connected components of the graph with union-find. Since the
+  // root of a merged component is always the smallest of the two roots, each
+  // component ends up represented by its smallest clique.
+  std::vector<int> root(num_cliques());
+  std::iota(root.begin(), root.end(), 0);
+  const auto find_root = [&root](int c) {
+    while (root[c] != c) {
+      root[c] = root[root[c]];  // Path halving.
+      c = root[c];
+    }
+    return c;
+  };
+  std::vector<bool> participates(num_cliques(), false);
+  for (const auto& cluster : graph_.clusters()) {
+    const int first = cluster.cliques().first();
+    const int second = cluster.cliques().second();
+    participates[first] = true;
+    participates[second] = true;
+    const int first_root = find_root(first);
+    const int second_root = find_root(second);
+    root[std::max(first_root, second_root)] =
+        std::min(first_root, second_root);
+  }
+
+  // Number islands in the order of their smallest clique. The root of a
+  // clique is never larger than the clique itself and therefore it is always
+  // assigned an island first.
+  std::vector<int> clique_island(num_cliques(), -1);
+  int num_islands = 0;
+  for (int c = 0; c < num_cliques(); ++c) {
+    if (!participates[c]) continue;
+    const int r = find_root(c);
+    clique_island[c] = r == c ? num_islands++ : clique_island[r];
+  }
+
+  const ReducedMapping empty_mapping{
+      PartialPermutation(num_velocities()), PartialPermutation(num_cliques()),
+      PartialPermutation(num_constraint_equations())};
+  mappings->assign(num_islands, empty_mapping);
+  std::vector<std::vector<MatrixX<T>>> island_A(num_islands);
+  for (int c = 0; c < num_cliques(); ++c) {
+    const int island = clique_island[c];
+    if (island < 0) continue;
+    ReducedMapping& mapping = (*mappings)[island];
+    mapping.clique_permutation.push(c);
+    for (int k = 0; k < num_velocities(c); ++k) {
+      mapping.velocity_permutation.push(velocities_start(c) + k);
+    }
+    island_A[island].push_back(A_[c]);
+  }
+
+  std::vector<std::unique_ptr<SapContactProblem<T>>> islands;
+  islands.reserve(num_islands);
+  for (int i = 0; i < num_islands; ++i) {
+    const PartialPermutation& velocity_permutation =
+        (*mappings)[i].velocity_permutation;
+    VectorX<T> v_star(velocity_permutation.permuted_domain_size());
+    velocity_permutation.Apply(v_star_, &v_star);
+    islands.push_back(std::make_unique<SapContactProblem<T>>(
+        time_step(), std::move(island_A[i]), std::move(v_star)));
+    islands.back()->set_num_objects(num_objects());
+  }
+
+  // Since none of the cliques has known DoFs, MakeReduced() simply re-indexes
+  // the cliques of each constraint into its island.
+  const std::vector<std::vector<int>> no_known_dofs;
+  for (int k = 0; k < num_constraints(); ++k) {
+    const SapConstraint<T>& c = get_constraint(k);
+    const int island = clique_island[c.first_clique()];
+    ReducedMapping& mapping = (*mappings)[island];
+    islands[island]->AddConstraint(
+        c.MakeReduced(mapping.clique_permutation, no_known_dofs));
+    for (int e = 0; e < c.num_constraint_equations(); ++e) {
+      mapping.constraint_equation_permutation.push(
+          constraint_equations_start(k) + e);
+    }
+  }
+
+  return islands;
+}
+
+template <typename T>
+void SapContactProblem<T>::ExpandIslandResults(
+    const std::vector<ReducedMapping>& mappings,
+    const std::vector<SapSolverResults<T>>& island_results,
+    SapSolverResults<T>* results) const {
+  DRAKE_THROW_UNLESS(island_results.size() == mappings.size());
+  DRAKE_THROW_UNLESS(results != nullptr);
+
+  // Every constraint belongs to an island and therefore gamma and vc are
+  // fully overwritten below. Velocities not in any island equal v*.
+  results->Resize(num_velocities(), num_constraint_equations());
+  results->v = v_star();
+  results->j.setZero();
+
+  for (int i = 0; i < ssize(mappings); ++i) {
+    const ReducedMapping& mapping = mappings[i];
+    const SapSolverResults<T>& island = island_results[i];
+    mapping.velocity_permutation.ApplyInverse(island.v, &results->v);
+    mapping.velocity_permutation.ApplyInverse(island.j, &results->j);
+    mapping.constraint_equation_permutation.ApplyInverse(island.gamma,
+                                                         &results->gamma);
+    mapping.constraint_equation_permutation.ApplyInverse(island.vc,
+                                                         &results->vc);
+  }
+}
+
 template <typename T>
 int SapContactProblem<T>::AddConstraint(std::unique_ptr<SapConstraint<T>> c) {
   if (c->first_clique() >= num_cliques()) {
@@ -91,6 +91,24 @@ class SapContactProblem {
   SapContactProblem(const T& time_step, std::vector<MatrixX<T>> A,
                     VectorX<T> v_star);
 
+  /* Resets `this` problem to the state of a newly constructed problem with the
+   given `time_step`, linear dynamics matrix `A` and free motion velocities
+   `v_star`, see the constructor for details. All constraints are removed and
+   num_objects() is reset to zero.
+
+   Unlike constructing a new problem, storage is reused. Therefore, when a
+   problem is reset with the same clique sizes as those it already stores and
+   it has no constraints, this call does not allocate. This allows drivers to
+   keep a single problem alive across time steps. Constraints added after the
+   reset are still allocated by the caller; only constraint-free problems are
+   rebuilt without touching the heap.
+
+   @throws exception if time_step is not strictly positive.
+   @throws exception if the blocks in A are not square.
+   @throws exception if the size of v_star is not nv = ∑A[c].rows(). */
+  void Reset(const T& time_step, const std::vector<MatrixX<T>>& A,
+             const VectorX<T>& v_star);
+
   /* Returns a deep-copy of `this` instance. */
   std::unique_ptr<SapContactProblem<T>> Clone() const;
 
@@ -171,6 +189,42 @@ class SapContactProblem {
                                   const SapSolverResults<T>& reduced_results,
                                   SapSolverResults<T>* results) const;
 
+  /* Splits this problem into "islands", one independent problem for each
+    connected component of graph(), with cliques as nodes and constraint
+    clusters as edges. Since there are no constraints coupling different
+    islands, each island can be solved on its own (and concurrently with the
+    others), and the results combined with ExpandIslandResults() are the
+    solution to this problem. Solving islands separately also allows each of
+    them to converge at its own rate.
+
+    Cliques not referenced by any constraint do not belong to any island,
+    since their velocities trivially equal v*. Islands are sorted by their
+    smallest clique index, and within each island cliques and constraints
+    keep the relative order they have in this problem.
+
+    @param[out] mappings On output, mappings->at(i) stores the mapping between
+      this problem and the i-th island, with the same semantics as the mapping
+      returned by MakeReduced().
+    @returns the islands, of size mappings->size().
+    @throws std::exception if mappings is nullptr. */
+  std::vector<std::unique_ptr<SapContactProblem<T>>> MakeIslands(
+      std::vector<ReducedMapping>* mappings) const;
+
+  /* Combines the solver results for each of the islands obtained with
+    MakeIslands() into solver results for this problem. Velocities for cliques
+    not in any island are set to v*, with zero generalized impulses.
+
+    @param[in] mappings The mappings returned by MakeIslands().
+    @param[in] island_results island_results[i] stores the solver results for
+      the i-th island.
+    @param[out] results On output, the solver results for this problem.
+    @throws std::exception if island_results.size() != mappings.size().
+    @throws std::exception if results is nullptr. */
+  void ExpandIslandResults(
+      const std::vector<ReducedMapping>& mappings,
+      const std::vector<SapSolverResults<T>>& island_results,
+      SapSolverResults<T>* results) const;
+
   /* TODO(amcastro-tri): consider constructor API taking std::vector<VectorX<T>>
    for v_star. It could be useful for deformables. */
 
@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
 #include "drake/math/linear_solve.h"
 #include "drake/multibody/contact_solvers/block_sparse_matrix.h"
 #include "drake/multibody/contact_solvers/block_sparse_supernodal_solver.h"
@@ -18,24 +19,42 @@ namespace internal {
 
 using systems::Context;
 
-HessianFactorizationCache::HessianFactorizationCache(
+namespace {
+
+// Makes a new factorization of the given type for H = A + Jᵀ⋅G⋅J. This can be
+// expensive for sparse factorizations, since it performs the symbolic
+// analysis.
+std::unique_ptr<SuperNodalSolver> MakeSuperNodalSolver(
     SapHessianFactorizationType type, const std::vector<MatrixX<double>>* A,
-    const BlockSparseMatrix<double>* J) {
+    const BlockSparseMatrix<double>* J, const PcgParameters& pcg_parameters) {
   DRAKE_DEMAND(A != nullptr);
   DRAKE_DEMAND(J != nullptr);
   switch (type) {
     case SapHessianFactorizationType::kConex:
-      factorization_ = std::make_unique<ConexSuperNodalSolver>(
-          J->block_rows(), J->get_blocks(), *A);
-      break;
+      return std::make_unique<ConexSuperNodalSolver>(J->block_rows(),
+                                                     J->get_blocks(), *A);
     case SapHessianFactorizationType::kBlockSparseCholesky:
-      factorization_ = std::make_unique<BlockSparseSuperNodalSolver>(
+      return std::make_unique<BlockSparseSuperNodalSolver>(
           J->block_rows(), J->get_blocks(), *A);
-      break;
     case SapHessianFactorizationType::kDense:
-      factorization_ = std::make_unique<DenseSuperNodalSolver>(A, J);
-      break;
+      return std::make_unique<DenseSuperNodalSolver>(A, J);
+    case SapHessianFactorizationType::kPreconditionedConjugateGradient:
+      return std::make_unique<PcgSuperNodalSolver>(A, J, pcg_parameters);
   }
+  DRAKE_UNREACHABLE();
+}
+
+}  // namespace
+
+HessianFactorizationCache::HessianFactorizationCache(
+    SapHessianFactorizationType type, const std::vector<MatrixX<double>>* A,
+    const BlockSparseMatrix<double>* J, const PcgParameters& pcg_parameters)
+    : factorization_(MakeSuperNodalSolver(type, A, J, pcg_parameters)) {}
+
+HessianFactorizationCache::HessianFactorizationCache(
+    std::shared_ptr<SuperNodalSolver> factorization)
+    : factorization_(std::move(factorization)) {
+  DRAKE_DEMAND(factorization_ != nullptr);
 }
 
 std::unique_ptr<HessianFactorizationCache> HessianFactorizationCache::Clone()
@@ -68,10 +87,37 @@ void HessianFactorizationCache::SolveInPlace(
   }
 }
 
+std::shared_ptr<SuperNodalSolver> PersistentHessianFactorization::MakeOrReuse(
+    SapHessianFactorizationType type, const std::vector<MatrixX<double>>* A,
+    const BlockSparseMatrix<double>* J) {
+  DRAKE_DEMAND(A != nullptr);
+  DRAKE_DEMAND(J != nullptr);
+  // N.B. UpdateMatrices() only succeeds for factorizations that copy A and J.
+  // Therefore a reused factorization never references the A and J of a
+  // previous model.
+  if (factorization_ != nullptr && type == type_ &&
+      factorization_->UpdateMatrices(J->block_rows(), J->get_blocks(), *A)) {
+    ++num_symbolic_factorization_reuses_;
+    factorization_->SetParallelism(parallelism_);
+    return factorization_;
+  }
+  // Release the previous factorization before making the new one, to keep
+  // peak memory low.
+  factorization_.reset();
+  factorization_ = MakeSuperNodalSolver(type, A, J, pcg_parameters_);
+  factorization_->SetParallelism(parallelism_);
+  type_ = type;
+  ++num_symbolic_factorizations_;
+  return factorization_;
+}
+
 template <typename T>
 SapModel<T>::SapModel(const SapContactProblem<T>* problem_ptr,
-                      SapHessianFactorizationType hessian_type)
-    : problem_(problem_ptr), hessian_type_(hessian_type) {
+                      SapHessianFactorizationType hessian_type,
+                      PersistentHessianFactorization* persistent_hessian)
+    : problem_(problem_ptr),
+      hessian_type_(hessian_type),
+      persistent_hessian_(persistent_hessian) {
   // Graph to the original contact problem, including all cliques
   // (participating and non-participating).
   const ContactProblemGraph& graph = problem().graph();
@@ -335,8 +381,13 @@ void SapModel<double>::CalcHessianFactorizationCache(
   // Make only for the very first time. This can be an expensive computation for
   // sparse Hessians even when the factorization is not yet computed.
   if (hessian->is_empty()) {
-    *hessian = HessianFactorizationCache(hessian_type_, &dynamics_matrix(),
-                                         &constraints_bundle().J());
+    if (persistent_hessian_ != nullptr) {
+      *hessian = HessianFactorizationCache(persistent_hessian_->MakeOrReuse(
+          hessian_type_, &dynamics_matrix(), &constraints_bundle().J()));
+    } else {
+      *hessian = HessianFactorizationCache(hessian_type_, &dynamics_matrix(),
+                                           &constraints_bundle().J());
+    }
   }
   const std::vector<MatrixX<double>>& G = EvalConstraintsHessian(context);
   hessian->UpdateWeightMatrixAndFactor(G);
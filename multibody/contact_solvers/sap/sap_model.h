@@ -4,7 +4,9 @@
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/sap/partial_permutation.h"
+#include "drake/multibody/contact_solvers/sap/pcg_supernodal_solver.h"
 #include "drake/multibody/contact_solvers/sap/sap_constraint_bundle.h"
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
 #include "drake/multibody/contact_solvers/supernodal_solver.h"
@@ -28,6 +30,12 @@ enum class SapHessianFactorizationType {
   kBlockSparseCholesky,
   // Dense algebra. Typically used for testing.
   kDense,
+  // Matrix-free preconditioned conjugate gradient with a block-Jacobi
+  // preconditioner over cliques, implemented by PcgSuperNodalSolver. Search
+  // directions are only approximate, leading to an inexact Newton method.
+  // Intended for very large problems for which the fill-in of a direct
+  // factorization becomes prohibitive.
+  kPreconditionedConjugateGradient,
 };
 
 // N.B. Ideally we'd like to nest the caching structs below into SapModel.
@@ -54,10 +62,11 @@ struct SapConstraintBundleDataCache {
   // Returns a deep-copy of `this` cache data.
   std::unique_ptr<SapConstraintBundleDataCache> Clone() const {
     auto clone = std::make_unique<SapConstraintBundleDataCache>();
-    clone->bundle_data.reserve(bundle_data.size());
-    for (const auto& data : bundle_data) {
-      clone->bundle_data.emplace_back(data->Clone());
+    clone->bundle_data.constraints.reserve(bundle_data.constraints.size());
+    for (const auto& data : bundle_data.constraints) {
+      clone->bundle_data.constraints.emplace_back(data->Clone());
     }
+    clone->bundle_data.friction_cones = bundle_data.friction_cones;
     return clone;
   }
 };
@@ -134,6 +143,13 @@ class HessianFactorizationCache {
   // After instantiations with this constructor is_empty() is `true`.
   HessianFactorizationCache() = default;
 
+  // Constructor for a cache entry that stores an already existing
+  // factorization, typically provided by a PersistentHessianFactorization.
+  // @note is_empty() will be `false` after construction with this constructor.
+  // @pre factorization is not nullptr.
+  explicit HessianFactorizationCache(
+      std::shared_ptr<SuperNodalSolver> factorization);
+
   // Constructor for a cache entry that stores the factorization of a SAP
   // Hessian.
   // This class can hold references to A and J and therefore they must outlive
@@ -144,10 +160,14 @@ class HessianFactorizationCache {
   // @warning This is a potentially expensive constructor, performing the
   // necessary symbolic analysis for the case of sparse factorizations.
   //
+  // Only when type is kPreconditionedConjugateGradient, pcg_parameters
+  // specifies the parameters of the iterative solver.
+  //
   // @pre A and J are not nullptr.
   HessianFactorizationCache(SapHessianFactorizationType type,
                             const std::vector<MatrixX<double>>* A,
-                            const BlockSparseMatrix<double>* J);
+                            const BlockSparseMatrix<double>* J,
+                            const PcgParameters& pcg_parameters = {});
 
   // @returns `true` if `this` factorization was never provided with a type and
   // matrices A and J.
@@ -181,7 +201,72 @@ class HessianFactorizationCache {
   std::unique_ptr<HessianFactorizationCache> Clone() const;
 
  private:
-  std::unique_ptr<SuperNodalSolver> factorization_;
+  // N.B. Shared with a PersistentHessianFactorization, if any, so that the
+  // factorization can outlive the SapModel that uses it.
+  std::shared_ptr<SuperNodalSolver> factorization_;
+};
+
+// Keeps the Hessian factorization used by a SapModel alive beyond the lifetime
+// of the model, so that the model of a subsequent problem with the same
+// sparsity pattern can reuse its symbolic analysis (elimination ordering and
+// supernodes) and only perform the numerical factorization. This is typically
+// the case for consecutive time steps that share the same contact graph. See
+// SapModel's constructor.
+//
+// This class is not thread safe. Its factorization is shared with the context
+// of the last SapModel that used it, and therefore it must not be used by
+// another model while that context is in use.
+class PersistentHessianFactorization {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PersistentHessianFactorization);
+
+  PersistentHessianFactorization() = default;
+
+  // Returns a factorization of the given `type` for the Hessian
+  // H = A + Jᵀ⋅G⋅J. When the previously returned factorization has the same
+  // type and the sparsity pattern of A and J is unchanged, it is updated with
+  // the new values of A and J and returned, see
+  // SuperNodalSolver::UpdateMatrices(). Otherwise a new factorization is made,
+  // performing the symbolic analysis.
+  //
+  // Since the returned factorization can hold references to A and J, they
+  // must outlive any use of it.
+  //
+  // @pre A and J are not nullptr.
+  std::shared_ptr<SuperNodalSolver> MakeOrReuse(
+      SapHessianFactorizationType type, const std::vector<MatrixX<double>>* A,
+      const BlockSparseMatrix<double>* J);
+
+  // Sets the degree of parallelism of the factorizations returned by
+  // MakeOrReuse(), see SuperNodalSolver::SetParallelism().
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  // Sets the parameters of the factorizations of type
+  // kPreconditionedConjugateGradient returned by MakeOrReuse().
+  void set_pcg_parameters(const PcgParameters& pcg_parameters) {
+    pcg_parameters_ = pcg_parameters;
+  }
+
+  // Returns the number of calls to MakeOrReuse() that had to make a new
+  // factorization, performing its symbolic analysis.
+  int num_symbolic_factorizations() const {
+    return num_symbolic_factorizations_;
+  }
+
+  // Returns the number of calls to MakeOrReuse() that reused the symbolic
+  // analysis of the previous factorization.
+  int num_symbolic_factorization_reuses() const {
+    return num_symbolic_factorization_reuses_;
+  }
+
+ private:
+  SapHessianFactorizationType type_{
+      SapHessianFactorizationType::kBlockSparseCholesky};
+  std::shared_ptr<SuperNodalSolver> factorization_;
+  Parallelism parallelism_{Parallelism::None()};
+  PcgParameters pcg_parameters_;
+  int num_symbolic_factorizations_{0};
+  int num_symbolic_factorization_reuses_{0};
 };
 
 /* This class represents the underlying computational model built by the SAP
@@ -218,10 +303,17 @@ class SapModel {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SapModel);
 
   /* Constructs a model of `problem` optimized to be used by the SAP solver.
-   The input `problem` must outlive `this` model. */
+   The input `problem` must outlive `this` model.
+   When `persistent_hessian` is not nullptr, the Hessian factorization is
+   obtained from it so that a symbolic analysis performed for a previous model
+   can be reused, see PersistentHessianFactorization. In that case
+   `persistent_hessian` must outlive `this` model and only one context of this
+   model is allowed to evaluate the Hessian factorization. */
   explicit SapModel(const SapContactProblem<T>* problem,
                     SapHessianFactorizationType hessian_type =
-                        SapHessianFactorizationType::kBlockSparseCholesky);
+                        SapHessianFactorizationType::kBlockSparseCholesky,
+                    PersistentHessianFactorization* persistent_hessian =
+                        nullptr);
 
   /* Returns a reference to the contact problem being modeled by this class. */
   const SapContactProblem<T>& problem() const {
@@ -581,6 +673,7 @@ class SapModel {
   const SapContactProblem<T>* problem_{nullptr};
   SapHessianFactorizationType hessian_type_{
       SapHessianFactorizationType::kBlockSparseCholesky};
+  PersistentHessianFactorization* persistent_hessian_{nullptr};
 
   /* TODO(amcastro-tri): Data below is heap allocated once per time step.
    Consider how to pre-allocate once to minimize heap allocation.
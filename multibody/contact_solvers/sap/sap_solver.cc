@@ -110,12 +110,18 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
     results->j.setZero();
     return SapSolverStatus::kSuccess;
   }
+  persistent_hessian_.set_parallelism(parameters_.linear_solver_parallelism);
+  persistent_hessian_.set_pcg_parameters(parameters_.conjugate_gradient);
   auto model = std::make_unique<SapModel<double>>(
-      &problem, parameters_.linear_solver_type);
+      &problem, parameters_.linear_solver_type, &persistent_hessian_);
   auto context = model->MakeContext();
   // Initialize context with v_guess.
   SetProblemVelocitiesIntoModelContext(*model, v_guess, context.get());
   const SapSolverStatus status = SolveWithGuessImpl(*model, context.get());
+  stats_.num_symbolic_factorizations =
+      persistent_hessian_.num_symbolic_factorizations();
+  stats_.num_symbolic_factorization_reuses =
+      persistent_hessian_.num_symbolic_factorization_reuses();
   if (status != SapSolverStatus::kSuccess) return status;
   PackSapSolverResults(*model, *context, results);
   return status;
@@ -153,16 +159,26 @@ SapSolverStatus SapSolver<AutoDiffXd>::SolveWithGuess(
 
   DRAKE_DEMAND(v_guess_ad.size() == problem_ad.num_velocities());
 
+  // Gradients are propagated with the factorization of the Hessian at the
+  // solution, which must therefore be exact.
+  const SapHessianFactorizationType linear_solver_type =
+      parameters_.linear_solver_type ==
+              SapHessianFactorizationType::kPreconditionedConjugateGradient
+          ? SapHessianFactorizationType::kBlockSparseCholesky
+          : parameters_.linear_solver_type;
+
   // Create a <double> version of the problem and its model.
   std::unique_ptr<SapContactProblem<double>> problem = problem_ad.ToDouble();
-  auto model = std::make_unique<SapModel<double>>(
-      problem.get(), parameters_.linear_solver_type);
+  auto model =
+      std::make_unique<SapModel<double>>(problem.get(), linear_solver_type);
   auto context = model->MakeContext();
   const VectorX<double> v_guess = math::DiscardGradient(v_guess_ad);
 
   // Solve problem with T = double.
   SapSolver<double> sap;
-  sap.set_parameters(parameters_);
+  SapSolverParameters parameters = parameters_;
+  parameters.linear_solver_type = linear_solver_type;
+  sap.set_parameters(parameters);
   sap.SetProblemVelocitiesIntoModelContext(*model, v_guess, context.get());
   const SapSolverStatus status = sap.SolveWithGuessImpl(*model, context.get());
   stats_ = sap.get_statistics();  // Report the <double> solver stats.
@@ -177,8 +193,8 @@ SapSolverStatus SapSolver<AutoDiffXd>::SolveWithGuess(
   // keeping velocities v constant. Therefore AutoDiffXd below is setup with no
   // gradients in v. Gradients in θ are implicitly defined through the input
   // data in problem_ad.
-  auto model_ad = std::make_unique<SapModel<AutoDiffXd>>(
-      &problem_ad, parameters_.linear_solver_type);
+  auto model_ad =
+      std::make_unique<SapModel<AutoDiffXd>>(&problem_ad, linear_solver_type);
   auto context_ad = model_ad->MakeContext();
   model_ad->GetMutableVelocities(context_ad.get()) =
       v_model;  // no gradients in v, only in θ.
@@ -699,6 +715,13 @@ void SapSolver<T>::CalcSearchDirectionData(
   const HessianFactorizationCache& hessian_factorization =
       model.EvalHessianFactorizationCache(context);
   hessian_factorization.SolveInPlace(&data->dv);
+  if (model.hessian_type() ==
+      SapHessianFactorizationType::kPreconditionedConjugateGradient) {
+    const auto* pcg = dynamic_cast<const PcgSuperNodalSolver*>(
+        hessian_factorization.factorization());
+    DRAKE_DEMAND(pcg != nullptr);
+    stats_.num_conjugate_gradient_iters += pcg->num_iterations();
+  }
 
   // Update Δp, Δvc and d²ellA/dα².
   model.constraints_bundle().J().Multiply(data->dv, &data->dvc);
@@ -6,7 +6,9 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/conex_supernodal_solver.h"
+#include "drake/multibody/contact_solvers/sap/pcg_supernodal_solver.h"
 #include "drake/multibody/contact_solvers/sap/sap_model.h"
 #include "drake/multibody/contact_solvers/sap/sap_solver_results.h"
 #include "drake/systems/framework/context.h"
@@ -164,8 +166,20 @@ struct SapSolverParameters {
   // documentation on `relative_slop`.
   bool nonmonotonic_convergence_is_error{false};
 
+  // For T = AutoDiffXd, kPreconditionedConjugateGradient is replaced with
+  // kBlockSparseCholesky, since the propagation of gradients requires exact
+  // solutions with the Hessian.
   SapHessianFactorizationType linear_solver_type{
       SapHessianFactorizationType::kBlockSparseCholesky};
+
+  // Parameters of the iterative linear solver used to compute search
+  // directions when linear_solver_type is kPreconditionedConjugateGradient.
+  PcgParameters conjugate_gradient;
+
+  // Degree of parallelism used to factorize the Hessian and solve with it,
+  // see SuperNodalSolver::SetParallelism(). Results do not depend on this
+  // value. Only used for T = double.
+  Parallelism linear_solver_parallelism{Parallelism::None()};
 };
 
 // Struct used to store SAP solver statistics.
@@ -174,6 +188,7 @@ struct SapStatistics {
   void Reset() {
     num_iters = 0;
     num_line_search_iters = 0;
+    num_conjugate_gradient_iters = 0;
     optimality_criterion_reached = false;
     cost_criterion_reached = false;
     momentum_residual.clear();
@@ -183,6 +198,10 @@ struct SapStatistics {
   }
   int num_iters{0};              // Number of Newton iterations.
   int num_line_search_iters{0};  // Total number of line search iterations.
+  // Total number of conjugate gradient iterations, only non-zero when
+  // SapSolverParameters::linear_solver_type is
+  // kPreconditionedConjugateGradient.
+  int num_conjugate_gradient_iters{0};
 
   // Indicates if the optimality condition was reached.
   bool optimality_criterion_reached{false};
@@ -205,6 +224,19 @@ struct SapStatistics {
   // Dimensionless momentum scale at each SAP Newton iteration. Of size
   // num_iters + 1.
   std::vector<double> momentum_scale;
+
+  // Unlike the statistics above, the counters below accumulate over all calls
+  // to SapSolver::SolveWithGuess() on the same solver object and are not
+  // cleared by Reset(). Their ratio is the rate at which the symbolic analysis
+  // of the Hessian is reused across solves, see
+  // PersistentHessianFactorization.
+
+  // Number of Hessian factorizations that required a new symbolic analysis.
+  int num_symbolic_factorizations{0};
+
+  // Number of Hessian factorizations that reused the symbolic analysis of a
+  // previous solve, given the sparsity pattern of the problem was unchanged.
+  int num_symbolic_factorization_reuses{0};
 };
 
 // This class implements the Semi-Analytic Primal (SAP) solver described in
@@ -247,6 +279,12 @@ class SapSolver {
   // Convergence of the solver is controlled by set_parameters(). Refer to
   // SapSolverParameters for details on the convergence conditions.
   //
+  // The symbolic analysis of the Hessian factorization is kept between calls.
+  // When the next problem has the same sparsity pattern, e.g. the next time
+  // step with the same contact graph, it is reused and only the numerical
+  // factorization is performed. Only the block sparse Cholesky factorization
+  // supports this reuse, see SapSolverParameters::linear_solver_type.
+  //
   // N.B. SolveWithGuess() is a non-const method and therefore changes to the
   // state of the SapSolver object are allowed. This means that when using this
   // solver in MultibodyPlant (or a DiscreteUpdateManager), it must either be
@@ -452,6 +490,8 @@ class SapSolver {
   // TODO(amcastro-tri): Consider moving stats into the solver's state stored as
   // part of the model's context.
   mutable SapStatistics stats_;
+  // Hessian factorization persisted across calls to SolveWithGuess().
+  PersistentHessianFactorization persistent_hessian_;
 };
 
 // Forward-declare specializations, prior to DRAKE_DECLARE... below.
@@ -0,0 +1,135 @@
+#include "drake/multibody/contact_solvers/sap/friction_cone_batch.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/ssize.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/contact_solvers/sap/sap_friction_cone_constraint.h"
+
+using drake::math::RotationMatrix;
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+// Makes a friction cone constraint with friction coefficient mu. All other
+// parameters are arbitrary.
+std::unique_ptr<SapFrictionConeConstraint<double>> MakeConstraint(double mu) {
+  const ContactConfiguration<double> configuration{
+      .objectA = 0,
+      .p_ApC_W = Vector3d(1., 2., 3.),
+      .objectB = 1,
+      .p_BqC_W = Vector3d(4., 5., 6.),
+      .phi = -2.5e-3,
+      .vn = 0.0,
+      .fe = 0.0,
+      .R_WC = RotationMatrix<double>::Identity()};
+  const SapFrictionConeConstraint<double>::Parameters parameters{
+      .mu = mu,
+      .stiffness = 1.0e5,
+      .dissipation_time_scale = 0.01,
+      .beta = 0.0,
+      .sigma = 1.0e-3};
+  return std::make_unique<SapFrictionConeConstraint<double>>(
+      configuration, SapConstraintJacobian<double>(0, MatrixXd::Ones(3, 2)),
+      parameters);
+}
+
+// Verifies that the batched evaluation matches the evaluation of each
+// SapFrictionConeConstraint individually, for all contact modes. The number
+// of constraints is chosen so that it is not a multiple of the SIMD width, to
+// exercise partial loads and stores.
+GTEST_TEST(FrictionConeBatch, MatchesSapFrictionConeConstraint) {
+  const double time_step = 0.01;
+  const Vector3d delassus_diagonal(1.5, 1.5, 2.0);
+
+  // Un-projected impulses y in stiction, sliding and no contact for μ = 0.5.
+  // With μ = 0 these are all either sliding or no contact.
+  const std::vector<Vector3d> y_samples = {
+      Vector3d(0.1, 0.1, 1.0), Vector3d(-0.05, 0.2, 3.0),
+      Vector3d(2.0, 0.0, 1.0), Vector3d(1.0, -1.5, 0.5),
+      Vector3d(0.1, 0.0, -1.0)};
+  const std::vector<double> mu_samples = {0.5, 0.0};
+
+  std::vector<std::unique_ptr<SapFrictionConeConstraint<double>>> constraints;
+  std::vector<std::unique_ptr<AbstractValue>> constraints_data;
+  FrictionConeBatchData batch;
+  batch.Resize(ssize(y_samples) * ssize(mu_samples));
+  std::vector<int> num_per_mode(3, 0);
+  int k = 0;
+  for (double mu : mu_samples) {
+    for (const Vector3d& y : y_samples) {
+      constraints.push_back(MakeConstraint(mu));
+      const SapFrictionConeConstraint<double>& c = *constraints.back();
+      constraints_data.push_back(c.MakeData(time_step, delassus_diagonal));
+      const auto& data =
+          constraints_data.back()
+              ->get_value<SapFrictionConeConstraintData<double>>();
+
+      // Pack parameters the same way SapConstraintBundle does.
+      batch.mu[k] = data.mu();
+      batch.mu_hat[k] = data.mu_hat();
+      batch.sliding_factor[k] = 1.0 / (1.0 + data.mu_tilde() * data.mu_tilde());
+      batch.Rt[k] = data.Rt();
+      batch.Rn[k] = data.Rn();
+      batch.Rt_inv[k] = data.R_inv()(0);
+      batch.Rn_inv[k] = data.R_inv()(2);
+      batch.vn_hat[k] = data.v_hat()(2);
+
+      // Velocities leading to y = R⁻¹⋅(v̂ − vc).
+      const Vector3d vc = data.v_hat() - data.R().cwiseProduct(y);
+      c.CalcData(vc, constraints_data.back().get());
+      batch.vc_x[k] = vc(0);
+      batch.vc_y[k] = vc(1);
+      batch.vc_z[k] = vc(2);
+      ++num_per_mode[static_cast<int>(
+          constraints_data.back()
+              ->get_value<SapFrictionConeConstraintData<double>>()
+              .mode())];
+      ++k;
+    }
+  }
+  // Sanity check that all modes are exercised.
+  EXPECT_GT(num_per_mode[static_cast<int>(ContactMode::kNoContact)], 0);
+  EXPECT_GT(num_per_mode[static_cast<int>(ContactMode::kStiction)], 0);
+  EXPECT_GT(num_per_mode[static_cast<int>(ContactMode::kSliding)], 0);
+
+  CalcFrictionConeImpulses(&batch);
+
+  double expected_cost = 0.0;
+  for (k = 0; k < batch.size(); ++k) {
+    const SapFrictionConeConstraint<double>& c = *constraints[k];
+    const AbstractValue& data = *constraints_data[k];
+    expected_cost += c.CalcCost(data);
+
+    VectorXd gamma_expected(3);
+    c.CalcImpulse(data, &gamma_expected);
+    const Vector3d gamma(batch.gamma_x[k], batch.gamma_y[k], batch.gamma_z[k]);
+    EXPECT_TRUE(CompareMatrices(gamma, gamma_expected,
+                                10 * kEps * gamma_expected.norm()));
+
+    MatrixXd G_expected(3, 3);
+    c.CalcCostHessian(data, &G_expected);
+    MatrixXd G;
+    CalcFrictionConeHessian(batch, k, &G);
+    EXPECT_TRUE(CompareMatrices(G, G_expected, 10 * kEps * G_expected.norm()));
+  }
+  EXPECT_NEAR(CalcFrictionConeCost(batch), expected_cost,
+              10 * kEps * expected_cost);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
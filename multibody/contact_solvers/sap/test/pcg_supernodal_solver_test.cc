@@ -0,0 +1,160 @@
+#include "drake/multibody/contact_solvers/sap/pcg_supernodal_solver.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/ssize.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/multibody/contact_solvers/sap/dense_supernodal_solver.h"
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+// Makes an arbitrary SPD matrix of size n.
+MatrixXd MakeSpdMatrix(int n, double seed) {
+  const MatrixXd M = MatrixXd::NullaryExpr(n, n, [seed](Eigen::Index i,
+                                                        Eigen::Index j) {
+    return std::sin(seed + 3.0 * i + 7.0 * j);
+  });
+  return M * M.transpose() + MatrixXd::Identity(n, n);
+}
+
+// A chain of four cliques of sizes 2, 3, 1 and 2, coupled by three
+// constraints of size 3 between consecutive cliques. This resembles the
+// Hessian of a SAP problem with three contacts. The last constraint has its
+// weight split into three 1x1 blocks, as for SAP constraints whose equations
+// are projected independently.
+class PcgSuperNodalSolverTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const std::vector<int> clique_sizes{2, 3, 1, 2};
+    for (int c = 0; c < ssize(clique_sizes); ++c) {
+      A_.push_back(MakeSpdMatrix(clique_sizes[c], c));
+    }
+    BlockSparseMatrixBuilder<double> builder(3, 4, 6);
+    for (int r = 0; r < 3; ++r) {
+      for (int c = r; c <= r + 1; ++c) {
+        const MatrixXd Jrc = MatrixXd::NullaryExpr(
+            3, clique_sizes[c], [r, c](Eigen::Index i, Eigen::Index j) {
+              return std::cos(1.0 + r + 2.0 * c + 3.0 * i + 5.0 * j);
+            });
+        builder.PushBlock(r, c, MatrixBlock<double>(Jrc));
+      }
+    }
+    J_ = builder.Build();
+    G_ = {MakeSpdMatrix(3, 10.0), MakeSpdMatrix(3, 11.0),
+          MatrixXd::Constant(1, 1, 2.0), MatrixXd::Constant(1, 1, 0.5),
+          MatrixXd::Constant(1, 1, 3.0)};
+
+    DenseSuperNodalSolver dense(&A_, &J_);
+    dense.SetWeightMatrix(G_);
+    H_ = dense.MakeFullMatrix();
+  }
+
+  std::vector<MatrixXd> A_;
+  BlockSparseMatrix<double> J_;
+  std::vector<MatrixXd> G_;
+  MatrixXd H_;  // The expected Hessian.
+};
+
+TEST_F(PcgSuperNodalSolverTest, MakeFullMatrix) {
+  PcgSuperNodalSolver dut(&A_, &J_);
+  EXPECT_EQ(dut.GetSize(), 8);
+  dut.SetWeightMatrix(G_);
+  EXPECT_TRUE(
+      CompareMatrices(dut.MakeFullMatrix(), H_, kEps,
+                      MatrixCompareType::relative));
+}
+
+// With a tight tolerance, PCG converges to the exact solution in at most as
+// many iterations as the size of the system, up to round-off errors.
+TEST_F(PcgSuperNodalSolverTest, Solve) {
+  PcgSuperNodalSolver dut(&A_, &J_, {.relative_tolerance = 1.0e-14,
+                                     .max_iterations = 100});
+  dut.SetWeightMatrix(G_);
+  ASSERT_TRUE(dut.Factor());
+  EXPECT_EQ(dut.num_iterations(), 0);
+
+  const VectorXd b = VectorXd::LinSpaced(dut.GetSize(), -3.0, 12.0);
+  const VectorXd x = dut.Solve(b);
+  EXPECT_GT(dut.num_iterations(), 0);
+  EXPECT_LE(dut.num_iterations(), dut.GetSize() + 2);
+  const VectorXd x_expected = H_.ldlt().solve(b);
+  EXPECT_TRUE(CompareMatrices(x, x_expected, 1.0e-12,
+                              MatrixCompareType::relative));
+
+  VectorXd x_in_place = b;
+  dut.SolveInPlace(&x_in_place);
+  EXPECT_TRUE(CompareMatrices(x_in_place, x, 0.0));
+
+  // The solution of a zero right hand side is exact.
+  EXPECT_TRUE(CompareMatrices(dut.Solve(VectorXd::Zero(dut.GetSize())),
+                              VectorXd::Zero(dut.GetSize()), 0.0));
+  EXPECT_EQ(dut.num_iterations(), 0);
+}
+
+// Even when the iteration stops early, the approximate solution x is a
+// descent direction for the quadratic 1/2⋅xᵀ⋅H⋅x − bᵀ⋅x, which is what makes
+// it suitable as an inexact Newton direction. Moreover, the H-norm of the
+// error decreases monotonically with the number of iterations.
+TEST_F(PcgSuperNodalSolverTest, MaxIterations) {
+  const VectorXd b = VectorXd::LinSpaced(H_.rows(), -3.0, 12.0);
+  const VectorXd x_expected = H_.ldlt().solve(b);
+  auto calc_error_energy = [&](const VectorXd& x) {
+    const VectorXd e = x - x_expected;
+    return e.dot(H_ * e);
+  };
+  double previous_error_energy = calc_error_energy(VectorXd::Zero(b.size()));
+  for (int max_iterations = 1; max_iterations <= 3; ++max_iterations) {
+    PcgSuperNodalSolver dut(&A_, &J_, {.relative_tolerance = 0.0,
+                                       .max_iterations = max_iterations});
+    dut.SetWeightMatrix(G_);
+    ASSERT_TRUE(dut.Factor());
+    const VectorXd x = dut.Solve(b);
+    EXPECT_EQ(dut.num_iterations(), max_iterations);
+    EXPECT_GT(b.dot(x), 0.0);
+    const double error_energy = calc_error_energy(x);
+    EXPECT_LT(error_energy, previous_error_energy);
+    previous_error_energy = error_energy;
+  }
+}
+
+TEST_F(PcgSuperNodalSolverTest, BadArguments) {
+  DRAKE_EXPECT_THROWS_MESSAGE(PcgSuperNodalSolver(nullptr, &J_),
+                              "Condition 'A != nullptr' failed.");
+  DRAKE_EXPECT_THROWS_MESSAGE(PcgSuperNodalSolver(&A_, nullptr),
+                              "Condition 'J != nullptr' failed.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      PcgSuperNodalSolver(&A_, &J_, {.relative_tolerance = -1.0}),
+      ".*relative_tolerance >= 0.0.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      PcgSuperNodalSolver(&A_, &J_, {.max_iterations = 0}),
+      ".*max_iterations > 0.*");
+  const std::vector<MatrixXd> bad_A(A_.begin(), A_.end() - 1);
+  EXPECT_THROW(PcgSuperNodalSolver(&bad_A, &J_), std::exception);
+
+  // G is incompatible with the Jacobian.
+  PcgSuperNodalSolver dut(&A_, &J_);
+  std::vector<MatrixXd> bad_G = G_;
+  bad_G[0] = MatrixXd::Identity(2, 2);
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.SetWeightMatrix(bad_G),
+                              "Weight matrix incompatible with Jacobian.");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
@@ -6,6 +6,7 @@
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/common/test_utilities/limit_malloc.h"
 #include "drake/multibody/contact_solvers/sap/sap_constraint.h"
 
 using Eigen::Matrix3d;
@@ -265,6 +266,58 @@ GTEST_TEST(ContactProblem, AddConstraints) {
   EXPECT_EQ(graph.num_constraint_equations(), 17);
 }
 
+GTEST_TEST(ContactProblem, Reset) {
+  const double time_step = 0.01;
+  const std::vector<MatrixXd> A{S22, S33, S44, S22};
+  const VectorXd v_star = VectorXd::LinSpaced(11, 1.0, 11.0);
+  SapContactProblem<double> problem(time_step, A, v_star);
+  AddConstraints(&problem);
+
+  // Reset to a problem with different cliques. Constraints and objects are
+  // removed.
+  const std::vector<MatrixXd> A2{S33, S22};
+  const VectorXd v_star2 = VectorXd::LinSpaced(5, -1.0, -5.0);
+  problem.Reset(2.0 * time_step, A2, v_star2);
+  EXPECT_EQ(problem.time_step(), 2.0 * time_step);
+  EXPECT_EQ(problem.num_cliques(), 2);
+  EXPECT_EQ(problem.num_velocities(), 5);
+  EXPECT_EQ(problem.velocities_start(0), 0);
+  EXPECT_EQ(problem.velocities_start(1), 3);
+  EXPECT_EQ(problem.dynamics_matrix(), A2);
+  EXPECT_EQ(problem.v_star(), v_star2);
+  EXPECT_EQ(problem.num_constraints(), 0);
+  EXPECT_EQ(problem.num_constraint_equations(), 0);
+  EXPECT_EQ(problem.num_objects(), 0);
+  EXPECT_EQ(problem.graph().num_cliques(), 2);
+  EXPECT_EQ(problem.graph().num_constraints(), 0);
+
+  // The reset problem can be populated like a new one.
+  problem.set_num_objects(2);
+  problem.AddConstraint(std::make_unique<TestConstraint<double>>(3, 1, 2));
+  EXPECT_EQ(problem.num_constraints(), 1);
+  EXPECT_EQ(problem.num_constraint_equations(), 3);
+  EXPECT_EQ(problem.constraint_equations_start(0), 0);
+  EXPECT_EQ(problem.graph().num_constraints(), 1);
+
+  // Once constraints are removed, resetting with the same sizes reuses all of
+  // the problem's storage.
+  problem.Reset(time_step, A2, v_star2);
+  const VectorXd v_star3 = VectorXd::Constant(5, 3.0);
+  {
+    test::LimitMalloc guard;
+    problem.Reset(time_step, A2, v_star3);
+  }
+  EXPECT_EQ(problem.v_star(), v_star3);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(problem.Reset(0.0, A2, v_star2),
+                              ".*time_step > 0.0.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      problem.Reset(time_step, {MatrixXd::Zero(2, 3)}, VectorXd::Zero(2)),
+      ".*Ac.rows\\(\\) == Ac.cols\\(\\).*");
+  DRAKE_EXPECT_THROWS_MESSAGE(problem.Reset(time_step, A2, v_star),
+                              ".*v_star.size\\(\\) == nv.*");
+}
+
 GTEST_TEST(ContactProblem, Clone) {
   const double time_step = 0.01;
   std::vector<MatrixXd> A{S22, S33, S44, S22};
@@ -590,6 +643,123 @@ GTEST_TEST(ContactProblem, ExpandContactSolverResults) {
   EXPECT_TRUE(CompareMatrices(results.vc, vc_expected));
 }
 
+/* We test MakeIslands() and ExpandIslandResults() on the graph below, with
+ two islands {0, 3} and {2, 4}, and clique 1 not participating. Constraint
+ indexes are in square brackets and their number of equations in parentheses.
+
+         [3](1)                  [1](1)
+          ┌─┐                     ┌─┐
+          │ │                     │ │
+         ┌┴─┴┐ [0](2) ┌───┐     ┌─┴─┴┐ [2](3) ┌───┐    ┌───┐
+         │ 0 ├────────┤ 3 │     │ 2  ├────────┤ 4 │    │ 1 │
+         └───┘        └───┘     └────┘        └───┘    └───┘
+*/
+GTEST_TEST(ContactProblem, MakeIslands) {
+  const double time_step = 0.01;
+  const std::vector<MatrixXd> A{S22, S33, S44, S22, S33};
+  const VectorXd v_star = VectorXd::LinSpaced(14, 1.0, 14.0);
+  SapContactProblem<double> problem(time_step, A, v_star);
+  problem.set_num_objects(2);
+  problem.AddConstraint(std::make_unique<TestConstraint<double>>(
+      2 /* num_equations */, 3 /* first_clique */, 2 /* first_clique_nv */,
+      0 /* second_clique */, 2 /* second_clique_nv */));
+  problem.AddConstraint(std::make_unique<TestConstraint<double>>(
+      1 /* num_equations */, 2 /* clique */, 4 /* clique_nv */));
+  problem.AddConstraint(std::make_unique<TestConstraint<double>>(
+      3 /* num_equations */, 4 /* first_clique */, 3 /* first_clique_nv */,
+      2 /* second_clique */, 4 /* second_clique_nv */));
+  problem.AddConstraint(std::make_unique<TestConstraint<double>>(
+      1 /* num_equations */, 0 /* clique */, 2 /* clique_nv */));
+
+  std::vector<ReducedMapping> mappings;
+  const std::vector<std::unique_ptr<SapContactProblem<double>>> islands =
+      problem.MakeIslands(&mappings);
+  ASSERT_EQ(islands.size(), 2);
+  ASSERT_EQ(mappings.size(), 2);
+
+  // Velocity, clique and constraint equation indexes in each island, in the
+  // original problem.
+  const std::vector<std::vector<int>> expected_velocities{
+      {0, 1, 9, 10}, {5, 6, 7, 8, 11, 12, 13}};
+  const std::vector<std::vector<int>> expected_cliques{{0, 3}, {2, 4}};
+  const std::vector<std::vector<int>> expected_equations{{0, 1, 6},
+                                                         {2, 3, 4, 5}};
+  for (int i = 0; i < 2; ++i) {
+    const SapContactProblem<double>& island = *islands[i];
+    const ReducedMapping& mapping = mappings[i];
+    EXPECT_EQ(island.time_step(), time_step);
+    EXPECT_EQ(island.num_objects(), problem.num_objects());
+    EXPECT_EQ(island.num_cliques(), 2);
+    EXPECT_EQ(island.num_constraints(), 2);
+    ASSERT_EQ(island.num_velocities(), ssize(expected_velocities[i]));
+    ASSERT_EQ(island.num_constraint_equations(),
+              ssize(expected_equations[i]));
+    for (int k = 0; k < island.num_velocities(); ++k) {
+      const int v = expected_velocities[i][k];
+      EXPECT_EQ(mapping.velocity_permutation.domain_index(k), v);
+      EXPECT_EQ(island.v_star()[k], v_star[v]);
+    }
+    for (int c = 0; c < 2; ++c) {
+      EXPECT_EQ(mapping.clique_permutation.domain_index(c),
+                expected_cliques[i][c]);
+      EXPECT_EQ(island.dynamics_matrix()[c], A[expected_cliques[i][c]]);
+    }
+    for (int e = 0; e < island.num_constraint_equations(); ++e) {
+      EXPECT_EQ(mapping.constraint_equation_permutation.domain_index(e),
+                expected_equations[i][e]);
+    }
+  }
+
+  // Constraints keep their relative order, with cliques re-indexed into their
+  // island.
+  const SapConstraint<double>& c0 = islands[0]->get_constraint(0);
+  EXPECT_EQ(c0.num_constraint_equations(), 2);
+  EXPECT_EQ(c0.first_clique(), 1);
+  EXPECT_EQ(c0.second_clique(), 0);
+  EXPECT_EQ(islands[0]->get_constraint(1).first_clique(), 0);
+  EXPECT_EQ(islands[1]->get_constraint(0).num_constraint_equations(), 1);
+  EXPECT_EQ(islands[1]->get_constraint(1).first_clique(), 1);
+  EXPECT_EQ(islands[1]->get_constraint(1).second_clique(), 0);
+
+  // Expand dummy results for each island.
+  std::vector<SapSolverResults<double>> island_results(2);
+  for (int i = 0; i < 2; ++i) {
+    const int nv = islands[i]->num_velocities();
+    const int ne = islands[i]->num_constraint_equations();
+    SapSolverResults<double>& results = island_results[i];
+    results.Resize(nv, ne);
+    results.v = VectorXd::LinSpaced(nv, 100.0 * (i + 1), 100.0 * (i + 1) + nv);
+    results.j = -results.v;
+    results.gamma =
+        VectorXd::LinSpaced(ne, 10.0 * (i + 1), 10.0 * (i + 1) + ne);
+    results.vc = -results.gamma;
+  }
+  SapSolverResults<double> results;
+  problem.ExpandIslandResults(mappings, island_results, &results);
+  ASSERT_EQ(results.v.size(), problem.num_velocities());
+  ASSERT_EQ(results.gamma.size(), problem.num_constraint_equations());
+
+  // Velocities for clique 1, not in any island, equal v*.
+  VectorXd v_expected = v_star;
+  VectorXd j_expected = VectorXd::Zero(problem.num_velocities());
+  VectorXd gamma_expected(problem.num_constraint_equations());
+  for (int i = 0; i < 2; ++i) {
+    for (int k = 0; k < ssize(expected_velocities[i]); ++k) {
+      v_expected[expected_velocities[i][k]] = island_results[i].v[k];
+      j_expected[expected_velocities[i][k]] = island_results[i].j[k];
+    }
+    for (int e = 0; e < ssize(expected_equations[i]); ++e) {
+      gamma_expected[expected_equations[i][e]] = island_results[i].gamma[e];
+    }
+  }
+  EXPECT_TRUE(CompareMatrices(results.v, v_expected));
+  EXPECT_TRUE(CompareMatrices(results.j, j_expected));
+  EXPECT_TRUE(CompareMatrices(results.gamma, gamma_expected));
+  EXPECT_TRUE(CompareMatrices(results.vc, -gamma_expected));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(problem.MakeIslands(nullptr), ".*nullptr.*");
+}
+
 GTEST_TEST(ContactProblem, CalcConstraintMultibodyForces) {
   const double time_step = 0.01;
   const std::vector<MatrixXd> A{S22, S33, S44, S22};
@@ -1,5 +1,6 @@
 #include "drake/multibody/contact_solvers/sap/sap_solver.h"
 
+#include <algorithm>
 #include <memory>
 
 #include <gtest/gtest.h>
@@ -250,6 +251,9 @@ class PizzaSaverTest
     VectorXd q = Vector4d(0.0, 0.0, 0.0, theta);
     VectorXd v = VectorXd::Zero(problem.kNumVelocities);
 
+    // Number of steps that performed at least one Newton iteration and
+    // therefore needed a factorization of the Hessian.
+    int num_factorizing_steps = 0;
     for (int i = 0; i < num_steps; ++i) {
       const auto contact_problem =
           problem.MakeContactProblem(q, v, tau, beta, kDefaultSigma);
@@ -267,6 +271,14 @@ class PizzaSaverTest
       } else {
         EXPECT_TRUE(stats.optimality_criterion_reached);
       }
+
+      // The contact graph does not change between steps and therefore the
+      // symbolic analysis of the Hessian is performed only once.
+      if (stats.num_iters > 0) ++num_factorizing_steps;
+      EXPECT_EQ(stats.num_symbolic_factorizations,
+                num_factorizing_steps > 0 ? 1 : 0);
+      EXPECT_EQ(stats.num_symbolic_factorization_reuses,
+                std::max(num_factorizing_steps - 1, 0));
     }
 
     return result;
@@ -1063,6 +1075,43 @@ TEST_P(SapNewtonIterationTest, GuessOutsideLimits) {
   CompareDenseAgainstSupernodal(v_guess);
 }
 
+// Verifies the inexact Newton iteration with search directions computed with
+// the preconditioned conjugate gradient method. For this problem the
+// block-Jacobi preconditioner is the Hessian itself, since the only constraint
+// couples no cliques. Therefore each search direction takes a single
+// conjugate gradient iteration and it is exact.
+TEST_P(SapNewtonIterationTest, PreconditionedConjugateGradient) {
+  VectorXd v_guess = v_star_;
+  v_guess.segment<3>(2) = Vector3d(1.2 * vl_(0), v_star_(1), 1.1 * vu_(2));
+
+  SapSolverParameters params;
+  params.abs_tolerance = 0;
+  params.rel_tolerance = kEps;
+  params.line_search_type = GetParam();
+  const VectorXd v_expected = SolveWithGuess(params, v_guess);
+
+  params.linear_solver_type =
+      SapHessianFactorizationType::kPreconditionedConjugateGradient;
+  params.conjugate_gradient.relative_tolerance = 1.0e-2;
+  SapSolver<double> sap;
+  sap.set_parameters(params);
+  SapSolverResults<double> result;
+  const SapSolverStatus status =
+      sap.SolveWithGuess(*sap_problem_, v_guess, &result);
+  EXPECT_EQ(status, SapSolverStatus::kSuccess);
+  const SapStatistics& stats = sap.get_statistics();
+  EXPECT_GT(stats.num_iters, 1);
+  EXPECT_EQ(stats.num_conjugate_gradient_iters, stats.num_iters);
+  EXPECT_TRUE(CompareMatrices(result.v, v_expected, 5.0 * kEps,
+                              MatrixCompareType::relative));
+
+  // Direct factorizations perform no conjugate gradient iterations.
+  params.linear_solver_type = SapHessianFactorizationType::kBlockSparseCholesky;
+  sap.set_parameters(params);
+  sap.SolveWithGuess(*sap_problem_, v_guess, &result);
+  EXPECT_EQ(sap.get_statistics().num_conjugate_gradient_iters, 0);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     TestLineSearchMethods, SapNewtonIterationTest,
     testing::Values(SapSolverParameters::LineSearchType::kBackTracking,
@@ -14,10 +14,27 @@ SchurComplement::SchurComplement() = default;
 SchurComplement::~SchurComplement() = default;
 
 SchurComplement::SchurComplement(const Block3x3SparseSymmetricMatrix& A,
-                                 const std::unordered_set<int>& D_indices)
-    : D_indices_(D_indices.begin(), D_indices.end()) {
+                                 const std::unordered_set<int>& D_indices) {
+  Update(A, D_indices);
+}
+
+SchurComplement::SchurComplement(
+    int num_blocks, const std::unordered_set<int>& D_indices,
+    MatrixX<double> S,
+    std::function<VectorX<double>(const VectorX<double>&)> solve_for_x)
+    : S_(std::move(S)), solve_for_x_(std::move(solve_for_x)) {
+  SetIndices(num_blocks, D_indices);
+  const int num_C_dofs = 3 * ssize(C_indices_);
+  DRAKE_THROW_UNLESS(S_.rows() == num_C_dofs && S_.cols() == num_C_dofs);
+  DRAKE_THROW_UNLESS(solve_for_x_ != nullptr);
+}
+
+void SchurComplement::SetIndices(int num_blocks,
+                                 const std::unordered_set<int>& D_indices) {
+  D_indices_.assign(D_indices.begin(), D_indices.end());
+  C_indices_.clear();
   /* Keep D_indices_ sorted. */
-  DRAKE_THROW_UNLESS(ssize(D_indices) <= A.block_cols());
+  DRAKE_THROW_UNLESS(ssize(D_indices) <= num_blocks);
   std::sort(D_indices_.begin(), D_indices_.end());
   /* If a block index doesn't belong to the D blocks, it belongs to the C
    blocks. We step through `D_indices_` to detect the gaps in order to fill in
@@ -31,9 +48,16 @@ SchurComplement::SchurComplement(const Block3x3SparseSymmetricMatrix& A,
     start = D_index + 1;
   }
   /* Add the remaining indices (if any) after the last D index. */
-  while (start < A.block_cols()) {
+  while (start < num_blocks) {
     C_indices_.push_back(start++);
   }
+}
+
+void SchurComplement::Update(const Block3x3SparseSymmetricMatrix& A,
+                             const std::unordered_set<int>& D_indices) {
+  SetIndices(A.block_cols(), D_indices);
+  /* Release the state of a previous construction without factorization. */
+  solve_for_x_ = nullptr;
 
   const int block_cols = C_indices_.size() + D_indices_.size();
   DRAKE_DEMAND(block_cols * 3 == A.cols());
@@ -67,9 +91,14 @@ SchurComplement::SchurComplement(const Block3x3SparseSymmetricMatrix& A,
 VectorX<double> SchurComplement::SolveForX(
     const Eigen::Ref<const VectorX<double>>& y) const {
   DRAKE_THROW_UNLESS(y.size() == 3 * ssize(C_indices_));
-  DRAKE_DEMAND(
-      A_solver_.solver_mode() ==
-      BlockSparseCholeskySolver<Matrix3<double>>::SolverMode::kFactored);
+  if (A_solver_.solver_mode() !=
+      BlockSparseCholeskySolver<Matrix3<double>>::SolverMode::kFactored) {
+    /* Either empty or constructed from precomputed quantities. */
+    if (solve_for_x_ == nullptr) {
+      return VectorX<double>::Zero(0);
+    }
+    return solve_for_x_(y);
+  }
   if (D_indices_.empty()) {
     return VectorX<double>::Zero(0);
   }
@@ -98,7 +127,7 @@ VectorX<double> SchurComplement::SolveForX(
 VectorX<double> SchurComplement::Solve(
     const Eigen::Ref<const VectorX<double>>& c) const {
   DRAKE_THROW_UNLESS(3 * (ssize(C_indices_) + ssize(D_indices_)) == c.size());
-  DRAKE_DEMAND(
+  DRAKE_THROW_UNLESS(
       A_solver_.solver_mode() ==
       BlockSparseCholeskySolver<Matrix3<double>>::SolverMode::kFactored);
   return A_solver_.Solve(c);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <unordered_set>
 #include <vector>
 
@@ -96,6 +97,35 @@ class SchurComplement {
   SchurComplement(const Block3x3SparseSymmetricMatrix& A,
                   const std::unordered_set<int>& D_indices);
 
+  /* Constructs a SchurComplement from precomputed quantities, for a matrix A of
+   size 3*`num_blocks`-by-3*`num_blocks` that is only available as a linear
+   operator, without factoring A. `D_indices` is as in the two-argument
+   constructor, and `S` is the Schur complement S = C - BᵀD⁻¹B. SolveForX()
+   then returns `solve_for_x`(y), which must compute x = -D⁻¹B⋅y, with the
+   entries of x and y ordered by increasing block index in A. Solve() is not
+   available.
+   @pre D_indices is a subset of {0, ..., num_blocks-1}.
+   @pre S has a size consistent with `num_blocks` and D_indices.
+   @pre solve_for_x is not empty. */
+  SchurComplement(
+      int num_blocks, const std::unordered_set<int>& D_indices,
+      MatrixX<double> S,
+      std::function<VectorX<double>(const VectorX<double>&)> solve_for_x);
+
+  /* Recomputes `this` Schur complement for the given A and D_indices, with the
+   same result as assigning SchurComplement(A, D_indices) to `this`. When A has
+   the same sparsity pattern as the matrix of the previous construction or
+   update, the elimination ordering and the symbolic factorization of that
+   matrix are reused, even if D_indices changed in a few blocks. See
+   BlockSparseCholeskySolver::FactorAndCalcSchurComplement() for details. This
+   is therefore preferred over constructing a new SchurComplement when the
+   Schur complements of matrices with the same sparsity pattern, such as the
+   tangent matrix of a deformable body at successive time steps, are computed
+   one after another.
+   @pre D_indices is a subset of {0, ..., A.block_cols()-1}. */
+  void Update(const Block3x3SparseSymmetricMatrix& A,
+              const std::unordered_set<int>& D_indices);
+
   /* Returns the Schur complement for the block D of the matrix A,
    S = C - BᵀD⁻¹B. */
   const MatrixX<double>& get_D_complement() const { return S_; }
@@ -110,10 +140,16 @@ class SchurComplement {
   /* Given a right-hand side vector b with the same dimension as the input
    matrix A provided at construction, solve solves for A*z = b.
    @pre The size of b is compatible with the input matrix A provided at
-   construction. */
+   construction.
+   @throws std::exception if `this` was constructed from precomputed
+   quantities, without a factorization of A. */
   VectorX<double> Solve(const Eigen::Ref<const VectorX<double>>& b) const;
 
  private:
+  /* Sets D_indices_ to the sorted `D_indices` and C_indices_ to the sorted
+   remaining block indices in [0, num_blocks). */
+  void SetIndices(int num_blocks, const std::unordered_set<int>& D_indices);
+
   /* Sorted block row/column indices for 3x3 blocks that belong to submatrix D.
    */
   std::vector<int> D_indices_;
@@ -124,6 +160,9 @@ class SchurComplement {
   BlockSparseCholeskySolver<Matrix3<double>> A_solver_;
   /* The Schur complement of block D: S = C - BᵀD⁻¹B. */
   MatrixX<double> S_;
+  /* Computes x = -D⁻¹B⋅y, only used when `this` was constructed without a
+   factorization of A. */
+  std::function<VectorX<double>(const VectorX<double>&)> solve_for_x_;
 };
 
 }  // namespace internal
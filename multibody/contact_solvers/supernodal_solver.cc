@@ -57,6 +57,26 @@ void SuperNodalSolver::SolveInPlace(Eigen::VectorXd* b) const {
   DoSolveInPlace(b);
 }
 
+bool SuperNodalSolver::UpdateMatrices(
+    int num_jacobian_row_blocks,
+    const std::vector<BlockTriplet>& jacobian_blocks,
+    const std::vector<Eigen::MatrixXd>& mass_matrices) {
+  if (!DoUpdateMatrices(num_jacobian_row_blocks, jacobian_blocks,
+                        mass_matrices)) {
+    return false;
+  }
+  factorization_ready_ = false;
+  matrix_ready_ = false;
+  return true;
+}
+
+bool SuperNodalSolver::DoUpdateMatrices(int, const std::vector<BlockTriplet>&,
+                                        const std::vector<Eigen::MatrixXd>&) {
+  return false;
+}
+
+void SuperNodalSolver::DoSetParallelism(Parallelism) {}
+
 std::vector<std::vector<int>> GetRowToTripletMapping(
     int num_row_blocks, const std::vector<BlockTriplet>& jacobian_blocks) {
   DRAKE_THROW_UNLESS(num_row_blocks >= 0);
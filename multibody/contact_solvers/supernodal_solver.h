@@ -8,6 +8,7 @@
 #include <Eigen/Dense>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/block_sparse_matrix.h"
 #include "drake/multibody/contact_solvers/matrix_block.h"
 
@@ -78,6 +79,26 @@ class SuperNodalSolver {
   // Returns the size of the system being solved.
   int GetSize() const { return DoGetSize(); }
 
+  // Replaces the matrices M and J provided at construction with new ones that
+  // have the same sparsity pattern, i.e. the same block sizes and the same
+  // block indices of the non-zero Jacobian blocks. This reuses the symbolic
+  // analysis performed at construction, which for sparse solvers is the most
+  // expensive part of setting up a new system.
+  // Returns `false`, leaving `this` solver unchanged, if the sparsity pattern
+  // differs or the specific solver does not support updates. On success,
+  // SetWeightMatrix() must be called again before Factor().
+  bool UpdateMatrices(int num_jacobian_row_blocks,
+                      const std::vector<BlockTriplet>& jacobian_blocks,
+                      const std::vector<Eigen::MatrixXd>& mass_matrices);
+
+  // Sets the degree of parallelism used by subsequent calls to Factor() and
+  // Solve(). This is only a hint, solvers that do not support multithreading
+  // ignore it. The results of the factorization must not depend on the
+  // degree of parallelism.
+  void SetParallelism(Parallelism parallelism) {
+    DoSetParallelism(parallelism);
+  }
+
  protected:
   SuperNodalSolver() = default;
 
@@ -105,6 +126,17 @@ class SuperNodalSolver {
 
   // @}
 
+  // @see UpdateMatrices(). Solvers that support reusing their symbolic
+  // analysis must override this method. The default implementation returns
+  // `false`.
+  virtual bool DoUpdateMatrices(
+      int num_jacobian_row_blocks,
+      const std::vector<BlockTriplet>& jacobian_blocks,
+      const std::vector<Eigen::MatrixXd>& mass_matrices);
+
+  // @see SetParallelism(). The default implementation does nothing.
+  virtual void DoSetParallelism(Parallelism parallelism);
+
  private:
   bool factorization_ready_ = false;
   bool matrix_ready_ = false;
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <numeric>
+#include <unordered_set>
 #include <utility>
 
 #include <gtest/gtest.h>
@@ -275,6 +276,130 @@ GTEST_TEST(BlockSparseCholeskySolverTest, FactorAndCalcSchurComplement) {
   }
 }
 
+/* Makes an arbitrary SPD matrix with 3x3 blocks whose block sparsity pattern
+ is a binary tree with `num_blocks` nodes, i.e. block i is coupled with block
+ (i - 1) / 2. The elimination tree of such a matrix has many independent
+ block columns at each level. All entries are multiplied by `scale`, and
+ therefore the matrix is negative definite for a negative scale. */
+BlockSparseSymmetricMatrix MakeBinaryTreeMatrix(int num_blocks,
+                                                double scale = 1.0) {
+  std::vector<std::vector<int>> sparsity(num_blocks);
+  for (int j = 0; j < num_blocks; ++j) {
+    sparsity[j].push_back(j);
+    for (int i : {2 * j + 1, 2 * j + 2}) {
+      if (i < num_blocks) sparsity[j].push_back(i);
+    }
+  }
+  BlockSparseSymmetricMatrix A(
+      BlockSparsityPattern(std::vector<int>(num_blocks, 3), sparsity));
+  for (int j = 0; j < num_blocks; ++j) {
+    A.AddToBlock(j, j, scale * (10.0 + 0.1 * j) * Matrix3d::Identity());
+    for (int flat = 1; flat < ssize(sparsity[j]); ++flat) {
+      const int i = sparsity[j][flat];
+      Matrix3d Aij;
+      for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+          Aij(r, c) = 0.1 * (r + 1) - 0.05 * c + 0.01 * i - 0.02 * j;
+        }
+      }
+      A.AddToBlock(i, j, scale * Aij);
+    }
+  }
+  return A;
+}
+
+GTEST_TEST(BlockSparseCholeskySolverTest, Parallelism) {
+  const BlockSparseSymmetricMatrix A = MakeBinaryTreeMatrix(31);
+  const MatrixXd dense_A = A.MakeDenseMatrix();
+  const VectorXd b = VectorXd::LinSpaced(A.cols(), -1.0, 2.0);
+
+  BlockSparseCholeskySolver<MatrixXd> serial_solver;
+  EXPECT_EQ(serial_solver.parallelism().num_threads(), 1);
+  serial_solver.SetMatrix(A);
+  ASSERT_TRUE(serial_solver.Factor());
+  const VectorXd serial_x = serial_solver.Solve(b);
+  EXPECT_TRUE(CompareMatrices(serial_x, dense_A.llt().solve(b), 1e-13));
+
+  BlockSparseCholeskySolver<MatrixXd> dut;
+  dut.set_parallelism(Parallelism(4));
+  EXPECT_EQ(dut.parallelism().num_threads(), 4);
+  dut.SetMatrix(A);
+  ASSERT_TRUE(dut.Factor());
+  /* Updates are accumulated in the same order as in the serial
+   factorization, and therefore results are bitwise identical. */
+  EXPECT_TRUE(CompareMatrices(dut.L().MakeDenseMatrix(),
+                              serial_solver.L().MakeDenseMatrix(), 0.0));
+  EXPECT_TRUE(CompareMatrices(dut.Solve(b), serial_x, 1e-15));
+
+  /* Refactor with new numeric values. */
+  const BlockSparseSymmetricMatrix A2 = MakeBinaryTreeMatrix(31, 10.0);
+  dut.UpdateMatrix(A2);
+  ASSERT_TRUE(dut.Factor());
+  EXPECT_TRUE(CompareMatrices(dut.Solve(b),
+                              A2.MakeDenseMatrix().llt().solve(b), 1e-13));
+
+  /* Failure is reported as in the serial factorization. */
+  dut.SetMatrix(MakeBinaryTreeMatrix(31, -1.0));
+  EXPECT_FALSE(dut.Factor());
+  EXPECT_EQ(dut.solver_mode(),
+            BlockSparseCholeskySolver<MatrixXd>::SolverMode::kEmpty);
+}
+
+/* FactorAndCalcSchurComplement() reuses the symbolic analysis of the previous
+ call for a matrix with the same sparsity pattern, and the results agree with
+ those of a fresh solver. */
+GTEST_TEST(BlockSparseCholeskySolverTest, ReuseSchurComplementAnalysis) {
+  constexpr int kNumBlocks = 31;
+  const VectorXd b = VectorXd::LinSpaced(3 * kNumBlocks, -1.0, 2.0);
+  BlockSparseCholeskySolver<MatrixXd> dut;
+
+  auto verify = [&](const BlockSparseSymmetricMatrix& A,
+                    const std::unordered_set<int>& eliminated_blocks) {
+    const std::optional<MatrixXd> S =
+        dut.FactorAndCalcSchurComplement(A, eliminated_blocks);
+    ASSERT_TRUE(S.has_value());
+    BlockSparseCholeskySolver<MatrixXd> fresh_solver;
+    const std::optional<MatrixXd> expected_S =
+        fresh_solver.FactorAndCalcSchurComplement(A, eliminated_blocks);
+    ASSERT_TRUE(expected_S.has_value());
+    EXPECT_TRUE(CompareMatrices(*S, *expected_S, 1e-13));
+    EXPECT_TRUE(CompareMatrices(dut.Solve(b), fresh_solver.Solve(b), 1e-13));
+    /* The eliminated blocks come first in the elimination ordering. */
+    const Eigen::PermutationMatrix<Eigen::Dynamic> P =
+        dut.CalcPermutationMatrix();
+    const int num_eliminated = ssize(eliminated_blocks);
+    for (int i : eliminated_blocks) {
+      EXPECT_LT(P.indices()(3 * i), 3 * num_eliminated);
+    }
+  };
+
+  const std::unordered_set<int> eliminated_blocks = {3, 4, 5, 6, 7, 8, 9,
+                                                     20, 21, 22, 23, 30};
+  const BlockSparseSymmetricMatrix A = MakeBinaryTreeMatrix(kNumBlocks);
+  const BlockSparseSymmetricMatrix A2 = MakeBinaryTreeMatrix(kNumBlocks, 10.0);
+  verify(A, eliminated_blocks);
+  /* Same blocks with new numeric values. */
+  verify(A2, eliminated_blocks);
+  /* A few blocks change. */
+  std::unordered_set<int> eliminated_blocks2 = eliminated_blocks;
+  eliminated_blocks2.erase(30);
+  eliminated_blocks2.insert(0);
+  verify(A, eliminated_blocks2);
+  /* All blocks are eliminated. */
+  std::unordered_set<int> all_blocks;
+  for (int i = 0; i < kNumBlocks; ++i) all_blocks.insert(i);
+  verify(A, all_blocks);
+  /* Many blocks changed, so the elimination ordering was computed from
+   scratch, as with SetMatrix(). */
+  BlockSparseCholeskySolver<MatrixXd> fresh_solver;
+  fresh_solver.SetMatrix(A);
+  EXPECT_EQ(MatrixXi(dut.CalcPermutationMatrix()),
+            MatrixXi(fresh_solver.CalcPermutationMatrix()));
+  /* SetMatrix() discards the analysis. */
+  dut.SetMatrix(A);
+  verify(A2, eliminated_blocks);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
@@ -57,6 +57,16 @@ GTEST_TEST(MatrixBlockTest, Constructors) {
                               dense_block.MakeDenseMatrix()));
 }
 
+GTEST_TEST(MatrixBlockTest, MutableDenseMatrix) {
+  MatrixBlock<double> dense_block(MakeArbitraryMatrix(3, 4));
+  const MatrixXd expected = MakeArbitraryMatrix(3, 2);
+  MatrixXd& dense = dense_block.get_mutable_dense_matrix();
+  dense.resize(3, 2);
+  dense = expected;
+  EXPECT_EQ(dense_block.cols(), 2);
+  EXPECT_TRUE(CompareMatrices(dense_block.MakeDenseMatrix(), expected));
+}
+
 GTEST_TEST(MatrixBlockTest, MultiplyAndAddTo) {
   const MatrixXd x = MakeArbitraryMatrix(9, 7);
   Block3x3SparseMatrix<double> sparse_matrix = MakeBlockSparseMatrix();
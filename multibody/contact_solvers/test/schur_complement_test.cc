@@ -127,6 +127,59 @@ GTEST_TEST(SchurComplementTest, Solve) {
   EXPECT_TRUE(CompareMatrices(z, expected_z, kTolerance));
 }
 
+/* Updating a SchurComplement gives the same result as constructing a new one,
+ whether or not the D indices change. */
+GTEST_TEST(SchurComplementTest, Update) {
+  const Block3x3SparseSymmetricMatrix A = MakeBlockSparseMatrix();
+  const VectorXd b = VectorXd::LinSpaced(9, 0.0, 12.0);
+  SchurComplement dut = MakeSchurComplement();
+  for (const std::unordered_set<int>& D_indices :
+       std::vector<std::unordered_set<int>>{{1}, {0, 2}, {0, 2}, {}, {1}}) {
+    dut.Update(A, D_indices);
+    const SchurComplement expected(A, D_indices);
+    EXPECT_TRUE(CompareMatrices(dut.get_D_complement(),
+                                expected.get_D_complement(), kTolerance));
+    EXPECT_TRUE(CompareMatrices(dut.Solve(b), expected.Solve(b), kTolerance));
+    const VectorXd y = VectorXd::LinSpaced(3 * (3 - ssize(D_indices)), 0, 1);
+    EXPECT_TRUE(
+        CompareMatrices(dut.SolveForX(y), expected.SolveForX(y), kTolerance));
+  }
+}
+
+/* A SchurComplement constructed from precomputed quantities agrees with one
+ computed from the factorization of A, but doesn't support Solve(). */
+GTEST_TEST(SchurComplementTest, ConstructFromPrecomputedQuantities) {
+  const SchurComplement expected = MakeSchurComplement();
+  MatrixXd D = A11();
+  MatrixXd B = MatrixXd::Zero(3, 6);
+  B.topLeftCorner<3, 3>() = A10();
+  const MatrixXd D_inverse_B = D.llt().solve(B);
+  const auto solve_for_x = [D_inverse_B](const VectorXd& y) -> VectorXd {
+    return -D_inverse_B * y;
+  };
+  const SchurComplement dut(3, {1}, expected.get_D_complement(), solve_for_x);
+  EXPECT_EQ(dut.get_D_complement(), expected.get_D_complement());
+  const VectorXd y = VectorXd::LinSpaced(6, 0.0, 12.0);
+  EXPECT_TRUE(
+      CompareMatrices(dut.SolveForX(y), expected.SolveForX(y), kTolerance));
+  EXPECT_THROW(dut.Solve(VectorXd::Zero(9)), std::exception);
+
+  /* Sizes must be consistent with the D indices. */
+  EXPECT_THROW(SchurComplement(3, {0, 1}, expected.get_D_complement(),
+                               solve_for_x),
+               std::exception);
+  /* A function to solve for x is required. */
+  EXPECT_THROW(SchurComplement(3, {1}, expected.get_D_complement(), nullptr),
+               std::exception);
+
+  /* Updating it with a matrix recovers the factorization. */
+  SchurComplement updated = dut;
+  updated.Update(MakeBlockSparseMatrix(), {1});
+  const VectorXd b = VectorXd::LinSpaced(9, 0.0, 12.0);
+  EXPECT_TRUE(
+      CompareMatrices(updated.Solve(b), expected.Solve(b), kTolerance));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
@@ -199,6 +199,118 @@ TYPED_TEST(SuperNodalSolverTest, InterfaceTest) {
                               "Weight matrix incompatible with Jacobian.");
 }
 
+// Verifies that UpdateMatrices() replaces M and J when their sparsity pattern
+// is unchanged, and leaves the solver untouched otherwise.
+TYPED_TEST(SuperNodalSolverTest, UpdateMatrices) {
+  const auto [M, blocks_of_M] = Make6x6SpdBlockDiagonalMatrixOf2x2SpdMatrices();
+
+  const int num_row_blocks_of_J = 3;
+  MatrixXd J(9, 6);
+
+  // clang-format off
+  J << 0, 0, 0, 0, 1, 2,
+       0, 0, 0, 0, 2, 1,
+       0, 0, 0, 0, 2, 3,
+       1, 2, 0, 0, 2, 4,
+       0, 1, 0, 0, 1, 3,
+       1, 3, 0, 0, 2, 4,
+       0, 0, 1, 1, 0, 0,
+       0, 0, 2, 1, 0, 0,
+       0, 0, 3, 3, 0, 0;
+  const std::vector<BlockTriplet> Jtriplets = MakeBlockTriplets(J,
+      {{0, 2}, {1, 0}, {1, 2}, {2, 1}},
+      {{0, 4}, {3, 0}, {3, 4}, {6, 2}},
+      {{3, 2}, {3, 2}, {3, 2}, {3, 2}});
+  // clang-format on
+
+  const auto [G, blocks_of_G] = Make9x9SpdBlockDiagonalMatrixOf3x3SpdMatrices();
+
+  TypeParam solver(num_row_blocks_of_J, Jtriplets, blocks_of_M);
+
+  // Same pattern, different values.
+  const MatrixXd M2 = 2.0 * M;
+  std::vector<MatrixXd> blocks_of_M2 = blocks_of_M;
+  for (MatrixXd& block : blocks_of_M2) block *= 2.0;
+  const MatrixXd J2 = 3.0 * J;
+  // clang-format off
+  const std::vector<BlockTriplet> J2triplets = MakeBlockTriplets(J2,
+      {{0, 2}, {1, 0}, {1, 2}, {2, 1}},
+      {{0, 4}, {3, 0}, {3, 4}, {6, 2}},
+      {{3, 2}, {3, 2}, {3, 2}, {3, 2}});
+  // Block (2, 1) moved to (2, 0), which changes the pattern.
+  const std::vector<BlockTriplet> J3triplets = MakeBlockTriplets(J2,
+      {{0, 2}, {1, 0}, {1, 2}, {2, 0}},
+      {{0, 4}, {3, 0}, {3, 4}, {6, 2}},
+      {{3, 2}, {3, 2}, {3, 2}, {3, 2}});
+  // clang-format on
+
+  if constexpr (std::is_same_v<TypeParam, ConexSuperNodalSolver>) {
+    // Not supported.
+    EXPECT_FALSE(
+        solver.UpdateMatrices(num_row_blocks_of_J, J2triplets, blocks_of_M2));
+    return;
+  }
+
+  EXPECT_FALSE(
+      solver.UpdateMatrices(num_row_blocks_of_J, J3triplets, blocks_of_M2));
+  solver.SetWeightMatrix(blocks_of_G);
+  EXPECT_NEAR(
+      (solver.MakeFullMatrix() - (M + J.transpose() * G * J)).norm(), 0,
+      1e-15);
+
+  ASSERT_TRUE(
+      solver.UpdateMatrices(num_row_blocks_of_J, J2triplets, blocks_of_M2));
+  // The weight matrix must be set again after an update.
+  EXPECT_THROW(solver.Factor(), std::exception);
+  solver.SetWeightMatrix(blocks_of_G);
+  const MatrixXd H2 = M2 + J2.transpose() * G * J2;
+  EXPECT_NEAR((solver.MakeFullMatrix() - H2).norm(), 0, 1e-12);
+  ASSERT_TRUE(solver.Factor());
+  const VectorXd b = VectorXd::LinSpaced(6, -1.0, 1.0);
+  const VectorXd x = solver.Solve(b);
+  EXPECT_NEAR((x - H2.ldlt().solve(b)).norm(), 0, 1e-12);
+}
+
+TYPED_TEST(SuperNodalSolverTest, SetParallelism) {
+  const auto [M, blocks_of_M] = Make6x6SpdBlockDiagonalMatrixOf2x2SpdMatrices();
+  unused(M);
+
+  const int num_row_blocks_of_J = 3;
+  MatrixXd J(9, 6);
+
+  // clang-format off
+  J << 0, 0, 0, 0, 1, 2,
+       0, 0, 0, 0, 2, 1,
+       0, 0, 0, 0, 2, 3,
+       1, 2, 0, 0, 2, 4,
+       0, 1, 0, 0, 1, 3,
+       1, 3, 0, 0, 2, 4,
+       0, 0, 1, 1, 0, 0,
+       0, 0, 2, 1, 0, 0,
+       0, 0, 3, 3, 0, 0;
+  const std::vector<BlockTriplet> Jtriplets = MakeBlockTriplets(J,
+      {{0, 2}, {1, 0}, {1, 2}, {2, 1}},
+      {{0, 4}, {3, 0}, {3, 4}, {6, 2}},
+      {{3, 2}, {3, 2}, {3, 2}, {3, 2}});
+  // clang-format on
+
+  const auto [G, blocks_of_G] = Make9x9SpdBlockDiagonalMatrixOf3x3SpdMatrices();
+  unused(G);
+  const VectorXd b = VectorXd::LinSpaced(6, -1.0, 1.0);
+
+  TypeParam serial_solver(num_row_blocks_of_J, Jtriplets, blocks_of_M);
+  serial_solver.SetWeightMatrix(blocks_of_G);
+  ASSERT_TRUE(serial_solver.Factor());
+
+  // Solvers that do not support parallelism ignore it, the others must give
+  // the same results.
+  TypeParam solver(num_row_blocks_of_J, Jtriplets, blocks_of_M);
+  solver.SetParallelism(Parallelism(2));
+  solver.SetWeightMatrix(blocks_of_G);
+  ASSERT_TRUE(solver.Factor());
+  EXPECT_NEAR((solver.Solve(b) - serial_solver.Solve(b)).norm(), 0, 1e-15);
+}
+
 // In this test we are providing a Jacobian with an empty column block. The
 // result is that the solver cannot match the columns partition of J to the
 // partition of M. We expect an exception at construction.
@@ -24,6 +24,12 @@ namespace internal {
  constitutive model must also be accompanied by a corresponding traits class
  that declares the compile time quantities and type declarations that this base
  class requires.
+
+ The data of several FEM elements can be updated together with
+ DeformationGradientData::UpdateDataBatch(). For example, the corotated models
+ then compute the polar decompositions of all of the elements' deformation
+ gradients with PolarDecomposeAll(), which, for T = double, processes them in
+ SIMD-width groups of kPolarDecomposeBatchSize.
  @tparam DerivedConstitutiveModel The concrete constitutive model that inherits
  from ConstitutiveModel through CRTP.
  @tparam DerivedTraits The traits class associated with the
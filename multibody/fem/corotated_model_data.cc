@@ -19,10 +19,16 @@ template <typename T, int num_locations>
 void CorotatedModelData<T, num_locations>::UpdateFromDeformationGradient() {
   const std::array<Matrix3<T>, num_locations>& F = this->deformation_gradient();
   for (int i = 0; i < num_locations; ++i) {
-    Matrix3<T>& local_R = R_[i];
-    Matrix3<T>& local_S = S_[i];
+    internal::PolarDecompose<T>(F[i], &R_[i], &S_[i]);
+  }
+  UpdateDeterminantAndCofactor();
+}
+
+template <typename T, int num_locations>
+void CorotatedModelData<T, num_locations>::UpdateDeterminantAndCofactor() {
+  const std::array<Matrix3<T>, num_locations>& F = this->deformation_gradient();
+  for (int i = 0; i < num_locations; ++i) {
     Matrix3<T>& local_JFinvT = JFinvT_[i];
-    internal::PolarDecompose<T>(F[i], &local_R, &local_S);
     Jm1_[i] = F[i].determinant() - 1.0;
     internal::CalcCofactorMatrix<T>(F[i], &local_JFinvT);
   }
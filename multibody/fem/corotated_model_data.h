@@ -4,6 +4,7 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/multibody/fem/deformation_gradient_data.h"
+#include "drake/multibody/fem/matrix_utilities.h"
 
 namespace drake {
 namespace multibody {
@@ -48,6 +49,31 @@ class CorotatedModelData
    required by the CRTP base class. */
   void UpdateFromDeformationGradient();
 
+  /* Shadows DeformationGradientData::UpdateFromDeformationGradientBatch() to
+   compute the polar decompositions of all locations of all of `data` with a
+   single call to PolarDecomposeAll(). */
+  template <size_t kBatch>
+  static void UpdateFromDeformationGradientBatch(
+      const std::array<CorotatedModelData*, kBatch>& data) {
+    std::array<Matrix3<T>, kBatch * num_locations> F, R, S;
+    for (size_t k = 0; k < kBatch; ++k) {
+      for (int i = 0; i < num_locations; ++i) {
+        F[k * num_locations + i] = data[k]->deformation_gradient()[i];
+      }
+    }
+    PolarDecomposeAll(F, &R, &S);
+    for (size_t k = 0; k < kBatch; ++k) {
+      for (int i = 0; i < num_locations; ++i) {
+        data[k]->R_[i] = R[k * num_locations + i];
+        data[k]->S_[i] = S[k * num_locations + i];
+      }
+      data[k]->UpdateDeterminantAndCofactor();
+    }
+  }
+
+  /* Updates Jm1_ and JFinvT_ from the deformation gradient. */
+  void UpdateDeterminantAndCofactor();
+
   /* Let F = RS be the polar decomposition of the deformation gradient where R
    is a rotation matrix and S is symmetric. */
   std::array<Matrix3<T>, num_locations> R_;
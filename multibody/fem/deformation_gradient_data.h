@@ -63,6 +63,29 @@ class DeformationGradientData<
     static_cast<Derived*>(this)->UpdateFromDeformationGradient();
   }
 
+  /* Updates each of the `kBatch` entries of `data` with its deformation
+   gradients, with the same result as calling UpdateData() on each of them.
+   Derived classes may shadow UpdateFromDeformationGradientBatch() to compute
+   the deformation gradient dependent quantities of the whole batch together,
+   e.g., to batch the polar decompositions of several FEM elements.
+   @pre Entries in `data` are non-null. */
+  template <size_t kBatch>
+  static void UpdateDataBatch(
+      const std::array<Derived*, kBatch>& data,
+      const std::array<std::array<Matrix3<T>, num_locations>, kBatch>&
+          deformation_gradients,
+      const std::array<std::array<Matrix3<T>, num_locations>, kBatch>&
+          previous_step_deformation_gradients) {
+    for (size_t k = 0; k < kBatch; ++k) {
+      DRAKE_ASSERT(data[k] != nullptr);
+      DeformationGradientData& base = *data[k];
+      base.deformation_gradient_ = deformation_gradients[k];
+      base.previous_step_deformation_gradient_ =
+          previous_step_deformation_gradients[k];
+    }
+    Derived::template UpdateFromDeformationGradientBatch<kBatch>(data);
+  }
+
   const std::array<Matrix3<T>, num_locations>& deformation_gradient() const {
     return deformation_gradient_;
   }
@@ -94,6 +117,17 @@ class DeformationGradientData<
                     NiceTypeName::Get(*static_cast<Derived*>(this))));
   }
 
+  /* Derived classes may shadow this method to compute the quantities derived
+   from the deformation gradients of all of `data` together. By default, each
+   entry is updated on its own. */
+  template <size_t kBatch>
+  static void UpdateFromDeformationGradientBatch(
+      const std::array<Derived*, kBatch>& data) {
+    for (Derived* entry : data) {
+      entry->UpdateFromDeformationGradient();
+    }
+  }
+
  private:
   std::array<Matrix3<T>, num_locations> deformation_gradient_;
   std::array<Matrix3<T>, num_locations> previous_step_deformation_gradient_;
@@ -102,6 +102,18 @@ class FemElement {
     return static_cast<const DerivedElement*>(this)->DoComputeData(state);
   }
 
+  /* Computes the data of each of the `kBatch` `elements` given the `state`,
+   with the same result as `*data[k] = elements[k]->ComputeData(state)` for
+   each k. Elements may implement this to batch work across the elements, for
+   example through DeformationGradientData::UpdateDataBatch().
+   @pre Entries in `elements` and `data` are non-null. */
+  template <size_t kBatch>
+  static void ComputeDataBatch(
+      const std::array<const DerivedElement*, kBatch>& elements,
+      const FemState<T>& state, const std::array<Data*, kBatch>& data) {
+    DerivedElement::template DoComputeDataBatch<kBatch>(elements, state, data);
+  }
+
   /* Calculates the tangent matrix for the element by combining the stiffness
    matrix, damping matrix, and the mass matrix according to the given `weights`.
    In particular, given a weight of (w₀, w₁, w₂), the tangent matrix is equal to
@@ -254,6 +266,19 @@ class FemElement {
     ThrowIfNotImplemented(__func__);
   }
 
+  /* `DerivedElement` may shadow `DoComputeDataBatch()` to compute the data of
+   several elements together. By default, the data of each element is computed
+   on its own with ComputeData(). */
+  template <size_t kBatch>
+  static void DoComputeDataBatch(
+      const std::array<const DerivedElement*, kBatch>& elements,
+      const FemState<T>& state, const std::array<Data*, kBatch>& data) {
+    for (size_t k = 0; k < kBatch; ++k) {
+      DRAKE_ASSERT(elements[k] != nullptr && data[k] != nullptr);
+      *data[k] = elements[k]->ComputeData(state);
+    }
+  }
+
   /* `DerivedElement` must provide an implementation for
    `DoCalcInverseDynamics()` to provide the external force required to keep the
    element's state given by `data` in equilibrium. The caller guarantees that
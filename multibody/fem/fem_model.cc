@@ -1,5 +1,7 @@
 #include "drake/multibody/fem/fem_model.h"
 
+#include <map>
+
 namespace drake {
 namespace multibody {
 namespace fem {
@@ -29,6 +31,7 @@ std::unique_ptr<FemModel<T>> FemModel<T>::Clone() const {
   std::unique_ptr<FemModel<T>> result = this->DoClone();
   result->UpdateFemStateSystem();
   result->dirichlet_bc_ = this->dirichlet_bc_;
+  result->parallelism_ = this->parallelism_;
   return result;
 }
 
@@ -78,6 +81,64 @@ FemModel<T>::MakeTangentMatrix() const {
   }
 }
 
+template <typename T>
+void FemModel<T>::ApplyTangentMatrix(const FemState<T>& fem_state,
+                                     const Vector3<T>& weights,
+                                     const Eigen::Ref<const VectorX<T>>& x,
+                                     EigenPtr<VectorX<T>> y) const {
+  if constexpr (std::is_same_v<T, double>) {
+    DRAKE_DEMAND(y != nullptr);
+    DRAKE_DEMAND(x.size() == num_dofs());
+    DRAKE_DEMAND(y->size() == num_dofs());
+    DRAKE_THROW_UNLESS(weights.minCoeff() >= 0.0);
+    ThrowIfModelStateIncompatible(__func__, fem_state);
+    const std::map<FemNodeIndex, internal::NodeState<T>>&
+        boundary_nodes = dirichlet_bc_.index_to_boundary_state();
+    if (boundary_nodes.empty()) {
+      DoApplyTangentMatrix(fem_state, weights, x, y, nullptr);
+      return;
+    }
+    /* Mirror ApplyBoundaryConditionToTangentMatrix(): the rows and columns for
+     the DoFs under the BC are zeroed out except for the diagonal entries. */
+    VectorX<T> x_free = x;
+    dirichlet_bc_.ApplyHomogeneousBoundaryCondition(&x_free);
+    VectorX<T> diagonal(num_dofs());
+    DoApplyTangentMatrix(fem_state, weights, x_free, y, &diagonal);
+    for (const auto& [node, unused_state] : boundary_nodes) {
+      y->template segment<3>(3 * node) =
+          diagonal.template segment<3>(3 * node).cwiseProduct(
+              x.template segment<3>(3 * node));
+    }
+  } else {
+    throw std::logic_error(
+        "FemModel::ApplyTangentMatrix() only supports double at the moment.");
+  }
+}
+
+template <typename T>
+void FemModel<T>::CalcTangentMatrixDiagonalBlocks(
+    const FemState<T>& fem_state, const Vector3<T>& weights,
+    std::vector<Matrix3<T>>* diagonal_blocks) const {
+  if constexpr (std::is_same_v<T, double>) {
+    DRAKE_DEMAND(diagonal_blocks != nullptr);
+    DRAKE_THROW_UNLESS(weights.minCoeff() >= 0.0);
+    ThrowIfModelStateIncompatible(__func__, fem_state);
+    diagonal_blocks->resize(num_nodes());
+    DoCalcTangentMatrixDiagonalBlocks(fem_state, weights, diagonal_blocks);
+    /* Mirror ApplyBoundaryConditionToTangentMatrix(): only the diagonal
+     entries of the diagonal blocks are kept for the nodes under the BC. */
+    for (const auto& [node, unused_state] :
+         dirichlet_bc_.index_to_boundary_state()) {
+      Matrix3<T>& block = diagonal_blocks->at(node);
+      block = block.diagonal().eval().asDiagonal();
+    }
+  } else {
+    throw std::logic_error(
+        "FemModel::CalcTangentMatrixDiagonalBlocks() only supports double at "
+        "the moment.");
+  }
+}
+
 template <typename T>
 void FemModel<T>::ApplyBoundaryCondition(FemState<T>* fem_state) const {
   DRAKE_DEMAND(fem_state != nullptr);
@@ -10,6 +10,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/block_sparse_lower_triangular_or_symmetric_matrix.h"
 #include "drake/multibody/fem/dirichlet_boundary_condition.h"
 #include "drake/multibody/fem/fem_plant_data.h"
@@ -182,6 +183,33 @@ class FemModel {
   std::unique_ptr<contact_solvers::internal::Block3x3SparseSymmetricMatrix>
   MakeTangentMatrix() const;
 
+  /** Computes y = A⋅x where A is the tangent matrix that CalcTangentMatrix()
+   computes for the same `fem_state` and `weights`. The product is accumulated
+   element by element without assembling A, and therefore the memory required
+   scales with the number of nodes instead of the number of nonzero entries in
+   A.
+   @pre y != nullptr.
+   @pre The sizes of `x` and `y` are `num_dofs()`.
+   @pre All entries in `weights` are non-negative.
+   @throws std::exception if the FEM state is incompatible with this model.
+   @throws std::exception if T is not double. */
+  void ApplyTangentMatrix(const FemState<T>& fem_state,
+                          const Vector3<T>& weights,
+                          const Eigen::Ref<const VectorX<T>>& x,
+                          EigenPtr<VectorX<T>> y) const;
+
+  /** Computes the 3x3 diagonal blocks of the tangent matrix that
+   CalcTangentMatrix() computes for the same `fem_state` and `weights`, without
+   assembling the full matrix. `(*diagonal_blocks)[i]` is set to the block
+   associated with the i-th node.
+   @pre diagonal_blocks != nullptr.
+   @pre All entries in `weights` are non-negative.
+   @throws std::exception if the FEM state is incompatible with this model.
+   @throws std::exception if T is not double. */
+  void CalcTangentMatrixDiagonalBlocks(
+      const FemState<T>& fem_state, const Vector3<T>& weights,
+      std::vector<Matrix3<T>>* diagonal_blocks) const;
+
   /** Applies boundary condition set for this %FemModel to the input `state`.
    No-op if no boundary condition is set.
    @pre fem_state != nullptr.
@@ -202,6 +230,19 @@ class FemModel {
     return dirichlet_bc_;
   }
 
+  /** Sets the degree of parallelism used by CalcResidual(),
+   CalcTangentMatrix(), and the evaluation of the per-element data they use.
+   With more than one thread, elements are partitioned into groups (colors) of
+   elements that share no nodes, and the elements in each group are processed
+   concurrently. Since the contributions of the elements are then summed in a
+   different order, results may differ from the serial computation by
+   round-off, but they do not depend on the number of threads. With
+   Parallelism::None(), the default, elements are processed serially. */
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /** Returns the parallelism set with set_parallelism(). */
+  Parallelism parallelism() const { return parallelism_; }
+
   /** Returns true the equation G(x, v, a) = 0 (see class documentation)
    corresponding to this %FemModel is linear. */
   bool is_linear() const { return do_is_linear(); }
@@ -251,6 +292,29 @@ class FemModel {
       contact_solvers::internal::Block3x3SparseSymmetricMatrix>
   DoMakeTangentMatrix() const = 0;
 
+  /** FemModelImpl must override this method to provide an implementation for
+   the NVI ApplyTangentMatrix(). It computes y = K⋅x where K is the tangent
+   matrix *without* the Dirichlet boundary condition applied. If `diagonal` is
+   not null, it also writes the diagonal of K to `diagonal`. The input
+   `fem_state` is guaranteed to be compatible with `this` FEM model, the inputs
+   `x`, `y`, and `diagonal` (if not null) are guaranteed to be properly sized,
+   and `y` is guaranteed to be non-null. */
+  virtual void DoApplyTangentMatrix(const FemState<T>& fem_state,
+                                    const Vector3<T>& weights,
+                                    const Eigen::Ref<const VectorX<T>>& x,
+                                    EigenPtr<VectorX<T>> y,
+                                    EigenPtr<VectorX<T>> diagonal) const = 0;
+
+  /** FemModelImpl must override this method to provide an implementation for
+   the NVI CalcTangentMatrixDiagonalBlocks(). It computes the diagonal blocks
+   of the tangent matrix *without* the Dirichlet boundary condition applied.
+   The input `fem_state` is guaranteed to be compatible with `this` FEM model,
+   and `diagonal_blocks` is guaranteed to be non-null and of size
+   `num_nodes()`. */
+  virtual void DoCalcTangentMatrixDiagonalBlocks(
+      const FemState<T>& fem_state, const Vector3<T>& weights,
+      std::vector<Matrix3<T>>* diagonal_blocks) const = 0;
+
   /** Updates the system that manages the states and the cache entries of this
    FEM model. Must be called before calling MakeFemState() after the FEM model
    changes (e.g. adding new elements). */
@@ -277,6 +341,8 @@ class FemModel {
   std::unique_ptr<internal::FemStateSystem<T>> fem_state_system_;
   /* The Dirichlet boundary condition that the model is subject to. */
   internal::DirichletBoundaryCondition<T> dirichlet_bc_;
+  /* The parallelism used to process the elements of this model. */
+  Parallelism parallelism_{Parallelism::None()};
 };
 
 }  // namespace fem
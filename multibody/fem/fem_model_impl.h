@@ -14,6 +14,7 @@
 #include "drake/multibody/fem/fem_element.h"
 #include "drake/multibody/fem/fem_indexes.h"
 #include "drake/multibody/fem/fem_model.h"
+#include "drake/multibody/fem/matrix_utilities.h"
 
 namespace drake {
 namespace multibody {
@@ -50,6 +51,7 @@ class FemModelImpl : public FemModel<typename Element::T> {
    FemModelImpl. */
   void AddElement(Element&& element) {
     elements_.emplace_back(std::move(element));
+    ColorElements(num_elements() - 1);
   }
 
   /* Moves the input `elements`' entries into the vector of elements owned by
@@ -58,9 +60,11 @@ class FemModelImpl : public FemModel<typename Element::T> {
    @pre elements != nullptr */
   void AddElements(std::vector<Element>* elements) {
     DRAKE_DEMAND(elements != nullptr);
+    const int first_new_element = num_elements();
     elements_.insert(elements_.end(),
                      std::make_move_iterator(elements->begin()),
                      std::make_move_iterator(elements->end()));
+    ColorElements(first_new_element);
   }
 
   /* Returns all elements stored in this model. */
@@ -74,6 +78,8 @@ class FemModelImpl : public FemModel<typename Element::T> {
    from the `other` FemModelImpl to `this` FemModelImpl . */
   void SetFrom(const FemModelImpl<Element>& other) {
     elements_ = other.elements_;
+    elements_by_color_ = other.elements_by_color_;
+    node_colors_ = other.node_colors_;
   }
 
  private:
@@ -84,18 +90,15 @@ class FemModelImpl : public FemModel<typename Element::T> {
      the old data. */
     residual->setZero();
     constexpr int kDim = 3;
-    /* Scratch space to store the contribution to the residual from each
-     element. */
-    Vector<T, Element::num_dofs> element_residual;
     const std::vector<Data>& element_data =
         fem_state.template EvalElementData<Data>(element_data_index_);
-    for (int e = 0; e < num_elements(); ++e) {
-      /* residual = Ma-fₑ(x)-fᵥ(x, v)-fₑₓₜ. */
-      /* The Ma-fₑ(x)-fᵥ(x, v) term. */
-      elements_[e].CalcInverseDynamics(element_data[e], &element_residual);
-      /* The -fₑₓₜ term. */
-      elements_[e].AddScaledExternalForces(element_data[e], plant_data, -1.0,
-                                           &element_residual);
+    /* External force densities may evaluate the plant context and its caches,
+     which must not be done concurrently. Therefore, when elements are
+     processed concurrently, the external forces are added in a second, serial
+     pass. */
+    const bool is_parallel = this->parallelism().num_threads() > 1;
+    const auto add_to_residual = [&](
+        int e, const Vector<T, Element::num_dofs>& element_residual) {
       const std::array<FemNodeIndex, Element::num_nodes>& element_node_indices =
           elements_[e].node_indices();
       for (int a = 0; a < Element::num_nodes; ++a) {
@@ -103,6 +106,29 @@ class FemModelImpl : public FemModel<typename Element::T> {
         residual->template segment<kDim>(global_node * kDim) +=
             element_residual.template segment<kDim>(a * kDim);
       }
+    };
+    ForEachElement([&](int e) {
+      /* Scratch space to store the contribution to the residual from this
+       element. */
+      Vector<T, Element::num_dofs> element_residual;
+      /* residual = Ma-fₑ(x)-fᵥ(x, v)-fₑₓₜ. */
+      /* The Ma-fₑ(x)-fᵥ(x, v) term. */
+      elements_[e].CalcInverseDynamics(element_data[e], &element_residual);
+      /* The -fₑₓₜ term. */
+      if (!is_parallel) {
+        elements_[e].AddScaledExternalForces(element_data[e], plant_data, -1.0,
+                                             &element_residual);
+      }
+      add_to_residual(e, element_residual);
+    });
+    if (is_parallel) {
+      Vector<T, Element::num_dofs> element_residual;
+      for (int e = 0; e < num_elements(); ++e) {
+        element_residual.setZero();
+        elements_[e].AddScaledExternalForces(element_data[e], plant_data, -1.0,
+                                             &element_residual);
+        add_to_residual(e, element_residual);
+      }
     }
   }
 
@@ -118,11 +144,11 @@ class FemModelImpl : public FemModel<typename Element::T> {
 
       const std::vector<Data>& element_data =
           fem_state.template EvalElementData<Data>(element_data_index_);
-      /* Scratch space to store the contribution to the tangent matrix from each
-       element. */
-      Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>
-          element_tangent_matrix;
-      for (int e = 0; e < num_elements(); ++e) {
+      ForEachElement([&](int e) {
+        /* Scratch space to store the contribution to the tangent matrix from
+         this element. */
+        Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>
+            element_tangent_matrix;
         elements_[e].CalcTangentMatrix(element_data[e], weights,
                                        &element_tangent_matrix);
         const std::array<FemNodeIndex, Element::num_nodes>&
@@ -142,7 +168,7 @@ class FemModelImpl : public FemModel<typename Element::T> {
             }
           }
         }
-      }
+      });
     } else {
       unused(fem_state, weights, tangent_matrix);
       DRAKE_UNREACHABLE();
@@ -191,6 +217,83 @@ class FemModelImpl : public FemModel<typename Element::T> {
     }
   }
 
+  void DoApplyTangentMatrix(const FemState<T>& fem_state,
+                            const Vector3<T>& weights,
+                            const Eigen::Ref<const VectorX<T>>& x,
+                            EigenPtr<VectorX<T>> y,
+                            EigenPtr<VectorX<T>> diagonal) const final {
+    /* We already check for the scalar type in `ApplyTangentMatrix()` but the
+     `if constexpr` here is still needed to make the compiler happy. */
+    if constexpr (std::is_same_v<T, double>) {
+      constexpr int kDim = 3;
+      y->setZero();
+      if (diagonal != nullptr) diagonal->setZero();
+      const std::vector<Data>& element_data =
+          fem_state.template EvalElementData<Data>(element_data_index_);
+      ForEachElement([&](int e) {
+        /* Scratch space for the element tangent matrix and the entries of x
+         and y associated with the nodes of this element. */
+        Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>
+            element_tangent_matrix;
+        elements_[e].CalcTangentMatrix(element_data[e], weights,
+                                       &element_tangent_matrix);
+        const std::array<FemNodeIndex, Element::num_nodes>&
+            element_node_indices = elements_[e].node_indices();
+        Vector<T, Element::num_dofs> element_x;
+        for (int a = 0; a < Element::num_nodes; ++a) {
+          element_x.template segment<kDim>(kDim * a) =
+              x.template segment<kDim>(kDim * element_node_indices[a]);
+        }
+        const Vector<T, Element::num_dofs> element_y =
+            element_tangent_matrix * element_x;
+        for (int a = 0; a < Element::num_nodes; ++a) {
+          const int i = element_node_indices[a];
+          y->template segment<kDim>(kDim * i) +=
+              element_y.template segment<kDim>(kDim * a);
+          if (diagonal != nullptr) {
+            diagonal->template segment<kDim>(kDim * i) +=
+                element_tangent_matrix.diagonal().template segment<kDim>(
+                    kDim * a);
+          }
+        }
+      });
+    } else {
+      unused(fem_state, weights, x, y, diagonal);
+      DRAKE_UNREACHABLE();
+    }
+  }
+
+  void DoCalcTangentMatrixDiagonalBlocks(
+      const FemState<T>& fem_state, const Vector3<T>& weights,
+      std::vector<Matrix3<T>>* diagonal_blocks) const final {
+    /* We already check for the scalar type in
+     `CalcTangentMatrixDiagonalBlocks()` but the `if constexpr` here is still
+     needed to make the compiler happy. */
+    if constexpr (std::is_same_v<T, double>) {
+      constexpr int kDim = 3;
+      std::fill(diagonal_blocks->begin(), diagonal_blocks->end(),
+                Matrix3<T>::Zero());
+      const std::vector<Data>& element_data =
+          fem_state.template EvalElementData<Data>(element_data_index_);
+      ForEachElement([&](int e) {
+        Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>
+            element_tangent_matrix;
+        elements_[e].CalcTangentMatrix(element_data[e], weights,
+                                       &element_tangent_matrix);
+        const std::array<FemNodeIndex, Element::num_nodes>&
+            element_node_indices = elements_[e].node_indices();
+        for (int a = 0; a < Element::num_nodes; ++a) {
+          (*diagonal_blocks)[element_node_indices[a]] +=
+              element_tangent_matrix.template block<kDim, kDim>(kDim * a,
+                                                                kDim * a);
+        }
+      });
+    } else {
+      unused(fem_state, weights, diagonal_blocks);
+      DRAKE_UNREACHABLE();
+    }
+  }
+
   void DeclareCacheEntries(
       internal::FemStateSystem<T>* fem_state_system) final {
     element_data_index_ =
@@ -210,13 +313,106 @@ class FemModelImpl : public FemModel<typename Element::T> {
     DRAKE_DEMAND(data != nullptr);
     data->resize(num_elements());
     const FemState<T> fem_state(&(this->fem_state_system()), &context);
-    for (int i = 0; i < num_elements(); ++i) {
+    /* The elements are processed in batches of kElementDataBatchSize so that
+     the constitutive models can batch their work (e.g., the polar
+     decompositions of the corotated models) across elements, which matters
+     most for elements with a single quadrature point. */
+    constexpr int kBatch = kElementDataBatchSize;
+    const int num_batches = num_elements() / kBatch;
+    /* Each element only writes its own data, so no coloring is needed. */
+    const int num_threads = this->parallelism().num_threads();
+    unused(num_threads);  // Only used with OpenMP.
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) if (num_threads > 1)
+#endif
+    for (int b = 0; b < num_batches; ++b) {
+      std::array<const Element*, kBatch> batch_elements;
+      std::array<Data*, kBatch> batch_data;
+      for (int k = 0; k < kBatch; ++k) {
+        batch_elements[k] = &elements_[b * kBatch + k];
+        batch_data[k] = &(*data)[b * kBatch + k];
+      }
+      Element::ComputeDataBatch(batch_elements, fem_state, batch_data);
+    }
+    for (int i = num_batches * kBatch; i < num_elements(); ++i) {
       (*data)[i] = elements_[i].ComputeData(fem_state);
     }
   }
 
+  /* The number of elements whose data are computed together in
+   CalcElementData(). Batching only pays off for T = double, for which
+   PolarDecomposeAll() uses the vectorized PolarDecomposeBatch(). */
+  static constexpr int kElementDataBatchSize =
+      std::is_same_v<T, double> ? kPolarDecomposeBatchSize : 1;
+
+  /* Invokes `calc(e)` for each element e, where `calc` may only modify
+   quantities associated with element e or with its nodes. With more than one
+   thread allowed by parallelism(), the elements are processed one color at a
+   time, and the elements of the same color, which share no nodes, are
+   processed concurrently. `calc` must not throw. */
+  template <typename Calc>
+  void ForEachElement(const Calc& calc) const {
+    const int num_threads = this->parallelism().num_threads();
+    if (num_threads <= 1) {
+      for (int e = 0; e < num_elements(); ++e) {
+        calc(e);
+      }
+      return;
+    }
+    for (const std::vector<int>& color : elements_by_color_) {
+      const int num_elements_in_color = color.size();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads)
+#endif
+      for (int k = 0; k < num_elements_in_color; ++k) {
+        calc(color[k]);
+      }
+    }
+  }
+
+  /* Assigns a color to each element with index `first_element` or greater, such
+   that elements of the same color share no nodes. Each element greedily takes
+   the smallest color not already taken by an element sharing one of its
+   nodes. */
+  void ColorElements(int first_element) {
+    for (int e = first_element; e < num_elements(); ++e) {
+      const std::array<FemNodeIndex, Element::num_nodes>& element_node_indices =
+          elements_[e].node_indices();
+      for (const FemNodeIndex& node : element_node_indices) {
+        if (node >= static_cast<int>(node_colors_.size())) {
+          node_colors_.resize(node + 1);
+        }
+      }
+      const auto is_taken = [&](int color) {
+        for (const FemNodeIndex& node : element_node_indices) {
+          const std::vector<int>& taken = node_colors_[node];
+          if (std::find(taken.begin(), taken.end(), color) != taken.end()) {
+            return true;
+          }
+        }
+        return false;
+      };
+      int color = 0;
+      while (is_taken(color)) {
+        ++color;
+      }
+      if (color == static_cast<int>(elements_by_color_.size())) {
+        elements_by_color_.emplace_back();
+      }
+      elements_by_color_[color].push_back(e);
+      for (const FemNodeIndex& node : element_node_indices) {
+        node_colors_[node].push_back(color);
+      }
+    }
+  }
+
   /* FemElements owned by this model. */
   std::vector<Element> elements_;
+  /* elements_by_color_[c] lists the indices of the elements with color c, in
+   increasing order. See ColorElements(). */
+  std::vector<std::vector<int>> elements_by_color_;
+  /* node_colors_[n] lists the colors of the elements that share node n. */
+  std::vector<std::vector<int>> node_colors_;
   systems::CacheIndex element_data_index_;
 };
 
@@ -1,7 +1,11 @@
 #include "drake/multibody/fem/fem_solver.h"
 
 #include <algorithm>
+#include <cmath>
+#include <memory>
+#include <utility>
 
+#include "drake/common/ssize.h"
 #include "drake/common/text_logging.h"
 
 namespace drake {
@@ -14,6 +18,15 @@ using contact_solvers::internal::SchurComplement;
 using LinearSolver =
     contact_solvers::internal::BlockSparseCholeskySolver<Matrix3<double>>;
 
+namespace {
+
+/* The tolerance of the conjugate gradient solves with the D block of the
+ tangent matrix in FemSolver's matrix-free Schur complement, relative to the
+ norm of the right-hand side. */
+constexpr double kSchurComplementRelativeTolerance = 1e-10;
+
+}  // namespace
+
 template <typename T>
 FemSolver<T>::FemStateAndSchurComplement::FemStateAndSchurComplement(
     const FemModel<T>& model)
@@ -25,30 +38,44 @@ FemSolver<T>::FemStateAndSchurComplement::~FemStateAndSchurComplement() =
 
 template <typename T>
 FemSolver<T>::Scratch::Scratch(const FemModel<T>& model) {
-  ReinitializeIfNeeded(model);
+  ReinitializeIfNeeded(model, /* use_direct_solver = */ true);
 }
 
 template <typename T>
 FemSolver<T>::Scratch::~Scratch() = default;
 
 template <typename T>
-void FemSolver<T>::Scratch::ReinitializeIfNeeded(const FemModel<T>& model) {
+void FemSolver<T>::Scratch::ReinitializeIfNeeded(const FemModel<T>& model,
+                                                 bool use_direct_solver) {
   if (b.size() != model.num_dofs()) {
     b.resize(model.num_dofs());
     dz.resize(model.num_dofs());
-    tangent_matrix = model.MakeTangentMatrix();
-    /* For non-linear models, we use a BlockSparseCholeskySolver to solve the
-     linear systems from Newton-Raphson iterations. This usually allow for
-     better elimination ordering. In addition, since the sparsity pattern
-     remains unchanged throughout Newton iterations, using the linear solver
-     prevents reallocation for the L matrix in the Cholesky factorizations. For
-     linear models, we use `schur_complement` to both solve the linear system
-     and to find the Schur complement to avoid factoring the matrix more times
-     than necessary.
-    */
-    if (!model.is_linear()) {
-      linear_solver.SetMatrix(*tangent_matrix);
+    tangent_matrix = nullptr;
+    linear_solver = LinearSolver{};
+  }
+  if (!use_direct_solver) {
+    /* Release the storage of any earlier direct solves. */
+    if (tangent_matrix != nullptr) {
+      tangent_matrix = nullptr;
+      linear_solver = LinearSolver{};
     }
+    return;
+  }
+  if (tangent_matrix == nullptr) {
+    tangent_matrix = model.MakeTangentMatrix();
+  }
+  /* For non-linear models, we use a BlockSparseCholeskySolver to solve the
+   linear systems from Newton-Raphson iterations. This usually allow for
+   better elimination ordering. In addition, since the sparsity pattern
+   remains unchanged throughout Newton iterations, using the linear solver
+   prevents reallocation for the L matrix in the Cholesky factorizations. For
+   linear models, we use `schur_complement` to both solve the linear system
+   and to find the Schur complement to avoid factoring the matrix more times
+   than necessary. A model without any dofs has nothing to analyze.
+  */
+  if (!model.is_linear() && model.num_dofs() > 0 &&
+      linear_solver.solver_mode() == LinearSolver::SolverMode::kEmpty) {
+    linear_solver.SetMatrix(*tangent_matrix);
   }
 }
 
@@ -71,14 +98,24 @@ int FemSolver<T>::AdvanceOneTimeStep(
     const FemState<T>& prev_state, const FemPlantData<T>& plant_data,
     const std::unordered_set<int>& nonparticipating_vertices) {
   model_->ThrowIfModelStateIncompatible(__func__, prev_state);
+  stats_.Reset();
   next_state_and_schur_complement_.ReinitializeIfNeeded(*model_);
-  scratch_.ReinitializeIfNeeded(*model_);
+  scratch_.ReinitializeIfNeeded(*model_, !matrix_free_);
   const VectorX<T>& unknown_variable = integrator_->GetUnknowns(prev_state);
   FemState<T>* next_state =
       next_state_and_schur_complement_.state.get_mutable();
   integrator_->AdvanceOneTimeStep(prev_state, unknown_variable, next_state);
   if (model_->is_linear()) {
-    return SolveLinearModel(plant_data, nonparticipating_vertices);
+    const int iterations =
+        SolveLinearModel(plant_data, nonparticipating_vertices);
+    if (iterations == -1) {
+      throw std::runtime_error(
+          "FemSolver::AdvanceOneTimeStep() failed to converge on a linear FEM "
+          "model because the matrix-free linear solve reached its iteration "
+          "limit. Consider using a smaller timestep or reduce the stiffness of "
+          "the material.");
+    }
+    return iterations;
   }
   /* Run Newton-Raphson iterations. */
   const int iterations =
@@ -107,20 +144,29 @@ int FemSolver<T>::SolveLinearModel(
   FemState<T>& state = *next_state_and_schur_complement_.state;
   VectorX<T>& b = scratch_.b;
   VectorX<T>& dz = scratch_.dz;
-  Block3x3SparseSymmetricMatrix& tangent_matrix = *scratch_.tangent_matrix;
 
   model_->ApplyBoundaryCondition(&state);
   model_->CalcResidual(state, plant_data, &b);
   T residual_norm = b.norm();
-  model_->CalcTangentMatrix(state, integrator_->GetWeights(), &tangent_matrix);
-  next_state_and_schur_complement_.schur_complement =
-      contact_solvers::internal::SchurComplement(tangent_matrix,
-                                                 nonparticipating_vertices);
+  stats_.residual_norms.push_back(residual_norm);
+  /* The tangent matrix of a linear model doesn't depend on the state, so the
+   Schur complement can be computed before the state is updated. With a direct
+   solver, the factorization from the Schur complement is reused for the
+   solve. In matrix-free mode, nothing is factored. */
+  CalcSchurComplement(nonparticipating_vertices);
   if (residual_norm < absolute_tolerance_) {
     return 0;
   }
-  dz = next_state_and_schur_complement_.schur_complement.Solve(-b);
+  if (matrix_free_) {
+    if (!SolveMatrixFree(std::max(relative_tolerance_ * residual_norm,
+                                  absolute_tolerance_))) {
+      return -1;
+    }
+  } else {
+    dz = next_state_and_schur_complement_.schur_complement.Solve(-b);
+  }
   integrator_->UpdateStateFromChangeInUnknowns(dz, &state);
+  stats_.num_iterations = 1;
   return 1;
 }
 
@@ -131,15 +177,18 @@ int FemSolver<T>::SolveNonlinearModel(
   DRAKE_DEMAND(!model_->is_linear());
   VectorX<T>& b = scratch_.b;
   VectorX<T>& dz = scratch_.dz;
-  Block3x3SparseSymmetricMatrix& tangent_matrix = *scratch_.tangent_matrix;
-  LinearSolver& linear_solver = scratch_.linear_solver;
   FemState<T>& state = *next_state_and_schur_complement_.state;
 
   model_->ApplyBoundaryCondition(&state);
   model_->CalcResidual(state, plant_data, &b);
   T residual_norm = b.norm();
+  stats_.residual_norms.push_back(residual_norm);
   const T initial_residual_norm = residual_norm;
   int iter = 0;
+  /* Whether the tangent matrix must be refreshed before the next iteration
+   even if the factorization in `linear_solver` hasn't reached the refresh
+   interval. */
+  bool refresh_tangent = false;
   /* For non-linear FEM models, the system of equations is non-linear and we use
    a Newton-Raphson solver. We iterate until any of the following is true:
    1. The max number of allowed iterations is reached;
@@ -149,35 +198,331 @@ int FemSolver<T>::SolveNonlinearModel(
   while (iter < max_iterations_ &&
          /* On first iteration, this is equivalent to residual_norm < abs_tol */
          !solver_converged(residual_norm, initial_residual_norm)) {
-    model_->CalcTangentMatrix(state, integrator_->GetWeights(),
-                              &tangent_matrix);
-    linear_solver.UpdateMatrix(tangent_matrix);
-    const bool factored = linear_solver.Factor();
-    if (!factored) {
-      throw std::runtime_error(
-          "Tangent matrix factorization failed in FemSolver because the FEM "
-          "tangent matrix is not symmetric positive definite (SPD). This may "
-          "be triggered by a combination of a stiff nonlinear constitutive "
-          "model and a large time step.");
+    if (matrix_free_) {
+      /* Inexact Newton: the linear system only needs to be solved to a
+       relative accuracy proportional to the square root of the relative
+       residual, which retains superlinear convergence [Eisenstat and Walker,
+       1996], and no more accurately than needed to meet the tolerances of the
+       nonlinear solve.
+
+       [Eisenstat and Walker, 1996] Eisenstat, Stanley C., and Homer F. Walker.
+       "Choosing the forcing terms in an inexact Newton method." SIAM Journal
+       on Scientific Computing 17.1 (1996): 16-32. */
+      const T forcing_term =
+          std::min(0.1, std::sqrt(residual_norm / initial_residual_norm));
+      const T nonlinear_tolerance = std::max(
+          relative_tolerance_ * initial_residual_norm, absolute_tolerance_);
+      /* An unconverged solve still gives an inexact Newton step; it is
+       recorded in the statistics, and convergence is decided by the
+       residual. */
+      SolveMatrixFree(
+          std::max(forcing_term * residual_norm, 0.1 * nonlinear_tolerance));
+      integrator_->UpdateStateFromChangeInUnknowns(dz, &state);
+      model_->CalcResidual(state, plant_data, &b);
+      residual_norm = b.norm();
+      stats_.residual_norms.push_back(residual_norm);
+      ++iter;
+      continue;
+    }
+
+    LinearSolver& linear_solver = scratch_.linear_solver;
+    const bool lagged_tangent =
+        !refresh_tangent &&
+        linear_solver.solver_mode() == LinearSolver::SolverMode::kFactored &&
+        scratch_.num_iterations_with_tangent < tangent_refresh_interval_;
+    if (!lagged_tangent) {
+      Block3x3SparseSymmetricMatrix& tangent_matrix = *scratch_.tangent_matrix;
+      model_->CalcTangentMatrix(state, integrator_->GetWeights(),
+                                &tangent_matrix);
+      linear_solver.UpdateMatrix(tangent_matrix);
+      const bool factored = linear_solver.Factor();
+      if (!factored) {
+        throw std::runtime_error(
+            "Tangent matrix factorization failed in FemSolver because the FEM "
+            "tangent matrix is not symmetric positive definite (SPD). This may "
+            "be triggered by a combination of a stiff nonlinear constitutive "
+            "model and a large time step.");
+      }
+      scratch_.num_iterations_with_tangent = 0;
+      refresh_tangent = false;
+      ++stats_.num_tangent_updates;
     }
     dz = linear_solver.Solve(-b);
+    ++scratch_.num_iterations_with_tangent;
     integrator_->UpdateStateFromChangeInUnknowns(dz, &state);
     model_->CalcResidual(state, plant_data, &b);
+    const T previous_residual_norm = residual_norm;
     residual_norm = b.norm();
     ++iter;
+    if (lagged_tangent && residual_norm > lagged_tangent_residual_ratio_ *
+                                              previous_residual_norm) {
+      refresh_tangent = true;
+      if (residual_norm >= previous_residual_norm) {
+        /* Reject the iteration. The state is affine in the unknowns (see
+         DiscreteTimeIntegrator::UpdateStateFromChangeInUnknowns()), so the
+         update is undone by applying its negation. */
+        dz = -dz;
+        integrator_->UpdateStateFromChangeInUnknowns(dz, &state);
+        model_->CalcResidual(state, plant_data, &b);
+        residual_norm = b.norm();
+        ++stats_.num_rejected_iterations;
+        continue;
+      }
+    }
+    stats_.residual_norms.push_back(residual_norm);
   }
+  stats_.num_iterations = iter;
   if (!solver_converged(residual_norm, initial_residual_norm)) {
     /* Solver failed to converge with max number of Newton iterations. */
     return -1;
   }
   /* Build the Schur complement after the Newton iterations have converged. */
-  model_->CalcTangentMatrix(state, integrator_->GetWeights(), &tangent_matrix);
-  next_state_and_schur_complement_.schur_complement =
-      contact_solvers::internal::SchurComplement(tangent_matrix,
-                                                 nonparticipating_vertices);
+  CalcSchurComplement(nonparticipating_vertices);
   return iter;
 }
 
+template <typename T>
+void FemSolver<T>::CalcPreconditioner() {
+  std::vector<Matrix3<T>>& preconditioner = scratch_.preconditioner;
+  model_->CalcTangentMatrixDiagonalBlocks(
+      *next_state_and_schur_complement_.state, integrator_->GetWeights(),
+      &preconditioner);
+  for (Matrix3<T>& block : preconditioner) {
+    const Eigen::LLT<Matrix3<T>> llt(block);
+    if (llt.info() != Eigen::Success) {
+      throw std::runtime_error(
+          "The block Jacobi preconditioner in FemSolver's matrix-free solve "
+          "failed because the FEM tangent matrix is not symmetric positive "
+          "definite (SPD). This may be triggered by a combination of a stiff "
+          "nonlinear constitutive model and a large time step.");
+    }
+    block = llt.solve(Matrix3<T>::Identity());
+  }
+}
+
+template <typename T>
+bool FemSolver<T>::RunConjugateGradient(
+    const FemModel<T>& model, const FemState<T>& state,
+    const Vector3<T>& weights, const std::vector<Matrix3<T>>& preconditioner,
+    const VectorX<T>& rhs, const T& tolerance,
+    const std::vector<int>& excluded_vertices,
+    ConjugateGradientScratch* scratch, VectorX<T>* x, int* num_iterations) {
+  DRAKE_DEMAND(scratch != nullptr);
+  DRAKE_DEMAND(x != nullptr);
+  DRAKE_DEMAND(num_iterations != nullptr);
+  const int num_dofs = model.num_dofs();
+  DRAKE_DEMAND(ssize(preconditioner) == model.num_nodes());
+  VectorX<T>& r = scratch->residual;
+  VectorX<T>& z = scratch->preconditioned_residual;
+  VectorX<T>& p = scratch->direction;
+  VectorX<T>& Ap = scratch->tangent_times_direction;
+  r.resize(num_dofs);
+  z.resize(num_dofs);
+  p.resize(num_dofs);
+  Ap.resize(num_dofs);
+
+  const auto apply_preconditioner = [&preconditioner](const VectorX<T>& u,
+                                                      VectorX<T>* v) {
+    for (int i = 0; i < ssize(preconditioner); ++i) {
+      v->template segment<3>(3 * i) =
+          preconditioner[i] * u.template segment<3>(3 * i);
+    }
+  };
+  /* Applies the submatrix of A without the excluded vertices. The residual and
+   the search directions stay zero for the excluded vertices. */
+  const auto apply_tangent_matrix = [&](const VectorX<T>& u, VectorX<T>* v) {
+    model.ApplyTangentMatrix(state, weights, u, v);
+    for (int vertex : excluded_vertices) {
+      v->template segment<3>(3 * vertex).setZero();
+    }
+  };
+
+  x->setZero(num_dofs);
+  r = rhs;
+  int iter = 0;
+  bool converged = r.norm() <= tolerance;
+  if (!converged) {
+    apply_preconditioner(r, &z);
+    p = z;
+    T rz = r.dot(z);
+    while (iter < num_dofs) {
+      apply_tangent_matrix(p, &Ap);
+      const T pAp = p.dot(Ap);
+      if (!(pAp > 0)) {
+        throw std::runtime_error(
+            "The conjugate gradient iterations in FemSolver's matrix-free "
+            "solve failed because the FEM tangent matrix is not symmetric "
+            "positive definite (SPD). This may be triggered by a combination "
+            "of a stiff nonlinear constitutive model and a large time step.");
+      }
+      const T alpha = rz / pAp;
+      *x += alpha * p;
+      r -= alpha * Ap;
+      ++iter;
+      if (r.norm() <= tolerance) {
+        converged = true;
+        break;
+      }
+      apply_preconditioner(r, &z);
+      const T rz_next = r.dot(z);
+      p = z + (rz_next / rz) * p;
+      rz = rz_next;
+    }
+  }
+  *num_iterations = iter;
+  return converged;
+}
+
+template <typename T>
+bool FemSolver<T>::SolveConjugateGradient(
+    const VectorX<T>& rhs, const T& tolerance,
+    const std::vector<int>& excluded_vertices, VectorX<T>* x) {
+  int num_iterations = 0;
+  const bool converged = RunConjugateGradient(
+      *model_, *next_state_and_schur_complement_.state,
+      integrator_->GetWeights(), scratch_.preconditioner, rhs, tolerance,
+      excluded_vertices, &scratch_.conjugate_gradient, x, &num_iterations);
+  stats_.num_conjugate_gradient_iterations += num_iterations;
+  if (!converged) {
+    ++stats_.num_unconverged_conjugate_gradient_solves;
+  }
+  return converged;
+}
+
+template <typename T>
+bool FemSolver<T>::SolveMatrixFree(const T& tolerance) {
+  CalcPreconditioner();
+  /* Solve A⋅(-dz) = b and negate the result in place. */
+  VectorX<T>& dz = scratch_.dz;
+  const bool converged =
+      SolveConjugateGradient(scratch_.b, tolerance, {}, &dz);
+  dz = -dz;
+  return converged;
+}
+
+template <typename T>
+void FemSolver<T>::CalcSchurComplement(
+    const std::unordered_set<int>& nonparticipating_vertices) {
+  if (matrix_free_) {
+    CalcSchurComplementMatrixFree(nonparticipating_vertices);
+    return;
+  }
+  Block3x3SparseSymmetricMatrix& tangent_matrix = *scratch_.tangent_matrix;
+  model_->CalcTangentMatrix(*next_state_and_schur_complement_.state,
+                            integrator_->GetWeights(), &tangent_matrix);
+  /* Update the Schur complement in place so that the symbolic analysis of the
+   tangent matrix from the previous time step is reused. */
+  next_state_and_schur_complement_.schur_complement.Update(
+      tangent_matrix, nonparticipating_vertices);
+}
+
+template <typename T>
+void FemSolver<T>::CalcSchurComplementMatrixFree(
+    const std::unordered_set<int>& nonparticipating_vertices) {
+  const int num_nodes = model_->num_nodes();
+  if (ssize(nonparticipating_vertices) == num_nodes) {
+    next_state_and_schur_complement_.schur_complement = SchurComplement{};
+    return;
+  }
+  /* The vertices of the C and D blocks, sorted as in SchurComplement. */
+  std::vector<int> participating;
+  std::vector<int> nonparticipating;
+  for (int v = 0; v < num_nodes; ++v) {
+    if (nonparticipating_vertices.contains(v)) {
+      nonparticipating.push_back(v);
+    } else {
+      participating.push_back(v);
+    }
+  }
+  const int num_C_dofs = 3 * ssize(participating);
+  const FemState<T>& state = *next_state_and_schur_complement_.state;
+  const Vector3<T>& weights = integrator_->GetWeights();
+  const int num_dofs = model_->num_dofs();
+
+  CalcPreconditioner();
+  MatrixX<T> S(num_C_dofs, num_C_dofs);
+  VectorX<T> unit_vector = VectorX<T>::Zero(num_dofs);
+  VectorX<T> column(num_dofs);
+  VectorX<T> x(num_dofs);
+  for (int j = 0; j < num_C_dofs; ++j) {
+    const int dof = 3 * participating[j / 3] + j % 3;
+    unit_vector(dof) = 1.0;
+    model_->ApplyTangentMatrix(state, weights, unit_vector, &column);
+    unit_vector(dof) = 0.0;
+    for (int i = 0; i < ssize(participating); ++i) {
+      S.template block<3, 1>(3 * i, j) =
+          column.template segment<3>(3 * participating[i]);
+      column.template segment<3>(3 * participating[i]).setZero();
+    }
+    /* `column` now holds the j-th column of B, scattered into the dofs of the
+     nonparticipating vertices. An unconverged solve is recorded in the
+     statistics. */
+    SolveConjugateGradient(column,
+                           kSchurComplementRelativeTolerance * column.norm(),
+                           participating, &x);
+    /* x = D⁻¹B⋅eⱼ is zero for the participating dofs, so the participating
+     part of A⋅x is Bᵀ⋅x. */
+    model_->ApplyTangentMatrix(state, weights, x, &column);
+    for (int i = 0; i < ssize(participating); ++i) {
+      S.template block<3, 1>(3 * i, j) -=
+          column.template segment<3>(3 * participating[i]);
+    }
+  }
+  /* Remove the asymmetry from the inexact solves. */
+  S = 0.5 * (S + S.transpose()).eval();
+
+  /* SolveForX() computes x = -D⁻¹B⋅y with one more conjugate gradient solve.
+   It may be called after `this` solver has moved on to later time steps, or
+   through a copy of the Schur complement, so it owns a copy of the state and
+   of the preconditioner. */
+  struct SolveForXData {
+    const FemModel<T>* model{};
+    std::unique_ptr<FemState<T>> state;
+    Vector3<T> weights;
+    std::vector<Matrix3<T>> preconditioner;
+    std::vector<int> participating;
+    std::vector<int> nonparticipating;
+  };
+  auto data = std::make_shared<SolveForXData>();
+  data->model = model_;
+  data->state = state.Clone();
+  data->weights = weights;
+  data->preconditioner = scratch_.preconditioner;
+  data->participating = std::move(participating);
+  data->nonparticipating = std::move(nonparticipating);
+  auto solve_for_x = [data = std::shared_ptr<const SolveForXData>(
+                          std::move(data))](const VectorX<double>& y) {
+    const int num_model_dofs = data->model->num_dofs();
+    /* Scatter y into the participating dofs and compute B⋅y. */
+    VectorX<T> u = VectorX<T>::Zero(num_model_dofs);
+    for (int i = 0; i < ssize(data->participating); ++i) {
+      u.template segment<3>(3 * data->participating[i]) =
+          y.template segment<3>(3 * i);
+    }
+    VectorX<T> By(num_model_dofs);
+    data->model->ApplyTangentMatrix(*data->state, data->weights, u, &By);
+    for (int vertex : data->participating) {
+      By.template segment<3>(3 * vertex).setZero();
+    }
+    ConjugateGradientScratch cg_scratch;
+    int num_iterations = 0;
+    RunConjugateGradient(*data->model, *data->state, data->weights,
+                         data->preconditioner, By,
+                         kSchurComplementRelativeTolerance * By.norm(),
+                         data->participating, &cg_scratch, &u,
+                         &num_iterations);
+    VectorX<double> result(3 * ssize(data->nonparticipating));
+    for (int i = 0; i < ssize(data->nonparticipating); ++i) {
+      result.template segment<3>(3 * i) =
+          -u.template segment<3>(3 * data->nonparticipating[i]);
+    }
+    return result;
+  };
+  next_state_and_schur_complement_.schur_complement =
+      SchurComplement(num_nodes, nonparticipating_vertices, std::move(S),
+                      std::move(solve_for_x));
+}
+
 }  // namespace internal
 }  // namespace fem
 }  // namespace multibody
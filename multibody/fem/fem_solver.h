@@ -3,6 +3,7 @@
 #include <memory>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "drake/common/eigen_types.h"
 #include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
@@ -10,6 +11,7 @@
 #include "drake/multibody/contact_solvers/schur_complement.h"
 #include "drake/multibody/fem/discrete_time_integrator.h"
 #include "drake/multibody/fem/fem_model.h"
+#include "drake/multibody/fem/fem_solver_statistics.h"
 #include "drake/multibody/fem/fem_state.h"
 
 namespace drake {
@@ -59,7 +61,10 @@ class FemSolver {
    @note External forces are always evaluated explicitly at the previous time
    step regardless of the time integration scheme used.
    @throws std::exception if the input `prev_state` is incompatible with the FEM
-   model solved by this solver. */
+   model solved by this solver.
+   @throws std::exception if the solver fails to converge on a nonlinear model,
+   or, in matrix-free mode, if the linear solve of a linear model fails to
+   reach its tolerance. */
   int AdvanceOneTimeStep(
       const FemState<T>& prev_state, const FemPlantData<T>& plant_data,
       const std::unordered_set<int>& nonparticipating_vertices);
@@ -101,6 +106,66 @@ class FemSolver {
 
   double absolute_tolerance() const { return absolute_tolerance_; }
 
+  /* Sets whether the linear systems in the Newton iterations are solved
+   matrix-free. By default (false), the tangent matrix is assembled and
+   factored with a sparse Cholesky factorization in every Newton iteration.
+   When true, the linear systems are instead solved with the conjugate gradient
+   method, preconditioned with the 3x3 diagonal blocks of the tangent matrix
+   (block Jacobi), and the tangent matrix is only applied element by element
+   (see FemModel::ApplyTangentMatrix()). The memory required then scales with
+   the number of vertices instead of the number of nonzero entries in the
+   tangent matrix and its factorization. The tangent matrix is never assembled,
+   and any tangent matrix and factorization from earlier direct solves are
+   released. The Schur complement (see next_schur_complement()) is then computed
+   with one conjugate gradient solve per degree of freedom of the vertices that
+   participate in constraints, so its cost grows with the number of
+   participating vertices, and each call to its SolveForX() runs one more
+   conjugate gradient solve. When no vertex participates, the Schur complement
+   is empty in matrix-free mode. */
+  void set_matrix_free(bool matrix_free) { matrix_free_ = matrix_free; }
+
+  bool matrix_free() const { return matrix_free_; }
+
+  /* Sets the number of Newton-Raphson iterations that a factorization of the
+   tangent matrix is used for before the tangent matrix is reassembled and
+   refactored. With the default of 1, every iteration uses the tangent matrix
+   at the current iterate (the full Newton-Raphson method). With a larger
+   `interval`, the iterations use a lagged tangent matrix, and the
+   factorization is also carried over to the next time step. This takes more,
+   but much cheaper, iterations, which pays off for mildly nonlinear models.
+   The tangent matrix is refreshed early when an iteration with a lagged
+   tangent matrix reduces the residual norm by less than the factor set with
+   set_lagged_tangent_residual_ratio(), and that iteration is rejected if it
+   doesn't reduce the residual norm at all. Convergence is always decided by
+   the residual (see solver_converged()), and the Schur complement is always
+   computed with the tangent matrix at the converged state. Only nonlinear
+   models solved with a direct solver (see set_matrix_free()) are affected.
+   @throws std::exception if interval < 1. */
+  void set_tangent_refresh_interval(int interval) {
+    DRAKE_THROW_UNLESS(interval >= 1);
+    tangent_refresh_interval_ = interval;
+  }
+
+  int tangent_refresh_interval() const { return tangent_refresh_interval_; }
+
+  /* Sets the ratio of the residual norms after and before an iteration with a
+   lagged tangent matrix above which the tangent matrix is refreshed for the
+   next iteration. See set_tangent_refresh_interval(). The default value is
+   0.5.
+   @throws std::exception unless 0 < ratio <= 1. */
+  void set_lagged_tangent_residual_ratio(double ratio) {
+    DRAKE_THROW_UNLESS(0 < ratio && ratio <= 1);
+    lagged_tangent_residual_ratio_ = ratio;
+  }
+
+  double lagged_tangent_residual_ratio() const {
+    return lagged_tangent_residual_ratio_;
+  }
+
+  /* Returns the statistics of the last call to AdvanceOneTimeStep(). See
+   FemSolverStatistics. */
+  const FemSolverStatistics& get_statistics() const { return stats_; }
+
   /* The solver is considered as converged if ‖r‖ < max(εᵣ * ‖r₀‖, εₐ) where r
    and r₀ are `residual_norm` and `initial_residual_norm` respectively, and εᵣ
    and εₐ are relative and absolute tolerance respectively. */
@@ -133,6 +198,14 @@ class FemSolver {
     contact_solvers::internal::SchurComplement schur_complement;
   };
 
+  /* Scratch for the iterations of RunConjugateGradient(). */
+  struct ConjugateGradientScratch {
+    VectorX<T> residual;
+    VectorX<T> preconditioned_residual;
+    VectorX<T> direction;
+    VectorX<T> tangent_times_direction;
+  };
+
   struct Scratch {
     DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Scratch);
 
@@ -142,8 +215,10 @@ class FemSolver {
     ~Scratch();
 
     /* Reinitializes `this` scratch if it's incompatible with the given FEM
-     model. */
-    void ReinitializeIfNeeded(const FemModel<T>& model);
+     model. The tangent matrix and the linear solver are only allocated if
+     `use_direct_solver` is true; matrix-free solves don't need them, and they
+     are released otherwise. */
+    void ReinitializeIfNeeded(const FemModel<T>& model, bool use_direct_solver);
 
     copyable_unique_ptr<
         contact_solvers::internal::Block3x3SparseSymmetricMatrix>
@@ -152,8 +227,72 @@ class FemSolver {
         linear_solver;
     VectorX<T> b;
     VectorX<T> dz;
+    /* The number of Newton-Raphson iterations that used the current
+     factorization in `linear_solver`. */
+    int num_iterations_with_tangent{0};
+    /* Scratch for matrix-free solves. */
+    std::vector<Matrix3<T>> preconditioner;
+    ConjugateGradientScratch conjugate_gradient;
   };
 
+  /* Computes the inverses of the 3x3 diagonal blocks of the tangent matrix at
+   the next FEM state into `scratch_.preconditioner`, for use as the block
+   Jacobi preconditioner in SolveConjugateGradient().
+   @throws std::exception if a diagonal block is not positive definite. */
+  void CalcPreconditioner();
+
+  /* Solves A⋅x = `rhs` for x with the block Jacobi preconditioned conjugate
+   gradient method, where A is the tangent matrix of `model` at `state` with the
+   given integrator `weights`, which is only applied element by element, and
+   `preconditioner` holds the inverses of the 3x3 diagonal blocks of A. The
+   degrees of freedom of the vertices in `excluded_vertices` are left out of
+   the system, i.e., the system solved is the submatrix of A for the remaining
+   degrees of freedom. The entries of `rhs` for the excluded vertices must be
+   zero, and they are zero in `x`. The iterations stop once
+   ‖A⋅x - rhs‖ <= `tolerance`, or after `num_dofs` iterations. The number of
+   iterations taken is written to `num_iterations`.
+   @returns true if the tolerance is reached.
+   @throws std::exception if A is found to not be positive definite. */
+  static bool RunConjugateGradient(
+      const FemModel<T>& model, const FemState<T>& state,
+      const Vector3<T>& weights, const std::vector<Matrix3<T>>& preconditioner,
+      const VectorX<T>& rhs, const T& tolerance,
+      const std::vector<int>& excluded_vertices,
+      ConjugateGradientScratch* scratch, VectorX<T>* x, int* num_iterations);
+
+  /* Calls RunConjugateGradient() for the tangent matrix at the next FEM state,
+   with the preconditioner and scratch of `this` solver. The number of
+   iterations and, if the tolerance isn't reached, the failure are recorded in
+   the statistics.
+   @pre CalcPreconditioner() has been called for the current state. */
+  bool SolveConjugateGradient(const VectorX<T>& rhs, const T& tolerance,
+                              const std::vector<int>& excluded_vertices,
+                              VectorX<T>* x);
+
+  /* Solves A⋅dz = -b for dz with SolveConjugateGradient(), where b =
+   `scratch_.b`. The result is written to `scratch_.dz`.
+   @returns true if ‖A⋅dz + b‖ <= `tolerance`. */
+  bool SolveMatrixFree(const T& tolerance);
+
+  /* Computes the Schur complement of the tangent matrix at the next FEM state
+   (see FemModel::CalcTangentMatrix()) for the given `nonparticipating_vertices`
+   and writes it to `next_state_and_schur_complement_`. In matrix-free mode,
+   it is computed with CalcSchurComplementMatrixFree(). */
+  void CalcSchurComplement(
+      const std::unordered_set<int>& nonparticipating_vertices);
+
+  /* Computes the Schur complement S = C - BᵀD⁻¹B of the tangent matrix
+   A = [D B; Bᵀ C], where D is the block of the `nonparticipating_vertices`,
+   without assembling A and without storing B or D⁻¹B. For the j-th
+   participating dof, applying A to the unit vector eⱼ gives the j-th columns
+   of C and B, xⱼ = D⁻¹B⋅eⱼ is found with SolveConjugateGradient(), and since
+   xⱼ is zero for the participating dofs, the j-th column of BᵀD⁻¹B is the
+   participating part of A⋅xⱼ. The resulting SchurComplement keeps a copy of
+   the next FEM state, and its SolveForX() runs one conjugate gradient solve
+   per call. */
+  void CalcSchurComplementMatrixFree(
+      const std::unordered_set<int>& nonparticipating_vertices);
+
   /* Uses a Newton-Raphson solver to solve for the equilibrium FEM state z
    such that the residual is zero, i.e. b(z) = 0, up to the specified
    tolerances. In addition, computes the Schur complement of the tangent
@@ -183,7 +322,9 @@ class FemSolver {
    @param[in] nonparticipating_vertices
      The vertices of the FEM model that participate in constraint computation,
      used to compute the Schur complement of the tangent matrix.
-   @returns 0 if the `input` state is already at equilibrium, 1 otherwise.
+   @returns 0 if the `input` state is already at equilibrium, -1 if the
+   conjugate gradient solve in matrix-free mode fails to reach the tolerance,
+   and 1 otherwise.
    @pre the FEM model is linear. */
   int SolveLinearModel(
       const FemPlantData<T>& plant_data,
@@ -202,6 +343,11 @@ class FemSolver {
   /* Max number of Newton-Raphson iterations the solver takes before it gives
    up. */
   int max_iterations_{100};
+  /* Whether the linear systems are solved matrix-free. */
+  bool matrix_free_{false};
+  int tangent_refresh_interval_{1};
+  double lagged_tangent_residual_ratio_{0.5};
+  FemSolverStatistics stats_;
   FemStateAndSchurComplement next_state_and_schur_complement_;
   Scratch scratch_;
 };
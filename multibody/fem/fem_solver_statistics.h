@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+
+namespace drake {
+namespace multibody {
+namespace fem {
+
+/** %FemSolverStatistics stores the statistics of the solve for the free motion
+ of a deformable body over one time step, i.e. its motion in the absence of
+ contact and constraints. See DeformableModel::GetFemSolverStatistics(). */
+struct FemSolverStatistics {
+  /** Initializes counters to zero and clears the residual history. */
+  void Reset() {
+    num_iterations = 0;
+    num_tangent_updates = 0;
+    num_rejected_iterations = 0;
+    num_conjugate_gradient_iterations = 0;
+    num_unconverged_conjugate_gradient_solves = 0;
+    residual_norms.clear();
+  }
+
+  /** Number of Newton-Raphson iterations, including rejected ones. */
+  int num_iterations{0};
+
+  /** Number of times the tangent matrix was assembled and factored to solve
+   for the Newton-Raphson updates. The assembly and factorization to compute
+   the Schur complement is not included. */
+  int num_tangent_updates{0};
+
+  /** Number of iterations with a lagged tangent matrix that were rejected
+   because they failed to reduce the residual. See
+   DeformableModel::SetTangentRefreshInterval(). */
+  int num_rejected_iterations{0};
+
+  /** Total number of conjugate gradient iterations, only non-zero for bodies
+   using the matrix-free solver. See DeformableModel::SetUseMatrixFreeSolver().
+   */
+  int num_conjugate_gradient_iterations{0};
+
+  /** Number of conjugate gradient solves, with the matrix-free solver, that
+   stopped at the iteration limit before reaching their tolerance. Within
+   Newton-Raphson iterations, such a solve only yields an inexact step, and
+   convergence is still decided by the residual. When computing the Schur
+   complement, the Schur complement is less accurate than requested. */
+  int num_unconverged_conjugate_gradient_solves{0};
+
+  /** The norm of the residual before the first iteration and after each
+   accepted iteration, with unit N. For linear models, whose solve takes at
+   most one iteration, only the residual before the iteration is recorded. */
+  std::vector<double> residual_norms;
+};
+
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
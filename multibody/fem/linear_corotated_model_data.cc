@@ -17,14 +17,21 @@ LinearCorotatedModelData<T, num_locations>::LinearCorotatedModelData() {
 template <typename T, int num_locations>
 void LinearCorotatedModelData<T,
                               num_locations>::UpdateFromDeformationGradient() {
-  const std::array<Matrix3<T>, num_locations>& F = this->deformation_gradient();
   const std::array<Matrix3<T>, num_locations>& F0 =
       this->previous_step_deformation_gradient();
   for (int i = 0; i < num_locations; ++i) {
-    Matrix3<T>& local_R0 = R0_[i];
-    Matrix3<T>& local_strain = strain_[i];
     Matrix3<T> unused_S;
-    internal::PolarDecompose<T>(F0[i], &local_R0, &unused_S);
+    internal::PolarDecompose<T>(F0[i], &R0_[i], &unused_S);
+  }
+  UpdateStrain();
+}
+
+template <typename T, int num_locations>
+void LinearCorotatedModelData<T, num_locations>::UpdateStrain() {
+  const std::array<Matrix3<T>, num_locations>& F = this->deformation_gradient();
+  for (int i = 0; i < num_locations; ++i) {
+    const Matrix3<T>& local_R0 = R0_[i];
+    Matrix3<T>& local_strain = strain_[i];
     const Matrix3<T> corotated_F = local_R0.transpose() * F[i];
     local_strain =
         0.5 * (corotated_F + corotated_F.transpose()) - Matrix3<T>::Identity();
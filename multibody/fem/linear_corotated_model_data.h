@@ -4,6 +4,7 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/multibody/fem/deformation_gradient_data.h"
+#include "drake/multibody/fem/matrix_utilities.h"
 
 namespace drake {
 namespace multibody {
@@ -46,6 +47,32 @@ class LinearCorotatedModelData
    required by the CRTP base class. */
   void UpdateFromDeformationGradient();
 
+  /* Shadows DeformationGradientData::UpdateFromDeformationGradientBatch() to
+   compute the polar decompositions of the previous step deformation gradients
+   of all locations of all of `data` with a single call to
+   PolarDecomposeAll(). */
+  template <size_t kBatch>
+  static void UpdateFromDeformationGradientBatch(
+      const std::array<LinearCorotatedModelData*, kBatch>& data) {
+    std::array<Matrix3<T>, kBatch * num_locations> F0, R0, unused_S;
+    for (size_t k = 0; k < kBatch; ++k) {
+      for (int i = 0; i < num_locations; ++i) {
+        F0[k * num_locations + i] =
+            data[k]->previous_step_deformation_gradient()[i];
+      }
+    }
+    PolarDecomposeAll(F0, &R0, &unused_S);
+    for (size_t k = 0; k < kBatch; ++k) {
+      for (int i = 0; i < num_locations; ++i) {
+        data[k]->R0_[i] = R0[k * num_locations + i];
+      }
+      data[k]->UpdateStrain();
+    }
+  }
+
+  /* Updates strain_ and trace_strain_ from the deformation gradient and R0_. */
+  void UpdateStrain();
+
   std::array<Matrix3<T>, num_locations> R0_;
   std::array<Matrix3<T>, num_locations> strain_;
   std::array<T, num_locations> trace_strain_;
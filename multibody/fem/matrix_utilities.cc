@@ -49,6 +49,118 @@ void PolarDecompose(const Matrix3<T>& F, EigenPtr<Matrix3<T>> R,
   (*S).noalias() = V * sigma.asDiagonal() * V.transpose();
 }
 
+namespace {
+
+/* One value for each matrix in a batch of PolarDecomposeBatch(). */
+using BatchScalar = Eigen::Array<double, kPolarDecomposeBatchSize, 1>;
+
+/* A batch of 3-by-3 matrices in structure-of-arrays layout where A[i + 3 * j]
+ holds the (i, j)-th entries of all matrices in the batch. */
+using BatchMatrix3 = std::array<BatchScalar, 9>;
+
+/* Computes the cofactor matrices C of the batch A and returns their
+ determinants. */
+BatchScalar CalcBatchCofactorAndDeterminant(const BatchMatrix3& A,
+                                            BatchMatrix3* C) {
+  const auto a = [&A](int i, int j) -> const BatchScalar& {
+    return A[i + 3 * j];
+  };
+  BatchMatrix3& c = *C;
+  c[0] = a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1);
+  c[3] = a(1, 2) * a(2, 0) - a(1, 0) * a(2, 2);
+  c[6] = a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0);
+  c[1] = a(0, 2) * a(2, 1) - a(0, 1) * a(2, 2);
+  c[4] = a(0, 0) * a(2, 2) - a(0, 2) * a(2, 0);
+  c[7] = a(0, 1) * a(2, 0) - a(0, 0) * a(2, 1);
+  c[2] = a(0, 1) * a(1, 2) - a(0, 2) * a(1, 1);
+  c[5] = a(0, 2) * a(1, 0) - a(0, 0) * a(1, 2);
+  c[8] = a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0);
+  return a(0, 0) * c[0] + a(0, 1) * c[3] + a(0, 2) * c[6];
+}
+
+BatchScalar CalcBatchSquaredNorm(const BatchMatrix3& A) {
+  BatchScalar result = A[0].square();
+  for (int i = 1; i < 9; ++i) {
+    result += A[i].square();
+  }
+  return result;
+}
+
+}  // namespace
+
+void PolarDecomposeBatch(
+    const std::array<Matrix3<double>, kPolarDecomposeBatchSize>& F,
+    std::array<Matrix3<double>, kPolarDecomposeBatchSize>* R,
+    std::array<Matrix3<double>, kPolarDecomposeBatchSize>* S) {
+  DRAKE_ASSERT(R != nullptr && S != nullptr);
+  constexpr int kBatch = kPolarDecomposeBatchSize;
+  constexpr int kMaxIterations = 20;
+  /* The iteration converges quadratically, so once the update is below this
+   tolerance, the error after the update is at the level of round-off. */
+  constexpr double kTolerance = 1e-9;
+
+  BatchMatrix3 X;
+  for (int i = 0; i < 9; ++i) {
+    for (int k = 0; k < kBatch; ++k) {
+      X[i](k) = F[k](i);
+    }
+  }
+  BatchMatrix3 C;
+  BatchScalar det = CalcBatchCofactorAndDeterminant(X, &C);
+  /* The matrices that are handled by PolarDecompose() are replaced by the
+   identity so that the iteration is well defined for all entries. `det > 0` is
+   false for NaN, so that NaN entries are also handled by PolarDecompose(). */
+  const Eigen::Array<bool, kBatch, 1> valid = det > 0.0;
+  if (!valid.any()) {
+    for (int k = 0; k < kBatch; ++k) {
+      PolarDecompose<double>(F[k], &(*R)[k], &(*S)[k]);
+    }
+    return;
+  }
+  for (int i = 0; i < 9; ++i) {
+    const double identity = (i % 4 == 0) ? 1.0 : 0.0;
+    X[i] = valid.select(X[i], identity);
+    C[i] = valid.select(C[i], identity);
+  }
+  det = valid.select(det, 1.0);
+
+  /* Scaled Newton iteration X ← (γX + X⁻ᵀ/γ)/2, with X⁻ᵀ = C/det(X) and
+   γ = (‖X⁻¹‖/‖X‖)^½ in the Frobenius norm. */
+  Eigen::Array<bool, kBatch, 1> converged =
+      Eigen::Array<bool, kBatch, 1>::Constant(false);
+  for (int iteration = 0; iteration < kMaxIterations; ++iteration) {
+    const BatchScalar gamma =
+        (CalcBatchSquaredNorm(C) / (det.square() * CalcBatchSquaredNorm(X)))
+            .sqrt()
+            .sqrt();
+    const BatchScalar a = 0.5 * gamma;
+    const BatchScalar b = 0.5 / (gamma * det);
+    BatchScalar delta_squared = BatchScalar::Zero();
+    for (int i = 0; i < 9; ++i) {
+      const BatchScalar X_next = a * X[i] + b * C[i];
+      delta_squared += (X_next - X[i]).square();
+      X[i] = X_next;
+    }
+    converged = delta_squared < kTolerance * kTolerance;
+    if (converged.all()) break;
+    det = CalcBatchCofactorAndDeterminant(X, &C);
+  }
+
+  for (int k = 0; k < kBatch; ++k) {
+    if (!valid(k) || !converged(k)) {
+      PolarDecompose<double>(F[k], &(*R)[k], &(*S)[k]);
+      continue;
+    }
+    Matrix3<double>& R_k = (*R)[k];
+    for (int i = 0; i < 9; ++i) {
+      R_k(i) = X[i](k);
+    }
+    /* S = RᵀF is symmetric up to round-off, and we symmetrize it. */
+    const Matrix3<double> RtF = R_k.transpose() * F[k];
+    (*S)[k] = 0.5 * (RtF + RtF.transpose());
+  }
+}
+
 template <typename T>
 void AddScaledRotationalDerivative(
     const Matrix3<T>& R, const Matrix3<T>& S, const T& scale,
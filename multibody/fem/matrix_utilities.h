@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <type_traits>
 #include <vector>
 
 #include <Eigen/SparseCore>
@@ -53,6 +56,56 @@ template <typename T>
 void PolarDecompose(const Matrix3<T>& F, EigenPtr<Matrix3<T>> R,
                     EigenPtr<Matrix3<T>> S);
 
+/* The number of matrices processed together by PolarDecomposeBatch(). */
+constexpr int kPolarDecomposeBatchSize = 4;
+
+/* Calculates the polar decompositions F[k] = R[k]S[k] of a batch of 3-by-3
+ matrices, with the same result as PolarDecompose() up to round-off.
+
+ The matrices are stored in structure-of-arrays layout such that every
+ arithmetic operation applies to all matrices in the batch at once and is
+ vectorized. The rotations are computed with the scaled Newton iteration of
+ [Higham, 1986], which, unlike the SVD in PolarDecompose(), has no data
+ dependent branching. For matrices with non-positive determinant (e.g. from
+ inverted elements), for which the iteration converges to a reflection, and for
+ matrices for which the iteration fails to converge, this function falls back
+ to PolarDecompose().
+
+ [Higham, 1986] Higham, Nicholas J. "Computing the polar decomposition—with
+ applications." SIAM Journal on Scientific and Statistical Computing 7.4
+ (1986): 1160-1174.
+ @pre R != nullptr and S != nullptr. */
+void PolarDecomposeBatch(
+    const std::array<Matrix3<double>, kPolarDecomposeBatchSize>& F,
+    std::array<Matrix3<double>, kPolarDecomposeBatchSize>* R,
+    std::array<Matrix3<double>, kPolarDecomposeBatchSize>* S);
+
+/* Calculates the polar decompositions F[k] = R[k]S[k] of each of the given
+ matrices as in PolarDecompose(). For T = double, the matrices are processed in
+ groups of kPolarDecomposeBatchSize with PolarDecomposeBatch().
+ @pre R != nullptr and S != nullptr.
+ @tparam_nonsymbolic_scalar */
+template <typename T, size_t N>
+void PolarDecomposeAll(const std::array<Matrix3<T>, N>& F,
+                       std::array<Matrix3<T>, N>* R,
+                       std::array<Matrix3<T>, N>* S) {
+  DRAKE_ASSERT(R != nullptr && S != nullptr);
+  size_t k = 0;
+  if constexpr (std::is_same_v<T, double>) {
+    constexpr size_t kBatch = kPolarDecomposeBatchSize;
+    std::array<Matrix3<double>, kBatch> F_batch, R_batch, S_batch;
+    for (; k + kBatch <= N; k += kBatch) {
+      std::copy_n(F.begin() + k, kBatch, F_batch.begin());
+      PolarDecomposeBatch(F_batch, &R_batch, &S_batch);
+      std::copy_n(R_batch.begin(), kBatch, R->begin() + k);
+      std::copy_n(S_batch.begin(), kBatch, S->begin() + k);
+    }
+  }
+  for (; k < N; ++k) {
+    PolarDecompose<T>(F[k], &(*R)[k], &(*S)[k]);
+  }
+}
+
 /* Computes the derivative of the rotation matrix from the polar decomposition
  (see PolarDecompose()) with respect to the original matrix.
  @param[in] R               The rotation matrix in the polar decomposition
@@ -1,5 +1,7 @@
 #include "drake/multibody/fem/corotated_model_data.h"
 
+#include <array>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -67,6 +69,43 @@ GTEST_TEST(CorotatedModelDataTest, UpdateData) {
                               F.determinant() * F.inverse().transpose(), kTol));
 }
 
+/* Updating a batch of data agrees with updating each of them on its own. */
+GTEST_TEST(CorotatedModelDataTest, UpdateDataBatch) {
+  constexpr int kBatch = 5;
+  std::array<std::array<Matrix3<double>, kNumLocations>, kBatch> F;
+  for (int k = 0; k < kBatch; ++k) {
+    const Matrix3<double> R =
+        math::RotationMatrix<double>(math::RollPitchYaw<double>(1.0, 2.0, k))
+            .matrix();
+    // clang-format off
+    const Matrix3<double> S = (Matrix3<double>() <<
+           6, 1, 2,
+           1, 4, k,
+           2, k, 5)
+    .finished();
+    // clang-format on
+    F[k][0] = R * S;
+  }
+  /* One of the locations is inverted. */
+  F[3][0].col(0) *= -1.0;
+  std::array<CorotatedModelData<double, kNumLocations>, kBatch> batched_data;
+  std::array<CorotatedModelData<double, kNumLocations>*, kBatch> data_ptrs;
+  for (int k = 0; k < kBatch; ++k) {
+    data_ptrs[k] = &batched_data[k];
+  }
+  CorotatedModelData<double, kNumLocations>::UpdateDataBatch(data_ptrs, F, F);
+  for (int k = 0; k < kBatch; ++k) {
+    CorotatedModelData<double, kNumLocations> data;
+    data.UpdateData(F[k], F[k]);
+    const CorotatedModelData<double, kNumLocations>& batched = batched_data[k];
+    EXPECT_EQ(batched.deformation_gradient(), data.deformation_gradient());
+    EXPECT_TRUE(CompareMatrices(batched.R()[0], data.R()[0], 10 * kTol));
+    EXPECT_TRUE(CompareMatrices(batched.S()[0], data.S()[0], 10 * kTol));
+    EXPECT_EQ(batched.Jm1(), data.Jm1());
+    EXPECT_EQ(batched.JFinvT(), data.JFinvT());
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace fem
@@ -1,7 +1,10 @@
 #include "drake/multibody/fem/fem_model.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include "drake/common/ssize.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/multibody/fem/linear_corotated_model.h"
@@ -211,6 +214,52 @@ GTEST_TEST(FemModelTest, CalcTangentMatrix) {
                               MatrixCompareType::relative));
 }
 
+/* Verifies that the matrix-free product with the tangent matrix and the
+ diagonal blocks of the tangent matrix agree with the assembled tangent matrix,
+ with and without a Dirichlet boundary condition. */
+GTEST_TEST(FemModelTest, ApplyTangentMatrix) {
+  LinearDummyModel model;
+  LinearDummyModel::DummyBuilder builder(&model);
+  builder.AddTwoElementsWithSharedNodes();
+  builder.Build();
+  const Vector3d weights(0.1, 0.2, 0.3);
+  const VectorXd x = VectorXd::LinSpaced(model.num_dofs(), -1.0, 2.0);
+
+  auto verify_against_assembled_matrix = [&]() {
+    unique_ptr<FemState<double>> fem_state = model.MakeFemState();
+    unique_ptr<contact_solvers::internal::Block3x3SparseSymmetricMatrix>
+        tangent_matrix = model.MakeTangentMatrix();
+    model.CalcTangentMatrix(*fem_state, weights, tangent_matrix.get());
+    const MatrixXd A = tangent_matrix->MakeDenseMatrix();
+
+    VectorXd y(model.num_dofs());
+    model.ApplyTangentMatrix(*fem_state, weights, x, &y);
+    EXPECT_TRUE(CompareMatrices(y, A * x,
+                                16.0 * std::numeric_limits<double>::epsilon(),
+                                MatrixCompareType::relative));
+
+    std::vector<Matrix3<double>> diagonal_blocks;
+    model.CalcTangentMatrixDiagonalBlocks(*fem_state, weights,
+                                          &diagonal_blocks);
+    ASSERT_EQ(ssize(diagonal_blocks), model.num_nodes());
+    for (int i = 0; i < model.num_nodes(); ++i) {
+      EXPECT_TRUE(CompareMatrices(diagonal_blocks[i],
+                                  A.block<3, 3>(3 * i, 3 * i),
+                                  4.0 * std::numeric_limits<double>::epsilon(),
+                                  MatrixCompareType::relative));
+    }
+  };
+
+  verify_against_assembled_matrix();
+
+  DirichletBoundaryCondition<double> bc;
+  bc.AddBoundaryCondition(FemNodeIndex(2),
+                          {Vector3<double>(1, 1, 1), Vector3<double>(2, 2, 2),
+                           Vector3<double>(3, 3, 3)});
+  model.SetDirichletBoundaryCondition(bc);
+  verify_against_assembled_matrix();
+}
+
 GTEST_TEST(FemModelTest, CalcTangentMatrixNoAutoDiff) {
   using T = AutoDiffXd;
   constexpr int kNaturalDimension = 3;
@@ -240,6 +289,17 @@ GTEST_TEST(FemModelTest, CalcTangentMatrixNoAutoDiff) {
       fem_model->CalcTangentMatrix(*fem_state, Vector3<T>(0.1, 0.2, 0.3),
                                    &tangent_matrix),
       ".*only.*double.*");
+  const VectorX<T> x = VectorX<T>::Zero(fem_model->num_dofs());
+  VectorX<T> y(fem_model->num_dofs());
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      fem_model->ApplyTangentMatrix(*fem_state, Vector3<T>(0.1, 0.2, 0.3), x,
+                                    &y),
+      ".*only.*double.*");
+  std::vector<Matrix3<T>> diagonal_blocks;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      fem_model->CalcTangentMatrixDiagonalBlocks(
+          *fem_state, Vector3<T>(0.1, 0.2, 0.3), &diagonal_blocks),
+      ".*only.*double.*");
 }
 
 /* Verifies that performing calculations on incompatible model and states throws
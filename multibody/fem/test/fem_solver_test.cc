@@ -2,10 +2,18 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/ssize.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/proximity/make_box_mesh.h"
+#include "drake/math/rotation_matrix.h"
 #include "drake/multibody/fem/acceleration_newmark_scheme.h"
+#include "drake/multibody/fem/corotated_model.h"
+#include "drake/multibody/fem/linear_simplex_element.h"
+#include "drake/multibody/fem/simplex_gaussian_quadrature.h"
 #include "drake/multibody/fem/test/dummy_model.h"
+#include "drake/multibody/fem/volumetric_element.h"
+#include "drake/multibody/fem/volumetric_model.h"
 
 namespace drake {
 namespace multibody {
@@ -113,6 +121,169 @@ TYPED_TEST_P(FemSolverTest, AdvanceOneTimeStep) {
   EXPECT_TRUE(CompareMatrices(expected_schur_complement,
                               computed_schur_complement.get_D_complement(),
                               kTolerance, MatrixCompareType::relative));
+
+  /* The Schur complement is updated in place in the next time step, with
+   different nonparticipating vertices, and it agrees with a Schur complement
+   computed from scratch. */
+  const std::unordered_set<int> nonparticipating_vertices2 = {0, 1, 2};
+  this->solver_.AdvanceOneTimeStep(*state0, dummy_data,
+                                   nonparticipating_vertices2);
+  this->model_.CalcTangentMatrix(this->solver_.next_fem_state(),
+                                 this->integrator_.GetWeights(),
+                                 tangent_matrix.get());
+  const contact_solvers::internal::SchurComplement expected_schur_complement2(
+      *tangent_matrix, nonparticipating_vertices2);
+  EXPECT_TRUE(CompareMatrices(
+      expected_schur_complement2.get_D_complement(),
+      this->solver_.next_schur_complement().get_D_complement(), kTolerance,
+      MatrixCompareType::relative));
+}
+
+/* Tests that the matrix-free mode of FemSolver::AdvanceOneTimeStep solves the
+ same linear system as the direct solve up to the requested accuracy without
+ ever assembling the tangent matrix, that its Schur complement agrees with the
+ one from a direct factorization, and that it doesn't build the Schur
+ complement when no vertex participates in contact. */
+TYPED_TEST_P(FemSolverTest, MatrixFree) {
+  EXPECT_FALSE(this->solver_.matrix_free());
+  this->solver_.set_matrix_free(true);
+  EXPECT_TRUE(this->solver_.matrix_free());
+
+  constexpr bool is_linear = TypeParam::value;
+  typename DummyModel<is_linear>::DummyBuilder builder(&this->model_);
+  builder.AddTwoElementsWithSharedNodes();
+  builder.Build();
+  std::unique_ptr<FemState<double>> state0 = this->model_.MakeFemState();
+  const std::unordered_set<int> nonparticipating_vertices = {0, 1};
+  const systems::LeafContext<double> dummy_context;
+  const FemPlantData<double> dummy_data{dummy_context, {}};
+  const int num_iterations = this->solver_.AdvanceOneTimeStep(
+      *state0, dummy_data, nonparticipating_vertices);
+  EXPECT_EQ(num_iterations, 1);
+
+  /* The change in the unknowns (the accelerations) satisfies A*dz = -b up to
+   the tolerance of the iterative solve. The first Newton iteration of the
+   nonlinear solve asks for a reduction of the residual by a factor of 10. */
+  auto tangent_matrix0 = this->model_.MakeTangentMatrix();
+  this->model_.CalcTangentMatrix(*state0, this->integrator_.GetWeights(),
+                                 tangent_matrix0.get());
+  const MatrixXd A0 = tangent_matrix0->MakeDenseMatrix();
+  VectorX<double> b0(this->model_.num_dofs());
+  this->model_.CalcResidual(*state0, dummy_data, &b0);
+  const FemState<double>& computed_state = this->solver_.next_fem_state();
+  const VectorX<double> dz =
+      computed_state.GetAccelerations() - state0->GetAccelerations();
+  const double relative_tolerance =
+      is_linear ? this->solver_.relative_tolerance() : 0.1;
+  EXPECT_LE((A0 * dz + b0).norm(), relative_tolerance * b0.norm());
+  EXPECT_GT(this->solver_.get_statistics().num_conjugate_gradient_iterations,
+            0);
+  EXPECT_EQ(this->solver_.get_statistics().num_tangent_updates, 0);
+
+  EXPECT_EQ(
+      this->solver_.get_statistics().num_unconverged_conjugate_gradient_solves,
+      0);
+
+  /* The Schur complement is still computed for participating vertices, with
+   conjugate gradient solves in place of a factorization, so it only agrees
+   with the direct one up to the tolerance of those solves. */
+  constexpr double kIterativeTolerance = 1e-8;
+  auto tangent_matrix = this->model_.MakeTangentMatrix();
+  this->model_.CalcTangentMatrix(computed_state, this->integrator_.GetWeights(),
+                                 tangent_matrix.get());
+  contact_solvers::internal::SchurComplement
+      force_balance_tangent_matrix_schur_complement(*tangent_matrix,
+                                                    nonparticipating_vertices);
+  const contact_solvers::internal::SchurComplement& computed_schur_complement =
+      this->solver_.next_schur_complement();
+  EXPECT_TRUE(CompareMatrices(
+      force_balance_tangent_matrix_schur_complement.get_D_complement(),
+      computed_schur_complement.get_D_complement(), kIterativeTolerance,
+      MatrixCompareType::relative));
+  const int num_participating_dofs =
+      3 * (this->model_.num_nodes() - ssize(nonparticipating_vertices));
+  const VectorX<double> y =
+      VectorX<double>::LinSpaced(num_participating_dofs, 1.0, 2.0);
+  EXPECT_TRUE(
+      CompareMatrices(force_balance_tangent_matrix_schur_complement.SolveForX(y),
+                      computed_schur_complement.SolveForX(y),
+                      kIterativeTolerance, MatrixCompareType::relative));
+  EXPECT_EQ(this->solver_.get_statistics().num_tangent_updates, 0);
+
+  /* SolveForX() doesn't depend on the solver, so that a copy of the Schur
+   complement, such as one held by a copy of the solver, keeps working after
+   the solver moves on. */
+  const contact_solvers::internal::SchurComplement schur_complement_copy =
+      computed_schur_complement;
+
+  /* No vertex participates in contact. */
+  std::unordered_set<int> all_vertices;
+  for (int i = 0; i < this->model_.num_nodes(); ++i) {
+    all_vertices.insert(i);
+  }
+  this->solver_.AdvanceOneTimeStep(*state0, dummy_data, all_vertices);
+  EXPECT_EQ(this->solver_.next_schur_complement().get_D_complement().size(),
+            0);
+  EXPECT_TRUE(
+      CompareMatrices(force_balance_tangent_matrix_schur_complement.SolveForX(y),
+                      schur_complement_copy.SolveForX(y), kIterativeTolerance,
+                      MatrixCompareType::relative));
+}
+
+/* Tests that, with a tangent refresh interval larger than one, the Newton
+ iterations of nonlinear models reuse the factorization of the tangent matrix
+ across time steps until the interval elapses. The tangent matrix of the
+ DummyModel is constant, so the results are unaffected. */
+TYPED_TEST_P(FemSolverTest, LaggedTangent) {
+  /* Default values. */
+  EXPECT_EQ(this->solver_.tangent_refresh_interval(), 1);
+  EXPECT_EQ(this->solver_.lagged_tangent_residual_ratio(), 0.5);
+  /* Test setters. */
+  this->solver_.set_lagged_tangent_residual_ratio(0.25);
+  EXPECT_EQ(this->solver_.lagged_tangent_residual_ratio(), 0.25);
+  EXPECT_THROW(this->solver_.set_tangent_refresh_interval(0), std::exception);
+  EXPECT_THROW(this->solver_.set_lagged_tangent_residual_ratio(0.0),
+               std::exception);
+  EXPECT_THROW(this->solver_.set_lagged_tangent_residual_ratio(1.5),
+               std::exception);
+  constexpr int kInterval = 3;
+  this->solver_.set_tangent_refresh_interval(kInterval);
+  EXPECT_EQ(this->solver_.tangent_refresh_interval(), kInterval);
+
+  constexpr bool is_linear = TypeParam::value;
+  typename DummyModel<is_linear>::DummyBuilder builder(&this->model_);
+  builder.AddTwoElementsWithSharedNodes();
+  builder.Build();
+  std::unique_ptr<FemState<double>> state0 = this->model_.MakeFemState();
+  const std::unordered_set<int> nonparticipating_vertices = {0, 1};
+  const systems::LeafContext<double> dummy_context;
+  const FemPlantData<double> dummy_data{dummy_context, {}};
+
+  this->solver_.AdvanceOneTimeStep(*state0, dummy_data,
+                                   nonparticipating_vertices);
+  const VectorX<double> expected_accelerations =
+      this->solver_.next_fem_state().GetAccelerations();
+  for (int step = 0; step <= kInterval; ++step) {
+    if (step > 0) {
+      this->solver_.AdvanceOneTimeStep(*state0, dummy_data,
+                                       nonparticipating_vertices);
+    }
+    const FemSolverStatistics& stats = this->solver_.get_statistics();
+    EXPECT_EQ(stats.num_iterations, 1);
+    EXPECT_EQ(stats.num_rejected_iterations, 0);
+    EXPECT_EQ(stats.num_conjugate_gradient_iterations, 0);
+    EXPECT_TRUE(CompareMatrices(
+        this->solver_.next_fem_state().GetAccelerations(),
+        expected_accelerations, kTolerance));
+    if (!is_linear) {
+      /* The tangent matrix is refreshed on the first step and once every
+       kInterval iterations after that. */
+      EXPECT_EQ(stats.num_tangent_updates, step % kInterval == 0 ? 1 : 0);
+      ASSERT_EQ(ssize(stats.residual_norms), 2);
+      EXPECT_GT(stats.residual_norms[0], 0.0);
+      EXPECT_EQ(stats.residual_norms[1], 0.0);
+    }
+  }
 }
 
 /* Tests that AdvanceOneTimeStep for nonlinear models throws an error message if
@@ -155,9 +326,93 @@ TYPED_TEST_P(FemSolverTest, DefaultStateAndSchurComplement) {
 
 using AllTypes = ::testing::Types<BoolWrapper<true>, BoolWrapper<false>>;
 REGISTER_TYPED_TEST_SUITE_P(FemSolverTest, Tolerance, AdvanceOneTimeStep,
-                            Nonconvergence, DefaultStateAndSchurComplement);
+                            MatrixFree, LaggedTangent, Nonconvergence,
+                            DefaultStateAndSchurComplement);
 INSTANTIATE_TYPED_TEST_SUITE_P(LinearAndNonLinear, FemSolverTest, AllTypes);
 
+/* Unlike the DummyModel, a corotated model has a tangent matrix that depends
+ on the state. Tests that when a lagged factorization from an earlier time step
+ stalls the Newton-Raphson iterations, the solver rejects the iterations that
+ increase the residual and refreshes the tangent matrix before the refresh
+ interval elapses, and that it converges to the same state as the full
+ Newton-Raphson method. */
+GTEST_TEST(FemSolverLaggedTangentTest, StateDependentTangent) {
+  using QuadratureType = SimplexGaussianQuadrature<3, 1>;
+  using IsoparametricElementType = LinearSimplexElement<double, 3, 3, 1>;
+  using ConstitutiveModelType = CorotatedModel<double, 1>;
+  using ElementType = VolumetricElement<IsoparametricElementType,
+                                        QuadratureType, ConstitutiveModelType>;
+  using ModelType = VolumetricModel<ElementType>;
+
+  /* A stiff unit cube made of 6 tetrahedra, so that the elastic forces
+   dominate the inertial forces over a time step. */
+  ModelType model;
+  {
+    const geometry::VolumeMesh<double> mesh =
+        geometry::internal::MakeBoxVolumeMesh<double>(
+            geometry::Box(1.0, 1.0, 1.0), 1.0);
+    typename ModelType::VolumetricBuilder builder(&model);
+    builder.AddLinearTetrahedralElements(
+        mesh, ConstitutiveModelType(1e6, 0.3), /* density */ 1000.0,
+        DampingModel<double>(0.0, 0.0));
+    builder.Build();
+  }
+  const AccelerationNewmarkScheme<double> integrator(kDt, kGamma, kBeta);
+  const systems::LeafContext<double> dummy_context;
+  const FemPlantData<double> dummy_data{dummy_context, {}};
+  const std::unordered_set<int> nonparticipating_vertices;
+  const VectorX<double> q0 = model.MakeFemState()->GetPositions();
+
+  /* The first step starts from a slightly compressed cube. */
+  std::unique_ptr<FemState<double>> state0 = model.MakeFemState();
+  state0->SetPositions(0.99 * q0);
+  /* The second step starts from a cube that is rotated by a quarter turn and
+   stretched to twice its length, so that the tangent matrix is far from the
+   one at the end of the first step. */
+  std::unique_ptr<FemState<double>> state1 = model.MakeFemState();
+  const math::RotationMatrixd R = math::RotationMatrixd::MakeZRotation(M_PI_2);
+  VectorX<double> q1(q0.size());
+  for (int i = 0; i < model.num_nodes(); ++i) {
+    const Vector3<double> p = q0.segment<3>(3 * i);
+    q1.segment<3>(3 * i) = R * Vector3<double>(2.0 * p.x(), p.y(), p.z());
+  }
+  state1->SetPositions(q1);
+
+  const auto solve = [&](int interval, FemSolver<double>* solver) {
+    solver->set_relative_tolerance(1e-10);
+    solver->set_absolute_tolerance(1e-10);
+    solver->set_tangent_refresh_interval(interval);
+    solver->AdvanceOneTimeStep(*state0, dummy_data, nonparticipating_vertices);
+    return solver->AdvanceOneTimeStep(*state1, dummy_data,
+                                      nonparticipating_vertices);
+  };
+
+  FemSolver<double> newton_solver(&model, &integrator);
+  solve(1, &newton_solver);
+
+  /* The interval is never reached, so all refreshes in the second step are
+   caused by stalls. */
+  constexpr int kInterval = 1000;
+  FemSolver<double> lagged_solver(&model, &integrator);
+  const int num_iterations = solve(kInterval, &lagged_solver);
+  const FemSolverStatistics& stats = lagged_solver.get_statistics();
+  EXPECT_EQ(stats.num_iterations, num_iterations);
+  EXPECT_GE(stats.num_tangent_updates, 1);
+  EXPECT_GE(stats.num_rejected_iterations, 1);
+  /* Rejected iterations don't add to the residual history. */
+  EXPECT_EQ(ssize(stats.residual_norms),
+            num_iterations - stats.num_rejected_iterations + 1);
+
+  const FemState<double>& expected = newton_solver.next_fem_state();
+  const FemState<double>& computed = lagged_solver.next_fem_state();
+  constexpr double kStateTolerance = 1e-8;
+  EXPECT_TRUE(CompareMatrices(computed.GetAccelerations(),
+                              expected.GetAccelerations(), kStateTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(computed.GetPositions(), expected.GetPositions(),
+                              kStateTolerance, MatrixCompareType::relative));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace fem
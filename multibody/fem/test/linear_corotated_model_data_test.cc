@@ -1,5 +1,7 @@
 #include "drake/multibody/fem/linear_corotated_model_data.h"
 
+#include <array>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -76,6 +78,48 @@ GTEST_TEST(LinearCorotatedModelDataTest, UpdateData) {
               expected_strain.trace(), kTol);
 }
 
+/* Updating a batch of data agrees with updating each of them on its own. */
+GTEST_TEST(LinearCorotatedModelDataTest, UpdateDataBatch) {
+  constexpr int kBatch = 5;
+  std::array<std::array<Matrix3<double>, kNumLocations>, kBatch> F, F0;
+  for (int k = 0; k < kBatch; ++k) {
+    const Matrix3<double> R0 =
+        math::RotationMatrix<double>(math::RollPitchYaw<double>(1.0, 2.0, k))
+            .matrix();
+    // clang-format off
+    const Matrix3<double> S0 = (Matrix3<double>() <<
+           6, 1, 2,
+           1, 4, k,
+           2, k, 5)
+    .finished();
+    // clang-format on
+    F0[k][0] = R0 * S0;
+    F[k][0] = F0[k][0] + 0.1 * k * Matrix3<double>::Identity();
+  }
+  std::array<LinearCorotatedModelData<double, kNumLocations>, kBatch>
+      batched_data;
+  std::array<LinearCorotatedModelData<double, kNumLocations>*, kBatch>
+      data_ptrs;
+  for (int k = 0; k < kBatch; ++k) {
+    data_ptrs[k] = &batched_data[k];
+  }
+  LinearCorotatedModelData<double, kNumLocations>::UpdateDataBatch(data_ptrs,
+                                                                   F, F0);
+  for (int k = 0; k < kBatch; ++k) {
+    LinearCorotatedModelData<double, kNumLocations> data;
+    data.UpdateData(F[k], F0[k]);
+    const LinearCorotatedModelData<double, kNumLocations>& batched =
+        batched_data[k];
+    EXPECT_EQ(batched.deformation_gradient(), data.deformation_gradient());
+    EXPECT_EQ(batched.previous_step_deformation_gradient(),
+              data.previous_step_deformation_gradient());
+    EXPECT_TRUE(CompareMatrices(batched.R0()[0], data.R0()[0], 10 * kTol));
+    EXPECT_TRUE(
+        CompareMatrices(batched.strain()[0], data.strain()[0], 100 * kTol));
+    EXPECT_NEAR(batched.trace_strain()[0], data.trace_strain()[0], 100 * kTol);
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace fem
@@ -1,10 +1,14 @@
 #include "drake/multibody/fem/matrix_utilities.h"
 
+#include <algorithm>
+#include <array>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/autodiff_gradient.h"
+#include "drake/math/roll_pitch_yaw.h"
 #include "drake/math/rotation_matrix.h"
 
 namespace drake {
@@ -64,6 +68,51 @@ GTEST_TEST(MatrixUtilitiesTest, PolarDecompose) {
   EXPECT_TRUE(math::RotationMatrix<double>::IsValid(R, kTol));
 }
 
+/* PolarDecomposeBatch() agrees with PolarDecompose(), including for the entries
+ in the batch that it delegates to PolarDecompose(). */
+GTEST_TEST(MatrixUtilitiesTest, PolarDecomposeBatch) {
+  const math::RotationMatrix<double> R_AB(
+      math::RollPitchYaw<double>(0.3, -1.2, 2.5));
+  const Matrix3<double> stretch =
+      (Matrix3<double>() << 1.2, 0.1, -0.2, 0.1, 0.8, 0.05, -0.2, 0.05, 1.5)
+          .finished();
+  std::array<Matrix3<double>, kPolarDecomposeBatchSize> F;
+  /* A general deformation. */
+  F[0] = R_AB.matrix() * stretch;
+  /* An inverted deformation. */
+  F[1] = F[0] * Vector3<double>(1, 1, -1).asDiagonal();
+  /* A severely compressed deformation. */
+  F[2] = R_AB.matrix() * Vector3<double>(1e-3, 2.0, 0.5).asDiagonal();
+  /* A singular matrix. */
+  F[3] = MakeMatrix(3, 3);
+
+  std::array<Matrix3<double>, kPolarDecomposeBatchSize> R, S;
+  PolarDecomposeBatch(F, &R, &S);
+  for (int k = 0; k < kPolarDecomposeBatchSize; ++k) {
+    Matrix3<double> R_expected, S_expected;
+    PolarDecompose<double>(F[k], &R_expected, &S_expected);
+    EXPECT_TRUE(CompareMatrices(R[k], R_expected, 1e3 * kTol));
+    EXPECT_TRUE(CompareMatrices(S[k], S_expected, 1e3 * kTol));
+    EXPECT_TRUE(CompareMatrices(S[k], S[k].transpose(), kTol));
+    EXPECT_TRUE(math::RotationMatrix<double>::IsValid(R[k], kTol));
+  }
+
+  /* PolarDecomposeAll() processes the first kPolarDecomposeBatchSize matrices
+   as a batch and the rest one by one. */
+  std::array<Matrix3<double>, kPolarDecomposeBatchSize + 1> F_all;
+  std::copy(F.begin(), F.end(), F_all.begin());
+  F_all.back() = stretch;
+  std::array<Matrix3<double>, kPolarDecomposeBatchSize + 1> R_all, S_all;
+  PolarDecomposeAll(F_all, &R_all, &S_all);
+  for (int k = 0; k < kPolarDecomposeBatchSize; ++k) {
+    EXPECT_EQ(R_all[k], R[k]);
+    EXPECT_EQ(S_all[k], S[k]);
+  }
+  EXPECT_TRUE(CompareMatrices(R_all.back(), Matrix3<double>::Identity(),
+                              1e3 * kTol));
+  EXPECT_TRUE(CompareMatrices(S_all.back(), stretch, 1e3 * kTol));
+}
+
 GTEST_TEST(MatrixUtilitiesTest, AddScaledRotationalDerivative) {
   const Matrix3<AutoDiffXd> F = MakeAutoDiffMatrix(3, 3);
   Matrix3<AutoDiffXd> R, S;
@@ -310,6 +310,35 @@ TEST_F(VolumetricElementTest, DeformedState) {
   EXPECT_TRUE(CompareMatrices(force0, force0_expected, kEpsilon));
 }
 
+/* Computing the data of a batch of elements agrees with computing the data of
+ each element on its own. */
+TEST_F(VolumetricElementTest, ComputeDataBatch) {
+  unique_ptr<FemState<AD>> fem_state = MakeDeformedState();
+  const Data expected = element().ComputeData(*fem_state);
+  constexpr int kBatch = 2;
+  std::array<Data, kBatch> data;
+  const std::array<const ElementType*, kBatch> batch_elements = {&element(),
+                                                                 &element()};
+  const std::array<Data*, kBatch> batch_data = {&data[0], &data[1]};
+  ElementType::ComputeDataBatch(batch_elements, *fem_state, batch_data);
+  for (int k = 0; k < kBatch; ++k) {
+    EXPECT_TRUE(CompareMatrices(math::DiscardGradient(data[k].element_q),
+                                math::DiscardGradient(expected.element_q)));
+    EXPECT_TRUE(CompareMatrices(math::DiscardGradient(data[k].element_v),
+                                math::DiscardGradient(expected.element_v)));
+    for (int q = 0; q < kNumQuads; ++q) {
+      EXPECT_EQ(data[k].Psi[q].value(), expected.Psi[q].value());
+      EXPECT_TRUE(CompareMatrices(math::DiscardGradient(data[k].P[q]),
+                                  math::DiscardGradient(expected.P[q])));
+      EXPECT_TRUE(CompareMatrices(math::DiscardGradient(data[k].dPdF[q]),
+                                  math::DiscardGradient(expected.dPdF[q])));
+      EXPECT_TRUE(CompareMatrices(
+          math::DiscardGradient(data[k].quadrature_positions[q]),
+          math::DiscardGradient(expected.quadrature_positions[q])));
+    }
+  }
+}
+
 /* Tests that at any given state, the negative elastic force is the derivative
  elastic energy with respect to the generalized positions. */
 TEST_F(VolumetricElementTest, NegativeElasticForceIsEnergyDerivative) {
@@ -1,5 +1,7 @@
 #include "drake/multibody/fem/volumetric_model.h"
 
+#include <utility>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -257,6 +259,59 @@ TEST_F(VolumetricModelTest, Clone) {
   EXPECT_EQ(state->num_nodes(), clone_state->num_nodes());
 }
 
+/* Residuals and tangent matrices computed with element coloring agree with the
+ serial ones up to round-off, and do not depend on the number of threads. */
+TEST_F(VolumetricModelTest, Parallelism) {
+  using DoubleModel = VolumetricModel<DoubleElement>;
+  /* A box with many elements so that the elements have several colors. */
+  geometry::Box box(kBoxLength, kBoxLength, kBoxLength);
+  const geometry::VolumeMesh<double> mesh =
+      geometry::internal::MakeBoxVolumeMesh<double>(box, kBoxLength / 4);
+  DoubleModel double_model;
+  EXPECT_EQ(double_model.parallelism().num_threads(), 1);
+  {
+    const DoubleModel::ConstitutiveModel constitutive_model(kYoungsModulus,
+                                                            kPoissonRatio);
+    const DampingModel<double> damping_model(kMassDamping, kStiffnessDamping);
+    DoubleModel::VolumetricBuilder builder(&double_model);
+    builder.AddLinearTetrahedralElements(mesh, constitutive_model, kDensity,
+                                         damping_model);
+    builder.Build();
+  }
+  ASSERT_GT(double_model.num_elements(), 100);
+  const systems::LeafContext<double> dummy_context;
+  const FemPlantData<double> dummy_data{dummy_context, {}};
+
+  const auto calc = [&](const DoubleModel& model) {
+    unique_ptr<FemState<double>> state = MakeDeformedFemState(model);
+    VectorX<double> residual(model.num_dofs());
+    model.CalcResidual(*state, dummy_data, &residual);
+    auto tangent_matrix = model.MakeTangentMatrix();
+    model.CalcTangentMatrix(*state, double_integrator_.GetWeights(),
+                            tangent_matrix.get());
+    return std::make_pair(residual, tangent_matrix->MakeDenseMatrix());
+  };
+  const auto [expected_residual, expected_tangent_matrix] = calc(double_model);
+
+  double_model.set_parallelism(Parallelism(2));
+  EXPECT_EQ(double_model.parallelism().num_threads(), 2);
+  const auto [residual2, tangent_matrix2] = calc(double_model);
+  const double kTol = 1e-12;
+  EXPECT_TRUE(CompareMatrices(residual2, expected_residual,
+                              kTol * expected_residual.norm()));
+  EXPECT_TRUE(CompareMatrices(tangent_matrix2, expected_tangent_matrix,
+                              kTol * expected_tangent_matrix.norm()));
+
+  /* Clones keep the parallelism. */
+  std::unique_ptr<FemModel<double>> clone = double_model.Clone();
+  EXPECT_EQ(clone->parallelism().num_threads(), 2);
+  clone->set_parallelism(Parallelism(4));
+  const auto [residual4, tangent_matrix4] =
+      calc(dynamic_cast<const DoubleModel&>(*clone));
+  EXPECT_EQ(residual4, residual2);
+  EXPECT_EQ(tangent_matrix4, tangent_matrix2);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace fem
@@ -397,28 +397,63 @@ class VolumetricElement
   /* Implements FemElement::ComputeData(). */
   Data DoComputeData(const FemState<T>& state) const {
     Data data;
-    data.element_q = this->ExtractElementDofs(state.GetPositions());
-    data.element_q0 =
+    ExtractStateData(state, &data);
+    data.deformation_gradient_data.UpdateData(
+        CalcDeformationGradient(data.element_q),
+        CalcDeformationGradient(data.element_q0));
+    CalcConstitutiveData(&data);
+    return data;
+  }
+
+  /* Implements FemElement::ComputeDataBatch(). The deformation gradient data
+   of all elements are updated together with
+   DeformationGradientData::UpdateDataBatch(). */
+  template <size_t kBatch>
+  static void DoComputeDataBatch(
+      const std::array<const VolumetricElement*, kBatch>& elements,
+      const FemState<T>& state, const std::array<Data*, kBatch>& data) {
+    using DeformationGradientData = typename ConstitutiveModelType::Data;
+    std::array<std::array<Matrix3<T>, num_quadrature_points>, kBatch> F, F0;
+    std::array<DeformationGradientData*, kBatch> deformation_gradient_data;
+    for (size_t k = 0; k < kBatch; ++k) {
+      DRAKE_ASSERT(elements[k] != nullptr && data[k] != nullptr);
+      elements[k]->ExtractStateData(state, data[k]);
+      F[k] = elements[k]->CalcDeformationGradient(data[k]->element_q);
+      F0[k] = elements[k]->CalcDeformationGradient(data[k]->element_q0);
+      deformation_gradient_data[k] = &data[k]->deformation_gradient_data;
+    }
+    DeformationGradientData::UpdateDataBatch(deformation_gradient_data, F, F0);
+    for (size_t k = 0; k < kBatch; ++k) {
+      elements[k]->CalcConstitutiveData(data[k]);
+    }
+  }
+
+  /* Helper for DoComputeData() that extracts the element dofs from `state`
+   into `data` and interpolates the positions of the quadrature points. */
+  void ExtractStateData(const FemState<T>& state, Data* data) const {
+    data->element_q = this->ExtractElementDofs(state.GetPositions());
+    data->element_q0 =
         this->ExtractElementDofs(state.GetPreviousStepPositions());
-    data.element_v = this->ExtractElementDofs(state.GetVelocities());
-    data.element_a = this->ExtractElementDofs(state.GetAccelerations());
+    data->element_v = this->ExtractElementDofs(state.GetVelocities());
+    data->element_a = this->ExtractElementDofs(state.GetAccelerations());
     const auto& element_q_reshaped =
-        Eigen::Map<const Eigen::Matrix<T, 3, num_nodes>>(data.element_q.data(),
-                                                         3, num_nodes);
-    data.quadrature_positions =
+        Eigen::Map<const Eigen::Matrix<T, 3, num_nodes>>(
+            data->element_q.data(), 3, num_nodes);
+    data->quadrature_positions =
         isoparametric_element_.template InterpolateNodalValues<3>(
             element_q_reshaped);
+  }
 
-    data.deformation_gradient_data.UpdateData(
-        CalcDeformationGradient(data.element_q),
-        CalcDeformationGradient(data.element_q0));
+  /* Helper for DoComputeData() that evaluates the energy density, stress, and
+   stress derivative from the up-to-date deformation gradient data in `data`.
+   */
+  void CalcConstitutiveData(Data* data) const {
     this->constitutive_model().CalcElasticEnergyDensity(
-        data.deformation_gradient_data, &data.Psi);
+        data->deformation_gradient_data, &data->Psi);
     this->constitutive_model().CalcFirstPiolaStress(
-        data.deformation_gradient_data, &data.P);
+        data->deformation_gradient_data, &data->P);
     this->constitutive_model().CalcFirstPiolaStressDerivative(
-        data.deformation_gradient_data, &data.dPdF);
-    return data;
+        data->deformation_gradient_data, &data->dPdF);
   }
 
   void DoAddScaledExternalForces(const Data& data,
@@ -19,6 +19,13 @@ void UpdateContextConfiguration(drake::systems::Context<double>* context,
   return UpdateContextConfiguration(context, plant, math::ExtractValue(q));
 }
 
+void UpdateContextConfiguration(
+    drake::systems::Context<double>* context,
+    const MultibodyPlant<double>& plant,
+    const Eigen::Ref<const VectorX<AutoDiffUpTo16d>>& q) {
+  return UpdateContextConfiguration(context, plant, math::ExtractValue(q));
+}
+
 void UpdateContextConfiguration(systems::Context<AutoDiffXd>* context,
                                 const MultibodyPlant<AutoDiffXd>& plant,
                                 const Eigen::Ref<const AutoDiffVecXd>& q) {
@@ -24,6 +24,11 @@ void UpdateContextConfiguration(drake::systems::Context<double>* context,
                                 const MultibodyPlant<double>& plant,
                                 const Eigen::Ref<const VectorX<AutoDiffXd>>& q);
 
+void UpdateContextConfiguration(
+    drake::systems::Context<double>* context,
+    const MultibodyPlant<double>& plant,
+    const Eigen::Ref<const VectorX<AutoDiffUpTo16d>>& q);
+
 void UpdateContextConfiguration(systems::Context<AutoDiffXd>* context,
                                 const MultibodyPlant<AutoDiffXd>& plant,
                                 const Eigen::Ref<const AutoDiffVecXd>& q);
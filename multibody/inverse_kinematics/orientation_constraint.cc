@@ -58,14 +58,16 @@ OrientationConstraint::OrientationConstraint(
 
 namespace {
 
+// S is either AutoDiffXd or AutoDiffUpTo16d.
+template <typename S>
 void EvalConstraintGradient(const systems::Context<double>& context,
                             const MultibodyPlant<double>& plant,
                             const Frame<double>& frameAbar,
                             const Frame<double>& frameBbar,
                             const math::RotationMatrix<double>& R_AAbar,
                             const math::RotationMatrix<double>& R_AB,
-                            const Eigen::Ref<const AutoDiffVecXd>& x,
-                            AutoDiffVecXd* y) {
+                            const Eigen::Ref<const VectorX<S>>& x,
+                            VectorX<S>* y) {
   // The constraint function is
   //  g(q) = tr(R_AB(q)).
   // To derive the Jacobian of g, ∂g/∂q, we first differentiate
@@ -154,5 +156,19 @@ void OrientationConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
   }
 }
 
+void OrientationConstraint::EvalFixedSizeAutoDiff(
+    const Eigen::Ref<const VectorX<AutoDiffUpTo16d>>& x,
+    VectorX<AutoDiffUpTo16d>* y) const {
+  if (use_autodiff()) {
+    throw std::logic_error(
+        "OrientationConstraint::EvalFixedSizeAutoDiff() requires a constraint "
+        "constructed with a MultibodyPlant<double>.");
+  }
+  DRAKE_THROW_UNLESS(y != nullptr);
+  DRAKE_THROW_UNLESS(x.size() == num_vars());
+  DoEvalGeneric(*plant_double_, context_double_, frameAbar_index_,
+                frameBbar_index_, R_AAbar_, R_BbarB_, x, y);
+}
+
 }  // namespace multibody
 }  // namespace drake
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "drake/math/rotation_matrix.h"
+#include "drake/common/autodiff.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/solvers/constraint.h"
 
@@ -82,6 +83,20 @@ class OrientationConstraint : public solvers::Constraint {
 
   ~OrientationConstraint() override {}
 
+  /**
+   * Evaluates the constraint like Eval() does for AutoDiffXd, but with the
+   * gradients stored in AutoDiffUpTo16d, whose partials live inline instead of
+   * on the heap. This suits gradients with respect to at most 16 variables,
+   * e.g., the joints of an arm. The gradient is computed from the Jacobian of
+   * the MultibodyPlant<double> used to construct this constraint.
+   * @throws std::exception if this constraint was constructed with a
+   *   MultibodyPlant<AutoDiffXd>.
+   * @throws std::exception if `y` is nullptr or x.size() != num_vars().
+   */
+  void EvalFixedSizeAutoDiff(
+      const Eigen::Ref<const VectorX<AutoDiffUpTo16d>>& x,
+      VectorX<AutoDiffUpTo16d>* y) const;
+
  private:
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd* y) const override;
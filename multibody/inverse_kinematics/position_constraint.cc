@@ -80,19 +80,24 @@ PositionConstraint::PositionConstraint(
 
 namespace {
 
+// S is either AutoDiffXd or AutoDiffUpTo16d.
+template <typename S>
 void EvalConstraintGradient(
     const systems::Context<double>& context,
     const MultibodyPlant<double>& plant, const Frame<double>& frameAbar,
     const math::RigidTransformd& X_AAbar, const Frame<double>& frameB,
     const Eigen::Vector3d& p_AQ, const Eigen::Vector3d& p_BQ,
-    const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) {
+    const Eigen::Ref<const VectorX<S>>& x, VectorX<S>* y) {
   Eigen::Matrix3Xd Jq_V_AbarBq(3, plant.num_positions());
   plant.CalcJacobianTranslationalVelocity(context, JacobianWrtVariable::kQDot,
                                           frameB, p_BQ, frameAbar, frameAbar,
                                           &Jq_V_AbarBq);
-  *y =
-      math::InitializeAutoDiff(p_AQ, X_AAbar.rotation().matrix() * Jq_V_AbarBq *
-                                         math::ExtractGradient(x));
+  const Eigen::Matrix3Xd dy_dx = X_AAbar.rotation().matrix() * Jq_V_AbarBq *
+                                 math::ExtractGradient(x);
+  for (int i = 0; i < 3; ++i) {
+    (*y)(i).value() = p_AQ(i);
+    (*y)(i).derivatives() = dy_dx.row(i).transpose();
+  }
 }
 
 template <typename T, typename S>
@@ -141,5 +146,19 @@ void PositionConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
   }
 }
 
+void PositionConstraint::EvalFixedSizeAutoDiff(
+    const Eigen::Ref<const VectorX<AutoDiffUpTo16d>>& x,
+    VectorX<AutoDiffUpTo16d>* y) const {
+  if (use_autodiff()) {
+    throw std::logic_error(
+        "PositionConstraint::EvalFixedSizeAutoDiff() requires a constraint "
+        "constructed with a MultibodyPlant<double>.");
+  }
+  DRAKE_THROW_UNLESS(y != nullptr);
+  DRAKE_THROW_UNLESS(x.size() == num_vars());
+  DoEvalGeneric(*plant_double_, context_double_, frameAbar_index_, X_AAbar_,
+                frameB_index_, p_BQ_, x, y);
+}
+
 }  // namespace multibody
 }  // namespace drake
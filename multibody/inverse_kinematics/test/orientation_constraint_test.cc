@@ -25,6 +25,27 @@ AutoDiffVecXd EvalOrientationConstraintAutoDiff(
   return y_autodiff;
 }
 
+// Evaluates `dut` with AutoDiffXd and with AutoDiffUpTo16d for the positions
+// q with gradient dq, and checks that the results agree.
+template <typename Constraint>
+void CheckFixedSizeAutoDiffEval(const Constraint& dut,
+                                const Eigen::Ref<const Eigen::VectorXd>& q,
+                                const Eigen::Ref<const Eigen::MatrixXd>& dq) {
+  AutoDiffVecXd y_expected;
+  dut.Eval(math::InitializeAutoDiff(q, dq), &y_expected);
+  VectorX<AutoDiffUpTo16d> q_fixed(q.size());
+  for (int i = 0; i < q.size(); ++i) {
+    q_fixed(i) = AutoDiffUpTo16d(q(i), dq.row(i).transpose());
+  }
+  VectorX<AutoDiffUpTo16d> y_fixed;
+  dut.EvalFixedSizeAutoDiff(q_fixed, &y_fixed);
+  const double tol = 1E-14;
+  EXPECT_TRUE(CompareMatrices(math::ExtractValue(y_fixed),
+                              math::ExtractValue(y_expected), tol));
+  EXPECT_TRUE(CompareMatrices(math::ExtractGradient(y_fixed),
+                              math::ExtractGradient(y_expected), tol));
+}
+
 TEST_F(IiwaKinematicConstraintTest, OrientationConstraint) {
   const double angle_bound{0.1 * M_PI};
   const auto frameAbar_index = plant_->GetFrameByName("iiwa_link_7").index();
@@ -93,6 +114,14 @@ TEST_F(IiwaKinematicConstraintTest, OrientationConstraint) {
   const double gradient_tol = 2E-6;
   TestKinematicConstraintEval(*constraint, constraint_from_autodiff, q, dq,
                               gradient_tol);
+
+  // Gradients stored in AutoDiffUpTo16d agree with those from AutoDiffXd. They
+  // are only supported for constraints constructed from MBP<double>.
+  CheckFixedSizeAutoDiffEval(*constraint, q, dq);
+  VectorX<AutoDiffUpTo16d> y_fixed;
+  EXPECT_THROW(constraint_from_autodiff.EvalFixedSizeAutoDiff(
+                   q.cast<AutoDiffUpTo16d>(), &y_fixed),
+               std::logic_error);
 }
 
 TEST_F(TwoFreeBodiesConstraintTest, OrientationConstraint) {
@@ -23,6 +23,27 @@ AutoDiffVecXd EvalPositionConstraintAutoDiff(
   return X_AAbar.cast<AutoDiffXd>() * p_AbarQ;
 }
 
+// Evaluates `dut` with AutoDiffXd and with AutoDiffUpTo16d for the positions
+// q with gradient dq, and checks that the results agree.
+template <typename Constraint>
+void CheckFixedSizeAutoDiffEval(const Constraint& dut,
+                                const Eigen::Ref<const Eigen::VectorXd>& q,
+                                const Eigen::Ref<const Eigen::MatrixXd>& dq) {
+  AutoDiffVecXd y_expected;
+  dut.Eval(math::InitializeAutoDiff(q, dq), &y_expected);
+  VectorX<AutoDiffUpTo16d> q_fixed(q.size());
+  for (int i = 0; i < q.size(); ++i) {
+    q_fixed(i) = AutoDiffUpTo16d(q(i), dq.row(i).transpose());
+  }
+  VectorX<AutoDiffUpTo16d> y_fixed;
+  dut.EvalFixedSizeAutoDiff(q_fixed, &y_fixed);
+  const double tol = 1E-14;
+  EXPECT_TRUE(CompareMatrices(math::ExtractValue(y_fixed),
+                              math::ExtractValue(y_expected), tol));
+  EXPECT_TRUE(CompareMatrices(math::ExtractGradient(y_fixed),
+                              math::ExtractGradient(y_expected), tol));
+}
+
 TEST_F(IiwaKinematicConstraintTest, PositionConstraint) {
   const Eigen::Vector3d p_BQ(0.1, 0.2, 0.3);
   const Eigen::Vector3d p_AQ_lower(-0.2, -0.3, -0.4);
@@ -117,6 +138,14 @@ TEST_F(IiwaKinematicConstraintTest, PositionConstraint) {
   TestKinematicConstraintEval(constraint, constraint_from_autodiff, q, dq,
                               gradient_tol);
 
+  // Gradients stored in AutoDiffUpTo16d agree with those from AutoDiffXd. They
+  // are only supported for constraints constructed from MBP<double>.
+  CheckFixedSizeAutoDiffEval(constraint, q, dq);
+  VectorX<AutoDiffUpTo16d> y_fixed;
+  EXPECT_THROW(constraint_from_autodiff.EvalFixedSizeAutoDiff(
+                   q.cast<AutoDiffUpTo16d>(), &y_fixed),
+               std::logic_error);
+
   // Update bounds
   Eigen::Vector3d new_lb(-0.5, -kInf, 0);
   Eigen::Vector3d new_ub(kInf, kInf, 2);
@@ -36,13 +36,17 @@ namespace internal {
 
 template <typename T>
 AccelerationsDueNonConstraintForcesCache<
-    T>::AccelerationsDueNonConstraintForcesCache(const MultibodyTreeTopology&
+    T>::AccelerationsDueNonConstraintForcesCache(const MultibodyPlant<T>&
+                                                     plant,
+                                                 const MultibodyTreeTopology&
                                                      topology)
     : forces(topology.num_rigid_bodies(), topology.num_velocities()),
       abic(topology),
       Zb_Bo_W(topology.num_rigid_bodies()),
       aba_forces(topology),
-      ac(topology) {}
+      ac(topology),
+      input_port_forces(plant),
+      diagonal_inertia(topology.num_velocities()) {}
 
 template <typename T>
 CompliantContactManager<T>::CompliantContactManager() = default;
@@ -90,7 +94,8 @@ void CompliantContactManager<T>::DoDeclareCacheEntries() {
   // We cache non-contact forces, ABA forces and accelerations into an
   // AccelerationsDueNonConstraintForcesCache.
   AccelerationsDueNonConstraintForcesCache<T>
-      non_constraint_forces_accelerations(this->internal_tree().get_topology());
+      non_constraint_forces_accelerations(this->plant(),
+                                          this->internal_tree().get_topology());
   const auto& non_constraint_forces_accelerations_cache_entry =
       this->DeclareCacheEntry(
           "Non-constraint forces and induced accelerations.",
@@ -118,10 +123,18 @@ void CompliantContactManager<T>::DoDeclareCacheEntries() {
 template <typename T>
 VectorX<T> CompliantContactManager<T>::CalcEffectiveDamping(
     const systems::Context<T>& context) const {
-  const VectorX<T> diagonal_inertia =
+  VectorX<T> diagonal_inertia;
+  CalcEffectiveDamping(context, &diagonal_inertia);
+  return diagonal_inertia;
+}
+
+template <typename T>
+void CompliantContactManager<T>::CalcEffectiveDamping(
+    const systems::Context<T>& context, VectorX<T>* diagonal_inertia) const {
+  DRAKE_DEMAND(diagonal_inertia != nullptr);
+  *diagonal_inertia =
       plant().EvalReflectedInertiaCache(context) +
       plant().EvalJointDampingCache(context) * plant().time_step();
-  return diagonal_inertia;
 }
 
 template <typename T>
@@ -135,7 +148,9 @@ void CompliantContactManager<T>::CalcAccelerationsDueToNonConstraintForcesCache(
   // included later as SAP constraints.
   this->CalcNonContactForces(
       context, /* include_joint_limit_penalty_forces */ false,
-      /* include_pd_controlled_input */ false, &forward_dynamics_cache->forces);
+      /* include_pd_controlled_input */ false,
+      &forward_dynamics_cache->input_port_forces,
+      &forward_dynamics_cache->forces);
 
   // Our goal is to compute accelerations from the Newton-Euler equations:
   //   M⋅v̇ = k(x)
@@ -164,7 +179,8 @@ void CompliantContactManager<T>::CalcAccelerationsDueToNonConstraintForcesCache(
   // below in terms of MultibodyTree APIs.
 
   // We must include reflected rotor inertias along with the new term dt⋅D.
-  const VectorX<T> diagonal_inertia = CalcEffectiveDamping(context);
+  VectorX<T>& diagonal_inertia = forward_dynamics_cache->diagonal_inertia;
+  CalcEffectiveDamping(context, &diagonal_inertia);
 
   // We compute the articulated body inertia including the contribution of the
   // additional diagonal elements arising from the implicit treatment of joint
@@ -36,13 +36,16 @@ template <typename T>
 struct AccelerationsDueNonConstraintForcesCache {
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(
       AccelerationsDueNonConstraintForcesCache);
-  explicit AccelerationsDueNonConstraintForcesCache(
-      const MultibodyTreeTopology& topology);
+  AccelerationsDueNonConstraintForcesCache(
+      const MultibodyPlant<T>& plant, const MultibodyTreeTopology& topology);
   MultibodyForces<T> forces;  // The external forces causing accelerations.
   ArticulatedBodyInertiaCache<T> abic;   // Articulated body inertia cache.
   std::vector<SpatialForce<T>> Zb_Bo_W;  // Articulated body biases cache.
   multibody::internal::ArticulatedBodyForceCache<T> aba_forces;  // ABA cache.
   multibody::internal::AccelerationKinematicsCache<T> ac;  // Accelerations.
+  // Scratch storage, reused across evaluations to avoid heap allocations.
+  InputPortForces<T> input_port_forces;  // Forces from input ports.
+  VectorX<T> diagonal_inertia;  // Effective damping, see CalcEffectiveDamping.
 };
 
 // This class implements the interface given by DiscreteUpdateManager so that
@@ -146,6 +149,11 @@ class CompliantContactManager final : public DiscreteUpdateManager<T> {
   // entries only.
   VectorX<T> CalcEffectiveDamping(const systems::Context<T>& context) const;
 
+  // Output argument overload of CalcEffectiveDamping(), which reuses the
+  // storage in `diagonal_inertia`.
+  void CalcEffectiveDamping(const systems::Context<T>& context,
+                            VectorX<T>* diagonal_inertia) const;
+
   // TODO(amcastro-tri): implement these APIs according to #16955.
   // @throws For SAP if T = symbolic::Expression.
   // @throws For TAMSI if T = symbolic::Expression only if the model contains
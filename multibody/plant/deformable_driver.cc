@@ -878,6 +878,11 @@ void DeformableDriver<T>::CalcFreeMotionFemSolver(
    FemPlantData for the associated FEM model. */
   const fem::FemPlantData<T> plant_data{
       context, deformable_model_->GetExternalForces(body_id)};
+  fem_solver->set_matrix_free(deformable_model_->UsesMatrixFreeSolver(body_id));
+  fem_solver->set_tangent_refresh_interval(
+      deformable_model_->GetTangentRefreshInterval(body_id));
+  fem_solver->set_lagged_tangent_residual_ratio(
+      deformable_model_->GetLaggedTangentResidualRatio(body_id));
   fem_solver->AdvanceOneTimeStep(fem_state, plant_data,
                                  nonparticipating_vertices);
 }
@@ -890,6 +895,12 @@ const FemSolver<T>& DeformableDriver<T>::EvalFreeMotionFemSolver(
       .template Eval<FemSolver<T>>(context);
 }
 
+template <typename T>
+const fem::FemSolverStatistics& DeformableDriver<T>::EvalFemSolverStatistics(
+    const systems::Context<T>& context, DeformableBodyIndex index) const {
+  return EvalFreeMotionFemSolver(context, index).get_statistics();
+}
+
 template <typename T>
 const FemState<T>& DeformableDriver<T>::EvalFreeMotionFemState(
     const systems::Context<T>& context, DeformableBodyIndex index) const {
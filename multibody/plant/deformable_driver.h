@@ -176,6 +176,11 @@ class DeformableDriver : public ScalarConvertibleComponent<T> {
   const Multiplexer<T>& EvalParticipatingVelocityMultiplexer(
       const systems::Context<T>& context) const;
 
+  /* Evaluates the statistics of the FEM solve for the free motion of the
+   deformable body with the given `index`. */
+  const fem::FemSolverStatistics& EvalFemSolverStatistics(
+      const systems::Context<T>& context, DeformableBodyIndex index) const;
+
   /* Evaluates the constraint participation information of the deformable body
    with the given `index`. See geometry::internal::ContactParticipation. */
   const geometry::internal::ContactParticipation& EvalConstraintParticipation(
@@ -11,7 +11,9 @@
 #include "drake/multibody/fem/linear_simplex_element.h"
 #include "drake/multibody/fem/simplex_gaussian_quadrature.h"
 #include "drake/multibody/fem/volumetric_model.h"
+#include "drake/multibody/plant/deformable_driver.h"
 #include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/plant/multibody_plant_model_attorney.h"
 
 namespace drake {
 namespace multibody {
@@ -26,6 +28,13 @@ using geometry::SourceId;
 using fem::DeformableBodyConfig;
 using fem::MaterialModel;
 
+namespace {
+
+/* The default of FemSolver::lagged_tangent_residual_ratio(). */
+constexpr double kDefaultLaggedTangentResidualRatio = 0.5;
+
+}  // namespace
+
 template <typename T>
 DeformableModel<T>::DeformableModel(MultibodyPlant<T>* plant)
     : PhysicalModel<T>(plant) {}
@@ -208,6 +217,91 @@ DeformableModel<T>::GetExternalForces(DeformableBodyId id) const {
   return body_index_to_force_densities_[GetBodyIndex(id)];
 }
 
+template <typename T>
+void DeformableModel<T>::SetParallelism(Parallelism parallelism) {
+  parallelism_ = parallelism;
+  for (const auto& [deformable_id, fem_model] : fem_models_) {
+    fem_model->set_parallelism(parallelism);
+  }
+}
+
+template <typename T>
+void DeformableModel<T>::SetUseMatrixFreeSolver(DeformableBodyId id,
+                                                bool use_matrix_free) {
+  ThrowUnlessRegistered(__func__, id);
+  if (use_matrix_free) {
+    matrix_free_body_ids_.insert(id);
+  } else {
+    matrix_free_body_ids_.erase(id);
+  }
+}
+
+template <typename T>
+bool DeformableModel<T>::UsesMatrixFreeSolver(DeformableBodyId id) const {
+  ThrowUnlessRegistered(__func__, id);
+  return matrix_free_body_ids_.contains(id);
+}
+
+template <typename T>
+void DeformableModel<T>::SetTangentRefreshInterval(DeformableBodyId id,
+                                                   int interval) {
+  ThrowUnlessRegistered(__func__, id);
+  DRAKE_THROW_UNLESS(interval >= 1);
+  if (interval == 1) {
+    tangent_refresh_intervals_.erase(id);
+  } else {
+    tangent_refresh_intervals_[id] = interval;
+  }
+}
+
+template <typename T>
+int DeformableModel<T>::GetTangentRefreshInterval(DeformableBodyId id) const {
+  ThrowUnlessRegistered(__func__, id);
+  const auto it = tangent_refresh_intervals_.find(id);
+  return it == tangent_refresh_intervals_.end() ? 1 : it->second;
+}
+
+template <typename T>
+void DeformableModel<T>::SetLaggedTangentResidualRatio(DeformableBodyId id,
+                                                       double ratio) {
+  ThrowUnlessRegistered(__func__, id);
+  DRAKE_THROW_UNLESS(0 < ratio && ratio <= 1);
+  if (ratio == kDefaultLaggedTangentResidualRatio) {
+    lagged_tangent_residual_ratios_.erase(id);
+  } else {
+    lagged_tangent_residual_ratios_[id] = ratio;
+  }
+}
+
+template <typename T>
+double DeformableModel<T>::GetLaggedTangentResidualRatio(
+    DeformableBodyId id) const {
+  ThrowUnlessRegistered(__func__, id);
+  const auto it = lagged_tangent_residual_ratios_.find(id);
+  return it == lagged_tangent_residual_ratios_.end()
+             ? kDefaultLaggedTangentResidualRatio
+             : it->second;
+}
+
+template <typename T>
+const fem::FemSolverStatistics& DeformableModel<T>::GetFemSolverStatistics(
+    const systems::Context<T>& context, DeformableBodyId id) const {
+  ThrowIfNotDouble(__func__);
+  this->ThrowIfSystemResourcesNotDeclared(__func__);
+  ThrowUnlessRegistered(__func__, id);
+  DRAKE_DEMAND(finalized_plant_ != nullptr);
+  finalized_plant_->ValidateContext(context);
+  if constexpr (std::is_same_v<T, double>) {
+    const internal::DeformableDriver<double>* driver =
+        internal::MultibodyPlantModelAttorney<T>::deformable_driver(
+            *finalized_plant_);
+    DRAKE_DEMAND(driver != nullptr);
+    return driver->EvalFemSolverStatistics(context, GetBodyIndex(id));
+  } else {
+    DRAKE_UNREACHABLE();
+  }
+}
+
 template <typename T>
 const fem::FemModel<T>& DeformableModel<T>::GetFemModel(
     DeformableBodyId id) const {
@@ -280,6 +374,10 @@ std::unique_ptr<PhysicalModel<double>> DeformableModel<T>::CloneToDouble(
     for (const auto& [deformable_id, fem_model] : fem_models_) {
       result->fem_models_.emplace(deformable_id, fem_model->Clone());
     }
+    result->parallelism_ = parallelism_;
+    result->matrix_free_body_ids_ = matrix_free_body_ids_;
+    result->tangent_refresh_intervals_ = tangent_refresh_intervals_;
+    result->lagged_tangent_residual_ratios_ = lagged_tangent_residual_ratios_;
     for (const auto& force_density : force_densities_) {
       result->force_densities_.emplace_back(force_density->Clone());
     }
@@ -295,6 +393,8 @@ std::unique_ptr<PhysicalModel<double>> DeformableModel<T>::CloneToDouble(
     /* `configuration_output_port_index_` is set in `DeclareSceneGraphPorts()`;
      because callers to `PhysicalModel::CloneToScalar` are required to
      subsequently call `DeclareSceneGraphPorts`. */
+    /* `finalized_plant_` is set in `DeclareSystemResources()`, which the plant
+     owning the clone calls. */
   }
 
   return result;
@@ -379,6 +479,7 @@ DeformableModel<T>::BuildLinearVolumetricModelHelper(
   builder.AddLinearTetrahedralElements(mesh, constitutive_model,
                                        config.mass_density(), damping_model);
   builder.Build();
+  fem_model->set_parallelism(parallelism_);
 
   fem_models_.emplace(id, std::move(fem_model));
 }
@@ -445,6 +546,7 @@ void DeformableModel<T>::DoDeclareSystemResources() {
        force_densities_) {
     force_density->DeclareSystemResources(this->mutable_plant());
   }
+  finalized_plant_ = this->plant();
 }
 
 template <typename T>
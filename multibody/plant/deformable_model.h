@@ -4,12 +4,15 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/identifier.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/fem/deformable_body_config.h"
 #include "drake/multibody/fem/fem_model.h"
+#include "drake/multibody/fem/fem_solver_statistics.h"
 #include "drake/multibody/plant/constraint_specs.h"
 #include "drake/multibody/plant/deformable_ids.h"
 #include "drake/multibody/plant/force_density_field.h"
@@ -174,6 +177,95 @@ class DeformableModel final : public multibody::PhysicalModel<T> {
   const std::vector<const ForceDensityField<T>*>& GetExternalForces(
       DeformableBodyId id) const;
 
+  /** Sets the degree of parallelism used to assemble the FEM residual and
+   tangent matrix of each deformable body, for the bodies already registered
+   and those registered afterwards. See fem::FemModel::set_parallelism() for
+   details. With Parallelism::None(), the default, the elements of each body
+   are processed serially. This setting can be changed at any time, pre- or
+   post-finalize. */
+  void SetParallelism(Parallelism parallelism);
+
+  /** Returns the parallelism set with SetParallelism(). */
+  Parallelism parallelism() const { return parallelism_; }
+
+  /** Sets whether the time step of the deformable body with the given `id` is
+   computed with the matrix-free iterative solver (see
+   fem::internal::FemSolver::set_matrix_free()) instead of a sparse direct
+   solver. The iterative solver never assembles or factorizes the tangent
+   matrix of the body, so its memory use scales with the number of vertices,
+   which pays off for large meshes. However, when p vertices of the body
+   participate in contact or constraints, each time step additionally runs 3p
+   conjugate gradient solves to compute the dense 3p-by-3p Schur complement
+   of the tangent matrix, and one more to propagate the contact velocity
+   update to the remaining vertices. It is therefore best suited to large
+   bodies with small contact patches. The default is `false`. This setting
+   can be changed at any time, pre- or post-finalize; it takes effect the next
+   time the body's free motion is computed.
+   @throws std::exception if no deformable body with the given `id` has been
+   registered in this model. */
+  void SetUseMatrixFreeSolver(DeformableBodyId id, bool use_matrix_free);
+
+  /** Returns the setting from SetUseMatrixFreeSolver() for the deformable body
+   with the given `id`.
+   @throws std::exception if no deformable body with the given `id` has been
+   registered in this model. */
+  bool UsesMatrixFreeSolver(DeformableBodyId id) const;
+
+  /** Sets the number of Newton-Raphson iterations for which a factorization of
+   the tangent matrix of the deformable body with the given `id` is reused
+   when its free motion is computed (see
+   fem::internal::FemSolver::set_tangent_refresh_interval()). With the default
+   of 1, the tangent matrix is refactored in every iteration. A larger
+   interval trades more iterations for fewer factorizations, which pays off
+   for mildly nonlinear materials. Linear materials and bodies using the
+   matrix-free solver (see SetUseMatrixFreeSolver()) are not affected. This
+   setting can be changed at any time, pre- or post-finalize; it takes effect
+   the next time the body's free motion is computed.
+   @throws std::exception if no deformable body with the given `id` has been
+   registered in this model.
+   @throws std::exception if `interval` < 1. */
+  void SetTangentRefreshInterval(DeformableBodyId id, int interval);
+
+  /** Returns the setting from SetTangentRefreshInterval() for the deformable
+   body with the given `id`.
+   @throws std::exception if no deformable body with the given `id` has been
+   registered in this model. */
+  int GetTangentRefreshInterval(DeformableBodyId id) const;
+
+  /** Sets the ratio of the residual norms after and before a Newton-Raphson
+   iteration with a lagged tangent matrix above which the tangent matrix of the
+   deformable body with the given `id` is refreshed early (see
+   SetTangentRefreshInterval() and
+   fem::internal::FemSolver::set_lagged_tangent_residual_ratio()). A smaller
+   ratio refreshes the tangent matrix more eagerly. The default is 0.5. This
+   setting can be changed at any time, pre- or post-finalize; it takes effect
+   the next time the body's free motion is computed.
+   @throws std::exception if no deformable body with the given `id` has been
+   registered in this model.
+   @throws std::exception unless 0 < `ratio` <= 1. */
+  void SetLaggedTangentResidualRatio(DeformableBodyId id, double ratio);
+
+  /** Returns the setting from SetLaggedTangentResidualRatio() for the
+   deformable body with the given `id`.
+   @throws std::exception if no deformable body with the given `id` has been
+   registered in this model. */
+  double GetLaggedTangentResidualRatio(DeformableBodyId id) const;
+
+  /** Returns the statistics of the FEM solve for the free motion of the
+   deformable body with the given `id` (i.e., its motion over one time step
+   in the absence of contact and constraints) in the discrete update from the
+   state stored in `context`, which is a context of the owning plant. The free
+   motion is computed if it isn't already cached in `context`. After a
+   discrete update, the state in `context` is the result of that update;
+   therefore, to inspect the solve of a given step, call this function before
+   taking the step.
+   @throws std::exception if called pre-finalize.
+   @throws std::exception if no deformable body with the given `id` has been
+   registered in this model.
+   @throws std::exception if T is not double. */
+  const fem::FemSolverStatistics& GetFemSolverStatistics(
+      const systems::Context<T>& context, DeformableBodyId id) const;
+
   /** Returns the FemModel for the body with `id`.
    @throws exception if no deformable body with `id` is registered with `this`
    %DeformableModel. */
@@ -332,6 +424,16 @@ class DeformableModel final : public multibody::PhysicalModel<T> {
       geometry_id_to_body_id_;
   std::unordered_map<DeformableBodyId, std::unique_ptr<fem::FemModel<T>>>
       fem_models_;
+  /* The parallelism used by all FEM models in `fem_models_`. */
+  Parallelism parallelism_{Parallelism::None()};
+  /* The bodies whose time steps are computed with the matrix-free solver. */
+  std::unordered_set<DeformableBodyId> matrix_free_body_ids_;
+  /* The tangent refresh intervals of the bodies whose interval isn't the
+   default of 1. */
+  std::unordered_map<DeformableBodyId, int> tangent_refresh_intervals_;
+  /* The lagged tangent residual ratios of the bodies whose ratio isn't the
+   default of 0.5. */
+  std::unordered_map<DeformableBodyId, double> lagged_tangent_residual_ratios_;
   /* The collection all external forces. */
   std::vector<std::unique_ptr<ForceDensityField<T>>> force_densities_;
   /* body_index_to_force_densities_[i] is the collection of pointers to external
@@ -347,6 +449,10 @@ class DeformableModel final : public multibody::PhysicalModel<T> {
   std::map<MultibodyConstraintId, internal::DeformableRigidFixedConstraintSpec>
       fixed_constraint_specs_;
   systems::OutputPortIndex configuration_output_port_index_;
+  /* The owning plant, recorded in DoDeclareSystemResources() since
+   PhysicalModel::plant() is nullptr post-finalize. It is only used to evaluate
+   the plant's cache entries in GetFemSolverStatistics(). */
+  const MultibodyPlant<T>* finalized_plant_{nullptr};
 };
 
 }  // namespace multibody
@@ -3,7 +3,6 @@
 #include <utility>
 #include <vector>
 
-#include "drake/common/drake_copyable.h"
 #include "drake/common/drake_throw.h"
 
 namespace drake {
@@ -20,17 +19,43 @@ enum class DiscreteContactType {
 /**
  Container to store results from discrete contact. Categorized by the contact
  type: point, hydroelastic, and deformable contact.
+
+ Clear() does not release the data it removes. Instead, it keeps it as spare
+ entries that the next calls to AppendPointData(), AppendHydroData(), and
+ AppendDeformableData() hand back out, so that any heap storage owned by Data
+ (e.g. Jacobian matrices) can be reused. Therefore, once the container has
+ seen its steady-state number of entries, refilling it after Clear() does not
+ allocate as long as the callers overwrite the recycled entries in place.
+ Copying the container copies only its current data, not its spare entries.
  @tparam Data The type of contact data shared by both point, hydroelastic, and
  deformable contact.
 */
 template <typename Data>
 class DiscreteContactData {
  public:
-  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(DiscreteContactData);
-
   /* Constructs an empty contact data. */
   DiscreteContactData() = default;
 
+  DiscreteContactData(const DiscreteContactData& other)
+      : point_(other.point_),
+        hydro_(other.hydro_),
+        deformable_(other.deformable_) {}
+
+  DiscreteContactData& operator=(const DiscreteContactData& other) {
+    if (this != &other) {
+      point_ = other.point_;
+      hydro_ = other.hydro_;
+      deformable_ = other.deformable_;
+      spare_point_.clear();
+      spare_hydro_.clear();
+      spare_deformable_.clear();
+    }
+    return *this;
+  }
+
+  DiscreteContactData(DiscreteContactData&&) = default;
+  DiscreteContactData& operator=(DiscreteContactData&&) = default;
+
   /* The total number of contact data, including all of point, hydroelastic, and
    deformable contacts. */
   int size() const {
@@ -84,21 +109,33 @@ class DiscreteContactData {
   }
 
   void AppendPointData(Data&& data) {
-    point_.push_back(std::forward<Data>(data));
+    Append(std::forward<Data>(data), &point_, &spare_point_);
   }
   void AppendHydroData(Data&& data) {
-    hydro_.push_back(std::forward<Data>(data));
+    Append(std::forward<Data>(data), &hydro_, &spare_hydro_);
   }
   void AppendDeformableData(Data&& data) {
-    deformable_.push_back(std::forward<Data>(data));
+    Append(std::forward<Data>(data), &deformable_, &spare_deformable_);
+  }
+
+  /* Appends a new entry and returns a reference to it, for the caller to fill
+   in place. The entry is one of the spare entries left by a previous call to
+   Clear() if there is any, in which case it holds stale values that the
+   caller must overwrite; otherwise it is value-initialized. The reference is
+   invalidated by the next call to any of the Append methods. */
+  Data& AppendPointData() { return Append(&point_, &spare_point_); }
+  Data& AppendHydroData() { return Append(&hydro_, &spare_hydro_); }
+  Data& AppendDeformableData() {
+    return Append(&deformable_, &spare_deformable_);
   }
 
   /* Removes all data from the container, leaving the container with a `size()`
-   of 0. */
+   of 0. The removed data is kept as spare entries for reuse, see the class
+   documentation. */
   void Clear() {
-    point_.clear();
-    hydro_.clear();
-    deformable_.clear();
+    Recycle(&point_, &spare_point_);
+    Recycle(&hydro_, &spare_hydro_);
+    Recycle(&deformable_, &spare_deformable_);
   }
 
   /* The starting index of point, hydroelastic, and deformable contact data when
@@ -110,9 +147,37 @@ class DiscreteContactData {
   }
 
  private:
+  static void Append(Data&& data, std::vector<Data>* entries,
+                     std::vector<Data>* spares) {
+    entries->push_back(std::forward<Data>(data));
+    // Discard one spare entry so that the number of entries plus spares does
+    // not exceed its high-water mark.
+    if (!spares->empty()) spares->pop_back();
+  }
+
+  static Data& Append(std::vector<Data>* entries, std::vector<Data>* spares) {
+    if (spares->empty()) return entries->emplace_back();
+    entries->push_back(std::move(spares->back()));
+    spares->pop_back();
+    return entries->back();
+  }
+
+  // Moves all `entries` to `spares`, in reverse order so that the spares are
+  // handed back out in the order they were appended.
+  static void Recycle(std::vector<Data>* entries, std::vector<Data>* spares) {
+    for (auto it = entries->rbegin(); it != entries->rend(); ++it) {
+      spares->push_back(std::move(*it));
+    }
+    entries->clear();
+  }
+
   std::vector<Data> point_;
   std::vector<Data> hydro_;
   std::vector<Data> deformable_;
+  // Entries removed by Clear(), available for reuse.
+  std::vector<Data> spare_point_;
+  std::vector<Data> spare_hydro_;
+  std::vector<Data> spare_deformable_;
 };
 
 }  // namespace internal
@@ -3,9 +3,11 @@
 #include <limits>
 #include <utility>
 
+#include "drake/common/ssize.h"
 #include "drake/multibody/plant/contact_properties.h"
 #include "drake/multibody/plant/deformable_driver.h"
 #include "drake/multibody/plant/deformable_model.h"
+#include "drake/multibody/plant/hydroelastic_quadrature_reduction.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/plant/multibody_plant_discrete_update_manager_attorney.h"
 
@@ -25,6 +27,38 @@ using drake::multibody::internal::MultibodyTreeTopology;
 using drake::systems::Context;
 using drake::systems::DependencyTicket;
 
+namespace {
+
+/* Sets the `index`-th block of `jacobian` to the Jacobian R_WCᵀ⋅Jv_AcBc_W of
+ the contact velocity with respect to the velocities of `tree`, expressed in
+ the contact frame C, where `Jv_AcBc_W_tree` holds the columns of Jv_AcBc_W for
+ those velocities. When `jacobian` already has a dense block at that index (as
+ is the case for a recycled contact pair) its storage is reused. Otherwise,
+ `index` must equal the number of blocks and a new block is appended. */
+template <typename T>
+void SetContactJacobianTreeBlock(
+    int index, TreeIndex tree, const RotationMatrix<T>& R_WC,
+    const Eigen::Ref<const Matrix3X<T>>& Jv_AcBc_W_tree,
+    std::vector<typename DiscreteContactPair<T>::JacobianTreeBlock>*
+        jacobian) {
+  DRAKE_ASSERT(0 <= index && index <= ssize(*jacobian));
+  if (index < ssize(*jacobian) && (*jacobian)[index].J.is_dense()) {
+    (*jacobian)[index].tree = tree;
+    MatrixX<T>& J = (*jacobian)[index].J.get_mutable_dense_matrix();
+    J.resize(3, Jv_AcBc_W_tree.cols());
+    J.noalias() = R_WC.matrix().transpose() * Jv_AcBc_W_tree;
+    return;
+  }
+  Matrix3X<T> J = R_WC.matrix().transpose() * Jv_AcBc_W_tree;
+  if (index < ssize(*jacobian)) {
+    (*jacobian)[index] = {tree, MatrixBlock<T>(std::move(J))};
+  } else {
+    jacobian->emplace_back(tree, MatrixBlock<T>(std::move(J)));
+  }
+}
+
+}  // namespace
+
 template <typename T>
 DiscreteUpdateManager<T>::~DiscreteUpdateManager() = default;
 
@@ -209,7 +243,18 @@ void DiscreteUpdateManager<T>::CalcNonContactForces(
     const drake::systems::Context<T>& context,
     bool include_joint_limit_penalty_forces, bool include_pd_controlled_input,
     MultibodyForces<T>* forces) const {
+  InputPortForces<T> inputs(plant());
+  CalcNonContactForces(context, include_joint_limit_penalty_forces,
+                       include_pd_controlled_input, &inputs, forces);
+}
+
+template <typename T>
+void DiscreteUpdateManager<T>::CalcNonContactForces(
+    const drake::systems::Context<T>& context,
+    bool include_joint_limit_penalty_forces, bool include_pd_controlled_input,
+    InputPortForces<T>* input_port_forces, MultibodyForces<T>* forces) const {
   plant().ValidateContext(context);
+  DRAKE_DEMAND(input_port_forces != nullptr);
   DRAKE_DEMAND(forces != nullptr);
   DRAKE_DEMAND(forces->CheckHasRightSizeForModel(plant()));
 
@@ -218,7 +263,7 @@ void DiscreteUpdateManager<T>::CalcNonContactForces(
   CalcForceElementsContribution(context, forces);
 
   // Incorporate all input forces.
-  InputPortForces<T> inputs(plant());
+  InputPortForces<T>& inputs = *input_port_forces;
   CalcInputPortForces(context, &inputs);
 
   // Copy into `forces` as requested.
@@ -698,32 +743,39 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForPointContact(
     const Vector3<T> v_AcBc_C = R_WC.transpose() * v_AcBc_W;
     const T vn0 = v_AcBc_C(2);
 
+    // The pair is filled in place, recycling the storage of a pair from a
+    // previous update when available.
+    DiscreteContactPair<T>& contact_pair = contact_pairs->AppendPointData();
+
     // We have at most two blocks per contact.
     std::vector<typename DiscreteContactPair<T>::JacobianTreeBlock>
-        jacobian_blocks;
+        jacobian_blocks = std::move(contact_pair.jacobian);
     jacobian_blocks.reserve(2);
+    int num_blocks = 0;
 
     // Tree A contribution to contact Jacobian Jv_W_AcBc_C.
     if (treeA_has_dofs) {
-      Matrix3X<T> J =
-          R_WC.matrix().transpose() *
+      SetContactJacobianTreeBlock<T>(
+          num_blocks++, treeA_index, R_WC,
           Jv_AcBc_W.middleCols(
               tree_topology().tree_velocities_start_in_v(treeA_index),
-              tree_topology().num_tree_velocities(treeA_index));
-      jacobian_blocks.emplace_back(treeA_index, MatrixBlock<T>(std::move(J)));
+              tree_topology().num_tree_velocities(treeA_index)),
+          &jacobian_blocks);
     }
 
     // Tree B contribution to contact Jacobian Jv_W_AcBc_C.
     // This contribution must be added only if B is different from A.
     if ((treeB_has_dofs && !treeA_has_dofs) ||
         (treeB_has_dofs && treeB_index != treeA_index)) {
-      Matrix3X<T> J =
-          R_WC.matrix().transpose() *
+      SetContactJacobianTreeBlock<T>(
+          num_blocks++, treeB_index, R_WC,
           Jv_AcBc_W.middleCols(
               tree_topology().tree_velocities_start_in_v(treeB_index),
-              tree_topology().num_tree_velocities(treeB_index));
-      jacobian_blocks.emplace_back(treeB_index, MatrixBlock<T>(std::move(J)));
+              tree_topology().num_tree_velocities(treeB_index)),
+          &jacobian_blocks);
     }
+    jacobian_blocks.erase(jacobian_blocks.begin() + num_blocks,
+                          jacobian_blocks.end());
 
     // Contact stiffness and damping
     const T k = GetCombinedPointContactStiffness(
@@ -756,27 +808,26 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForPointContact(
     const Vector3<T>& p_WB = X_WB.translation();
     const Vector3<T> p_BC_W = p_WC - p_WB;
 
-    DiscreteContactPair<T> contact_pair{.jacobian = std::move(jacobian_blocks),
-                                        .id_A = pair.id_A,
-                                        .object_A = body_A_index,
-                                        .id_B = pair.id_B,
-                                        .object_B = body_B_index,
-                                        .R_WC = R_WC,
-                                        .p_WC = p_WC,
-                                        .p_ApC_W = p_AC_W,
-                                        .p_BqC_W = p_BC_W,
-                                        .nhat_BA_W = pair.nhat_BA_W,
-                                        .phi0 = phi0,
-                                        .vn0 = vn0,
-                                        .fn0 = fn0,
-                                        .stiffness = k,
-                                        .damping = d,
-                                        .dissipation_time_scale = tau,
-                                        .friction_coefficient = mu,
-                                        .surface_index{} /* no surface index */,
-                                        .face_index = {} /* no face index */,
-                                        .point_pair_index = point_pair_index};
-    contact_pairs->AppendPointData(std::move(contact_pair));
+    contact_pair = {.jacobian = std::move(jacobian_blocks),
+                    .id_A = pair.id_A,
+                    .object_A = body_A_index,
+                    .id_B = pair.id_B,
+                    .object_B = body_B_index,
+                    .R_WC = R_WC,
+                    .p_WC = p_WC,
+                    .p_ApC_W = p_AC_W,
+                    .p_BqC_W = p_BC_W,
+                    .nhat_BA_W = pair.nhat_BA_W,
+                    .phi0 = phi0,
+                    .vn0 = vn0,
+                    .fn0 = fn0,
+                    .stiffness = k,
+                    .damping = d,
+                    .dissipation_time_scale = tau,
+                    .friction_coefficient = mu,
+                    .surface_index{} /* no surface index */,
+                    .face_index = {} /* no face index */,
+                    .point_pair_index = point_pair_index};
   }
 }
 
@@ -814,6 +865,11 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
   Matrix3X<T> Jv_WAc_W(3, nv);
   Matrix3X<T> Jv_WBc_W(3, nv);
   Matrix3X<T> Jv_AcBc_W(3, nv);
+  std::vector<HydroelasticQuadraturePoint<T>> quadrature_points;
+
+  // Zero when no reduction is requested.
+  const int max_quadrature_points =
+      plant().get_hydroelastic_max_quadrature_points_per_surface();
 
   const int num_surfaces = surfaces.size();
   for (int surface_index = 0; surface_index < num_surfaces; ++surface_index) {
@@ -860,6 +916,8 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
     const T mu =
         GetCombinedDynamicCoulombFriction(s.id_M(), s.id_N(), inspector);
 
+    // Quadrature points for this surface, one per face.
+    quadrature_points.clear();
     for (int face = 0; face < s.num_faces(); ++face) {
       const T& Ae = s.area(face);  // Face element area.
 
@@ -911,61 +969,6 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
         // is measured and expressed in W).
         const Vector3<T>& p_WC = s.centroid(face);
 
-        // Since v_AcBc_W = v_WBc - v_WAc the relative velocity Jacobian
-        // will be:
-        //   J_AcBc_W = Jv_WBc_W - Jv_WAc_W.
-        // That is the relative velocity at C is v_AcBc_W = J_AcBc_W * v.
-        internal_tree().CalcJacobianTranslationalVelocity(
-            context, JacobianWrtVariable::kV, body_A.body_frame(), frame_W,
-            p_WC, frame_W, frame_W, &Jv_WAc_W);
-        internal_tree().CalcJacobianTranslationalVelocity(
-            context, JacobianWrtVariable::kV, body_B.body_frame(), frame_W,
-            p_WC, frame_W, frame_W, &Jv_WBc_W);
-        Jv_AcBc_W = Jv_WBc_W - Jv_WAc_W;
-
-        // Define a contact frame C at the contact point such that the
-        // z-axis Cz equals nhat_AB_W. The tangent vectors are arbitrary,
-        // with the only requirement being that they form a valid right
-        // handed basis with nhat_AB_W.
-        const Vector3<T> nhat_AB_W = -nhat_BA_W;
-        math::RotationMatrix<T> R_WC =
-            math::RotationMatrix<T>::MakeFromOneVector(nhat_AB_W, 2);
-
-        // Contact velocity stored in the current context (previous time
-        // step).
-        const Vector3<T> v_AcBc_W = Jv_AcBc_W * v;
-        const Vector3<T> v_AcBc_C = R_WC.transpose() * v_AcBc_W;
-        const T vn0 = v_AcBc_C(2);
-
-        // We have at most two blocks per contact.
-        std::vector<typename DiscreteContactPair<T>::JacobianTreeBlock>
-            jacobian_blocks;
-        jacobian_blocks.reserve(2);
-
-        // Tree A contribution to contact Jacobian Jv_W_AcBc_C.
-        if (treeA_has_dofs) {
-          Matrix3X<T> J =
-              R_WC.matrix().transpose() *
-              Jv_AcBc_W.middleCols(
-                  tree_topology().tree_velocities_start_in_v(tree_A_index),
-                  tree_topology().num_tree_velocities(tree_A_index));
-          jacobian_blocks.emplace_back(tree_A_index,
-                                       MatrixBlock<T>(std::move(J)));
-        }
-
-        // Tree B contribution to contact Jacobian Jv_W_AcBc_C.
-        // This contribution must be added only if B is different from A.
-        if ((treeB_has_dofs && !treeA_has_dofs) ||
-            (treeB_has_dofs && tree_B_index != tree_A_index)) {
-          Matrix3X<T> J =
-              R_WC.matrix().transpose() *
-              Jv_AcBc_W.middleCols(
-                  tree_topology().tree_velocities_start_in_v(tree_B_index),
-                  tree_topology().num_tree_velocities(tree_B_index));
-          jacobian_blocks.emplace_back(tree_B_index,
-                                       MatrixBlock<T>(std::move(J)));
-        }
-
         // For a triangle, its centroid has the fixed barycentric
         // coordinates independent of the shape of the triangle. Using
         // barycentric coordinates to evaluate field value could be
@@ -992,39 +995,116 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
         // phi < 0 when in penetration.
         const T phi0 = -p0 / g;
 
-        // Contact point position relative to each body.
-        const RigidTransform<T>& X_WA =
-            plant().EvalBodyPoseInWorld(context, body_A);
-        const Vector3<T>& p_WA = X_WA.translation();
-        const Vector3<T> p_AC_W = p_WC - p_WA;
-        const RigidTransform<T>& X_WB =
-            plant().EvalBodyPoseInWorld(context, body_B);
-        const Vector3<T>& p_WB = X_WB.translation();
-        const Vector3<T> p_BC_W = p_WC - p_WB;
-
-        DiscreteContactPair<T> contact_pair{
-            .jacobian = std::move(jacobian_blocks),
-            .id_A = s.id_M(),
-            .object_A = body_A_index,
-            .id_B = s.id_N(),
-            .object_B = body_B_index,
-            .R_WC = R_WC,
-            .p_WC = p_WC,
-            .p_ApC_W = p_AC_W,
-            .p_BqC_W = p_BC_W,
-            .nhat_BA_W = nhat_BA_W,
-            .phi0 = phi0,
-            .vn0 = vn0,
-            .fn0 = fn0,
-            .stiffness = k,
-            .damping = d,
-            .dissipation_time_scale = tau,
-            .friction_coefficient = mu,
-            .surface_index = surface_index,
-            .face_index = face,
-            .point_pair_index = {} /* no point pair index */};
-        contact_pairs->AppendHydroData(std::move(contact_pair));
+        quadrature_points.push_back({.p_WQ = p_WC,
+                                     .nhat_BA_W = nhat_BA_W,
+                                     .fn0 = fn0,
+                                     .stiffness = k,
+                                     .phi0 = phi0,
+                                     .face_index = face});
+      }
+    }
+
+    // Optionally, bound the number of discrete pairs per surface.
+    if (max_quadrature_points > 0) {
+      quadrature_points = ReduceHydroelasticQuadrature(quadrature_points,
+                                                       max_quadrature_points);
+    }
+
+    for (const HydroelasticQuadraturePoint<T>& point : quadrature_points) {
+      const Vector3<T>& p_WC = point.p_WQ;
+      const Vector3<T>& nhat_BA_W = point.nhat_BA_W;
+
+      // Since v_AcBc_W = v_WBc - v_WAc the relative velocity Jacobian
+      // will be:
+      //   J_AcBc_W = Jv_WBc_W - Jv_WAc_W.
+      // That is the relative velocity at C is v_AcBc_W = J_AcBc_W * v.
+      internal_tree().CalcJacobianTranslationalVelocity(
+          context, JacobianWrtVariable::kV, body_A.body_frame(), frame_W, p_WC,
+          frame_W, frame_W, &Jv_WAc_W);
+      internal_tree().CalcJacobianTranslationalVelocity(
+          context, JacobianWrtVariable::kV, body_B.body_frame(), frame_W, p_WC,
+          frame_W, frame_W, &Jv_WBc_W);
+      Jv_AcBc_W = Jv_WBc_W - Jv_WAc_W;
+
+      // Define a contact frame C at the contact point such that the
+      // z-axis Cz equals nhat_AB_W. The tangent vectors are arbitrary,
+      // with the only requirement being that they form a valid right
+      // handed basis with nhat_AB_W.
+      const Vector3<T> nhat_AB_W = -nhat_BA_W;
+      math::RotationMatrix<T> R_WC =
+          math::RotationMatrix<T>::MakeFromOneVector(nhat_AB_W, 2);
+
+      // Contact velocity stored in the current context (previous time
+      // step).
+      const Vector3<T> v_AcBc_W = Jv_AcBc_W * v;
+      const Vector3<T> v_AcBc_C = R_WC.transpose() * v_AcBc_W;
+      const T vn0 = v_AcBc_C(2);
+
+      // The pair is filled in place, recycling the storage of a pair from a
+      // previous update when available.
+      DiscreteContactPair<T>& contact_pair = contact_pairs->AppendHydroData();
+
+      // We have at most two blocks per contact.
+      std::vector<typename DiscreteContactPair<T>::JacobianTreeBlock>
+          jacobian_blocks = std::move(contact_pair.jacobian);
+      jacobian_blocks.reserve(2);
+      int num_blocks = 0;
+
+      // Tree A contribution to contact Jacobian Jv_W_AcBc_C.
+      if (treeA_has_dofs) {
+        SetContactJacobianTreeBlock<T>(
+            num_blocks++, tree_A_index, R_WC,
+            Jv_AcBc_W.middleCols(
+                tree_topology().tree_velocities_start_in_v(tree_A_index),
+                tree_topology().num_tree_velocities(tree_A_index)),
+            &jacobian_blocks);
+      }
+
+      // Tree B contribution to contact Jacobian Jv_W_AcBc_C.
+      // This contribution must be added only if B is different from A.
+      if ((treeB_has_dofs && !treeA_has_dofs) ||
+          (treeB_has_dofs && tree_B_index != tree_A_index)) {
+        SetContactJacobianTreeBlock<T>(
+            num_blocks++, tree_B_index, R_WC,
+            Jv_AcBc_W.middleCols(
+                tree_topology().tree_velocities_start_in_v(tree_B_index),
+                tree_topology().num_tree_velocities(tree_B_index)),
+            &jacobian_blocks);
       }
+      jacobian_blocks.erase(jacobian_blocks.begin() + num_blocks,
+                          jacobian_blocks.end());
+
+      // Contact point position relative to each body.
+      const RigidTransform<T>& X_WA =
+          plant().EvalBodyPoseInWorld(context, body_A);
+      const Vector3<T>& p_WA = X_WA.translation();
+      const Vector3<T> p_AC_W = p_WC - p_WA;
+      const RigidTransform<T>& X_WB =
+          plant().EvalBodyPoseInWorld(context, body_B);
+      const Vector3<T>& p_WB = X_WB.translation();
+      const Vector3<T> p_BC_W = p_WC - p_WB;
+
+      contact_pair = {
+          .jacobian = std::move(jacobian_blocks),
+          .id_A = s.id_M(),
+          .object_A = body_A_index,
+          .id_B = s.id_N(),
+          .object_B = body_B_index,
+          .R_WC = R_WC,
+          .p_WC = p_WC,
+          .p_ApC_W = p_AC_W,
+          .p_BqC_W = p_BC_W,
+          .nhat_BA_W = nhat_BA_W,
+          .phi0 = point.phi0,
+          .vn0 = vn0,
+          .fn0 = point.fn0,
+          .stiffness = point.stiffness,
+          .damping = d,
+          .dissipation_time_scale = tau,
+          .friction_coefficient = mu,
+          .surface_index = surface_index,
+          .face_index = point.face_index,
+          .point_pair_index = {} /* no point pair index */};
     }
   }
 }
@@ -1068,16 +1148,17 @@ void DiscreteUpdateManager<T>::DoCalcDiscreteValues(
   const auto q0 = x0.topRows(nq);
 
   // Retrieve the rigid velocity for the next time step.
-  const VectorX<T>& v_next = results.v_next.head(plant().num_velocities());
+  const auto v_next = results.v_next.head(plant().num_velocities());
 
-  // Update generalized positions.
-  VectorX<T> qdot_next(plant().num_positions());
-  plant().MapVelocityToQDot(context, v_next, &qdot_next);
-  const VectorX<T> q_next = q0 + plant().time_step() * qdot_next;
+  // The next state is written in place, to avoid heap allocations.
+  Eigen::VectorBlock<VectorX<T>> x_next =
+      updates->get_mutable_value(multibody_state_index());
+  auto q_next = x_next.head(nq);
+  x_next.tail(plant().num_velocities()) = v_next;
 
-  VectorX<T> x_next(plant().num_multibody_states());
-  x_next << q_next, v_next;
-  updates->set_value(multibody_state_index(), x_next);
+  // Update generalized positions. We first store q̇ in q_next.
+  plant().MapVelocityToQDot(context, v_next, &q_next);
+  q_next = q0 + plant().time_step() * q_next;
 }
 
 template <typename T>
@@ -187,6 +187,16 @@ class DiscreteUpdateManager : public ScalarConvertibleComponent<T> {
                             bool include_pd_controlled_input,
                             MultibodyForces<T>* forces) const;
 
+  /* Overload of CalcNonContactForces() that uses `input_port_forces` as
+   scratch storage for the input port forces, so that callers can reuse it
+   across calls to avoid heap allocations.
+   @pre input_port_forces was constructed for plant(). */
+  void CalcNonContactForces(const drake::systems::Context<T>& context,
+                            bool include_joint_limit_penalty_forces,
+                            bool include_pd_controlled_input,
+                            InputPortForces<T>* input_port_forces,
+                            MultibodyForces<T>* forces) const;
+
   // TODO(amcastro-tri): Consider replacing with more specific APIs with the
   // resolution of #16955. E.g., APIs to obtain generalized forces due to
   // constraints, rather than raw solver results.
@@ -0,0 +1,125 @@
+#include "drake/multibody/plant/hydroelastic_quadrature_reduction.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+#include "drake/common/extract_double.h"
+#include "drake/common/ssize.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+/* Lumps the points with indices order[begin], ..., order[end - 1] into a single
+ point. See ReduceHydroelasticQuadrature(). */
+template <typename T>
+HydroelasticQuadraturePoint<T> LumpQuadraturePoints(
+    const std::vector<HydroelasticQuadraturePoint<T>>& points,
+    const std::vector<int>& order, int begin, int end) {
+  T stiffness = 0.0;
+  T fn0_sum = 0.0;
+  Vector3<T> f_W = Vector3<T>::Zero();
+  // Force and stiffness weighted sums of the positions of the points.
+  Vector3<T> fp_W = Vector3<T>::Zero();
+  Vector3<T> kp_W = Vector3<T>::Zero();
+  Vector3<T> kn_W = Vector3<T>::Zero();
+  int face_index = points[order[begin]].face_index;
+  double max_fn0 = -std::numeric_limits<double>::infinity();
+  for (int i = begin; i < end; ++i) {
+    const HydroelasticQuadraturePoint<T>& point = points[order[i]];
+    stiffness += point.stiffness;
+    fn0_sum += point.fn0;
+    f_W += point.fn0 * point.nhat_BA_W;
+    fp_W += point.fn0 * point.p_WQ;
+    kp_W += point.stiffness * point.p_WQ;
+    kn_W += point.stiffness * point.nhat_BA_W;
+    if (ExtractDoubleOrThrow(point.fn0) > max_fn0) {
+      max_fn0 = ExtractDoubleOrThrow(point.fn0);
+      face_index = point.face_index;
+    }
+  }
+
+  HydroelasticQuadraturePoint<T> lumped;
+  lumped.stiffness = stiffness;
+  lumped.face_index = face_index;
+  const T f_norm = f_W.norm();
+  if (fn0_sum > 0.0 && f_norm > 0.0) {
+    lumped.p_WQ = fp_W / fn0_sum;
+    lumped.nhat_BA_W = f_W / f_norm;
+    lumped.fn0 = f_norm;
+  } else {
+    lumped.p_WQ = kp_W / stiffness;
+    lumped.nhat_BA_W = kn_W.normalized();
+    lumped.fn0 = 0.0;
+  }
+  lumped.phi0 = -lumped.fn0 / stiffness;
+  return lumped;
+}
+
+}  // namespace
+
+template <typename T>
+std::vector<HydroelasticQuadraturePoint<T>> ReduceHydroelasticQuadrature(
+    const std::vector<HydroelasticQuadraturePoint<T>>& points,
+    int max_num_points) {
+  DRAKE_DEMAND(max_num_points > 0);
+  const int num_points = ssize(points);
+  if (num_points <= max_num_points) return points;
+
+  // Clusters are contiguous ranges [begin, end) of `order`.
+  std::vector<int> order(num_points);
+  std::iota(order.begin(), order.end(), 0);
+  std::vector<std::pair<int, int>> clusters{{0, num_points}};
+  clusters.reserve(max_num_points);
+  while (ssize(clusters) < max_num_points) {
+    auto largest = std::max_element(
+        clusters.begin(), clusters.end(), [](const auto& a, const auto& b) {
+          return a.second - a.first < b.second - b.first;
+        });
+    const auto [begin, end] = *largest;
+    // Since num_points > max_num_points, the largest cluster always has more
+    // than one point.
+    DRAKE_ASSERT(end - begin > 1);
+
+    // Split along the direction of largest extent of the cluster.
+    Vector3<double> lower =
+        Vector3<double>::Constant(std::numeric_limits<double>::infinity());
+    Vector3<double> upper = -lower;
+    for (int i = begin; i < end; ++i) {
+      const Vector3<double> p_WQ =
+          ExtractDoubleOrThrow(points[order[i]].p_WQ);
+      lower = lower.cwiseMin(p_WQ);
+      upper = upper.cwiseMax(p_WQ);
+    }
+    int axis{};
+    (upper - lower).maxCoeff(&axis);
+    const int mid = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + mid,
+                     order.begin() + end, [&points, axis](int a, int b) {
+                       return ExtractDoubleOrThrow(points[a].p_WQ(axis)) <
+                              ExtractDoubleOrThrow(points[b].p_WQ(axis));
+                     });
+    *largest = {begin, mid};
+    clusters.emplace_back(mid, end);
+  }
+
+  // Report the clusters in the order of their ranges so that the result does
+  // not depend on the order in which they were split.
+  std::sort(clusters.begin(), clusters.end());
+  std::vector<HydroelasticQuadraturePoint<T>> reduced;
+  reduced.reserve(clusters.size());
+  for (const auto& [begin, end] : clusters) {
+    reduced.push_back(LumpQuadraturePoints(points, order, begin, end));
+  }
+  return reduced;
+}
+
+DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    (&ReduceHydroelasticQuadrature<T>));
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+/* A quadrature point used by the discrete approximation of a hydroelastic
+ contact surface, along with the contact quantities lumped at it. With the
+ first order quadrature used for discrete hydroelastics, there is one such
+ point per face of the contact surface, located at the face centroid. */
+template <typename T>
+struct HydroelasticQuadraturePoint {
+  /* Position of the quadrature point Q, measured and expressed in the world
+   frame W. */
+  Vector3<T> p_WQ;
+  /* Unit normal at Q, pointing out of geometry N and into geometry M of the
+   contact surface, expressed in the world frame W. */
+  Vector3<T> nhat_BA_W;
+  /* The (undamped) normal force at the current configuration, i.e. the
+   integral of the pressure over the area lumped at Q. */
+  T fn0{0.0};
+  /* The normal stiffness at Q, i.e. the integral of the effective pressure
+   gradient over the area lumped at Q. */
+  T stiffness{0.0};
+  /* The signed distance at Q, negative in penetration, such that
+   fn0 = -stiffness⋅phi0. */
+  T phi0{0.0};
+  /* Index of the face of the contact surface that contributes the most to the
+   force at Q. */
+  int face_index{};
+};
+
+/* Reduces the quadrature points of a single contact surface to at most
+ `max_num_points` representative points.
+
+ The points are partitioned into spatially coherent clusters by recursive
+ bisection: the cluster with the most points is split at the median of its
+ points along the direction of its largest extent, until there are
+ `max_num_points` clusters. Each cluster is then lumped into a single point
+ such that:
+
+   - the stiffness is the sum of the stiffnesses in the cluster,
+   - the force vector fn0⋅n̂ is the sum of the force vectors in the cluster,
+     and phi0 is such that fn0 = -stiffness⋅phi0,
+   - the point is the center of pressure of the cluster, so that the moment
+     of the forces in the cluster is also preserved if their normals are
+     parallel, as is the case for a planar patch.
+
+ Therefore, at the current configuration, the total contact force on each body
+ is preserved, and so is the total moment for planar contact patches. If the
+ force in a cluster is zero, its point and normal are the stiffness-weighted
+ averages instead.
+
+ If there are no more than `max_num_points` points, they are returned
+ unchanged.
+
+ @pre max_num_points > 0.
+ @pre The stiffness of each point is positive and its force non-negative.
+ @tparam_nonsymbolic_scalar */
+template <typename T>
+std::vector<HydroelasticQuadraturePoint<T>> ReduceHydroelasticQuadrature(
+    const std::vector<HydroelasticQuadraturePoint<T>>& points,
+    int max_num_points);
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -17,6 +17,7 @@
 #include "drake/geometry/proximity_properties.h"
 #include "drake/geometry/query_results/contact_surface.h"
 #include "drake/geometry/render/render_label.h"
+#include "drake/math/linear_solve.h"
 #include "drake/math/random_rotation.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/hydroelastics/hydroelastic_engine.h"
@@ -389,6 +390,13 @@ MultibodyPlant<T>::MultibodyPlant(const MultibodyPlant<U>& other)
     contact_model_ = other.contact_model_;
     discrete_contact_approximation_ = other.discrete_contact_approximation_;
     sap_near_rigid_threshold_ = other.sap_near_rigid_threshold_;
+    hydroelastic_max_quadrature_points_per_surface_ =
+        other.hydroelastic_max_quadrature_points_per_surface_;
+    sap_island_parallelism_ = other.sap_island_parallelism_;
+    sap_linear_solver_parallelism_ = other.sap_linear_solver_parallelism_;
+    forward_dynamics_algorithm_ = other.forward_dynamics_algorithm_;
+    this->set_forward_dynamics_via_mass_matrix(
+        forward_dynamics_algorithm_ == ForwardDynamicsAlgorithm::kMassMatrix);
     contact_surface_representation_ = other.contact_surface_representation_;
     // geometry_query_port_ is set during DeclareSceneGraphPorts() below.
     // geometry_pose_port_ is set during DeclareSceneGraphPorts() below.
@@ -792,6 +800,56 @@ double MultibodyPlant<T>::get_sap_near_rigid_threshold() const {
   return sap_near_rigid_threshold_;
 }
 
+template <typename T>
+void MultibodyPlant<T>::set_hydroelastic_max_quadrature_points_per_surface(
+    int max_num_points) {
+  DRAKE_MBP_THROW_IF_FINALIZED();
+  DRAKE_THROW_UNLESS(max_num_points >= 0);
+  hydroelastic_max_quadrature_points_per_surface_ = max_num_points;
+}
+
+template <typename T>
+int MultibodyPlant<T>::get_hydroelastic_max_quadrature_points_per_surface()
+    const {
+  return hydroelastic_max_quadrature_points_per_surface_;
+}
+
+template <typename T>
+void MultibodyPlant<T>::set_sap_island_parallelism(Parallelism parallelism) {
+  sap_island_parallelism_ = parallelism;
+}
+
+template <typename T>
+Parallelism MultibodyPlant<T>::get_sap_island_parallelism() const {
+  return sap_island_parallelism_;
+}
+
+template <typename T>
+void MultibodyPlant<T>::set_sap_linear_solver_parallelism(
+    Parallelism parallelism) {
+  sap_linear_solver_parallelism_ = parallelism;
+}
+
+template <typename T>
+Parallelism MultibodyPlant<T>::get_sap_linear_solver_parallelism() const {
+  return sap_linear_solver_parallelism_;
+}
+
+template <typename T>
+void MultibodyPlant<T>::set_forward_dynamics_algorithm(
+    ForwardDynamicsAlgorithm algorithm) {
+  DRAKE_MBP_THROW_IF_FINALIZED();
+  forward_dynamics_algorithm_ = algorithm;
+  this->set_forward_dynamics_via_mass_matrix(
+      algorithm == ForwardDynamicsAlgorithm::kMassMatrix);
+}
+
+template <typename T>
+ForwardDynamicsAlgorithm MultibodyPlant<T>::get_forward_dynamics_algorithm()
+    const {
+  return forward_dynamics_algorithm_;
+}
+
 template <typename T>
 ContactModel MultibodyPlant<T>::get_contact_model() const {
   return contact_model_;
@@ -1195,6 +1253,57 @@ void MultibodyPlant<T>::CalcSpatialAccelerationsFromVdot(
   }
 }
 
+template <typename T>
+void MultibodyPlant<T>::CalcInverseDynamicsDerivatives(
+    const systems::Context<T>& context, const VectorX<T>& known_vdot,
+    const MultibodyForces<T>& external_forces, EigenPtr<MatrixX<T>> dtau_dq,
+    EigenPtr<MatrixX<T>> dtau_dv) const {
+  this->ValidateContext(context);
+  DRAKE_THROW_UNLESS(known_vdot.size() == num_velocities());
+  DRAKE_THROW_UNLESS(external_forces.CheckHasRightSizeForModel(*this));
+  DRAKE_THROW_UNLESS(dtau_dq != nullptr);
+  DRAKE_THROW_UNLESS(dtau_dq->rows() == num_velocities() &&
+                     dtau_dq->cols() == num_positions());
+  DRAKE_THROW_UNLESS(dtau_dv != nullptr);
+  DRAKE_THROW_UNLESS(dtau_dv->rows() == num_velocities() &&
+                     dtau_dv->cols() == num_velocities());
+  // The tree computes derivatives along the tangent directions δ, for which
+  // q̇ = N(q)⋅δ̇. Therefore ∂tau/∂q = ∂tau/∂δ⋅N⁺(q).
+  MatrixX<T> dtau_dqt(num_velocities(), num_velocities());
+  internal_tree().CalcInverseDynamicsDerivatives(
+      context, known_vdot, external_forces, &dtau_dqt, dtau_dv);
+  *dtau_dq = dtau_dqt * MakeQDotToVelocityMap(context);
+}
+
+template <typename T>
+void MultibodyPlant<T>::CalcForwardDynamicsDerivatives(
+    const systems::Context<T>& context,
+    const MultibodyForces<T>& applied_forces, EigenPtr<VectorX<T>> vdot,
+    EigenPtr<MatrixX<T>> dvdot_dq, EigenPtr<MatrixX<T>> dvdot_dv,
+    EigenPtr<MatrixX<T>> dvdot_dtau) const {
+  this->ValidateContext(context);
+  const int nv = num_velocities();
+  DRAKE_THROW_UNLESS(vdot != nullptr && vdot->size() == nv);
+  DRAKE_THROW_UNLESS(dvdot_dtau != nullptr);
+  DRAKE_THROW_UNLESS(dvdot_dtau->rows() == nv && dvdot_dtau->cols() == nv);
+
+  MatrixX<T> M(nv, nv);
+  internal_tree().CalcMassMatrix(context, &M);
+  const math::LinearSolver<Eigen::LDLT, MatrixX<T>> M_ldlt(M);
+  // With v̇ = 0, inverse dynamics computes C(q, v)⋅v − τ_app.
+  *vdot = M_ldlt.Solve(
+      -internal_tree().CalcInverseDynamics(context, VectorX<T>::Zero(nv),
+                                           applied_forces));
+
+  // Differentiating M(q)⋅v̇ + C(q, v)⋅v − τ_app = τ, with v̇ = v̇(q, v, τ),
+  // gives ∂tau_id/∂x + M⋅∂v̇/∂x = 0 for x = q, v.
+  CalcInverseDynamicsDerivatives(context, *vdot, applied_forces, dvdot_dq,
+                                 dvdot_dv);
+  *dvdot_dq = -M_ldlt.Solve(*dvdot_dq);
+  *dvdot_dv = -M_ldlt.Solve(*dvdot_dv);
+  *dvdot_dtau = M_ldlt.Solve(MatrixX<T>::Identity(nv, nv));
+}
+
 template <typename T>
 void MultibodyPlant<T>::CalcForceElementsContribution(
     const systems::Context<T>& context, MultibodyForces<T>* forces) const {
@@ -3069,6 +3178,41 @@ systems::EventStatus MultibodyPlant<T>::CalcStepDiscrete(
   return systems::EventStatus::Succeeded();
 }
 
+template <typename T>
+void MultibodyPlant<T>::AdvanceDiscreteSteps(systems::Context<T>* context,
+                                             int num_steps) const {
+  DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  DRAKE_THROW_UNLESS(context != nullptr);
+  this->ValidateContext(*context);
+  DRAKE_THROW_UNLESS(is_discrete());
+  DRAKE_THROW_UNLESS(num_steps >= 0);
+  if (num_steps == 0) return;
+
+  // Only the root context can change time. Time is computed from the
+  // initial time rather than accumulated, to avoid drift over long rollouts.
+  const bool advance_time = context->is_root_context();
+  const T t0 = context->get_time();
+  auto advance_time_to_step = [&](int step) {
+    if (advance_time) context->SetTime(t0 + step * time_step_);
+  };
+  if (use_sampled_output_ports_) {
+    std::unique_ptr<systems::State<T>> next_state = context->CloneState();
+    for (int step = 1; step <= num_steps; ++step) {
+      CalcStepUnrestricted(*context, next_state.get());
+      context->get_mutable_state().SetFrom(*next_state);
+      advance_time_to_step(step);
+    }
+  } else {
+    std::unique_ptr<systems::DiscreteValues<T>> next_discrete_state =
+        this->AllocateDiscreteVariables();
+    for (int step = 1; step <= num_steps; ++step) {
+      CalcStepDiscrete(*context, next_discrete_state.get());
+      context->get_mutable_discrete_state().SetFrom(*next_discrete_state);
+      advance_time_to_step(step);
+    }
+  }
+}
+
 template <typename T>
 systems::EventStatus MultibodyPlant<T>::CalcStepUnrestricted(
     const systems::Context<T>& context0, systems::State<T>* next_state) const {
@@ -17,6 +17,7 @@
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_deprecated.h"
 #include "drake/common/drake_export.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/random.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/math/rigid_transform.h"
@@ -27,8 +28,10 @@
 #include "drake/multibody/plant/dummy_physical_model.h"
 #include "drake/multibody/plant/multibody_plant_config.h"
 #include "drake/multibody/plant/physical_model_collection.h"
+#include "drake/multibody/tree/body_poses_batch.h"
 #include "drake/multibody/tree/force_element.h"
 #include "drake/multibody/tree/frame.h"
+#include "drake/multibody/tree/incremental_kinematics_statistics.h"
 #include "drake/multibody/tree/joint.h"
 #include "drake/multibody/tree/joint_actuator.h"
 #include "drake/multibody/tree/multibody_forces.h"
@@ -227,6 +230,19 @@ enum class DiscreteContactApproximation {
   kLagged,
 };
 
+/// The algorithm used by a continuous %MultibodyPlant to compute forward
+/// dynamics, i.e. the generalized accelerations v̇ given the state and the
+/// applied forces. See MultibodyPlant::set_forward_dynamics_algorithm().
+enum class ForwardDynamicsAlgorithm {
+  /// The O(n) Articulated Body Algorithm (ABA), where n is the number of
+  /// bodies. The mass matrix is never formed.
+  kArticulatedBody,
+  /// The mass matrix M is formed with the O(n²) Composite Rigid Body Algorithm
+  /// and factored with a dense O(n³) LDLT factorization to solve for v̇. For
+  /// models with few degrees of freedom this can outperform ABA.
+  kMassMatrix,
+};
+
 /// @cond
 // Helper macro to throw an exception within methods that should not be called
 // post-finalize.
@@ -2314,6 +2330,133 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   /// @see See set_sap_near_rigid_threshold().
   double get_sap_near_rigid_threshold() const;
 
+  /// Sets the maximum number of quadrature points used to approximate each
+  /// hydroelastic contact surface in discrete models. By default, zero, each
+  /// face of a contact surface is approximated with one quadrature point at
+  /// its centroid, and therefore the number of discrete contact constraints
+  /// grows with the resolution of the hydroelastic meshes. With a positive
+  /// value, the faces of each contact surface with more faces than that are
+  /// partitioned into spatially coherent clusters, and each cluster is lumped
+  /// into a single quadrature point located at its center of pressure. The
+  /// lumped points preserve the total stiffness and the total contact force
+  /// at the start of the step, as well as the total moment for planar contact
+  /// patches. Fewer points reduce the cost of the discrete contact solver at
+  /// the expense of resolving the torsional and rolling resistance of the
+  /// patch less accurately. Contact results still report the full contact
+  /// surfaces. This setting has no effect on continuous models.
+  /// @throws std::exception if max_num_points is negative.
+  /// @throws std::exception if called post-finalize.
+  void set_hydroelastic_max_quadrature_points_per_surface(int max_num_points);
+
+  /// @returns the maximum number of quadrature points per hydroelastic
+  /// contact surface, or zero if the number is unbounded.
+  /// @see set_hydroelastic_max_quadrature_points_per_surface().
+  int get_hydroelastic_max_quadrature_points_per_surface() const;
+
+  /// Sets the degree of parallelism used by the SAP solver to solve
+  /// independent "islands" concurrently. An island is a set of trees coupled
+  /// through contact or other constraints; for instance, objects resting
+  /// separately in different bins form different islands. When more than one
+  /// thread is allowed, the SAP problem at each discrete step is partitioned
+  /// into its islands, which are then solved concurrently and with their own
+  /// convergence checks. The cost of a step then scales with the size of the
+  /// largest island rather than with the size of the whole scene. With
+  /// Parallelism::None(), the default, a single problem is solved. Since each
+  /// island must satisfy SAP's convergence criteria on its own, results agree
+  /// with those of the single problem to within the solver tolerances. Only
+  /// %MultibodyPlant<double> solves islands in parallel; for other scalar
+  /// types islands are solved in sequence. This setting only has an effect
+  /// when the discrete contact approximation uses SAP, see
+  /// set_discrete_contact_approximation(), and can be changed at any time,
+  /// pre- or post-finalize.
+  void set_sap_island_parallelism(Parallelism parallelism);
+
+  /// @returns the parallelism set with set_sap_island_parallelism().
+  Parallelism get_sap_island_parallelism() const;
+
+  /// Sets the degree of parallelism used by the SAP solver to factorize its
+  /// Hessian and to solve linear systems with it, once per Newton iteration.
+  /// With more than one thread, the sparse Cholesky factorization and the
+  /// triangular solves process independent branches of the elimination tree
+  /// concurrently. This benefits large scenes where the Hessian does not
+  /// split into islands, such as piles of objects in contact. The
+  /// factorization is numerically identical to the serial one and therefore
+  /// results do not depend on this setting. With Parallelism::None(), the
+  /// default, the factorization is serial. When islands are solved
+  /// concurrently (see set_sap_island_parallelism()), each island is still
+  /// factorized serially, so that threads are not nested. Only
+  /// %MultibodyPlant<double> factorizes in parallel. This setting only has
+  /// an effect when the discrete contact approximation uses SAP, see
+  /// set_discrete_contact_approximation(), and can be changed at any time,
+  /// pre- or post-finalize.
+  void set_sap_linear_solver_parallelism(Parallelism parallelism);
+
+  /// @returns the parallelism set with set_sap_linear_solver_parallelism().
+  Parallelism get_sap_linear_solver_parallelism() const;
+
+  /// Sets the degree of parallelism used to evaluate the recursive multibody
+  /// algorithms that sweep the tree level by level: position and velocity
+  /// kinematics, articulated body inertias and inverse dynamics. Bodies at
+  /// the same level of the forest (for instance, the hundreds of free bodies
+  /// in a bin picking scene, all at level one) are processed concurrently.
+  /// The computed results do not depend on this setting. Only
+  /// %MultibodyPlant<double> is evaluated in parallel; for other scalar types
+  /// this setting has no effect. It defaults to Parallelism::None() and can
+  /// be changed at any time, pre- or post-finalize.
+  void set_tree_parallelism(Parallelism parallelism) {
+    this->mutable_tree().set_parallelism(parallelism);
+  }
+
+  /// @returns the parallelism set with set_tree_parallelism().
+  Parallelism get_tree_parallelism() const {
+    return internal_tree().parallelism();
+  }
+
+  /// Enables or disables incremental position kinematics. When enabled, each
+  /// evaluation of position kinematics compares the generalized positions
+  /// against those of the previous evaluation and only recomputes the bodies
+  /// whose mobilizer positions, or those of a mobilizer inboard to them,
+  /// changed. This pays off in workflows that repeatedly evaluate
+  /// configurations that differ in a few joints, such as finite differencing
+  /// or sampling-based planning. Any change in the numeric parameters
+  /// triggers a full update. The computed results do not depend on this
+  /// setting. Only %MultibodyPlant<double> supports incremental kinematics;
+  /// for other scalar types this setting has no effect. It defaults to
+  /// `false` and can be changed at any time, pre- or post-finalize.
+  /// @see GetIncrementalKinematicsStatistics().
+  void set_incremental_kinematics(bool incremental) {
+    this->mutable_tree().set_incremental_kinematics(incremental);
+  }
+
+  /// @returns the value set with set_incremental_kinematics().
+  bool get_incremental_kinematics() const {
+    return internal_tree().incremental_kinematics();
+  }
+
+  /// Evaluates position kinematics and returns the statistics accumulated by
+  /// the incremental kinematics updates performed for `context`, see
+  /// set_incremental_kinematics(). Evaluations performed while incremental
+  /// kinematics is disabled are not counted.
+  /// @throws std::exception if called pre-finalize.
+  const IncrementalKinematicsStatistics& GetIncrementalKinematicsStatistics(
+      const systems::Context<T>& context) const {
+    DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+    this->ValidateContext(context);
+    return EvalPositionKinematics(context).incremental_data().statistics;
+  }
+
+  /// Sets the algorithm used to compute forward dynamics for continuous
+  /// models, see ForwardDynamicsAlgorithm. Both algorithms compute the same
+  /// accelerations, up to round-off errors, and differ only in cost.
+  /// @note This setting is ignored for discrete models (when is_discrete() is
+  /// true), which compute accelerations as part of the discrete update.
+  /// @throws std::exception iff called post-finalize.
+  void set_forward_dynamics_algorithm(ForwardDynamicsAlgorithm algorithm);
+
+  /// @returns the forward dynamics algorithm for continuous models.
+  /// @see set_forward_dynamics_algorithm().
+  ForwardDynamicsAlgorithm get_forward_dynamics_algorithm() const;
+
   /// Return the default value for contact representation, given the desired
   /// time step. Discrete systems default to use polygons; continuous systems
   /// default to use triangles.
@@ -3296,6 +3439,38 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     return internal_tree().EvalBodyPoseInWorld(context, body_B);
   }
 
+  /// Computes the poses `X_WB` of all bodies in the world frame W for a batch
+  /// of N configurations, given as the columns of the `nq x N` matrix `q`.
+  /// The kinematics recursion is performed once for the whole batch, visiting
+  /// each mobilizer only once and computing its across-mobilizer transforms
+  /// for all N configurations in lockstep. Results are stored in
+  /// structure-of-arrays form, see BodyPosesBatch.
+  ///
+  /// This is considerably cheaper than setting each configuration in
+  /// `context` and evaluating poses one configuration at a time, since no
+  /// cache entry is invalidated or re-evaluated. The generalized positions
+  /// stored in `context` are ignored; `context` is only used to read
+  /// parameters such as the poses of fixed offset frames.
+  ///
+  /// @param[in] context
+  ///   The context storing the parameters of the model.
+  /// @param[in] q
+  ///   The `nq x N` matrix of generalized positions, where `nq` is
+  ///   num_positions(). Column k is the k-th configuration.
+  /// @param[out] X_WB_batch
+  ///   On output, `X_WB_batch->GetPose(body.index(), k)` is the pose of body
+  ///   B in the world frame for the k-th configuration. It is resized as
+  ///   needed to store num_bodies() poses for N configurations.
+  /// @throws std::exception if Finalize() was not called on `this` model, if
+  ///   `X_WB_batch` is nullptr, or if `q` does not have num_positions() rows.
+  void CalcBodyPosesInWorldBatch(const systems::Context<T>& context,
+                                 const Eigen::Ref<const MatrixX<T>>& q,
+                                 BodyPosesBatch<T>* X_WB_batch) const {
+    DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+    this->ValidateContext(context);
+    internal_tree().CalcBodyPosesInWorldBatch(context, q, X_WB_batch);
+  }
+
   /// Evaluates V_WB, body B's spatial velocity in the world frame W.
   /// @param[in] context The context storing the state of the model.
   /// @param[in] body_B  The body B for which the spatial velocity is requested.
@@ -3712,6 +3887,113 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
                                                external_forces);
   }
 
+  /// Computes the partial derivatives of the generalized forces `tau`
+  /// returned by CalcInverseDynamics() with respect to the generalized
+  /// positions q and velocities v, with `known_vdot` and `external_forces`
+  /// held fixed. The partial derivative with respect to `known_vdot` is the
+  /// mass matrix, see CalcMassMatrix().
+  ///
+  /// Derivatives are computed analytically by differentiating the recursive
+  /// Newton-Euler algorithm, at O(n⋅nv) cost with n the number of bodies.
+  /// This is considerably faster than propagating derivatives with
+  /// AutoDiffXd through CalcInverseDynamics(), and yields the same values to
+  /// within roundoff.
+  ///
+  /// Body spatial forces in `external_forces` are held fixed in the world
+  /// frame and applied at each body's origin Bo. Therefore, gravity and any
+  /// other configuration dependent forces only contribute to the derivatives
+  /// through the motion of their point of application. To differentiate
+  /// through them, the caller needs to add their derivatives separately.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[in] known_vdot
+  ///   A vector with the known generalized accelerations `vdot` for the full
+  ///   model.
+  /// @param[in] external_forces
+  ///   A set of forces applied to the system, see CalcInverseDynamics().
+  /// @param[out] dtau_dq
+  ///   On output, the `nv x nq` matrix `∂tau/∂q`. For models with quaternion
+  ///   coordinates, only its product `∂tau/∂q⋅N(q)` with the matrix N(q) from
+  ///   MakeVelocityToQDotMap() is meaningful, i.e. derivatives along
+  ///   directions that preserve the unit norm of the quaternions.
+  /// @param[out] dtau_dv
+  ///   On output, the `nv x nv` matrix `∂tau/∂v`.
+  ///
+  /// @pre dtau_dq and dtau_dv are non-null and have the right sizes.
+  void CalcInverseDynamicsDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& known_vdot,
+      const MultibodyForces<T>& external_forces, EigenPtr<MatrixX<T>> dtau_dq,
+      EigenPtr<MatrixX<T>> dtau_dv) const;
+
+  /// Computes the generalized accelerations `vdot` of the model and their
+  /// partial derivatives with respect to the generalized positions q,
+  /// velocities v and generalized forces `tau`, given the state in `context`
+  /// and a set of `applied_forces`. That is, `vdot` solves <pre>
+  ///   M(q)v̇ + C(q, v)v = tau + tau_app + ∑ J_WBᵀ(q) Fapp_Bo_W
+  /// </pre>
+  /// where `tau_app` and `Fapp_Bo_W` are taken from `applied_forces`, and the
+  /// derivatives are evaluated at `tau = 0`. Since `∂v̇/∂tau = M⁻¹`, the
+  /// remaining derivatives follow from CalcInverseDynamicsDerivatives() as
+  /// `∂v̇/∂q = -M⁻¹⋅∂tau_id/∂q` and `∂v̇/∂v = -M⁻¹⋅∂tau_id/∂v`, with
+  /// `tau_id` the inverse dynamics evaluated at v̇. As for the latter,
+  /// `applied_forces` are held fixed.
+  ///
+  /// Unlike EvalTimeDerivatives(), this method does not include forces
+  /// computed by the plant, e.g. gravity, force elements or contact. Use
+  /// CalcForceElementsContribution() to include force elements in
+  /// `applied_forces`, understanding that they are held fixed.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[in] applied_forces
+  ///   A set of forces applied to the system, see MultibodyForces.
+  /// @param[out] vdot
+  ///   On output, the generalized accelerations, of size nv.
+  /// @param[out] dvdot_dq
+  ///   On output, the `nv x nq` matrix `∂v̇/∂q`, see
+  ///   CalcInverseDynamicsDerivatives() for models with quaternions.
+  /// @param[out] dvdot_dv
+  ///   On output, the `nv x nv` matrix `∂v̇/∂v`.
+  /// @param[out] dvdot_dtau
+  ///   On output, the `nv x nv` matrix `∂v̇/∂tau = M⁻¹`.
+  ///
+  /// @pre All output arguments are non-null and have the right sizes.
+  void CalcForwardDynamicsDerivatives(const systems::Context<T>& context,
+                                      const MultibodyForces<T>& applied_forces,
+                                      EigenPtr<VectorX<T>> vdot,
+                                      EigenPtr<MatrixX<T>> dvdot_dq,
+                                      EigenPtr<MatrixX<T>> dvdot_dv,
+                                      EigenPtr<MatrixX<T>> dvdot_dtau) const;
+
+  /// (Advanced) Advances the state stored in `context` by `num_steps` discrete
+  /// steps of size time_step(). If `context` is a root context, its time is
+  /// advanced accordingly; otherwise time is left unchanged, since only the
+  /// root context of a Diagram can change time. Each step performs the same
+  /// update a systems::Simulator would perform for this plant's periodic
+  /// discrete update, and therefore the resulting state matches that of
+  /// advancing a Simulator by the same number of steps.
+  ///
+  /// Unlike a Simulator, this method bypasses the event handling machinery
+  /// (collection of events, publishing, witness functions, and the like)
+  /// to reduce the per-step overhead of long offline rollouts. Input ports
+  /// are evaluated at every step, so that actuation fixed with
+  /// InputPort::FixValue() is held constant throughout. When `context` is part
+  /// of a Diagram context, only the state of this plant is advanced; the
+  /// states of other systems in the Diagram remain unchanged, and so do any
+  /// inputs they provide to this plant unless they depend on its outputs.
+  ///
+  /// @param[in,out] context
+  ///   The context of this plant, storing the state to be advanced.
+  /// @param[in] num_steps
+  ///   The number of discrete steps to take. It must be non-negative.
+  ///
+  /// @throws std::exception if called pre-finalize.
+  /// @throws std::exception if `this` plant is continuous (i.e. is_discrete()
+  ///   is `false`).
+  /// @throws std::exception if `num_steps` is negative.
+  void AdvanceDiscreteSteps(systems::Context<T>* context, int num_steps) const;
+
 #ifdef DRAKE_DOXYGEN_CXX
   // MultibodyPlant uses the NVI implementation of
   // CalcImplicitTimeDerivativesResidual from
@@ -4008,6 +4290,39 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     internal_tree().CalcMassMatrix(context, M);
   }
 
+  /// Computes the mass matrix `M(q)` of the model, like CalcMassMatrix(), but
+  /// stores only its structurally non-zero entries, see
+  /// BranchInducedSparseMatrix. Two generalized velocities can only be
+  /// coupled in M if one of them belongs to a mobilizer on the path from the
+  /// other one to the world, so that for a forest of many independent trees,
+  /// or for branched trees such as humanoids, most of the dense matrix is zero
+  /// by construction. The result can be factorized with
+  /// BranchInducedLtdlFactorization at a cost that scales with the depth of
+  /// the trees rather than with the total number of velocities:
+  /// @code
+  /// BranchInducedSparseMatrix<double> M;
+  /// plant.CalcBranchInducedMassMatrix(context, &M);
+  /// const BranchInducedLtdlFactorization<double> M_ltdl(M);
+  /// const VectorX<double> vdot = M_ltdl.Solve(tau);
+  /// @endcode
+  ///
+  /// @param[in] context
+  ///   The Context containing the state of the model from which generalized
+  ///   coordinates q are extracted.
+  /// @param[out] M
+  ///   On output, the mass matrix. If its sparsity pattern does not match that
+  ///   of this model's mass matrix (e.g. if default constructed), it is
+  ///   reallocated, otherwise its storage is reused.
+  ///
+  /// @pre M is non-null.
+  /// @see CalcMassMatrix() for the dense version.
+  void CalcBranchInducedMassMatrix(const systems::Context<T>& context,
+                                   BranchInducedSparseMatrix<T>* M) const {
+    this->ValidateContext(context);
+    DRAKE_DEMAND(M != nullptr);
+    internal_tree().CalcBranchInducedMassMatrix(context, M);
+  }
+
   /// Computes the bias term `C(q, v)v` containing Coriolis, centripetal, and
   /// gyroscopic effects in the multibody equations of motion: <pre>
   ///   M(q) v̇ + C(q, v) v = tau_app + ∑ (Jv_V_WBᵀ(q) ⋅ Fapp_Bo_W)
@@ -4266,6 +4581,60 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
         Js_v_ABi_E);
   }
 
+  /// Calculates the spatial velocity Jacobians of points fixed to several
+  /// frames in a single pass over the multibody tree. For each frame
+  /// `Bk = *frames_B[k]` and each point Bki in `p_BoBi_B_list[k]`, this method
+  /// computes J𝑠_V_ABki, point Bki's spatial velocity Jacobian in frame A with
+  /// respect to "speeds" 𝑠, with the same meaning as in
+  /// CalcJacobianSpatialVelocity().
+  ///
+  /// The result is the same as that of calling CalcJacobianSpatialVelocity()
+  /// once per point, but the across-node Jacobian of each mobilizer (and the
+  /// mapping N⁺(q) when 𝑠 = q̇) is evaluated only once and shared among all
+  /// the frames whose kinematic path contains that mobilizer. Mobilizers
+  /// shared by the paths from A and from Bk to the world are skipped, since
+  /// their contributions cancel out. Prefer this method over repeated calls
+  /// to CalcJacobianSpatialVelocity() or CalcJacobianTranslationalVelocity()
+  /// when many Jacobians are needed for the same configuration, as is common
+  /// in inverse kinematics or collision avoidance costs.
+  ///
+  /// @param[in] context The state of the multibody system.
+  /// @param[in] with_respect_to Enum equal to JacobianWrtVariable::kQDot or
+  /// JacobianWrtVariable::kV, indicating whether the Jacobians are partial
+  /// derivatives with respect to 𝑠 = q̇ (time-derivatives of generalized
+  /// positions) or with respect to 𝑠 = v (generalized velocities).
+  /// @param[in] frames_B The list of frames Bk on which the points are fixed.
+  /// @param[in] p_BoBi_B_list For each frame Bk, the `3 x pₖ` matrix of
+  /// position vectors from Bko (Bk's origin) to its points Bki, expressed in
+  /// frame Bk. A frame may have zero points.
+  /// @param[in] frame_A The frame in which the spatial velocities are
+  /// measured.
+  /// @param[in] frame_E The frame in which the Jacobians are expressed on
+  /// output.
+  /// @param[out] Js_V_ABi_E_list On output, has one entry per frame Bk. Entry
+  /// k is a `6⋅pₖ x n` matrix, where n is the number of elements in 𝑠, that
+  /// stacks the `6 x n` Jacobians J𝑠_V_ABki_E of the points of Bk in the
+  /// order they are listed in `p_BoBi_B_list[k]`. As in
+  /// CalcJacobianSpatialVelocity(), the top three rows of each `6 x n` block
+  /// hold frame Bk's angular velocity Jacobian and the bottom three rows hold
+  /// point Bki's translational velocity Jacobian. Entries are resized as
+  /// needed, so that memory is reused when this method is called repeatedly
+  /// with the same points.
+  /// @throws std::exception if `Js_V_ABi_E_list` is nullptr, if `frames_B`
+  /// contains a nullptr or if `frames_B` and `p_BoBi_B_list` have different
+  /// sizes.
+  void CalcJacobiansSpatialVelocity(
+      const systems::Context<T>& context, JacobianWrtVariable with_respect_to,
+      const std::vector<const Frame<T>*>& frames_B,
+      const std::vector<Matrix3X<T>>& p_BoBi_B_list, const Frame<T>& frame_A,
+      const Frame<T>& frame_E,
+      std::vector<MatrixX<T>>* Js_V_ABi_E_list) const {
+    this->ValidateContext(context);
+    internal_tree().CalcJacobiansSpatialVelocity(
+        context, with_respect_to, frames_B, p_BoBi_B_list, frame_A, frame_E,
+        Js_V_ABi_E_list);
+  }
+
   /// For each point Bi affixed/welded to a frame B, calculates Jq_p_AoBi, Bi's
   /// position vector Jacobian in frame A with respect to the generalized
   /// positions q ≜ [q₁ ... qₙ]ᵀ as
@@ -5995,6 +6364,23 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   double sap_near_rigid_threshold_{
       MultibodyPlantConfig{}.sap_near_rigid_threshold};
 
+  // Maximum number of quadrature points per hydroelastic contact surface.
+  // Refer to set_hydroelastic_max_quadrature_points_per_surface() for details.
+  int hydroelastic_max_quadrature_points_per_surface_{
+      MultibodyPlantConfig{}.hydroelastic_max_quadrature_points_per_surface};
+
+  // Parallelism used to solve SAP islands. Refer to
+  // set_sap_island_parallelism() for details.
+  Parallelism sap_island_parallelism_{Parallelism::None()};
+
+  // Parallelism used to factorize the SAP Hessian. Refer to
+  // set_sap_linear_solver_parallelism() for details.
+  Parallelism sap_linear_solver_parallelism_{Parallelism::None()};
+
+  // The algorithm used by continuous models to compute forward dynamics.
+  ForwardDynamicsAlgorithm forward_dynamics_algorithm_{
+      ForwardDynamicsAlgorithm::kArticulatedBody};
+
   // User's choice of the representation of contact surfaces in discrete
   // systems. The default value is dependent on whether the system is
   // continuous or discrete, so the constructor will set it. See
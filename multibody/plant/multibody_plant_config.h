@@ -24,8 +24,11 @@ struct MultibodyPlantConfig {
     a->Visit(DRAKE_NVP(discrete_contact_approximation));
     a->Visit(DRAKE_NVP(discrete_contact_solver));
     a->Visit(DRAKE_NVP(sap_near_rigid_threshold));
+    a->Visit(DRAKE_NVP(sap_linear_solver_num_threads));
+    a->Visit(DRAKE_NVP(hydroelastic_max_quadrature_points_per_surface));
     a->Visit(DRAKE_NVP(contact_surface_representation));
     a->Visit(DRAKE_NVP(adjacent_bodies_collision_filters));
+    a->Visit(DRAKE_NVP(forward_dynamics_algorithm));
   }
 
   /// Configures the MultibodyPlant::MultibodyPlant() constructor time_step.
@@ -109,6 +112,19 @@ struct MultibodyPlantConfig {
   ///      For instance, set values in the range (1e-3, 1e-2).
   double sap_near_rigid_threshold{1.0};
 
+  /// Configures MultibodyPlant::set_sap_linear_solver_parallelism() with
+  /// Parallelism(sap_linear_solver_num_threads), the number of threads used
+  /// to factorize the Hessian of the SAP solver. Must be positive. The
+  /// default value of 1 factorizes serially.
+  int sap_linear_solver_num_threads{1};
+
+  /// Configures the
+  /// MultibodyPlant::set_hydroelastic_max_quadrature_points_per_surface().
+  /// Must be non-negative. The default value of 0 uses one quadrature point
+  /// per face of each hydroelastic contact surface.
+  /// Ignored when the time_step is zero.
+  int hydroelastic_max_quadrature_points_per_surface{0};
+
   /// Configures the MultibodyPlant::set_contact_surface_representation().
   /// Refer to drake::geometry::HydroelasticContactRepresentation for details.
   /// Valid strings are:
@@ -122,6 +138,15 @@ struct MultibodyPlantConfig {
 
   /// Configures the MultibodyPlant::set_adjacent_bodies_collision_filters().
   bool adjacent_bodies_collision_filters{true};
+
+  /// Configures the MultibodyPlant::set_forward_dynamics_algorithm().
+  /// Refer to drake::multibody::ForwardDynamicsAlgorithm for details.
+  /// Valid strings are:
+  /// - "articulated_body", the O(n) Articulated Body Algorithm.
+  /// - "mass_matrix", forms and factors the mass matrix.
+  ///
+  /// Ignored when the time_step is non-zero.
+  std::string forward_dynamics_algorithm{"articulated_body"};
 };
 
 }  // namespace multibody
@@ -88,11 +88,18 @@ void ApplyMultibodyPlantConfig(const MultibodyPlantConfig& config,
     }
   }
   plant->set_sap_near_rigid_threshold(config.sap_near_rigid_threshold);
+  plant->set_sap_linear_solver_parallelism(
+      Parallelism(config.sap_linear_solver_num_threads));
+  plant->set_hydroelastic_max_quadrature_points_per_surface(
+      config.hydroelastic_max_quadrature_points_per_surface);
   plant->set_contact_surface_representation(
       internal::GetContactSurfaceRepresentationFromString(
           config.contact_surface_representation));
   plant->set_adjacent_bodies_collision_filters(
       config.adjacent_bodies_collision_filters);
+  plant->set_forward_dynamics_algorithm(
+      internal::GetForwardDynamicsAlgorithmFromString(
+          config.forward_dynamics_algorithm));
 }
 
 namespace internal {
@@ -137,6 +144,18 @@ constexpr const char* EnumToChars(DiscreteContactApproximation enum_value) {
   }
 }
 
+// Use a switch() statement here, to ensure the compiler sends us a reminder
+// when somebody adds a new value to the enum. New values must be listed here
+// as well as in the list of kForwardDynamicsAlgorithms below.
+constexpr const char* EnumToChars(ForwardDynamicsAlgorithm enum_value) {
+  switch (enum_value) {
+    case ForwardDynamicsAlgorithm::kArticulatedBody:
+      return "articulated_body";
+    case ForwardDynamicsAlgorithm::kMassMatrix:
+      return "mass_matrix";
+  }
+}
+
 // Take an alias to limit verbosity, especially in the constexpr boilerplate.
 using ContactRep = geometry::HydroelasticContactRepresentation;
 
@@ -181,6 +200,12 @@ constexpr std::array<NamedEnum<DiscreteContactApproximation>, 4>
         {DiscreteContactApproximation::kLagged},
     }};
 
+constexpr std::array<NamedEnum<ForwardDynamicsAlgorithm>, 2>
+    kForwardDynamicsAlgorithms{{
+        {ForwardDynamicsAlgorithm::kArticulatedBody},
+        {ForwardDynamicsAlgorithm::kMassMatrix},
+    }};
+
 constexpr std::array<NamedEnum<ContactRep>, 2> kContactReps{{
     {ContactRep::kTriangle},
     {ContactRep::kPolygon},
@@ -272,6 +297,27 @@ std::string GetStringFromContactSurfaceRepresentation(
   DRAKE_UNREACHABLE();
 }
 
+ForwardDynamicsAlgorithm GetForwardDynamicsAlgorithmFromString(
+    std::string_view forward_dynamics_algorithm) {
+  for (const auto& [value, name] : kForwardDynamicsAlgorithms) {
+    if (name == forward_dynamics_algorithm) {
+      return value;
+    }
+  }
+  throw std::logic_error(fmt::format("Unknown forward_dynamics_algorithm: '{}'",
+                                     forward_dynamics_algorithm));
+}
+
+std::string GetStringFromForwardDynamicsAlgorithm(
+    ForwardDynamicsAlgorithm forward_dynamics_algorithm) {
+  for (const auto& [value, name] : kForwardDynamicsAlgorithms) {
+    if (value == forward_dynamics_algorithm) {
+      return name;
+    }
+  }
+  DRAKE_UNREACHABLE();
+}
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
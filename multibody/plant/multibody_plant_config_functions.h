@@ -79,6 +79,20 @@ GetContactSurfaceRepresentationFromString(
 std::string GetStringFromContactSurfaceRepresentation(
     geometry::HydroelasticContactRepresentation contact_representation);
 
+// (Exposed for unit testing only.)
+// Parses a string name for a forward dynamics algorithm and returns the
+// enumerated value. Valid string names are listed in MultibodyPlantConfig's
+// class overview.
+// @throws std::exception if an invalid string is passed in.
+ForwardDynamicsAlgorithm GetForwardDynamicsAlgorithmFromString(
+    std::string_view forward_dynamics_algorithm);
+
+// (Exposed for unit testing only.)
+// Returns the string name of an enumerated value for a forward dynamics
+// algorithm.
+std::string GetStringFromForwardDynamicsAlgorithm(
+    ForwardDynamicsAlgorithm forward_dynamics_algorithm);
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
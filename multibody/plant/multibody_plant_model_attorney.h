@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "drake/common/drake_assert.h"
+#include "drake/multibody/plant/discrete_update_manager.h"
 #include "drake/multibody/plant/multibody_plant.h"
 
 namespace drake {
@@ -13,10 +14,13 @@ namespace multibody {
 template <typename T>
 class PhysicalModel;
 
+template <typename T>
+class DeformableModel;
+
 namespace internal {
 
 /* This class is used to grant access to a selected collection of
- MultibodyPlant's private methods to PhysicalModel.
+ MultibodyPlant's private methods to PhysicalModel and DeformableModel.
 
  @tparam_default_scalar */
 template <typename T>
@@ -25,6 +29,7 @@ class MultibodyPlantModelAttorney {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MultibodyPlantModelAttorney);
 
   friend class PhysicalModel<T>;
+  friend class DeformableModel<T>;
 
   /* Returns the SceneGraph with which the given `plant` has been registered.
    @pre plant != nullptr.
@@ -68,6 +73,17 @@ class MultibodyPlantModelAttorney {
                                           std::move(vector_calc_function),
                                           std::move(prerequisites_of_calc));
   }
+
+  /* Returns the DeformableDriver used by the discrete update manager of the
+   given `plant`, or nullptr if there is none, e.g., if `plant` is continuous
+   or not yet finalized. */
+  static const DeformableDriver<double>* deformable_driver(
+      const MultibodyPlant<T>& plant) {
+    if (plant.discrete_update_manager_ == nullptr) {
+      return nullptr;
+    }
+    return plant.discrete_update_manager_->deformable_driver();
+  }
 };
 }  // namespace internal
 }  // namespace multibody
@@ -1,14 +1,17 @@
 #include "drake/multibody/plant/sap_driver.h"
 
 #include <algorithm>
+#include <exception>
 #include <limits>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "drake/common/ssize.h"
 #include "drake/common/unused.h"
 #include "drake/multibody/contact_solvers/contact_configuration.h"
 #include "drake/multibody/contact_solvers/contact_solver_utils.h"
@@ -38,6 +41,8 @@ using drake::multibody::contact_solvers::internal::ExtractTangent;
 using drake::multibody::contact_solvers::internal::FixedConstraintKinematics;
 using drake::multibody::contact_solvers::internal::MakeContactConfiguration;
 using drake::multibody::contact_solvers::internal::MatrixBlock;
+using drake::multibody::contact_solvers::internal::PartialPermutation;
+using drake::multibody::contact_solvers::internal::ReducedMapping;
 using drake::multibody::contact_solvers::internal::SapBallConstraint;
 using drake::multibody::contact_solvers::internal::SapConstraint;
 using drake::multibody::contact_solvers::internal::SapConstraintJacobian;
@@ -52,8 +57,10 @@ using drake::multibody::contact_solvers::internal::SapHuntCrossleyConstraint;
 using drake::multibody::contact_solvers::internal::SapLimitConstraint;
 using drake::multibody::contact_solvers::internal::SapPdControllerConstraint;
 using drake::multibody::contact_solvers::internal::SapSolver;
+using drake::multibody::contact_solvers::internal::SapSolverParameters;
 using drake::multibody::contact_solvers::internal::SapSolverResults;
 using drake::multibody::contact_solvers::internal::SapSolverStatus;
+using drake::multibody::contact_solvers::internal::SapStatistics;
 using drake::multibody::contact_solvers::internal::SapWeldConstraint;
 using drake::systems::DependencyTicket;
 
@@ -118,7 +125,8 @@ const SapSolverResults<T>& SapDriver<T>::EvalSapSolverResults(
     const systems::Context<T>& context) const {
   return plant()
       .get_cache_entry(sap_results_)
-      .template Eval<SapSolverResults<T>>(context);
+      .template Eval<SapSolverResultsCache<T>>(context)
+      .results;
 }
 
 template <typename T>
@@ -132,14 +140,23 @@ const ContactProblemCache<T>& SapDriver<T>::EvalContactProblemCache(
 template <typename T>
 void SapDriver<T>::CalcLinearDynamicsMatrix(const systems::Context<T>& context,
                                             std::vector<MatrixX<T>>* A) const {
+  MatrixX<T> M;
+  CalcLinearDynamicsMatrix(context, &M, A);
+}
+
+template <typename T>
+void SapDriver<T>::CalcLinearDynamicsMatrix(const systems::Context<T>& context,
+                                            MatrixX<T>* M_scratch,
+                                            std::vector<MatrixX<T>>* A) const {
+  DRAKE_DEMAND(M_scratch != nullptr);
   DRAKE_DEMAND(A != nullptr);
   A->resize(tree_topology().num_trees());
   const int nv = plant().num_velocities();
 
-  // TODO(amcastro-tri): consider placing the computation of the dense mass
-  // matrix in a cache entry to minimize heap allocations or better yet,
-  // implement a MultibodyPlant method to compute the per-tree mass matrices.
-  MatrixX<T> M(nv, nv);
+  // TODO(amcastro-tri): consider implementing a MultibodyPlant method to
+  // compute the per-tree mass matrices.
+  MatrixX<T>& M = *M_scratch;
+  M.resize(nv, nv);
   plant().CalcMassMatrix(context, &M);
 
   // The driver solves free motion velocities using a discrete scheme with
@@ -432,6 +449,9 @@ void SapDriver<T>::AddDistanceConstraints(const systems::Context<T>& context,
                                           SapContactProblem<T>* problem) const {
   DRAKE_DEMAND(problem != nullptr);
 
+  // Quick no-op exit, before any scratch space is allocated.
+  if (manager().distance_constraints_specs().empty()) return;
+
   const int nv = plant().num_velocities();
   Matrix3X<T> Jv_WAp_W(3, nv);
   Matrix3X<T> Jv_WBq_W(3, nv);
@@ -522,6 +542,9 @@ void SapDriver<T>::AddBallConstraints(
     contact_solvers::internal::SapContactProblem<T>* problem) const {
   DRAKE_DEMAND(problem != nullptr);
 
+  // Quick no-op exit, before any scratch space is allocated.
+  if (manager().ball_constraints_specs().empty()) return;
+
   const int nv = plant().num_velocities();
   Matrix3X<T> Jv_WAp_W(3, nv);
   Matrix3X<T> Jv_WBq_W(3, nv);
@@ -617,6 +640,9 @@ void SapDriver<T>::AddWeldConstraints(
     contact_solvers::internal::SapContactProblem<T>* problem) const {
   DRAKE_DEMAND(problem != nullptr);
 
+  // Quick no-op exit, before any scratch space is allocated.
+  if (manager().weld_constraints_specs().empty()) return;
+
   const int nv = plant().num_velocities();
   Matrix6X<T> J_WAm(6, nv);
   Matrix6X<T> J_WBm(6, nv);
@@ -792,20 +818,19 @@ void SapDriver<T>::AddFixedConstraints(
 template <typename T>
 void SapDriver<T>::CalcContactProblemCache(
     const systems::Context<T>& context, ContactProblemCache<T>* cache) const {
-  std::vector<MatrixX<T>> A;
-  CalcLinearDynamicsMatrix(context, &A);
-  VectorX<T> v_star;
-  CalcFreeMotionVelocities(context, &v_star);
+  CalcLinearDynamicsMatrix(context, &cache->M, &cache->A);
+  CalcFreeMotionVelocities(context, &cache->v_star);
   const int num_rigid_bodies = plant().num_bodies();
   const int num_deformable_bodies =
       (manager().deformable_driver() == nullptr)
           ? 0
           : manager().deformable_driver()->num_deformable_bodies();
   const int num_objects = num_rigid_bodies + num_deformable_bodies;
-  cache->sap_problem = std::make_unique<SapContactProblem<T>>(
-      plant().time_step(), std::move(A), std::move(v_star));
-  cache->sap_problem->set_num_objects(num_objects);
+  // The problem persists across updates and it is reset in place to reuse its
+  // storage.
   SapContactProblem<T>& problem = *cache->sap_problem;
+  problem.Reset(plant().time_step(), cache->A, cache->v_star);
+  problem.set_num_objects(num_objects);
   // N.B. All contact constraints must be added before any other constraint
   // types. This driver assumes this ordering of the constraints in order to
   // extract contact impulses for reporting contact results.
@@ -926,10 +951,154 @@ void SapDriver<T>::AddCliqueContribution(
   }
 }
 
+template <typename T>
+SapSolverStatus SapDriver<T>::SolveSapProblem(
+    const SapContactProblem<T>& problem, const VectorX<T>& v_guess,
+    SapSolverResultsCache<T>* cache, SapSolverResults<T>* results) const {
+  DRAKE_DEMAND(cache != nullptr);
+  const int max_threads = plant().get_sap_island_parallelism().num_threads();
+  std::vector<ReducedMapping> mappings;
+  std::vector<std::unique_ptr<SapContactProblem<T>>> islands;
+  if (max_threads > 1) islands = problem.MakeIslands(&mappings);
+
+  // Resets `statistics` to `solve_statistics`, except for the symbolic
+  // factorization counters, which accumulate over all solves, see
+  // SapSolverResultsCache::statistics.
+  SapStatistics& statistics = cache->statistics;
+  const auto reset_statistics =
+      [&statistics](const SapStatistics& solve_statistics) {
+        const int num_factorizations = statistics.num_symbolic_factorizations;
+        const int num_reuses = statistics.num_symbolic_factorization_reuses;
+        statistics = solve_statistics;
+        statistics.num_symbolic_factorizations = num_factorizations;
+        statistics.num_symbolic_factorization_reuses = num_reuses;
+      };
+  // Adds the factorizations performed by a solver since its counters were
+  // `counters_before` (factorizations, reuses).
+  const auto accumulate_factorizations =
+      [&statistics](const SapSolver<T>& solver,
+                    const std::pair<int, int>& counters_before) {
+        const SapStatistics& solver_statistics = solver.get_statistics();
+        statistics.num_symbolic_factorizations +=
+            solver_statistics.num_symbolic_factorizations -
+            counters_before.first;
+        statistics.num_symbolic_factorization_reuses +=
+            solver_statistics.num_symbolic_factorization_reuses -
+            counters_before.second;
+      };
+  const auto get_counters = [](const SapSolver<T>& solver) {
+    const SapStatistics& solver_statistics = solver.get_statistics();
+    return std::make_pair(solver_statistics.num_symbolic_factorizations,
+                          solver_statistics.num_symbolic_factorization_reuses);
+  };
+
+  // Nothing to gain from a single island.
+  const int num_islands = ssize(islands);
+  if (num_islands <= 1) {
+    // Only a single problem is factorized in parallel. Islands are already
+    // solved concurrently, and their solvers stay serial to avoid nesting
+    // threads.
+    SapSolver<T>& solver = *cache->solver;
+    SapSolverParameters parameters = sap_parameters_;
+    parameters.linear_solver_parallelism =
+        plant().get_sap_linear_solver_parallelism();
+    solver.set_parameters(parameters);
+    const std::pair<int, int> counters_before = get_counters(solver);
+    const SapSolverStatus status =
+        solver.SolveWithGuess(problem, v_guess, results);
+    reset_statistics(solver.get_statistics());
+    accumulate_factorizations(solver, counters_before);
+    return status;
+  }
+
+  // Pair each island with the solver used for it in the previous split solve,
+  // if any. This is done serially, before solving the islands concurrently.
+  // Islands are keyed by their smallest clique index, which is the clique at
+  // position 0 in their clique permutation.
+  std::map<int, std::unique_ptr<SapSolver<T>>> island_solvers;
+  std::vector<SapSolver<T>*> solvers(num_islands);
+  for (int i = 0; i < num_islands; ++i) {
+    const int key = mappings[i].clique_permutation.domain_index(0);
+    auto previous = cache->island_solvers.find(key);
+    std::unique_ptr<SapSolver<T>>& solver = island_solvers[key];
+    if (previous != cache->island_solvers.end()) {
+      solver = std::move(previous->second);
+    } else {
+      solver = std::make_unique<SapSolver<T>>();
+    }
+    solver->set_parameters(sap_parameters_);
+    solvers[i] = solver.get();
+  }
+  cache->island_solvers = std::move(island_solvers);
+  std::vector<std::pair<int, int>> counters_before(num_islands);
+  for (int i = 0; i < num_islands; ++i) {
+    counters_before[i] = get_counters(*solvers[i]);
+  }
+
+  std::vector<SapSolverResults<T>> island_results(num_islands);
+  std::vector<SapSolverStatus> island_status(num_islands,
+                                             SapSolverStatus::kFailure);
+  const auto solve_island = [&](int i) {
+    const PartialPermutation& velocity_permutation =
+        mappings[i].velocity_permutation;
+    VectorX<T> island_v_guess(velocity_permutation.permuted_domain_size());
+    velocity_permutation.Apply(v_guess, &island_v_guess);
+    island_status[i] = solvers[i]->SolveWithGuess(*islands[i], island_v_guess,
+                                                  &island_results[i]);
+  };
+
+  if constexpr (std::is_same_v<T, double>) {
+    const int num_threads = std::min(max_threads, num_islands);
+    unused(num_threads);  // Only used with OpenMP.
+    // Exceptions must not escape the parallel region. We keep the first one
+    // caught and rethrow it once all islands were processed.
+    std::exception_ptr error;
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+    for (int i = 0; i < num_islands; ++i) {
+      try {
+        solve_island(i);
+      } catch (...) {
+#if defined(_OPENMP)
+#pragma omp critical(SapDriver_SolveSapProblem)
+#endif
+        if (!error) error = std::current_exception();
+      }
+    }
+    if (error) std::rethrow_exception(error);
+  } else {
+    for (int i = 0; i < num_islands; ++i) solve_island(i);
+  }
+
+  reset_statistics(SapStatistics{});
+  statistics.optimality_criterion_reached = true;
+  statistics.cost_criterion_reached = true;
+  for (int i = 0; i < num_islands; ++i) {
+    const SapStatistics& island_statistics = solvers[i]->get_statistics();
+    statistics.num_iters += island_statistics.num_iters;
+    statistics.num_line_search_iters += island_statistics.num_line_search_iters;
+    statistics.num_conjugate_gradient_iters +=
+        island_statistics.num_conjugate_gradient_iters;
+    statistics.optimality_criterion_reached &=
+        island_statistics.optimality_criterion_reached;
+    statistics.cost_criterion_reached &=
+        island_statistics.cost_criterion_reached;
+    accumulate_factorizations(*solvers[i], counters_before[i]);
+  }
+
+  for (SapSolverStatus status : island_status) {
+    if (status != SapSolverStatus::kSuccess) return status;
+  }
+  problem.ExpandIslandResults(mappings, island_results, results);
+  return SapSolverStatus::kSuccess;
+}
+
 template <typename T>
 void SapDriver<T>::CalcSapSolverResults(
     const systems::Context<T>& context,
-    SapSolverResults<T>* sap_results) const {
+    SapSolverResultsCache<T>* cache) const {
+  SapSolverResults<T>* sap_results = &cache->results;
   const ContactProblemCache<T>& contact_problem_cache =
       EvalContactProblemCache(context);
   const SapContactProblem<T>& sap_problem = *contact_problem_cache.sap_problem;
@@ -939,7 +1108,8 @@ void SapDriver<T>::CalcSapSolverResults(
   // We use the velocity stored in the current context as initial guess.
   const VectorX<T>& x0 =
       context.get_discrete_state(manager().multibody_state_index()).value();
-  VectorX<T> v0 = x0.bottomRows(this->plant().num_velocities());
+  VectorX<T>& v0 = cache->v_guess;
+  v0 = x0.bottomRows(this->plant().num_velocities());
 
   // Eliminate known DoFs.
   if (has_locked_dofs) {
@@ -960,20 +1130,17 @@ void SapDriver<T>::CalcSapSolverResults(
   }
 
   // Solve the reduced DOF locked problem.
-  SapSolver<T> sap;
-  sap.set_parameters(sap_parameters_);
-
   SapSolverStatus status;
   if (has_locked_dofs) {
-    SapSolverResults<T> locked_sap_results;
-    status = sap.SolveWithGuess(*contact_problem_cache.sap_problem_locked, v0,
-                                &locked_sap_results);
+    SapSolverResults<T>& locked_sap_results = cache->locked_results;
+    status = SolveSapProblem(*contact_problem_cache.sap_problem_locked, v0,
+                             cache, &locked_sap_results);
     if (status == SapSolverStatus::kSuccess) {
       sap_problem.ExpandContactSolverResults(contact_problem_cache.mapping,
                                              locked_sap_results, sap_results);
     }
   } else {
-    status = sap.SolveWithGuess(sap_problem, v0, sap_results);
+    status = SolveSapProblem(sap_problem, v0, cache, sap_results);
   }
 
   if (status != SapSolverStatus::kSuccess) {
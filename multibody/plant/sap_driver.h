@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -61,6 +62,70 @@ struct ContactProblemCache {
   std::vector<math::RotationMatrix<T>> R_WC;
 
   contact_solvers::internal::ReducedMapping mapping;
+
+  // Scratch storage for the mass matrix M, the linear dynamics matrix A and
+  // the free motion velocities v*. Since the value of a cache entry persists
+  // when it is invalidated, these and `sap_problem` (which is reset in place)
+  // are reused across discrete updates. Therefore, once sizes reach a steady
+  // state, building a problem without constraints does not allocate. This is
+  // limited to constraint-free steps; constraints, including those for
+  // contact, are heap-allocated each time the problem is built.
+  MatrixX<T> M;
+  std::vector<MatrixX<T>> A;
+  VectorX<T> v_star;
+};
+
+// Cache entry for the results of the SAP solver. Since the value of a cache
+// entry persists when it is invalidated, it also stores the SapSolver used to
+// compute the results, so that the symbolic analysis of its Hessian
+// factorization is reused across discrete updates while the contact graph is
+// unchanged. The same holds for the solvers of the islands when the problem is
+// split, see SapDriver::SolveSapProblem(). A copy (e.g. from cloning a
+// context) gets its own new solvers and statistics, so that solvers are never
+// shared between contexts.
+template <typename T>
+struct SapSolverResultsCache {
+  SapSolverResultsCache()
+      : solver(std::make_unique<contact_solvers::internal::SapSolver<T>>()) {}
+
+  SapSolverResultsCache(const SapSolverResultsCache& other)
+      : results(other.results),
+        solver(std::make_unique<contact_solvers::internal::SapSolver<T>>()) {}
+
+  SapSolverResultsCache& operator=(const SapSolverResultsCache& other) {
+    if (this != &other) {
+      results = other.results;
+      solver = std::make_unique<contact_solvers::internal::SapSolver<T>>();
+      island_solvers.clear();
+      statistics = {};
+    }
+    return *this;
+  }
+
+  SapSolverResultsCache(SapSolverResultsCache&&) = default;
+  SapSolverResultsCache& operator=(SapSolverResultsCache&&) = default;
+
+  contact_solvers::internal::SapSolverResults<T> results;
+  std::unique_ptr<contact_solvers::internal::SapSolver<T>> solver;
+
+  // The solvers for the islands of the last solve that was split into
+  // islands, keyed by the smallest clique index of each island.
+  std::map<int, std::unique_ptr<contact_solvers::internal::SapSolver<T>>>
+      island_solvers;
+
+  // Statistics of the last solve. When the problem is split into islands,
+  // iteration counts are summed over islands, the convergence criteria are
+  // reported as reached only if they were reached by all islands, and the
+  // per-iteration histories (cost, alpha, momentum residual and scale) are
+  // empty. The counters of symbolic factorizations and their reuses
+  // accumulate over all solves with `solver` and `island_solvers`.
+  contact_solvers::internal::SapStatistics statistics;
+
+  // Scratch storage reused across discrete updates. Copies do not need their
+  // contents and therefore these are not copied.
+  VectorX<T> v_guess;  // Initial guess for the solver.
+  // Results for the problem with locked DoFs eliminated, if any.
+  contact_solvers::internal::SapSolverResults<T> locked_results;
 };
 
 // Performs the computations needed by CompliantContactManager for discrete
@@ -138,6 +203,12 @@ class SapDriver {
   void CalcLinearDynamicsMatrix(const systems::Context<T>& context,
                                 std::vector<MatrixX<T>>* A) const;
 
+  // Overload that uses `M` as scratch storage for the mass matrix, so that
+  // its storage can be reused across calls.
+  void CalcLinearDynamicsMatrix(const systems::Context<T>& context,
+                                MatrixX<T>* M,
+                                std::vector<MatrixX<T>>* A) const;
+
   // Given the previous state x0 stored in `context`, this method computes the
   // "free motion" velocities, denoted v*.
   void CalcFreeMotionVelocities(const systems::Context<T>& context,
@@ -272,10 +343,25 @@ class SapDriver {
 
   // Computes the discrete update from the state stored in the context. The
   // resulting next time step velocities and constraint impulses are stored in
-  // `sap_results`.
-  void CalcSapSolverResults(
-      const systems::Context<T>& context,
-      contact_solvers::internal::SapSolverResults<T>* sap_results) const;
+  // `cache->results`. The solver in `cache->solver` is reused from the previous
+  // discrete update.
+  void CalcSapSolverResults(const systems::Context<T>& context,
+                            SapSolverResultsCache<T>* cache) const;
+
+  // Solves `problem` using `v_guess` as the initial guess. When more than one
+  // thread is allowed by MultibodyPlant::get_sap_island_parallelism(), the
+  // problem is split into independent islands that are solved concurrently,
+  // see SapContactProblem::MakeIslands(). The status is kSuccess only if all
+  // islands converged. Otherwise the problem is solved with `cache->solver`.
+  // Each island is solved with the solver in `cache->island_solvers` keyed by
+  // its smallest clique index, so that an island whose sparsity pattern did
+  // not change since the previous solve reuses its symbolic factorization.
+  // Solvers of islands that no longer exist are discarded. The statistics of
+  // the solve are written to `cache->statistics`.
+  contact_solvers::internal::SapSolverStatus SolveSapProblem(
+      const contact_solvers::internal::SapContactProblem<T>& problem,
+      const VectorX<T>& v_guess, SapSolverResultsCache<T>* cache,
+      contact_solvers::internal::SapSolverResults<T>* results) const;
 
   // Eval version of  SapSolverResults().
   const contact_solvers::internal::SapSolverResults<T>& EvalSapSolverResults(
@@ -388,6 +388,54 @@ TEST_F(SpheresStackTest, CalcDiscreteContactPairs) {
   }
 }
 
+// Verifies that reducing the number of hydroelastic quadrature points
+// preserves the total stiffness, force and moment of the contact surface
+// between sphere 1 and the ground, which is planar.
+TEST_F(SpheresStackTest, ReducedHydroelasticQuadrature) {
+  struct Totals {
+    int num_hydro_contacts{};
+    double stiffness{};
+    Vector3d force{Vector3d::Zero()};
+    Vector3d moment{Vector3d::Zero()};
+  };
+  auto calc_totals = [this]() {
+    const DiscreteContactData<DiscreteContactPair<double>>& contact_pairs =
+        contact_manager_->EvalDiscreteContactPairs(*plant_context_);
+    Totals totals;
+    totals.num_hydro_contacts = contact_pairs.num_hydro_contacts();
+    // Hydroelastic pairs come after point pairs.
+    for (int q = contact_pairs.num_point_contacts();
+         q < contact_pairs.num_point_contacts() +
+                 contact_pairs.num_hydro_contacts();
+         ++q) {
+      const DiscreteContactPair<double>& pair = contact_pairs[q];
+      const Vector3d f_W = pair.fn0 * pair.nhat_BA_W;
+      totals.stiffness += pair.stiffness;
+      totals.force += f_W;
+      totals.moment += pair.p_WC.cross(f_W);
+      EXPECT_NEAR(pair.fn0, -pair.stiffness * pair.phi0,
+                  10 * kEps * pair.fn0);
+    }
+    return totals;
+  };
+
+  SetupRigidGroundCompliantSphereAndNonHydroSphere();
+  const Totals expected = calc_totals();
+  ASSERT_GT(expected.num_hydro_contacts, 1);
+
+  max_quadrature_points_per_surface_ = 1;
+  SetupRigidGroundCompliantSphereAndNonHydroSphere();
+  EXPECT_EQ(plant_->get_hydroelastic_max_quadrature_points_per_surface(), 1);
+  const Totals reduced = calc_totals();
+  EXPECT_EQ(reduced.num_hydro_contacts, 1);
+  EXPECT_NEAR(reduced.stiffness, expected.stiffness,
+              10 * kEps * expected.stiffness);
+  EXPECT_TRUE(CompareMatrices(reduced.force, expected.force,
+                              10 * kEps * expected.force.norm()));
+  EXPECT_TRUE(CompareMatrices(reduced.moment, expected.moment,
+                              10 * kEps * expected.force.norm()));
+}
+
 // Unit test to verify discrete contact pairs computed by the manager for
 // different combinations of compliance.
 TEST_F(SpheresStackTest, VerifyDiscreteContactPairs) {
@@ -79,6 +79,189 @@ TEST_F(DeformableModelTest, RegisterDeformableBody) {
       ".*RegisterDeformableBody.*after system resources have been declared.*");
 }
 
+/* The parallelism applies to the FEM models of bodies registered before and
+ after it is set, and is preserved by cloning. */
+TEST_F(DeformableModelTest, Parallelism) {
+  EXPECT_EQ(deformable_model_ptr_->parallelism().num_threads(), 1);
+  const DeformableBodyId body_id1 = RegisterSphere(0.5);
+  EXPECT_EQ(
+      deformable_model_ptr_->GetFemModel(body_id1).parallelism().num_threads(),
+      1);
+
+  deformable_model_ptr_->SetParallelism(Parallelism(3));
+  EXPECT_EQ(deformable_model_ptr_->parallelism().num_threads(), 3);
+  const DeformableBodyId body_id2 = RegisterSphere(0.5);
+  for (DeformableBodyId id : {body_id1, body_id2}) {
+    EXPECT_EQ(
+        deformable_model_ptr_->GetFemModel(id).parallelism().num_threads(), 3);
+  }
+
+  plant_->Finalize();
+  MultibodyPlant<double> double_plant(0.01);
+  std::unique_ptr<PhysicalModel<double>> clone =
+      deformable_model_ptr_->CloneToScalar<double>(&double_plant);
+  const auto& double_clone =
+      dynamic_cast<const DeformableModel<double>&>(*clone);
+  EXPECT_EQ(double_clone.parallelism().num_threads(), 3);
+  EXPECT_EQ(double_clone.GetFemModel(body_id2).parallelism().num_threads(), 3);
+
+  /* It can be changed post-finalize. */
+  deformable_model_ptr_->SetParallelism(Parallelism::None());
+  EXPECT_EQ(
+      deformable_model_ptr_->GetFemModel(body_id2).parallelism().num_threads(),
+      1);
+}
+
+/* The matrix-free solver is selected per body and the selection is preserved
+ by cloning. */
+TEST_F(DeformableModelTest, MatrixFreeSolver) {
+  const DeformableBodyId body_id1 = RegisterSphere(0.5);
+  const DeformableBodyId body_id2 = RegisterSphere(0.5);
+  EXPECT_FALSE(deformable_model_ptr_->UsesMatrixFreeSolver(body_id1));
+  EXPECT_FALSE(deformable_model_ptr_->UsesMatrixFreeSolver(body_id2));
+
+  deformable_model_ptr_->SetUseMatrixFreeSolver(body_id1, true);
+  EXPECT_TRUE(deformable_model_ptr_->UsesMatrixFreeSolver(body_id1));
+  EXPECT_FALSE(deformable_model_ptr_->UsesMatrixFreeSolver(body_id2));
+
+  plant_->Finalize();
+  MultibodyPlant<double> double_plant(0.01);
+  std::unique_ptr<PhysicalModel<double>> clone =
+      deformable_model_ptr_->CloneToScalar<double>(&double_plant);
+  const auto& double_clone =
+      dynamic_cast<const DeformableModel<double>&>(*clone);
+  EXPECT_TRUE(double_clone.UsesMatrixFreeSolver(body_id1));
+  EXPECT_FALSE(double_clone.UsesMatrixFreeSolver(body_id2));
+
+  /* It can be changed post-finalize. */
+  deformable_model_ptr_->SetUseMatrixFreeSolver(body_id1, false);
+  EXPECT_FALSE(deformable_model_ptr_->UsesMatrixFreeSolver(body_id1));
+
+  const DeformableBodyId fake_id = DeformableBodyId::get_new_id();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      deformable_model_ptr_->SetUseMatrixFreeSolver(fake_id, true),
+      ".*No deformable body with id .* has been registered.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      deformable_model_ptr_->UsesMatrixFreeSolver(fake_id),
+      ".*No deformable body with id .* has been registered.*");
+}
+
+/* The tangent refresh interval is set per body and preserved by cloning. */
+TEST_F(DeformableModelTest, TangentRefreshInterval) {
+  const DeformableBodyId body_id1 = RegisterSphere(0.5);
+  const DeformableBodyId body_id2 = RegisterSphere(0.5);
+  EXPECT_EQ(deformable_model_ptr_->GetTangentRefreshInterval(body_id1), 1);
+  EXPECT_EQ(deformable_model_ptr_->GetTangentRefreshInterval(body_id2), 1);
+
+  deformable_model_ptr_->SetTangentRefreshInterval(body_id1, 4);
+  EXPECT_EQ(deformable_model_ptr_->GetTangentRefreshInterval(body_id1), 4);
+  EXPECT_EQ(deformable_model_ptr_->GetTangentRefreshInterval(body_id2), 1);
+  EXPECT_THROW(deformable_model_ptr_->SetTangentRefreshInterval(body_id2, 0),
+               std::exception);
+
+  plant_->Finalize();
+  MultibodyPlant<double> double_plant(0.01);
+  std::unique_ptr<PhysicalModel<double>> clone =
+      deformable_model_ptr_->CloneToScalar<double>(&double_plant);
+  const auto& double_clone =
+      dynamic_cast<const DeformableModel<double>&>(*clone);
+  EXPECT_EQ(double_clone.GetTangentRefreshInterval(body_id1), 4);
+  EXPECT_EQ(double_clone.GetTangentRefreshInterval(body_id2), 1);
+
+  /* It can be changed post-finalize. */
+  deformable_model_ptr_->SetTangentRefreshInterval(body_id1, 1);
+  EXPECT_EQ(deformable_model_ptr_->GetTangentRefreshInterval(body_id1), 1);
+
+  const DeformableBodyId fake_id = DeformableBodyId::get_new_id();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      deformable_model_ptr_->SetTangentRefreshInterval(fake_id, 2),
+      ".*No deformable body with id .* has been registered.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      deformable_model_ptr_->GetTangentRefreshInterval(fake_id),
+      ".*No deformable body with id .* has been registered.*");
+}
+
+/* The lagged tangent residual ratio is set per body and preserved by cloning.
+ */
+TEST_F(DeformableModelTest, LaggedTangentResidualRatio) {
+  const DeformableBodyId body_id1 = RegisterSphere(0.5);
+  const DeformableBodyId body_id2 = RegisterSphere(0.5);
+  EXPECT_EQ(deformable_model_ptr_->GetLaggedTangentResidualRatio(body_id1),
+            0.5);
+  EXPECT_EQ(deformable_model_ptr_->GetLaggedTangentResidualRatio(body_id2),
+            0.5);
+
+  deformable_model_ptr_->SetLaggedTangentResidualRatio(body_id1, 0.25);
+  EXPECT_EQ(deformable_model_ptr_->GetLaggedTangentResidualRatio(body_id1),
+            0.25);
+  EXPECT_EQ(deformable_model_ptr_->GetLaggedTangentResidualRatio(body_id2),
+            0.5);
+  EXPECT_THROW(
+      deformable_model_ptr_->SetLaggedTangentResidualRatio(body_id2, 0.0),
+      std::exception);
+  EXPECT_THROW(
+      deformable_model_ptr_->SetLaggedTangentResidualRatio(body_id2, 1.5),
+      std::exception);
+
+  plant_->Finalize();
+  MultibodyPlant<double> double_plant(0.01);
+  std::unique_ptr<PhysicalModel<double>> clone =
+      deformable_model_ptr_->CloneToScalar<double>(&double_plant);
+  const auto& double_clone =
+      dynamic_cast<const DeformableModel<double>&>(*clone);
+  EXPECT_EQ(double_clone.GetLaggedTangentResidualRatio(body_id1), 0.25);
+  EXPECT_EQ(double_clone.GetLaggedTangentResidualRatio(body_id2), 0.5);
+
+  /* It can be changed post-finalize. */
+  deformable_model_ptr_->SetLaggedTangentResidualRatio(body_id1, 1.0);
+  EXPECT_EQ(deformable_model_ptr_->GetLaggedTangentResidualRatio(body_id1),
+            1.0);
+
+  const DeformableBodyId fake_id = DeformableBodyId::get_new_id();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      deformable_model_ptr_->SetLaggedTangentResidualRatio(fake_id, 0.5),
+      ".*No deformable body with id .* has been registered.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      deformable_model_ptr_->GetLaggedTangentResidualRatio(fake_id),
+      ".*No deformable body with id .* has been registered.*");
+}
+
+/* The statistics of the FEM solve for a body's free motion are available
+ through the plant's context. */
+TEST_F(DeformableModelTest, FemSolverStatistics) {
+  const DeformableBodyId body_id = RegisterSphere(1.0);
+  deformable_model_ptr_->SetTangentRefreshInterval(body_id, 2);
+  plant_->Finalize();
+  auto diagram = builder_.Build();
+  auto diagram_context = diagram->CreateDefaultContext();
+  const systems::Context<double>& plant_context =
+      plant_->GetMyContextFromRoot(*diagram_context);
+  /* The body is not at equilibrium under gravity, so its free motion takes at
+   least one Newton-Raphson iteration. */
+  const fem::FemSolverStatistics& stats =
+      deformable_model_ptr_->GetFemSolverStatistics(plant_context, body_id);
+  EXPECT_GE(stats.num_iterations, 1);
+  EXPECT_GE(stats.num_tangent_updates, 1);
+  EXPECT_LE(stats.num_tangent_updates, stats.num_iterations);
+  EXPECT_FALSE(stats.residual_norms.empty());
+  EXPECT_EQ(stats.num_conjugate_gradient_iterations, 0);
+
+  /* The matrix-free solver reports its conjugate gradient iterations. */
+  deformable_model_ptr_->SetUseMatrixFreeSolver(body_id, true);
+  auto matrix_free_context = diagram->CreateDefaultContext();
+  EXPECT_GT(deformable_model_ptr_
+                ->GetFemSolverStatistics(
+                    plant_->GetMyContextFromRoot(*matrix_free_context),
+                    body_id)
+                .num_conjugate_gradient_iterations,
+            0);
+
+  const DeformableBodyId fake_id = DeformableBodyId::get_new_id();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      deformable_model_ptr_->GetFemSolverStatistics(plant_context, fake_id),
+      ".*No deformable body with id .* has been registered.*");
+}
+
 /* Coarsely tests that SetWallBoundaryCondition adds some sort of boundary
  condition. Showing that boundary conditions only get conditionally added (based
  on location of the boundary wall) is sufficient evidence to infer that the
@@ -1,5 +1,7 @@
 #include "drake/multibody/plant/discrete_contact_data.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/limit_malloc.h"
@@ -88,6 +90,82 @@ GTEST_TEST(DiscreteContactData, Reserve) {
   dut.AppendDeformableData(DummyData{0});
 }
 
+/* Data that owns heap storage. */
+struct HeapData {
+  std::vector<double> values;
+};
+
+/* Fills `dut` with `num_point`, `num_hydro`, and `num_deformable` entries
+ filled in place, each one holding `num_values` values. */
+void Fill(int num_point, int num_hydro, int num_deformable, int num_values,
+          DiscreteContactData<HeapData>* dut) {
+  for (int i = 0; i < num_point; ++i) {
+    dut->AppendPointData().values.assign(num_values, i);
+  }
+  for (int i = 0; i < num_hydro; ++i) {
+    dut->AppendHydroData().values.assign(num_values, 10 + i);
+  }
+  for (int i = 0; i < num_deformable; ++i) {
+    dut->AppendDeformableData().values.assign(num_values, 20 + i);
+  }
+}
+
+GTEST_TEST(DiscreteContactData, AppendInPlace) {
+  DiscreteContactData<HeapData> dut;
+  EXPECT_TRUE(dut.AppendPointData().values.empty());
+  Fill(2, 1, 3, 4, &dut);
+  EXPECT_EQ(dut.num_point_contacts(), 3);
+  EXPECT_EQ(dut.num_hydro_contacts(), 1);
+  EXPECT_EQ(dut.num_deformable_contacts(), 3);
+  EXPECT_EQ(dut[1].values, std::vector<double>(4, 0));
+  EXPECT_EQ(dut[3].values, std::vector<double>(4, 10));
+  EXPECT_EQ(dut[6].values, std::vector<double>(4, 22));
+
+  /* Recycled entries are handed out in the order they were appended, with
+   their stale values. */
+  dut.Clear();
+  EXPECT_EQ(dut.size(), 0);
+  EXPECT_TRUE(dut.AppendPointData().values.empty());
+  EXPECT_EQ(dut.AppendPointData().values, std::vector<double>(4, 0));
+  EXPECT_EQ(dut.AppendHydroData().values, std::vector<double>(4, 10));
+  EXPECT_EQ(dut.AppendDeformableData().values, std::vector<double>(4, 20));
+  EXPECT_EQ(dut.size(), 4);
+
+  /* Copies do not carry spare entries. */
+  dut.Clear();
+  DiscreteContactData<HeapData> copy(dut);
+  EXPECT_TRUE(copy.AppendPointData().values.empty());
+  copy = dut;
+  EXPECT_TRUE(copy.AppendHydroData().values.empty());
+}
+
+/* Once the container has reached its steady-state size, clearing and
+ refilling it, either in place or by moving in new data, does not allocate. */
+GTEST_TEST(DiscreteContactData, SteadyStateDoesNotAllocate) {
+  using drake::test::LimitMalloc;
+  DiscreteContactData<HeapData> dut;
+  Fill(5, 3, 2, 6, &dut);
+  dut.Clear();
+  Fill(5, 3, 2, 6, &dut);
+
+  for (int step = 0; step < 3; ++step) {
+    LimitMalloc guard;
+    dut.Clear();
+    /* Fewer entries, with fewer values each. */
+    Fill(4, 3, 1, 5, &dut);
+    dut.Clear();
+    Fill(5, 3, 2, 6, &dut);
+  }
+
+  {
+    LimitMalloc guard;
+    dut.Clear();
+    dut.AppendPointData(HeapData{});
+    dut.AppendHydroData(HeapData{});
+    dut.AppendDeformableData(HeapData{});
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace multibody
@@ -0,0 +1,141 @@
+#include "drake/multibody/plant/hydroelastic_quadrature_reduction.h"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/ssize.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+using Eigen::Vector3d;
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+using Point = HydroelasticQuadraturePoint<double>;
+
+// Makes a grid of nx by ny points on the plane z = 0, with normals along +z
+// and a pressure distribution that peaks at the center of the grid.
+std::vector<Point> MakePlanarPatch(int nx, int ny) {
+  std::vector<Point> points;
+  const double g = 1.0e5;
+  for (int i = 0; i < nx; ++i) {
+    for (int j = 0; j < ny; ++j) {
+      const double x = (i + 0.5) / nx - 0.5;
+      const double y = (j + 0.5) / ny - 0.5;
+      const double area = 1.0 / (nx * ny);
+      const double p0 = 1.0e3 * (1.0 - x * x - 2 * y * y + 0.3 * x);
+      points.push_back({.p_WQ = Vector3d(x, y, 0.0),
+                        .nhat_BA_W = Vector3d::UnitZ(),
+                        .fn0 = area * p0,
+                        .stiffness = area * g,
+                        .phi0 = -p0 / g,
+                        .face_index = static_cast<int>(points.size())});
+    }
+  }
+  return points;
+}
+
+// Returns the sum of the force vectors fn0⋅n̂.
+Vector3d CalcTotalForce(const std::vector<Point>& points) {
+  Vector3d f = Vector3d::Zero();
+  for (const Point& point : points) f += point.fn0 * point.nhat_BA_W;
+  return f;
+}
+
+// Returns the sum of the moments about the origin of the force vectors.
+Vector3d CalcTotalMoment(const std::vector<Point>& points) {
+  Vector3d m = Vector3d::Zero();
+  for (const Point& point : points) {
+    m += point.p_WQ.cross(point.fn0 * point.nhat_BA_W);
+  }
+  return m;
+}
+
+double CalcTotalStiffness(const std::vector<Point>& points) {
+  double k = 0;
+  for (const Point& point : points) k += point.stiffness;
+  return k;
+}
+
+GTEST_TEST(HydroelasticQuadratureReduction, FewPointsUnchanged) {
+  const std::vector<Point> points = MakePlanarPatch(2, 3);
+  const std::vector<Point> reduced = ReduceHydroelasticQuadrature(points, 6);
+  ASSERT_EQ(reduced.size(), points.size());
+  for (int i = 0; i < ssize(points); ++i) {
+    EXPECT_EQ(reduced[i].p_WQ, points[i].p_WQ);
+    EXPECT_EQ(reduced[i].fn0, points[i].fn0);
+    EXPECT_EQ(reduced[i].face_index, points[i].face_index);
+  }
+}
+
+// For a planar patch, the reduction preserves the total stiffness, force and
+// moment, and each lumped point satisfies fn0 = -stiffness⋅phi0.
+GTEST_TEST(HydroelasticQuadratureReduction, PlanarPatch) {
+  const std::vector<Point> points = MakePlanarPatch(10, 7);
+  const double k = CalcTotalStiffness(points);
+  const Vector3d f = CalcTotalForce(points);
+  const Vector3d m = CalcTotalMoment(points);
+  for (int max_num_points : {1, 3, 8, 69}) {
+    const std::vector<Point> reduced =
+        ReduceHydroelasticQuadrature(points, max_num_points);
+    EXPECT_EQ(ssize(reduced), max_num_points);
+    EXPECT_NEAR(CalcTotalStiffness(reduced), k, 10 * kEps * k);
+    EXPECT_TRUE(CompareMatrices(CalcTotalForce(reduced), f,
+                                10 * kEps * f.norm()));
+    EXPECT_TRUE(CompareMatrices(CalcTotalMoment(reduced), m,
+                                10 * kEps * f.norm()));
+    for (const Point& point : reduced) {
+      EXPECT_TRUE(CompareMatrices(point.nhat_BA_W, Vector3d::UnitZ(),
+                                  10 * kEps));
+      EXPECT_NEAR(point.fn0, -point.stiffness * point.phi0,
+                  10 * kEps * point.fn0);
+      EXPECT_GE(point.face_index, 0);
+      EXPECT_LT(point.face_index, ssize(points));
+    }
+  }
+}
+
+// For a curved patch the total force vector is still preserved.
+GTEST_TEST(HydroelasticQuadratureReduction, CurvedPatch) {
+  std::vector<Point> points = MakePlanarPatch(6, 6);
+  for (Point& point : points) {
+    point.nhat_BA_W = Vector3d(0.2 * point.p_WQ.x(), 0.1 * point.p_WQ.y(), 1.0)
+                          .normalized();
+    point.p_WQ.z() = 0.1 * point.p_WQ.squaredNorm();
+  }
+  const Vector3d f = CalcTotalForce(points);
+  const std::vector<Point> reduced = ReduceHydroelasticQuadrature(points, 5);
+  EXPECT_EQ(reduced.size(), 5);
+  EXPECT_TRUE(
+      CompareMatrices(CalcTotalForce(reduced), f, 10 * kEps * f.norm()));
+  for (const Point& point : reduced) {
+    EXPECT_NEAR(point.nhat_BA_W.norm(), 1.0, 10 * kEps);
+  }
+}
+
+// Clusters with zero force are lumped at the stiffness-weighted centroid.
+GTEST_TEST(HydroelasticQuadratureReduction, ZeroForce) {
+  std::vector<Point> points = MakePlanarPatch(2, 2);
+  for (Point& point : points) {
+    point.fn0 = 0.0;
+    point.phi0 = 0.0;
+  }
+  const std::vector<Point> reduced = ReduceHydroelasticQuadrature(points, 1);
+  ASSERT_EQ(reduced.size(), 1);
+  EXPECT_TRUE(CompareMatrices(reduced[0].p_WQ, Vector3d::Zero(), 10 * kEps));
+  EXPECT_TRUE(CompareMatrices(reduced[0].nhat_BA_W, Vector3d::UnitZ()));
+  EXPECT_EQ(reduced[0].fn0, 0.0);
+  EXPECT_EQ(reduced[0].phi0, 0.0);
+  EXPECT_EQ(reduced[0].stiffness, CalcTotalStiffness(points));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
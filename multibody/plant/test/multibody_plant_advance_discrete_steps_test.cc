@@ -0,0 +1,198 @@
+#include <limits>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using geometry::HalfSpace;
+using geometry::Sphere;
+using math::RigidTransformd;
+using systems::Context;
+using systems::Diagram;
+using systems::DiagramBuilder;
+using systems::Simulator;
+
+constexpr double kTimeStep = 0.001;
+constexpr int kNumSteps = 50;
+
+// Builds a diagram with a sphere dropped on the ground next to an actuated
+// pendulum, with constant actuation.
+class AdvanceDiscreteStepsTest : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    DiagramBuilder<double> builder;
+    plant_ = &AddMultibodyPlantSceneGraph(&builder, kTimeStep).plant;
+    plant_->SetUseSampledOutputPorts(GetParam());
+    plant_->set_discrete_contact_approximation(
+        DiscreteContactApproximation::kSap);
+
+    const CoulombFriction<double> friction(0.5, 0.5);
+    plant_->RegisterCollisionGeometry(plant_->world_body(), RigidTransformd(),
+                                      HalfSpace(), "ground", friction);
+    const RigidBody<double>& ball = plant_->AddRigidBody(
+        "ball", SpatialInertia<double>::SolidSphereWithMass(0.5, 0.1));
+    plant_->RegisterCollisionGeometry(ball, RigidTransformd(), Sphere(0.1),
+                                      "ball", friction);
+
+    const RigidBody<double>& link = plant_->AddRigidBody(
+        "link", SpatialInertia<double>::SolidBoxWithMass(1.0, 0.1, 0.1, 0.5));
+    const RevoluteJoint<double>& joint = plant_->AddJoint<RevoluteJoint>(
+        "joint", plant_->world_body(), RigidTransformd(Vector3d(1, 0, 1)),
+        link, RigidTransformd(Vector3d(0, 0, 0.25)), Vector3d::UnitY());
+    plant_->AddJointActuator("actuator", joint);
+    plant_->Finalize();
+
+    diagram_ = builder.Build();
+    diagram_context_ = diagram_->CreateDefaultContext();
+    Context<double>& plant_context =
+        plant_->GetMyMutableContextFromRoot(diagram_context_.get());
+    plant_->SetFreeBodyPose(&plant_context, ball,
+                            RigidTransformd(Vector3d(0, 0, 0.095)));
+    plant_->SetFreeBodySpatialVelocity(
+        &plant_context, ball,
+        SpatialVelocity<double>(Vector3d(0, 2, 0), Vector3d(0.3, 0, -0.1)));
+    joint.set_angle(&plant_context, 0.3);
+    plant_->get_actuation_input_port().FixValue(&plant_context,
+                                                VectorXd::Constant(1, 0.7));
+  }
+
+  MultibodyPlant<double>* plant_{nullptr};
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> diagram_context_;
+};
+
+// Advancing the plant's context matches advancing a Simulator by the same
+// number of steps.
+TEST_P(AdvanceDiscreteStepsTest, MatchesSimulator) {
+  Simulator<double> simulator(*diagram_, diagram_context_->Clone());
+  simulator.AdvanceTo(kNumSteps * kTimeStep);
+  const VectorXd expected_x = plant_->GetPositionsAndVelocities(
+      plant_->GetMyContextFromRoot(simulator.get_context()));
+
+  Context<double>& plant_context =
+      plant_->GetMyMutableContextFromRoot(diagram_context_.get());
+  const VectorXd x0 = plant_->GetPositionsAndVelocities(plant_context);
+  plant_->AdvanceDiscreteSteps(&plant_context, 0);
+  EXPECT_EQ(plant_->GetPositionsAndVelocities(plant_context), x0);
+
+  // Taking the steps in two batches makes no difference.
+  plant_->AdvanceDiscreteSteps(&plant_context, kNumSteps / 2);
+  plant_->AdvanceDiscreteSteps(&plant_context, kNumSteps - kNumSteps / 2);
+  const VectorXd x = plant_->GetPositionsAndVelocities(plant_context);
+  EXPECT_FALSE(x.isApprox(x0));
+  EXPECT_TRUE(CompareMatrices(x, expected_x));
+
+  // The plant's context is not the root context, and therefore time does not
+  // change.
+  EXPECT_EQ(diagram_context_->get_time(), 0.0);
+
+  // With sampled output ports, the outputs reflect the last step.
+  if (plant_->has_sampled_output_ports()) {
+    const VectorXd& expected_accelerations =
+        plant_->get_generalized_acceleration_output_port().Eval(
+            plant_->GetMyContextFromRoot(simulator.get_context()));
+    EXPECT_TRUE(CompareMatrices(
+        plant_->get_generalized_acceleration_output_port().Eval(plant_context),
+        expected_accelerations));
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(SampledOutputPorts, AdvanceDiscreteStepsTest,
+                         testing::Bool());
+
+// A plant's own root context advances time.
+GTEST_TEST(AdvanceDiscreteSteps, RootContextAdvancesTime) {
+  MultibodyPlant<double> plant(kTimeStep);
+  const RigidBody<double>& body = plant.AddRigidBody(
+      "body", SpatialInertia<double>::SolidSphereWithMass(1.0, 0.1));
+  plant.Finalize();
+  auto context = plant.CreateDefaultContext();
+  context->SetTime(1.0);
+  plant.AdvanceDiscreteSteps(context.get(), kNumSteps);
+  EXPECT_NEAR(context->get_time(), 1.0 + kNumSteps * kTimeStep,
+              std::numeric_limits<double>::epsilon());
+  // The body is in free fall.
+  const Vector3d v_WB =
+      plant.EvalBodySpatialVelocityInWorld(*context, body).translational();
+  EXPECT_TRUE(CompareMatrices(
+      v_WB, plant.gravity_field().gravity_vector() * kNumSteps * kTimeStep,
+      1.0e-14));
+}
+
+// Once warmed up, a SAP discrete update of a plant without contact or
+// constraints does not allocate. This guarantee is limited to constraint-free
+// steps: with contact, the contact pairs, the SAP constraints built from them,
+// the solver's model and the contact results are still allocated every step.
+GTEST_TEST(AdvanceDiscreteSteps, ConstraintFreeSteadyStateDoesNotAllocate) {
+  MultibodyPlant<double> plant(kTimeStep);
+  plant.set_discrete_contact_approximation(DiscreteContactApproximation::kSap);
+  const SpatialInertia<double> M_BBo_B =
+      SpatialInertia<double>::SolidBoxWithMass(1.0, 0.1, 0.1, 0.5);
+  const RigidBody<double>& link1 = plant.AddRigidBody("link1", M_BBo_B);
+  const RigidBody<double>& link2 = plant.AddRigidBody("link2", M_BBo_B);
+  const RevoluteJoint<double>& joint1 = plant.AddJoint<RevoluteJoint>(
+      "joint1", plant.world_body(), RigidTransformd(), link1,
+      RigidTransformd(Vector3d(0, 0, 0.25)), Vector3d::UnitY());
+  const RevoluteJoint<double>& joint2 = plant.AddJoint<RevoluteJoint>(
+      "joint2", link1, RigidTransformd(Vector3d(0, 0, -0.25)), link2,
+      RigidTransformd(Vector3d(0, 0, 0.25)), Vector3d::UnitY(),
+      /* damping */ 0.1);
+  plant.Finalize();
+
+  auto context = plant.CreateDefaultContext();
+  joint1.set_angle(context.get(), 0.3);
+  joint2.set_angle(context.get(), -0.2);
+  std::unique_ptr<systems::DiscreteValues<double>> next =
+      plant.AllocateDiscreteVariables();
+
+  // Warm up, so that cache entries and solver scratch reach their sizes.
+  for (int i = 0; i < 3; ++i) {
+    plant.CalcForcedDiscreteVariableUpdate(*context, next.get());
+    context->get_mutable_discrete_state().SetFrom(*next);
+  }
+  const VectorXd x0 = plant.GetPositionsAndVelocities(*context);
+
+  {
+    // N.B. AdvanceDiscreteSteps() allocates its next state once per call, so
+    // we step by hand here.
+    test::LimitMalloc guard;
+    for (int i = 0; i < kNumSteps; ++i) {
+      plant.CalcForcedDiscreteVariableUpdate(*context, next.get());
+      context->get_mutable_discrete_state().SetFrom(*next);
+    }
+  }
+  EXPECT_FALSE(plant.GetPositionsAndVelocities(*context).isApprox(x0));
+}
+
+GTEST_TEST(AdvanceDiscreteSteps, Preconditions) {
+  MultibodyPlant<double> continuous_plant(0.0);
+  continuous_plant.Finalize();
+  auto continuous_context = continuous_plant.CreateDefaultContext();
+  EXPECT_THROW(
+      continuous_plant.AdvanceDiscreteSteps(continuous_context.get(), 1),
+      std::exception);
+
+  MultibodyPlant<double> plant(kTimeStep);
+  plant.Finalize();
+  auto context = plant.CreateDefaultContext();
+  EXPECT_THROW(plant.AdvanceDiscreteSteps(context.get(), -1), std::exception);
+  EXPECT_THROW(plant.AdvanceDiscreteSteps(nullptr, 1), std::exception);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -19,15 +19,23 @@ GTEST_TEST(MultibodyPlantConfigFunctionsTest, AddMultibodyBasicTest) {
   config.penetration_allowance = 0.003;
   config.stiction_tolerance = 0.004;
   config.sap_near_rigid_threshold = 0.1;
+  config.sap_linear_solver_num_threads = 3;
+  config.hydroelastic_max_quadrature_points_per_surface = 8;
   config.contact_model = "hydroelastic";
   config.contact_surface_representation = "polygon";
   config.adjacent_bodies_collision_filters = false;
+  config.forward_dynamics_algorithm = "mass_matrix";
 
   drake::systems::DiagramBuilder<double> builder;
   auto result = AddMultibodyPlant(config, &builder);
   EXPECT_EQ(result.plant.time_step(), 0.002);
   EXPECT_EQ(result.plant.has_sampled_output_ports(), false);
+  EXPECT_EQ(result.plant.get_forward_dynamics_algorithm(),
+            ForwardDynamicsAlgorithm::kMassMatrix);
   EXPECT_EQ(result.plant.get_sap_near_rigid_threshold(), 0.1);
+  EXPECT_EQ(result.plant.get_sap_linear_solver_parallelism().num_threads(), 3);
+  EXPECT_EQ(result.plant.get_hydroelastic_max_quadrature_points_per_surface(),
+            8);
   EXPECT_EQ(result.plant.get_contact_model(), ContactModel::kHydroelasticsOnly);
   EXPECT_EQ(result.plant.get_contact_surface_representation(),
             geometry::HydroelasticContactRepresentation::kPolygon);
@@ -92,8 +100,11 @@ contact_model: hydroelastic
 discrete_contact_solver: ""
 discrete_contact_approximation: lagged
 sap_near_rigid_threshold: 0.01
+sap_linear_solver_num_threads: 2
+hydroelastic_max_quadrature_points_per_surface: 4
 contact_surface_representation: triangle
 adjacent_bodies_collision_filters: false
+forward_dynamics_algorithm: mass_matrix
 )""";
 
 GTEST_TEST(MultibodyPlantConfigFunctionsTest, YamlTest) {
@@ -109,7 +120,12 @@ GTEST_TEST(MultibodyPlantConfigFunctionsTest, YamlTest) {
   EXPECT_EQ(result.plant.get_discrete_contact_approximation(),
             DiscreteContactApproximation::kLagged);
   EXPECT_EQ(result.plant.get_sap_near_rigid_threshold(), 0.01);
+  EXPECT_EQ(result.plant.get_sap_linear_solver_parallelism().num_threads(), 2);
+  EXPECT_EQ(result.plant.get_hydroelastic_max_quadrature_points_per_surface(),
+            4);
   EXPECT_EQ(result.plant.get_adjacent_bodies_collision_filters(), false);
+  EXPECT_EQ(result.plant.get_forward_dynamics_algorithm(),
+            ForwardDynamicsAlgorithm::kMassMatrix);
   // There is no getter for penetration_allowance nor stiction_tolerance, so we
   // can't test them.
 }
@@ -168,6 +184,22 @@ GTEST_TEST(MultibodyPlantConfigFunctionsTest,
       ".*Unknown.*foobar.*");
 }
 
+GTEST_TEST(MultibodyPlantConfigFunctionsTest, ForwardDynamicsAlgorithmTest) {
+  std::vector<std::pair<const char*, ForwardDynamicsAlgorithm>> known_values{
+      std::pair("articulated_body",
+                ForwardDynamicsAlgorithm::kArticulatedBody),
+      std::pair("mass_matrix", ForwardDynamicsAlgorithm::kMassMatrix),
+  };
+
+  for (const auto& [name, value] : known_values) {
+    EXPECT_EQ(GetForwardDynamicsAlgorithmFromString(name), value);
+    EXPECT_EQ(GetStringFromForwardDynamicsAlgorithm(value), name);
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(GetForwardDynamicsAlgorithmFromString("foobar"),
+                              ".*Unknown.*foobar.*");
+}
+
 // MultibodyPlantConfig::discrete_contact_solver is deprecated for removal on or
 // after 2024-04-01. In the meantime, this test verifies it properly coexists
 // with MultibodyPlantConfig::discrete_contact_approximation.
@@ -0,0 +1,190 @@
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/planar_joint.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rpy_floating_joint.h"
+#include "drake/multibody/tree/screw_joint.h"
+#include "drake/multibody/tree/universal_joint.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::Context;
+
+// Both methods are exact, so they only differ by roundoff errors.
+constexpr double kTolerance = 1.0e-10;
+
+// We verify the analytical derivatives of inverse and forward dynamics
+// against derivatives computed with AutoDiffXd. The model includes every
+// kind of mobilizer whose hinge matrix depends on its own configuration, and
+// joint offsets so that no frame is aligned with the world.
+class DynamicsDerivativesTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const SpatialInertia<double> M_BBo_B =
+        SpatialInertia<double>::SolidBoxWithMass(1.5, 0.1, 0.2, 0.3);
+    const RigidTransformd X_PF(RollPitchYawd(0.1, -0.2, 0.3),
+                               Vector3d(0.1, 0.2, -0.3));
+    const RigidTransformd X_BM(RollPitchYawd(-0.3, 0.2, 0.4),
+                               Vector3d(-0.2, 0.1, 0.05));
+
+    // A free body uses a quaternion floating joint.
+    const RigidBody<double>& free_body =
+        plant_.AddRigidBody("free_body", M_BBo_B);
+    const RigidBody<double>& body1 = plant_.AddRigidBody("body1", M_BBo_B);
+    plant_.AddJoint<UniversalJoint>("universal", free_body, X_PF, body1,
+                                    X_BM);
+    const RigidBody<double>& body2 = plant_.AddRigidBody("body2", M_BBo_B);
+    plant_.AddJoint<PlanarJoint>("planar", body1, X_PF, body2, X_BM,
+                                 Vector3d::Zero());
+    const RigidBody<double>& body3 = plant_.AddRigidBody("body3", M_BBo_B);
+    plant_.AddJoint<RpyFloatingJoint>("rpy_floating", body2, X_PF, body3,
+                                      X_BM);
+    const RigidBody<double>& body4 = plant_.AddRigidBody("body4", M_BBo_B);
+    const auto& revolute = plant_.AddJoint<RevoluteJoint>(
+        "revolute", body1, X_PF, body4, X_BM, Vector3d(1, 2, 3).normalized());
+    const RigidBody<double>& body5 = plant_.AddRigidBody("body5", M_BBo_B);
+    plant_.AddJoint<PrismaticJoint>("prismatic", body4, X_PF, body5, X_BM,
+                                    Vector3d(-1, 0, 2).normalized());
+    const RigidBody<double>& body6 = plant_.AddRigidBody("body6", M_BBo_B);
+    plant_.AddJoint<ScrewJoint>("screw", body5, X_PF, body6, X_BM,
+                                Vector3d::UnitY(), 0.1, 0.0);
+    // Reflected inertias only contribute to ∂tau/∂v̇ = M.
+    const JointActuatorIndex actuator =
+        plant_.AddJointActuator("actuator", revolute).index();
+    plant_.get_mutable_joint_actuator(actuator).set_default_rotor_inertia(0.5);
+    plant_.get_mutable_joint_actuator(actuator).set_default_gear_ratio(2.0);
+    plant_.Finalize();
+
+    context_ = plant_.CreateDefaultContext();
+    plant_.SetFreeBodyPose(
+        context_.get(), free_body,
+        RigidTransformd(RollPitchYawd(0.4, -0.3, 1.2), Vector3d(1, 2, 3)));
+    VectorXd q = plant_.GetPositions(*context_);
+    // Set all positions except the quaternion's.
+    q.tail(plant_.num_positions() - 7) =
+        VectorXd::LinSpaced(plant_.num_positions() - 7, -0.8, 1.1);
+    plant_.SetPositions(context_.get(), q);
+    plant_.SetVelocities(
+        context_.get(),
+        VectorXd::LinSpaced(plant_.num_velocities(), 1.5, -2.0));
+
+    plant_ad_ = systems::System<double>::ToAutoDiffXd(plant_);
+  }
+
+  // Returns applied forces with arbitrary, non-zero, values.
+  template <typename T>
+  static MultibodyForces<T> MakeForces(const MultibodyPlant<T>& plant) {
+    MultibodyForces<T> forces(plant);
+    for (int i = 0; i < plant.num_bodies(); ++i) {
+      forces.mutable_body_forces()[i] = SpatialForce<T>(
+          Vector3<T>(0.1 * i, -0.2, 0.3), Vector3<T>(1.0, 0.5 * i, -2.0));
+    }
+    forces.mutable_generalized_forces() =
+        VectorX<T>::LinSpaced(plant.num_velocities(), -1.0, 1.0);
+    return forces;
+  }
+
+  // Returns a context for plant_ad_ with the state of context_, where the
+  // gradients of q and v are the identity.
+  std::unique_ptr<Context<AutoDiffXd>> MakeAutoDiffContext() const {
+    auto context_ad = plant_ad_->CreateDefaultContext();
+    context_ad->SetTimeStateAndParametersFrom(*context_);
+    const VectorX<AutoDiffXd> x_ad =
+        math::InitializeAutoDiff(plant_.GetPositionsAndVelocities(*context_));
+    plant_ad_->SetPositionsAndVelocities(context_ad.get(), x_ad);
+    return context_ad;
+  }
+
+  // Since q contains a quaternion, only derivatives along directions q̇ =
+  // N(q)⋅v are meaningful.
+  MatrixXd ProjectWithN(const MatrixXd& d_dq) const {
+    return d_dq * plant_.MakeVelocityToQDotMap(*context_);
+  }
+
+  MultibodyPlant<double> plant_{0.0};
+  std::unique_ptr<Context<double>> context_;
+  std::unique_ptr<MultibodyPlant<AutoDiffXd>> plant_ad_;
+};
+
+TEST_F(DynamicsDerivativesTest, InverseDynamics) {
+  const int nq = plant_.num_positions();
+  const int nv = plant_.num_velocities();
+  const VectorXd vdot = VectorXd::LinSpaced(nv, -3.0, 2.0);
+  MatrixXd dtau_dq(nv, nq);
+  MatrixXd dtau_dv(nv, nv);
+  plant_.CalcInverseDynamicsDerivatives(*context_, vdot, MakeForces(plant_),
+                                        &dtau_dq, &dtau_dv);
+
+  const auto context_ad = MakeAutoDiffContext();
+  const VectorX<AutoDiffXd> tau_ad = plant_ad_->CalcInverseDynamics(
+      *context_ad, vdot.cast<AutoDiffXd>(), MakeForces(*plant_ad_));
+  const MatrixXd dtau_dx = math::ExtractGradient(tau_ad);
+  EXPECT_TRUE(CompareMatrices(ProjectWithN(dtau_dq),
+                              ProjectWithN(dtau_dx.leftCols(nq)), kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dtau_dv, dtau_dx.rightCols(nv), kTolerance,
+                              MatrixCompareType::relative));
+}
+
+TEST_F(DynamicsDerivativesTest, ForwardDynamics) {
+  const int nq = plant_.num_positions();
+  const int nv = plant_.num_velocities();
+  VectorXd vdot(nv);
+  MatrixXd dvdot_dq(nv, nq);
+  MatrixXd dvdot_dv(nv, nv);
+  MatrixXd dvdot_dtau(nv, nv);
+  plant_.CalcForwardDynamicsDerivatives(*context_, MakeForces(plant_), &vdot,
+                                        &dvdot_dq, &dvdot_dv, &dvdot_dtau);
+
+  // Forward dynamics with AutoDiffXd: v̇ = -M⁻¹⋅(C(q, v)⋅v - tau_app).
+  const auto context_ad = MakeAutoDiffContext();
+  MatrixX<AutoDiffXd> M_ad(nv, nv);
+  plant_ad_->CalcMassMatrix(*context_ad, &M_ad);
+  const VectorX<AutoDiffXd> vdot_ad = -M_ad.ldlt().solve(
+      plant_ad_->CalcInverseDynamics(*context_ad,
+                                     VectorX<AutoDiffXd>::Zero(nv),
+                                     MakeForces(*plant_ad_)));
+  const MatrixXd dvdot_dx = math::ExtractGradient(vdot_ad);
+  EXPECT_TRUE(CompareMatrices(vdot, math::ExtractValue(vdot_ad), kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(ProjectWithN(dvdot_dq),
+                              ProjectWithN(dvdot_dx.leftCols(nq)), kTolerance,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dvdot_dv, dvdot_dx.rightCols(nv), kTolerance,
+                              MatrixCompareType::relative));
+
+  MatrixXd M(nv, nv);
+  plant_.CalcMassMatrix(*context_, &M);
+  EXPECT_TRUE(CompareMatrices(dvdot_dtau * M, MatrixXd::Identity(nv, nv),
+                              kTolerance, MatrixCompareType::relative));
+}
+
+TEST_F(DynamicsDerivativesTest, BadArguments) {
+  const int nv = plant_.num_velocities();
+  MatrixXd dtau_dq(nv, nv);  // Wrong size, should be nv x nq.
+  MatrixXd dtau_dv(nv, nv);
+  EXPECT_THROW(plant_.CalcInverseDynamicsDerivatives(
+                   *context_, VectorXd::Zero(nv), MakeForces(plant_),
+                   &dtau_dq, &dtau_dv),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
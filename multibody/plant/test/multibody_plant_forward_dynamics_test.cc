@@ -204,6 +204,68 @@ GTEST_TEST(MultibodyPlantForwardDynamics, AtlasRobot) {
       residual, Eigen::VectorXd::Zero(plant.num_multibody_states()), 6e-13));
 }
 
+// Verifies that ForwardDynamicsAlgorithm::kMassMatrix computes the same time
+// derivatives as the default articulated body algorithm.
+GTEST_TEST(MultibodyPlantForwardDynamics, MassMatrixAlgorithm) {
+  auto make_plant = [](ForwardDynamicsAlgorithm algorithm) {
+    auto plant = std::make_unique<MultibodyPlant<double>>(0.0);
+    Parser(plant.get()).AddModelsFromUrl(
+        "package://drake_models/atlas/atlas_convex_hull.urdf");
+    plant->set_forward_dynamics_algorithm(algorithm);
+    plant->Finalize();
+    return plant;
+  };
+  const std::unique_ptr<MultibodyPlant<double>> aba_plant =
+      make_plant(ForwardDynamicsAlgorithm::kArticulatedBody);
+  const std::unique_ptr<MultibodyPlant<double>> crba_plant =
+      make_plant(ForwardDynamicsAlgorithm::kMassMatrix);
+  EXPECT_EQ(crba_plant->get_forward_dynamics_algorithm(),
+            ForwardDynamicsAlgorithm::kMassMatrix);
+  DRAKE_EXPECT_THROWS_MESSAGE(crba_plant->set_forward_dynamics_algorithm(
+                                  ForwardDynamicsAlgorithm::kArticulatedBody),
+                              ".*set_forward_dynamics_algorithm.*");
+
+  // Arbitrary non-zero state and actuation.
+  const int nq = aba_plant->num_positions();
+  const int nv = aba_plant->num_velocities();
+  auto aba_context = aba_plant->CreateDefaultContext();
+  aba_plant->SetPositionsAndVelocities(aba_context.get(),
+                                       VectorXd::LinSpaced(nq + nv, -0.5, 0.7));
+  // Overwrite the floating base quaternion with a unit one.
+  aba_plant->SetFreeBodyPose(
+      aba_context.get(), aba_plant->GetBodyByName("pelvis"),
+      RigidTransformd(math::RollPitchYawd(0.1, 0.2, 0.3), Vector3d(1, 2, 3)));
+  const VectorXd x = aba_plant->GetPositionsAndVelocities(*aba_context);
+  auto crba_context = crba_plant->CreateDefaultContext();
+  crba_plant->SetPositionsAndVelocities(crba_context.get(), x);
+  const VectorXd u = VectorXd::LinSpaced(aba_plant->num_actuators(), -1, 1);
+  aba_plant->get_actuation_input_port().FixValue(aba_context.get(), u);
+  crba_plant->get_actuation_input_port().FixValue(crba_context.get(), u);
+
+  const VectorXd xdot_aba =
+      aba_plant->EvalTimeDerivatives(*aba_context).CopyToVector();
+  const VectorXd xdot_crba =
+      crba_plant->EvalTimeDerivatives(*crba_context).CopyToVector();
+
+  // Both results agree to within the conditioning of the mass matrix.
+  MatrixX<double> M(nv, nv);
+  aba_plant->CalcMassMatrix(*aba_context, &M);
+  const double kappa = 1.0 / M.llt().rcond();
+  EXPECT_TRUE(CompareMatrices(xdot_crba, xdot_aba, kappa * kEpsilon,
+                              MatrixCompareType::relative));
+
+  // Spatial accelerations are computed consistently with vdot.
+  const BodyIndex last_body(aba_plant->num_bodies() - 1);
+  EXPECT_TRUE(CompareMatrices(
+      crba_plant->EvalBodySpatialAccelerationInWorld(
+                    *crba_context, crba_plant->get_body(last_body))
+          .get_coeffs(),
+      aba_plant->EvalBodySpatialAccelerationInWorld(
+                   *aba_context, aba_plant->get_body(last_body))
+          .get_coeffs(),
+      kappa * kEpsilon, MatrixCompareType::relative));
+}
+
 // Verifies we can do forward dynamics on a model with a zero-sized state.
 GTEST_TEST(WeldedBoxesTest, ForwardDynamicsViaArticulatedBodyAlgorithm) {
   // Problem parameters.
@@ -1,5 +1,6 @@
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -322,6 +323,64 @@ TEST_F(KukaIiwaModelTests, CalcJacobianTranslationalVelocityB) {
                               MatrixCompareType::relative));
 }
 
+// Verifies that the batched CalcJacobiansSpatialVelocity() matches point by
+// point evaluations of CalcJacobianSpatialVelocity(), including frames A that
+// share part of their path to the world with the frames Bk.
+TEST_F(KukaIiwaModelTests, CalcJacobiansSpatialVelocity) {
+  SetArbitraryConfigurationAndMotion();
+  const Frame<double>& frame_W = plant_->world_frame();
+  const Frame<double>& frame_E = end_effector_link_->body_frame();
+  const Frame<double>& frame_L3 =
+      plant_->GetBodyByName("iiwa_link_3").body_frame();
+  const Frame<double>& frame_L5 =
+      plant_->GetBodyByName("iiwa_link_5").body_frame();
+
+  const std::vector<const Frame<double>*> frames_B{&frame_E, frame_H_,
+                                                   &frame_L3, &frame_W};
+  Matrix3X<double> p_EoEi_E(3, 2);
+  p_EoEi_E.col(0) << 0.1, -0.05, 0.02;
+  p_EoEi_E.col(1) << 0.2, 0.3, -0.15;
+  const std::vector<Matrix3X<double>> p_BoBi_B_list{
+      p_EoEi_E, Vector3d(-0.1, 0.2, 0.3), Matrix3X<double>(3, 0),
+      Vector3d(1.0, 2.0, 3.0)};
+
+  const double kTolerance = 16 * std::numeric_limits<double>::epsilon();
+  std::vector<MatrixX<double>> Js_V_ABi_E_list;
+  for (const JacobianWrtVariable wrt :
+       {JacobianWrtVariable::kV, JacobianWrtVariable::kQDot}) {
+    const int num_columns = wrt == JacobianWrtVariable::kV
+                                ? plant_->num_velocities()
+                                : plant_->num_positions();
+    for (const Frame<double>* frame_A : {&frame_W, &frame_L3, &frame_E}) {
+      for (const Frame<double>* frame_E_expressed : {&frame_W, &frame_L5}) {
+        plant_->CalcJacobiansSpatialVelocity(
+            *context_, wrt, frames_B, p_BoBi_B_list, *frame_A,
+            *frame_E_expressed, &Js_V_ABi_E_list);
+        ASSERT_EQ(Js_V_ABi_E_list.size(), frames_B.size());
+        for (size_t k = 0; k < frames_B.size(); ++k) {
+          const Matrix3X<double>& p_BoBi_B = p_BoBi_B_list[k];
+          ASSERT_EQ(Js_V_ABi_E_list[k].rows(), 6 * p_BoBi_B.cols());
+          ASSERT_EQ(Js_V_ABi_E_list[k].cols(), num_columns);
+          for (int i = 0; i < p_BoBi_B.cols(); ++i) {
+            MatrixX<double> Js_V_ABi_E_expected(6, num_columns);
+            plant_->CalcJacobianSpatialVelocity(
+                *context_, wrt, *frames_B[k], p_BoBi_B.col(i), *frame_A,
+                *frame_E_expressed, &Js_V_ABi_E_expected);
+            EXPECT_TRUE(CompareMatrices(
+                Js_V_ABi_E_list[k].middleRows(6 * i, 6), Js_V_ABi_E_expected,
+                kTolerance, MatrixCompareType::relative));
+          }
+        }
+      }
+    }
+  }
+
+  EXPECT_THROW(plant_->CalcJacobiansSpatialVelocity(
+                   *context_, JacobianWrtVariable::kV, frames_B, {}, frame_W,
+                   frame_W, &Js_V_ABi_E_list),
+               std::exception);
+}
+
 // Fixture for a two degree-of-freedom pendulum having two links A and B.
 // Link A is connected to world (frame W) with a z-axis pin joint (PinJoint1).
 // Link B is connected to link A with another z-axis pin joint (PinJoint2).
@@ -4,6 +4,8 @@
 /// kinematics methods in the Frame class.
 #include <limits>
 #include <memory>
+#include <optional>
+#include <string>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -12,11 +14,16 @@
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/autodiff_gradient.h"
 #include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/test_utilities/spatial_derivative.h"
+#include "drake/multibody/tree/body_poses_batch.h"
+#include "drake/multibody/tree/planar_joint.h"
+#include "drake/multibody/tree/prismatic_joint.h"
 #include "drake/multibody/tree/revolute_joint.h"
 #include "drake/multibody/tree/rigid_body.h"
+#include "drake/multibody/tree/weld_joint.h"
 #include "drake/systems/framework/context.h"
 
 namespace drake {
@@ -513,6 +520,154 @@ TEST_F(TwoDOFPlanarPendulumTest, CalcCenterOfMassAccelerationForwardDynamics) {
   EXPECT_TRUE(CompareMatrices(a_WScm_W, a_WScm_W_expected, kTolerance));
 }
 
+// MultibodyTree computes position and velocity kinematics with kernels
+// specialized on the mobilizer type for weld, revolute, prismatic and
+// quaternion floating mobilizers, and with the generic virtual interface for
+// the others. We verify both paths on a model that mixes them by comparing
+// with computations that do not use these kernels: body poses from
+// CalcBodyPosesInWorldBatch() and body spatial velocities from the Jacobians.
+GTEST_TEST(MobilizerKernelsTest, PositionAndVelocityKinematics) {
+  MultibodyPlant<double> plant(0.0);
+  const SpatialInertia<double> M_BBo_B =
+      SpatialInertia<double>::SolidBoxWithMass(1.0, 0.1, 0.2, 0.3);
+  const math::RigidTransformd X_PF(math::RollPitchYawd(0.1, -0.2, 0.3),
+                                   Vector3d(0.1, 0.2, -0.3));
+  const math::RigidTransformd X_BM(math::RollPitchYawd(-0.3, 0.2, 0.4),
+                                   Vector3d(-0.2, 0.1, 0.05));
+  // The free body is modeled with a quaternion floating mobilizer.
+  const RigidBody<double>& free_body = plant.AddRigidBody("free", M_BBo_B);
+  const RigidBody<double>& body1 = plant.AddRigidBody("body1", M_BBo_B);
+  plant.AddJoint<RevoluteJoint>("revolute", free_body, X_PF, body1, X_BM,
+                                Vector3d(1, 2, 3).normalized());
+  const RigidBody<double>& body2 = plant.AddRigidBody("body2", M_BBo_B);
+  plant.AddJoint<PrismaticJoint>("prismatic", body1, X_PF, body2, X_BM,
+                                 Vector3d(-1, 0, 2).normalized());
+  const RigidBody<double>& body3 = plant.AddRigidBody("body3", M_BBo_B);
+  plant.AddJoint<WeldJoint>("weld", body2, X_PF, body3, X_BM,
+                            math::RigidTransformd(Vector3d(0.1, 0.0, 0.2)));
+  // A planar joint does not have a specialized kernel.
+  const RigidBody<double>& body4 = plant.AddRigidBody("body4", M_BBo_B);
+  plant.AddJoint<PlanarJoint>("planar", body3, X_PF, body4, X_BM,
+                              Vector3d::Zero());
+  const RigidBody<double>& body5 = plant.AddRigidBody("body5", M_BBo_B);
+  plant.AddJoint<RevoluteJoint>("revolute2", body4, X_PF, body5, X_BM,
+                                Vector3d::UnitZ());
+  plant.Finalize();
+
+  auto context = plant.CreateDefaultContext();
+  plant.SetFreeBodyPose(
+      context.get(), free_body,
+      math::RigidTransformd(math::RollPitchYawd(0.4, -0.3, 1.2),
+                            Vector3d(1, 2, 3)));
+  Eigen::VectorXd q = plant.GetPositions(*context);
+  q.tail(plant.num_positions() - 7) =
+      Eigen::VectorXd::LinSpaced(plant.num_positions() - 7, -0.8, 1.1);
+  plant.SetPositions(context.get(), q);
+  const Eigen::VectorXd v =
+      Eigen::VectorXd::LinSpaced(plant.num_velocities(), 1.5, -2.0);
+  plant.SetVelocities(context.get(), v);
+
+  BodyPosesBatch<double> X_WB_batch;
+  plant.CalcBodyPosesInWorldBatch(*context, q, &X_WB_batch);
+
+  const double kTolerance = 16 * std::numeric_limits<double>::epsilon();
+  const Frame<double>& frame_W = plant.world_frame();
+  MatrixXd Jv_V_WB(6, plant.num_velocities());
+  for (BodyIndex b(1); b < plant.num_bodies(); ++b) {
+    const RigidBody<double>& body = plant.get_body(b);
+    EXPECT_TRUE(plant.EvalBodyPoseInWorld(*context, body)
+                    .IsNearlyEqualTo(X_WB_batch.GetPose(b, 0), kTolerance));
+    plant.CalcJacobianSpatialVelocity(*context, JacobianWrtVariable::kV,
+                                      body.body_frame(), Vector3d::Zero(),
+                                      frame_W, frame_W, &Jv_V_WB);
+    EXPECT_TRUE(CompareMatrices(
+        plant.EvalBodySpatialVelocityInWorld(*context, body).get_coeffs(),
+        Jv_V_WB * v, kTolerance, MatrixCompareType::relative));
+  }
+}
+
+// Verifies that incremental position kinematics only recomputes the bodies
+// outboard of the mobilizers whose positions changed, and that results match
+// those computed from scratch.
+GTEST_TEST(IncrementalKinematicsTest, ReuseUnchangedSubtrees) {
+  MultibodyPlant<double> plant(0.0);
+  const SpatialInertia<double> M_BBo_B =
+      SpatialInertia<double>::SolidBoxWithMass(1.0, 0.1, 0.2, 0.3);
+  const math::RigidTransformd X_PF(Vector3d(0.1, 0.2, -0.3));
+  // The model is the forest:
+  //   World ─ A ─ B ─ C
+  //       └─ D
+  const RigidBody<double>* parent = &plant.world_body();
+  for (const char* name : {"A", "B", "C"}) {
+    const RigidBody<double>& body = plant.AddRigidBody(name, M_BBo_B);
+    plant.AddJoint<RevoluteJoint>(std::string("joint") + name, *parent, X_PF,
+                                  body, std::nullopt, Vector3d::UnitZ());
+    parent = &body;
+  }
+  const RigidBody<double>& body_D = plant.AddRigidBody("D", M_BBo_B);
+  plant.AddJoint<RevoluteJoint>("jointD", plant.world_body(), X_PF, body_D,
+                                std::nullopt, Vector3d::UnitX());
+  plant.Finalize();
+  EXPECT_FALSE(plant.get_incremental_kinematics());
+  plant.set_incremental_kinematics(true);
+  EXPECT_TRUE(plant.get_incremental_kinematics());
+
+  auto context = plant.CreateDefaultContext();
+  const double kTolerance = 16 * std::numeric_limits<double>::epsilon();
+  const auto verify_poses = [&]() {
+    BodyPosesBatch<double> X_WB_batch;
+    const Eigen::VectorXd q = plant.GetPositions(*context);
+    plant.CalcBodyPosesInWorldBatch(*context, q, &X_WB_batch);
+    for (BodyIndex b(1); b < plant.num_bodies(); ++b) {
+      EXPECT_TRUE(plant.EvalBodyPoseInWorld(*context, plant.get_body(b))
+                      .IsNearlyEqualTo(X_WB_batch.GetPose(b, 0), kTolerance));
+    }
+  };
+
+  // The first evaluation updates all bodies.
+  const IncrementalKinematicsStatistics& stats =
+      plant.GetIncrementalKinematicsStatistics(*context);
+  EXPECT_EQ(stats.num_evaluations, 1);
+  EXPECT_EQ(stats.num_full_updates, 1);
+  EXPECT_EQ(stats.num_nodes_updated, 4);
+  EXPECT_EQ(stats.num_nodes_reused, 0);
+
+  // Only B and its child C are updated.
+  plant.GetJointByName<RevoluteJoint>("jointB").set_angle(context.get(), 0.5);
+  verify_poses();
+  EXPECT_EQ(stats.num_evaluations, 2);
+  EXPECT_EQ(stats.num_full_updates, 1);
+  EXPECT_EQ(stats.num_nodes_updated, 6);
+  EXPECT_EQ(stats.num_nodes_reused, 2);
+
+  // Setting the same positions invalidates the cache, but nothing needs to be
+  // updated.
+  plant.SetPositions(context.get(), plant.GetPositions(*context));
+  verify_poses();
+  EXPECT_EQ(stats.num_evaluations, 3);
+  EXPECT_EQ(stats.num_nodes_updated, 6);
+  EXPECT_EQ(stats.num_nodes_reused, 6);
+
+  // Changing a parameter forces a full update.
+  body_D.SetMass(context.get(), 2.0);
+  verify_poses();
+  EXPECT_EQ(stats.num_evaluations, 4);
+  EXPECT_EQ(stats.num_full_updates, 2);
+  EXPECT_EQ(stats.num_nodes_updated, 10);
+
+  // Evaluations with incremental kinematics disabled are not counted, and
+  // re-enabling it starts with a full update.
+  plant.set_incremental_kinematics(false);
+  plant.GetJointByName<RevoluteJoint>("jointD").set_angle(context.get(), 0.3);
+  verify_poses();
+  EXPECT_EQ(stats.num_evaluations, 4);
+  plant.set_incremental_kinematics(true);
+  plant.GetJointByName<RevoluteJoint>("jointA").set_angle(context.get(), 0.2);
+  verify_poses();
+  EXPECT_EQ(stats.num_evaluations, 5);
+  EXPECT_EQ(stats.num_full_updates, 3);
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -26,6 +26,7 @@ namespace {
 //   - CalcMassMatrix(): uses the Composite Body Algorithm.
 //   - CalcMassMatrixViaInverseDynamics(): uses inverse dynamics to compute each
 //     column of the mass matrix at a time.
+// We also verify that CalcBranchInducedMassMatrix() agrees with them.
 class MultibodyPlantMassMatrixTests : public ::testing::Test {
  public:
   void LoadUrl(const std::string& url) {
@@ -84,6 +85,30 @@ class MultibodyPlantMassMatrixTests : public ::testing::Test {
                               Mcba.norm() / plant_.num_velocities();
     EXPECT_TRUE(
         CompareMatrices(Mcba, Mid, kTolerance, MatrixCompareType::relative));
+
+    // The branch-induced sparse mass matrix must store all of the non-zero
+    // entries of the dense matrix.
+    BranchInducedSparseMatrix<double> Msparse;
+    plant_.CalcBranchInducedMassMatrix(context, &Msparse);
+    EXPECT_TRUE(CompareMatrices(Msparse.MakeDenseMatrix(), Mcba, kTolerance,
+                                MatrixCompareType::relative));
+
+    // Once its sparsity pattern is set, the sparse matrix storage is reused.
+    {
+      LimitMalloc guard;
+      plant_.CalcBranchInducedMassMatrix(context, &Msparse);
+    }
+
+    // Solving with the sparse factorization leaves a small residual, on the
+    // order of what is expected from a backward stable solver.
+    const VectorX<double> b =
+        VectorX<double>::LinSpaced(plant_.num_velocities(), -1.0, 2.0);
+    const BranchInducedLtdlFactorization<double> Msparse_ltdl(Msparse);
+    const VectorX<double> x = Msparse_ltdl.Solve(b);
+    const double kResidualTolerance = 100.0 *
+                                      std::numeric_limits<double>::epsilon() *
+                                      Mcba.norm() * x.norm();
+    EXPECT_TRUE(CompareMatrices(Mcba * x, b, kResidualTolerance));
   }
 
  protected:
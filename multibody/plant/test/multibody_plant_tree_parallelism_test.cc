@@ -0,0 +1,133 @@
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::Context;
+
+// Builds a wide, shallow forest: many free bodies at level one and a few
+// branched revolute pendula with up to three levels.
+class TreeParallelismTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const SpatialInertia<double> M_BBo_B =
+        SpatialInertia<double>::SolidBoxWithMass(1.0, 0.1, 0.2, 0.3);
+    for (int i = 0; i < kNumFreeBodies; ++i) {
+      plant_.AddRigidBody(fmt::format("free_body{}", i), M_BBo_B);
+    }
+    for (int i = 0; i < kNumPendula; ++i) {
+      const RigidBody<double>& base =
+          plant_.AddRigidBody(fmt::format("base{}", i), M_BBo_B);
+      plant_.AddJoint<RevoluteJoint>(
+          fmt::format("base_joint{}", i), plant_.world_body(),
+          RigidTransformd(Vector3d(i, 0, 0)), base, {}, Vector3d::UnitZ());
+      for (int j = 0; j < 2; ++j) {
+        const RigidBody<double>& link =
+            plant_.AddRigidBody(fmt::format("link{}_{}", i, j), M_BBo_B);
+        plant_.AddJoint<RevoluteJoint>(
+            fmt::format("link_joint{}_{}", i, j), base,
+            RigidTransformd(Vector3d(0, 0.5, 0)), link,
+            RigidTransformd(Vector3d(0.1 * j, 0, 0)), Vector3d::UnitX());
+      }
+    }
+    plant_.Finalize();
+
+    serial_context_ = plant_.CreateDefaultContext();
+    for (int i = 0; i < kNumFreeBodies; ++i) {
+      plant_.SetFreeBodyPose(
+          serial_context_.get(),
+          plant_.GetBodyByName(fmt::format("free_body{}", i)),
+          RigidTransformd(RollPitchYawd(0.1 * i, -0.2 * i, 0.3),
+                          Vector3d(i, 2.0, -0.5 * i)));
+    }
+    for (int i = 0; i < kNumPendula; ++i) {
+      plant_.GetJointByName<RevoluteJoint>(fmt::format("base_joint{}", i))
+          .set_angle(serial_context_.get(), 0.2 * i);
+    }
+    plant_.SetVelocities(
+        serial_context_.get(),
+        Eigen::VectorXd::LinSpaced(plant_.num_velocities(), -1.0, 2.0));
+    parallel_context_ = serial_context_->Clone();
+  }
+
+  static constexpr int kNumFreeBodies = 40;
+  static constexpr int kNumPendula = 4;
+  MultibodyPlant<double> plant_{0.0};
+  std::unique_ptr<Context<double>> serial_context_;
+  std::unique_ptr<Context<double>> parallel_context_;
+};
+
+TEST_F(TreeParallelismTest, DefaultAndScalarConversion) {
+  EXPECT_EQ(plant_.get_tree_parallelism().num_threads(), 1);
+  plant_.set_tree_parallelism(Parallelism(3));
+  EXPECT_EQ(plant_.get_tree_parallelism().num_threads(), 3);
+  std::unique_ptr<MultibodyPlant<AutoDiffXd>> plant_ad =
+      systems::System<double>::ToAutoDiffXd(plant_);
+  EXPECT_EQ(plant_ad->get_tree_parallelism().num_threads(), 3);
+}
+
+// Level-parallel recursions must produce exactly the same results as the
+// serial ones, since each node performs the same operations in either mode.
+TEST_F(TreeParallelismTest, SameResultsAsSerial) {
+  // Results in serial_context_ are computed serially.
+  plant_.set_tree_parallelism(Parallelism::None());
+  std::vector<RigidTransformd> X_WB_serial;
+  std::vector<SpatialVelocity<double>> V_WB_serial;
+  for (BodyIndex b(0); b < plant_.num_bodies(); ++b) {
+    const RigidBody<double>& body = plant_.get_body(b);
+    X_WB_serial.push_back(plant_.EvalBodyPoseInWorld(*serial_context_, body));
+    V_WB_serial.push_back(
+        plant_.EvalBodySpatialVelocityInWorld(*serial_context_, body));
+  }
+  const Eigen::VectorXd vdot =
+      Eigen::VectorXd::LinSpaced(plant_.num_velocities(), 3.0, -1.0);
+  MultibodyForces<double> forces(plant_);
+  const Eigen::VectorXd tau_serial =
+      plant_.CalcInverseDynamics(*serial_context_, vdot, forces);
+  // Forward dynamics for continuous plants use the articulated body algorithm.
+  const Eigen::VectorXd xdot_serial =
+      plant_.EvalTimeDerivatives(*serial_context_).CopyToVector();
+
+  // Results in parallel_context_ are computed in parallel.
+  plant_.set_tree_parallelism(Parallelism(4));
+  std::vector<RigidTransformd> X_WB_parallel;
+  std::vector<SpatialVelocity<double>> V_WB_parallel;
+  for (BodyIndex b(0); b < plant_.num_bodies(); ++b) {
+    const RigidBody<double>& body = plant_.get_body(b);
+    X_WB_parallel.push_back(
+        plant_.EvalBodyPoseInWorld(*parallel_context_, body));
+    V_WB_parallel.push_back(
+        plant_.EvalBodySpatialVelocityInWorld(*parallel_context_, body));
+  }
+  const Eigen::VectorXd tau_parallel =
+      plant_.CalcInverseDynamics(*parallel_context_, vdot, forces);
+  const Eigen::VectorXd xdot_parallel =
+      plant_.EvalTimeDerivatives(*parallel_context_).CopyToVector();
+
+  for (BodyIndex b(0); b < plant_.num_bodies(); ++b) {
+    EXPECT_TRUE(CompareMatrices(X_WB_parallel[b].GetAsMatrix34(),
+                                X_WB_serial[b].GetAsMatrix34(), 0.0));
+    EXPECT_TRUE(CompareMatrices(V_WB_parallel[b].get_coeffs(),
+                                V_WB_serial[b].get_coeffs(), 0.0));
+  }
+  EXPECT_TRUE(CompareMatrices(tau_parallel, tau_serial, 0.0));
+  EXPECT_TRUE(CompareMatrices(xdot_parallel, xdot_serial, 0.0));
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,212 @@
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/plant/compliant_contact_manager.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/plant/sap_driver.h"
+#include "drake/multibody/plant/test/compliant_contact_manager_tester.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+using contact_solvers::internal::SapStatistics;
+
+// Friend of SapDriver, to access the statistics in its results cache entry.
+class SapDriverTest {
+ public:
+  // Evaluates the SAP results and returns the statistics of the solve
+  // stored in their cache entry.
+  static const SapStatistics& EvalSapStatistics(
+      const SapDriver<double>& driver,
+      const systems::Context<double>& context) {
+    return driver.plant()
+        .get_cache_entry(driver.sap_results_)
+        .Eval<SapSolverResultsCache<double>>(context)
+        .statistics;
+  }
+};
+
+}  // namespace internal
+
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using systems::Context;
+
+constexpr double kRadius = 0.1;
+constexpr double kPenetration = 1.0e-3;
+
+// A scene with several independent islands of contact: a stack of two
+// spheres, two spheres resting separately on the ground and a sphere in free
+// flight, which belongs to no island. We verify that solving the islands
+// separately, or factorizing the Hessian of the single problem in parallel,
+// gives the same discrete update as the serial solve of a single problem.
+class SapIslandsTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    systems::DiagramBuilder<double> builder;
+    plant_ = &AddMultibodyPlantSceneGraph(&builder, 1.0e-3).plant;
+    plant_->set_discrete_contact_approximation(
+        DiscreteContactApproximation::kSap);
+    const CoulombFriction<double> friction(0.5, 0.5);
+    plant_->RegisterCollisionGeometry(
+        plant_->world_body(), RigidTransformd::Identity(),
+        geometry::HalfSpace(), "ground", friction);
+    const SpatialInertia<double> M_BBo_B =
+        SpatialInertia<double>::SolidSphereWithMass(0.5, kRadius);
+    for (int i = 0; i < kNumSpheres; ++i) {
+      const RigidBody<double>& sphere =
+          plant_->AddRigidBody(fmt::format("sphere{}", i), M_BBo_B);
+      plant_->RegisterCollisionGeometry(
+          sphere, RigidTransformd::Identity(), geometry::Sphere(kRadius),
+          fmt::format("sphere{}", i), friction);
+    }
+    plant_->Finalize();
+    auto owned_contact_manager =
+        std::make_unique<internal::CompliantContactManager<double>>();
+    contact_manager_ = owned_contact_manager.get();
+    plant_->SetDiscreteUpdateManager(std::move(owned_contact_manager));
+    diagram_ = builder.Build();
+    context_ = diagram_->CreateDefaultContext();
+
+    // Spheres 0 and 1 form a stack, spheres 2 and 3 rest on the ground and
+    // sphere 4 is in free flight.
+    const double z0 = kRadius - kPenetration;
+    const std::vector<Vector3d> p_WBo{
+        Vector3d(0, 0, z0), Vector3d(0, 0, z0 + 2 * kRadius - kPenetration),
+        Vector3d(1, 0, z0), Vector3d(2, 0, z0), Vector3d(3, 0, 1)};
+    Context<double>& plant_context =
+        plant_->GetMyMutableContextFromRoot(context_.get());
+    for (int i = 0; i < kNumSpheres; ++i) {
+      const RigidBody<double>& sphere =
+          plant_->GetBodyByName(fmt::format("sphere{}", i));
+      plant_->SetFreeBodyPose(&plant_context, sphere,
+                              RigidTransformd(p_WBo[i]));
+      // Sliding velocities so that friction is exercised.
+      plant_->SetFreeBodySpatialVelocity(
+          &plant_context, sphere,
+          SpatialVelocity<double>(Vector3d(0.1 * i, 0, 0),
+                                  Vector3d(0.1, -0.05 * i, 0)));
+    }
+  }
+
+  // Returns the next state computed with the given island and linear solver
+  // parallelism.
+  VectorXd CalcNextState(
+      Parallelism parallelism,
+      Parallelism linear_solver_parallelism = Parallelism::None()) {
+    plant_->set_sap_island_parallelism(parallelism);
+    plant_->set_sap_linear_solver_parallelism(linear_solver_parallelism);
+    // Use a fresh context so that cached results are not reused.
+    std::unique_ptr<Context<double>> context = context_->Clone();
+    const Context<double>& plant_context =
+        plant_->GetMyContextFromRoot(*context);
+    return plant_->EvalUniquePeriodicDiscreteUpdate(plant_context).value();
+  }
+
+  const internal::SapStatistics& EvalSapStatistics(
+      const Context<double>& plant_context) const {
+    return internal::SapDriverTest::EvalSapStatistics(
+        internal::CompliantContactManagerTester::sap_driver(*contact_manager_),
+        plant_context);
+  }
+
+  static constexpr int kNumSpheres = 5;
+  MultibodyPlant<double>* plant_{nullptr};
+  internal::CompliantContactManager<double>* contact_manager_{nullptr};
+  std::unique_ptr<systems::Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+TEST_F(SapIslandsTest, SameResultsAsSingleProblem) {
+  EXPECT_EQ(plant_->get_sap_island_parallelism().num_threads(), 1);
+  const VectorXd x_single = CalcNextState(Parallelism::None());
+  const VectorXd x_islands = CalcNextState(Parallelism(2));
+  EXPECT_EQ(plant_->get_sap_island_parallelism().num_threads(), 2);
+  // Islands are solved to the same tolerances as the single problem, though
+  // their convergence checks differ.
+  EXPECT_TRUE(CompareMatrices(x_islands, x_single, 1.0e-6));
+
+  // Sanity check that the spheres in contact were affected by contact: the
+  // stack does not free fall.
+  const int nq = plant_->num_positions();
+  const RigidBody<double>& sphere0 = plant_->GetBodyByName("sphere0");
+  const int vz0 = nq + sphere0.floating_velocities_start_in_v() + 5;
+  EXPECT_GT(x_single[vz0], -1.0e-3 * 9.81);
+}
+
+TEST_F(SapIslandsTest, LinearSolverParallelism) {
+  EXPECT_EQ(plant_->get_sap_linear_solver_parallelism().num_threads(), 1);
+  const VectorXd x_serial = CalcNextState(Parallelism::None());
+  const VectorXd x_parallel =
+      CalcNextState(Parallelism::None(), Parallelism(2));
+  EXPECT_EQ(plant_->get_sap_linear_solver_parallelism().num_threads(), 2);
+  // The parallel factorization is numerically identical to the serial one,
+  // though the triangular solves might differ by round-off.
+  EXPECT_TRUE(CompareMatrices(x_parallel, x_serial, 1.0e-12));
+
+  // Islands are solved with serial factorizations, which is also the case
+  // when both settings are on.
+  const VectorXd x_islands = CalcNextState(Parallelism(2), Parallelism(2));
+  EXPECT_TRUE(CompareMatrices(x_islands, CalcNextState(Parallelism(2)), 0.0));
+}
+
+// Verifies that each island keeps its solver across discrete updates, so that
+// the symbolic analysis of its Hessian is reused while the contact graph does
+// not change, and that the statistics are aggregated over the islands.
+TEST_F(SapIslandsTest, ReuseIslandSolvers) {
+  plant_->set_sap_island_parallelism(Parallelism(2));
+  std::unique_ptr<Context<double>> context = context_->Clone();
+  Context<double>& plant_context =
+      plant_->GetMyMutableContextFromRoot(context.get());
+  // The stack and the two spheres resting on the ground.
+  const int kNumIslands = 3;
+  plant_->EvalUniquePeriodicDiscreteUpdate(plant_context);
+  {
+    const internal::SapStatistics& stats = EvalSapStatistics(plant_context);
+    EXPECT_GE(stats.num_iters, kNumIslands);
+    EXPECT_TRUE(stats.optimality_criterion_reached ||
+                stats.cost_criterion_reached);
+    EXPECT_TRUE(stats.momentum_residual.empty());
+    EXPECT_EQ(stats.num_symbolic_factorizations, kNumIslands);
+    EXPECT_EQ(stats.num_symbolic_factorization_reuses, 0);
+  }
+
+  // Changing velocities invalidates the results but, since contact pairs only
+  // depend on positions, not the contact graph.
+  plant_->SetVelocities(
+      &plant_context,
+      VectorXd::LinSpaced(plant_->num_velocities(), -0.1, 0.1));
+  const VectorXd x_reused =
+      plant_->EvalUniquePeriodicDiscreteUpdate(plant_context).value();
+  {
+    const internal::SapStatistics& stats = EvalSapStatistics(plant_context);
+    EXPECT_EQ(stats.num_symbolic_factorizations, kNumIslands);
+    EXPECT_EQ(stats.num_symbolic_factorization_reuses, kNumIslands);
+  }
+
+  // A cloned context starts with new solvers and gets the same results.
+  std::unique_ptr<Context<double>> clone = context->Clone();
+  const Context<double>& plant_clone = plant_->GetMyContextFromRoot(*clone);
+  const VectorXd x_clone =
+      plant_->EvalUniquePeriodicDiscreteUpdate(plant_clone).value();
+  EXPECT_EQ(EvalSapStatistics(plant_clone).num_symbolic_factorizations,
+            kNumIslands);
+  EXPECT_EQ(EvalSapStatistics(plant_clone).num_symbolic_factorization_reuses,
+            0);
+  EXPECT_TRUE(CompareMatrices(x_reused, x_clone, 1.0e-12));
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -32,6 +32,7 @@ using drake::multibody::contact_solvers::internal::SapPdControllerConstraint;
 using drake::multibody::contact_solvers::internal::SapSolver;
 using drake::multibody::contact_solvers::internal::SapSolverParameters;
 using drake::multibody::contact_solvers::internal::SapSolverResults;
+using drake::multibody::contact_solvers::internal::SapStatistics;
 using drake::multibody::internal::CompliantContactManager;
 using drake::multibody::internal::DiscreteContactPair;
 using drake::systems::Context;
@@ -96,6 +97,16 @@ class SapDriverTest {
     driver.PackContactSolverResults(context, problem, num_contacts, sap_results,
                                     contact_results);
   }
+
+  // Evaluates the SAP results and returns the statistics of the solve
+  // stored in their cache entry.
+  static const SapStatistics& EvalSapStatistics(
+      const SapDriver<double>& driver, const Context<double>& context) {
+    return driver.plant()
+        .get_cache_entry(driver.sap_results_)
+        .Eval<SapSolverResultsCache<double>>(context)
+        .statistics;
+  }
 };
 
 // Test fixture to test the functionality provided by SapDriver, with the
@@ -137,6 +148,10 @@ class SpheresStackTest : public SpheresStack, public ::testing::Test {
                                             contact_results);
   }
 
+  const SapStatistics& EvalSapStatistics(const Context<double>& context) const {
+    return SapDriverTest::EvalSapStatistics(sap_driver(), context);
+  }
+
   // The functions below provide access to private CompliantContactManager
   // functions for unit testing.
 
@@ -374,6 +389,50 @@ TEST_F(SpheresStackTest, EvalContactSolverResults) {
             contact_results_without_cache.v_next);
 }
 
+// Verifies that the symbolic analysis of the Hessian factorization persists
+// across discrete updates while the contact graph does not change, and that
+// reusing it does not change the results.
+TEST_F(SpheresStackTest, ReuseHessianSymbolicFactorization) {
+  SetupRigidGroundCompliantSphereAndNonHydroSphere();
+  const int nv = plant_->num_velocities();
+  contact_manager_->EvalContactSolverResults(*plant_context_);
+  {
+    const SapStatistics& stats = EvalSapStatistics(*plant_context_);
+    ASSERT_GT(stats.num_iters, 0);
+    EXPECT_EQ(stats.num_symbolic_factorizations, 1);
+    EXPECT_EQ(stats.num_symbolic_factorization_reuses, 0);
+  }
+
+  // Changing velocities invalidates the results but, since contact pairs only
+  // depend on positions, not the contact graph.
+  const VectorXd v = VectorXd::LinSpaced(nv, -0.1, 0.1);
+  plant_->SetVelocities(plant_context_, v);
+  const ContactSolverResults<double> results =
+      contact_manager_->EvalContactSolverResults(*plant_context_);
+  {
+    const SapStatistics& stats = EvalSapStatistics(*plant_context_);
+    ASSERT_GT(stats.num_iters, 0);
+    EXPECT_EQ(stats.num_symbolic_factorizations, 1);
+    EXPECT_EQ(stats.num_symbolic_factorization_reuses, 1);
+  }
+
+  // A cloned context gets its own solver, which must start from scratch and
+  // produce the same results.
+  auto diagram_clone = diagram_context_->Clone();
+  Context<double>* clone =
+      &plant_->GetMyMutableContextFromRoot(diagram_clone.get());
+  plant_->SetVelocities(clone, v);
+  const ContactSolverResults<double> clone_results =
+      contact_manager_->EvalContactSolverResults(*clone);
+  {
+    const SapStatistics& stats = EvalSapStatistics(*clone);
+    EXPECT_EQ(stats.num_symbolic_factorizations, 1);
+    EXPECT_EQ(stats.num_symbolic_factorization_reuses, 0);
+  }
+  EXPECT_TRUE(CompareMatrices(clone_results.v_next, results.v_next, kEps,
+                              MatrixCompareType::relative));
+}
+
 // Unit test that the manager is forwarded the active status of each constraint
 // and produces a SapContactProblem with only the active constraints and
 // recalculates the cached SapContactProblem with constraint parameters change.
@@ -123,6 +123,8 @@ class SpheresStack {
         AddMultibodyPlantSceneGraph(&builder, time_step_);
     plant_->set_discrete_contact_approximation(
         DiscreteContactApproximation::kSap);
+    plant_->set_hydroelastic_max_quadrature_points_per_surface(
+        max_quadrature_points_per_surface_);
 
     // Add model of the ground.
     if (ground_params) {
@@ -206,6 +208,10 @@ class SpheresStack {
   // ground/sphere1 and sphere1/sphere2 interpenetrate by this amount.
   const double penetration_distance_{1.0e-3};
 
+  // Maximum number of hydroelastic quadrature points per contact surface, see
+  // MultibodyPlant::set_hydroelastic_max_quadrature_points_per_surface().
+  int max_quadrature_points_per_surface_{0};
+
   std::unique_ptr<systems::Diagram<double>> diagram_;
   MultibodyPlant<double>* plant_{nullptr};
   SceneGraph<double>* scene_graph_{nullptr};
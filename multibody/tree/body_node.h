@@ -12,6 +12,7 @@
 #include "drake/multibody/tree/acceleration_kinematics_cache.h"
 #include "drake/multibody/tree/articulated_body_force_cache.h"
 #include "drake/multibody/tree/articulated_body_inertia_cache.h"
+#include "drake/multibody/tree/body_poses_batch.h"
 #include "drake/multibody/tree/mobilizer.h"
 #include "drake/multibody/tree/multibody_element.h"
 #include "drake/multibody/tree/multibody_tree_indexes.h"
@@ -218,6 +219,79 @@ class BodyNode : public MultibodyElement<T> {
     // its parent body P expressed in the world frame W.
   }
 
+  // Batched counterpart of CalcPositionKinematicsCache_BaseToTip(). For each
+  // of the N configurations stored as the columns of `q`, this method
+  // computes the pose X_WB of this node's body B and stores it in `X_WB_batch`
+  // column by column in lockstep, reusing the configuration independent
+  // poses X_PF and X_MB for all configurations.
+  // `context` is only used to read parameters (e.g. fixed frame offsets); the
+  // generalized positions it stores are ignored and no cache entry is
+  // evaluated or invalidated.
+  // @param[in] context The context with the parameters of the MultibodyTree.
+  // @param[in] q The nq x N matrix of generalized positions for the full
+  //   MultibodyTree, one configuration per column.
+  // @param[in,out] X_WB_batch On input, it must be sized for N configurations
+  //   and contain the poses of the parent body P. On output it also contains
+  //   the poses of body B.
+  // @pre CalcBodyPosesInWorldBatch_BaseToTip() must have already been called
+  // for the parent node (and, by recursive precondition, all predecessor nodes
+  // in the tree.)
+  void CalcBodyPosesInWorldBatch_BaseToTip(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q,
+      BodyPosesBatch<T>* X_WB_batch) const {
+    // This method must not be called for the "world" body node.
+    DRAKE_ASSERT(topology_.rigid_body != world_index());
+    DRAKE_ASSERT(X_WB_batch != nullptr);
+    DRAKE_ASSERT(X_WB_batch->num_configurations() == q.cols());
+
+    const Mobilizer<T>& mobilizer = get_mobilizer();
+    const Frame<T>& frame_F = mobilizer.inboard_frame();
+    const Frame<T>& frame_M = mobilizer.outboard_frame();
+
+    // Configuration independent poses, computed once for the whole batch.
+    const math::RigidTransform<T> X_PF = frame_F.CalcPoseInBodyFrame(context);
+    const math::RigidTransform<T> X_MB =
+        frame_M.CalcPoseInBodyFrame(context).inverse();
+
+    // Poses X_PB for all N configurations, stored in the same
+    // structure-of-arrays layout as X_WB_batch.
+    const int num_configurations = q.cols();
+    const int q_start = mobilizer.position_start_in_q();
+    typename BodyPosesBatch<T>::RotationsMatrix R_PB(num_configurations, 9);
+    typename BodyPosesBatch<T>::TranslationsMatrix p_PB(num_configurations, 3);
+    for (int k = 0; k < num_configurations; ++k) {
+      // Columns of q are contiguous in memory and therefore so are the
+      // positions for this mobilizer.
+      const math::RigidTransform<T> X_PB =
+          X_PF * mobilizer.calc_X_FM(q.col(k).data() + q_start) * X_MB;
+      const Matrix3<T>& R = X_PB.rotation().matrix();
+      for (int j = 0; j < 9; ++j) R_PB(k, j) = R(j % 3, j / 3);
+      p_PB.row(k) = X_PB.translation().transpose();
+    }
+
+    // Compose X_WB = X_WP * X_PB one scalar component at a time so that each
+    // operation streams over N contiguous values. Entry R(i, m) of a
+    // flattened rotation is stored in column 3 * m + i.
+    const BodyIndex body_B = topology_.rigid_body;
+    const BodyIndex body_P = topology_.parent_rigid_body;
+    const auto& R_WP = X_WB_batch->rotations(body_P);
+    const auto& p_WP = X_WB_batch->translations(body_P);
+    auto& R_WB = X_WB_batch->get_mutable_rotations(body_B);
+    auto& p_WB = X_WB_batch->get_mutable_translations(body_B);
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        R_WB.col(3 * j + i) =
+            R_WP.col(i).cwiseProduct(R_PB.col(3 * j)) +
+            R_WP.col(3 + i).cwiseProduct(R_PB.col(3 * j + 1)) +
+            R_WP.col(6 + i).cwiseProduct(R_PB.col(3 * j + 2));
+      }
+      p_WB.col(i) = p_WP.col(i) + R_WP.col(i).cwiseProduct(p_PB.col(0)) +
+                    R_WP.col(3 + i).cwiseProduct(p_PB.col(1)) +
+                    R_WP.col(6 + i).cwiseProduct(p_PB.col(2));
+    }
+  }
+
   // This method is used by MultibodyTree within a base-to-tip loop to compute
   // this node's kinematics that depend on the generalized velocities.
   // This method aborts in Debug builds when:
@@ -336,6 +410,65 @@ class BodyNode : public MultibodyElement<T> {
     get_mutable_V_WB(vc) = V_WP.ComposeWithMovingFrameVelocity(p_PB_W, V_PB_W);
   }
 
+  // @name Kernels specialized on the mobilizer type
+  // Counterparts of CalcPositionKinematicsCache_BaseToTip() and
+  // CalcVelocityKinematicsCache_BaseToTip() for a node whose mobilizer is
+  // known at compile time to be a `ConcreteMobilizer`, which must be a
+  // MobilizerImpl providing non-virtual calc_X_FM() and calc_V_FM() methods.
+  // Instead of going through the virtual Mobilizer interface with
+  // dynamically sized Eigen arguments, these call the concrete mobilizer's
+  // kernels directly on the mobilizer's slice of the state, and the hinge
+  // matrix product is performed with compile-time sizes.
+  // MultibodyTree uses these on nodes whose mobilizers have a specialized
+  // kernel, see MultibodyTree::CalcPositionKinematicsCache().
+  // @param[in] mobilizer This node's mobilizer, get_mobilizer(), already
+  //   downcast to its concrete type.
+  // @param[in] qv Pointer to the full vector of generalized positions and
+  //   velocities stored in `context`.
+  //@{
+
+  template <class ConcreteMobilizer>
+  void CalcPositionKinematicsCache_BaseToTip(
+      const systems::Context<T>& context, const ConcreteMobilizer& mobilizer,
+      const T* qv, PositionKinematicsCache<T>* pc) const {
+    DRAKE_ASSERT(topology_.rigid_body != world_index());
+    DRAKE_ASSERT(&mobilizer == &get_mobilizer());
+    DRAKE_ASSERT(pc != nullptr);
+    // Qualified call to avoid virtual dispatch.
+    get_mutable_X_FM(pc) = mobilizer.ConcreteMobilizer::calc_X_FM(
+        qv + topology_.mobilizer_positions_start);
+    CalcAcrossMobilizerBodyPoses_BaseToTip(context, pc);
+  }
+
+  template <class ConcreteMobilizer>
+  void CalcVelocityKinematicsCache_BaseToTip(
+      const ConcreteMobilizer& mobilizer, const T* qv,
+      const PositionKinematicsCache<T>& pc,
+      const std::vector<Vector6<T>>& H_PB_W_cache,
+      VelocityKinematicsCache<T>* vc) const {
+    constexpr int kNv = ConcreteMobilizer::kNumVelocities;
+    DRAKE_ASSERT(topology_.rigid_body != world_index());
+    DRAKE_ASSERT(&mobilizer == &get_mobilizer());
+    DRAKE_ASSERT(topology_.num_mobilizer_velocities == kNv);
+    DRAKE_ASSERT(vc != nullptr);
+    // See CalcVelocityKinematicsCache_BaseToTip() for the derivation.
+    const T* vm = qv + topology_.mobilizer_velocities_start_in_state;
+    get_mutable_V_FM(vc) = mobilizer.calc_V_FM(
+        qv + topology_.mobilizer_positions_start, vm);
+    SpatialVelocity<T>& V_PB_W = get_mutable_V_PB_W(vc);
+    if constexpr (kNv == 0) {
+      V_PB_W.get_coeffs().setZero();
+    } else {
+      const Eigen::Map<const Eigen::Matrix<T, 6, kNv>> H_PB_W(
+          H_PB_W_cache[topology_.mobilizer_velocities_start_in_v].data());
+      V_PB_W.get_coeffs().noalias() =
+          H_PB_W * Eigen::Map<const Vector<T, kNv>>(vm);
+    }
+    get_mutable_V_WB(vc) = get_V_WP(*vc).ComposeWithMovingFrameVelocity(
+        get_p_PoBo_W(pc), V_PB_W);
+  }
+  //@}
+
   // This method is used by MultibodyTree within a base-to-tip loop to compute
   // this node's kinematics that depend on the generalized accelerations, i.e.
   // the generalized velocities' time derivatives.
@@ -0,0 +1,57 @@
+#include "drake/multibody/tree/body_poses_batch.h"
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace multibody {
+
+template <typename T>
+BodyPosesBatch<T>::BodyPosesBatch(int num_bodies, int num_configurations) {
+  Resize(num_bodies, num_configurations);
+}
+
+template <typename T>
+void BodyPosesBatch<T>::Resize(int num_bodies, int num_configurations) {
+  DRAKE_THROW_UNLESS(num_bodies >= 0);
+  DRAKE_THROW_UNLESS(num_configurations >= 0);
+  if (num_bodies == this->num_bodies() &&
+      num_configurations == num_configurations_) {
+    return;
+  }
+  num_configurations_ = num_configurations;
+  // Identity rotation flattened in column-major order.
+  Eigen::Matrix<T, 1, 9> R_identity;
+  R_identity << 1, 0, 0, 0, 1, 0, 0, 0, 1;
+  p_WB_.assign(num_bodies, TranslationsMatrix::Zero(num_configurations, 3));
+  R_WB_.assign(num_bodies, R_identity.replicate(num_configurations, 1));
+}
+
+template <typename T>
+math::RigidTransform<T> BodyPosesBatch<T>::GetPose(BodyIndex body_index,
+                                                   int k) const {
+  DRAKE_ASSERT(body_index < num_bodies());
+  DRAKE_ASSERT(0 <= k && k < num_configurations_);
+  const auto R_row = R_WB_[body_index].row(k);
+  Matrix3<T> R;
+  for (int j = 0; j < 9; ++j) R(j % 3, j / 3) = R_row(j);
+  return math::RigidTransform<T>(
+      math::RotationMatrix<T>::MakeUnchecked(R),
+      p_WB_[body_index].row(k).transpose());
+}
+
+template <typename T>
+void BodyPosesBatch<T>::SetPose(BodyIndex body_index, int k,
+                                const math::RigidTransform<T>& X_WB) {
+  DRAKE_ASSERT(body_index < num_bodies());
+  DRAKE_ASSERT(0 <= k && k < num_configurations_);
+  const Matrix3<T>& R = X_WB.rotation().matrix();
+  auto R_row = R_WB_[body_index].row(k);
+  for (int j = 0; j < 9; ++j) R_row(j) = R(j % 3, j / 3);
+  p_WB_[body_index].row(k) = X_WB.translation().transpose();
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::BodyPosesBatch);
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/tree/multibody_tree_indexes.h"
+
+namespace drake {
+namespace multibody {
+
+/// Stores the poses `X_WB` of every RigidBody B in a model, measured and
+/// expressed in the world frame W, for a batch of N configurations.
+///
+/// Storage is laid out as a structure of arrays: for each body B, the N
+/// translations `p_WoBo_W` are stored as the three columns of an `N x 3`
+/// matrix and the N rotation matrices `R_WB` as the nine columns of an
+/// `N x 9` matrix (column j holds the entry `R_WB(j % 3, j / 3)`, i.e. the
+/// rotation matrix is flattened in column-major order). Since Eigen matrices
+/// are column-major, each scalar component of the poses is contiguous in
+/// memory across the N configurations, which is the layout batched
+/// (vectorized) kinematics sweeps operate on.
+///
+/// Bodies are indexed by BodyIndex and configurations by an integer
+/// `k ∈ [0, N)`, the column index of the matrix of generalized positions used
+/// to compute the poses. See MultibodyPlant::CalcBodyPosesInWorldBatch().
+///
+/// @tparam_default_scalar
+template <typename T>
+class BodyPosesBatch {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BodyPosesBatch);
+
+  /// The `N x 3` storage for the translations of a single body.
+  using TranslationsMatrix = Eigen::Matrix<T, Eigen::Dynamic, 3>;
+
+  /// The `N x 9` storage for the rotations of a single body.
+  using RotationsMatrix = Eigen::Matrix<T, Eigen::Dynamic, 9>;
+
+  /// Constructs an empty batch, with zero bodies and zero configurations.
+  BodyPosesBatch() = default;
+
+  /// Constructs a batch for `num_bodies` bodies and `num_configurations`
+  /// configurations. All poses are initialized to the identity.
+  /// @pre num_bodies >= 0 and num_configurations >= 0.
+  BodyPosesBatch(int num_bodies, int num_configurations);
+
+  /// Returns the number of bodies in this batch.
+  int num_bodies() const { return static_cast<int>(p_WB_.size()); }
+
+  /// Returns the number N of configurations in this batch.
+  int num_configurations() const { return num_configurations_; }
+
+  /// Resizes this batch to store `num_bodies` poses for each of
+  /// `num_configurations` configurations. Memory is only reallocated when
+  /// the sizes change. If reallocated, all poses are set to the identity,
+  /// otherwise they are left unchanged.
+  /// @pre num_bodies >= 0 and num_configurations >= 0.
+  void Resize(int num_bodies, int num_configurations);
+
+  /// Returns the `N x 3` matrix whose k-th row is the position `p_WoBo_W` of
+  /// body B's origin in the k-th configuration.
+  /// @pre body_index < num_bodies().
+  const TranslationsMatrix& translations(BodyIndex body_index) const {
+    DRAKE_ASSERT(body_index < num_bodies());
+    return p_WB_[body_index];
+  }
+
+  /// Mutable version of translations().
+  TranslationsMatrix& get_mutable_translations(BodyIndex body_index) {
+    DRAKE_ASSERT(body_index < num_bodies());
+    return p_WB_[body_index];
+  }
+
+  /// Returns the `N x 9` matrix whose k-th row is the rotation matrix `R_WB`
+  /// of body B in the k-th configuration, flattened in column-major order.
+  /// @pre body_index < num_bodies().
+  const RotationsMatrix& rotations(BodyIndex body_index) const {
+    DRAKE_ASSERT(body_index < num_bodies());
+    return R_WB_[body_index];
+  }
+
+  /// Mutable version of rotations().
+  RotationsMatrix& get_mutable_rotations(BodyIndex body_index) {
+    DRAKE_ASSERT(body_index < num_bodies());
+    return R_WB_[body_index];
+  }
+
+  /// Returns the pose `X_WB` of body B in the k-th configuration.
+  /// @pre body_index < num_bodies() and 0 <= k < num_configurations().
+  math::RigidTransform<T> GetPose(BodyIndex body_index, int k) const;
+
+  /// Sets the pose `X_WB` of body B in the k-th configuration.
+  /// @pre body_index < num_bodies() and 0 <= k < num_configurations().
+  void SetPose(BodyIndex body_index, int k,
+               const math::RigidTransform<T>& X_WB);
+
+ private:
+  int num_configurations_{0};
+  // p_WB_[b] and R_WB_[b] store the translations and rotations for the body
+  // with BodyIndex b. See the class documentation for layout details.
+  std::vector<TranslationsMatrix> p_WB_;
+  std::vector<RotationsMatrix> R_WB_;
+};
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::BodyPosesBatch);
@@ -0,0 +1,145 @@
+#include "drake/multibody/tree/branch_induced_sparse_matrix.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/extract_double.h"
+
+namespace drake {
+namespace multibody {
+
+template <typename T>
+BranchInducedSparseMatrix<T>::BranchInducedSparseMatrix(
+    std::vector<int> parents)
+    : parents_(std::move(parents)) {
+  const int n = size();
+  depths_.resize(n);
+  row_starts_.resize(n);
+  int num_entries = 0;
+  for (int i = 0; i < n; ++i) {
+    const int parent = parents_[i];
+    DRAKE_THROW_UNLESS(-1 <= parent && parent < i);
+    depths_[i] = parent < 0 ? 0 : depths_[parent] + 1;
+    row_starts_[i] = num_entries;
+    num_entries += depths_[i] + 1;
+  }
+  values_.assign(num_entries, T(0.0));
+}
+
+template <typename T>
+bool BranchInducedSparseMatrix<T>::IsStored(int i, int j) const {
+  DRAKE_ASSERT(0 <= i && i < size());
+  DRAKE_ASSERT(0 <= j && j < size());
+  // Since ancestors have smaller indexes, walk up from i until reaching j or
+  // going past it.
+  while (i > j) i = parents_[i];
+  return i == j;
+}
+
+template <typename T>
+void BranchInducedSparseMatrix<T>::SetZero() {
+  std::fill(values_.begin(), values_.end(), T(0.0));
+}
+
+template <typename T>
+MatrixX<T> BranchInducedSparseMatrix<T>::MakeDenseMatrix() const {
+  const int n = size();
+  MatrixX<T> H = MatrixX<T>::Zero(n, n);
+  for (int i = 0; i < n; ++i) {
+    H(i, i) = (*this)(i, i);
+    for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+      H(i, j) = (*this)(i, j);
+      H(j, i) = H(i, j);
+    }
+  }
+  return H;
+}
+
+template <typename T>
+BranchInducedLtdlFactorization<T>::BranchInducedLtdlFactorization(
+    const BranchInducedSparseMatrix<T>& H) {
+  Factor(H);
+}
+
+template <typename T>
+void BranchInducedLtdlFactorization<T>::Factor(
+    const BranchInducedSparseMatrix<T>& H) {
+  // Copy assignment reuses the existing storage when sizes match.
+  factors_ = H;
+  BranchInducedSparseMatrix<T>& LD = factors_;
+
+  // This is the LTDL algorithm in Section 6.5 of [Featherstone 2008], with
+  // zero-based indexes and λ(i) = -1 for roots. Rows are processed from the
+  // tips of the forest inwards. When row k is reached its diagonal entry holds
+  // D(k), and the update only modifies entries (i, j) for i and j ancestors
+  // of k, which are stored entries.
+  for (int k = size() - 1; k >= 0; --k) {
+    const T& d = LD(k, k);
+    if constexpr (scalar_predicate<T>::is_bool) {
+      if (!(d > 0.0)) {
+        throw std::runtime_error(fmt::format(
+            "BranchInducedLtdlFactorization: the matrix is not positive "
+            "definite. Found pivot {} at index {}.",
+            ExtractDoubleOrThrow(d), k));
+      }
+    }
+    for (int i = LD.parent(k); i >= 0; i = LD.parent(i)) {
+      const T a = LD(k, i) / d;
+      for (int j = i; j >= 0; j = LD.parent(j)) {
+        LD(i, j) -= a * LD(k, j);
+      }
+      LD(k, i) = a;
+    }
+  }
+}
+
+template <typename T>
+void BranchInducedLtdlFactorization<T>::SolveInPlace(
+    EigenPtr<VectorX<T>> b) const {
+  DRAKE_DEMAND(b != nullptr);
+  DRAKE_DEMAND(b->size() == size());
+  const BranchInducedSparseMatrix<T>& LD = factors_;
+  auto& x = *b;
+  const int n = size();
+
+  // Solve Lᵀ⋅z = b. Since row i of Lᵀ only has non-zeros for i and its
+  // descendants, which have larger indexes, z(i) is final once all of its
+  // descendants have been processed.
+  for (int i = n - 1; i >= 0; --i) {
+    for (int j = LD.parent(i); j >= 0; j = LD.parent(j)) {
+      x(j) -= LD(i, j) * x(i);
+    }
+  }
+
+  // Solve D⋅y = z.
+  for (int i = 0; i < n; ++i) {
+    x(i) /= LD(i, i);
+  }
+
+  // Solve L⋅x = y, processing ancestors first.
+  for (int i = 0; i < n; ++i) {
+    for (int j = LD.parent(i); j >= 0; j = LD.parent(j)) {
+      x(i) -= LD(i, j) * x(j);
+    }
+  }
+}
+
+template <typename T>
+VectorX<T> BranchInducedLtdlFactorization<T>::Solve(
+    const Eigen::Ref<const VectorX<T>>& b) const {
+  VectorX<T> x = b;
+  SolveInPlace(&x);
+  return x;
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::BranchInducedSparseMatrix);
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::BranchInducedLtdlFactorization);
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace multibody {
+
+/// Stores a symmetric `n x n` matrix H whose sparsity pattern is induced by a
+/// forest of `n` nodes, such as the mass matrix of a multibody system.
+///
+/// Each index `i ∈ [0, n)` has a parent index `λ(i) < i`, or `λ(i) = -1` if
+/// `i` is a root. Index `j` is an _ancestor_ of `i` if it can be reached from
+/// `i` by repeatedly applying λ. Entry `H(i, j)` can only be non-zero if
+/// `i == j`, `j` is an ancestor of `i` or `i` is an ancestor of `j`; this is
+/// _branch-induced sparsity_, see Section 6.5 of [Featherstone 2008]. For a
+/// multibody system the indexes are generalized velocities: within a
+/// mobilizer each velocity is the parent of the next one, and the first
+/// velocity of a mobilizer has as parent the last velocity of the nearest
+/// inboard mobilizer with velocities. Therefore the mass matrix of a forest
+/// of independent trees is block diagonal, and within a tree only entries
+/// coupling a velocity with the velocities on its path to the root are
+/// non-zero.
+///
+/// Only the diagonal and the entries `H(i, j)` for `j` an ancestor of `i`
+/// (which lie in the lower triangle, since `λ(i) < i`) are stored, the
+/// remaining non-zeros are implied by symmetry. Row i is stored contiguously
+/// as `H(i, i), H(i, λ(i)), H(i, λ(λ(i))), ...` up to its root, so that
+/// storage is O(n⋅d) with d the depth of the forest, rather than O(n²).
+///
+/// See BranchInducedLtdlFactorization to solve linear systems with this
+/// matrix exploiting its sparsity.
+///
+/// - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+///   algorithms. Springer.
+///
+/// @tparam_default_scalar
+template <typename T>
+class BranchInducedSparseMatrix {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BranchInducedSparseMatrix);
+
+  /// Constructs an empty matrix of size zero.
+  BranchInducedSparseMatrix() = default;
+
+  /// Constructs a matrix with the sparsity pattern induced by `parents`,
+  /// where `parents[i]` is λ(i). All entries are initialized to zero.
+  /// @throws std::exception if `parents[i]` is not in `[-1, i)` for some i.
+  explicit BranchInducedSparseMatrix(std::vector<int> parents);
+
+  /// Returns the number of rows (and columns) n of this matrix.
+  int size() const { return static_cast<int>(parents_.size()); }
+
+  /// Returns the parent indexes λ that define the sparsity pattern.
+  const std::vector<int>& parents() const { return parents_; }
+
+  /// Returns λ(i), or -1 if i is a root.
+  int parent(int i) const {
+    DRAKE_ASSERT(0 <= i && i < size());
+    return parents_[i];
+  }
+
+  /// Returns the number of ancestors of i, which is zero for a root.
+  int depth(int i) const {
+    DRAKE_ASSERT(0 <= i && i < size());
+    return depths_[i];
+  }
+
+  /// Returns the number of stored entries, i.e. the number of structural
+  /// non-zeros in the lower triangle, including the diagonal.
+  int num_stored_entries() const { return static_cast<int>(values_.size()); }
+
+  /// Returns `true` if `j == i` or `j` is an ancestor of `i`, i.e. if entry
+  /// `H(i, j)` is stored.
+  bool IsStored(int i, int j) const;
+
+  /// Returns entry `H(i, j)`.
+  /// @pre `j == i` or `j` is an ancestor of `i`, see IsStored().
+  const T& operator()(int i, int j) const { return values_[Offset(i, j)]; }
+
+  /// Returns a mutable reference to entry `H(i, j)`.
+  /// @pre `j == i` or `j` is an ancestor of `i`, see IsStored().
+  T& operator()(int i, int j) { return values_[Offset(i, j)]; }
+
+  /// Sets all stored entries to zero.
+  void SetZero();
+
+  /// Returns the full, symmetric, dense `n x n` matrix H.
+  MatrixX<T> MakeDenseMatrix() const;
+
+ private:
+  // Returns the index in values_ of entry (i, j), where j is i or one of its
+  // ancestors.
+  int Offset(int i, int j) const {
+    DRAKE_ASSERT(IsStored(i, j));
+    return row_starts_[i] + depths_[i] - depths_[j];
+  }
+
+  std::vector<int> parents_;
+  std::vector<int> depths_;
+  // Row i occupies the range [row_starts_[i], row_starts_[i] + depths_[i]]
+  // of values_.
+  std::vector<int> row_starts_;
+  std::vector<T> values_;
+};
+
+/// Computes the sparse `H = Lᵀ⋅D⋅L` factorization of a symmetric positive
+/// definite BranchInducedSparseMatrix H, where L is unit lower triangular and
+/// D is diagonal, and uses it to solve linear systems `H⋅x = b`.
+///
+/// This is the LTDL factorization of Section 6.5 in [Featherstone 2008].
+/// Unlike the more common `L⋅D⋅Lᵀ` factorization, it causes no fill-in: L has
+/// exactly the sparsity pattern of the lower triangle of H. Both the
+/// factorization and the solves only visit stored entries, with costs
+/// O(n⋅d²) and O(n⋅d) respectively, where d is the depth of the forest.
+/// For a forest of many shallow trees this is far cheaper than the O(n³)
+/// dense factorization.
+///
+/// - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+///   algorithms. Springer.
+///
+/// @tparam_default_scalar
+template <typename T>
+class BranchInducedLtdlFactorization {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BranchInducedLtdlFactorization);
+
+  /// Constructs an empty factorization of a matrix of size zero.
+  BranchInducedLtdlFactorization() = default;
+
+  /// Constructs the factorization of H, see Factor().
+  explicit BranchInducedLtdlFactorization(
+      const BranchInducedSparseMatrix<T>& H);
+
+  /// Computes the factorization of H, replacing any previous one. Memory is
+  /// only reallocated if the number of stored entries of H differs from the
+  /// previously factored matrix.
+  /// @throws std::exception if H is found not to be positive definite. This
+  /// check is skipped for symbolic scalars.
+  void Factor(const BranchInducedSparseMatrix<T>& H);
+
+  /// Returns the size n of the factored matrix.
+  int size() const { return factors_.size(); }
+
+  /// Returns the factors L and D, stored in place of the lower triangle of
+  /// H: the diagonal holds D and the entries below it hold the strictly
+  /// lower part of L.
+  const BranchInducedSparseMatrix<T>& factors() const { return factors_; }
+
+  /// Solves `H⋅x = b` in place, overwriting `b` with `x`.
+  /// @pre b->size() == size().
+  void SolveInPlace(EigenPtr<VectorX<T>> b) const;
+
+  /// Returns the solution x to `H⋅x = b`.
+  /// @pre b.size() == size().
+  VectorX<T> Solve(const Eigen::Ref<const VectorX<T>>& b) const;
+
+ private:
+  BranchInducedSparseMatrix<T> factors_;
+};
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::BranchInducedSparseMatrix);
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::BranchInducedLtdlFactorization);
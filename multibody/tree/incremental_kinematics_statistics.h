@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+namespace drake {
+namespace multibody {
+
+/// Counters that measure the savings of incremental position kinematics, see
+/// MultibodyPlant::set_incremental_kinematics(). A context accumulates these
+/// counters over all evaluations of its position kinematics made while the
+/// incremental mode was enabled.
+struct IncrementalKinematicsStatistics {
+  /// Number of evaluations of the position kinematics.
+  int num_evaluations{0};
+
+  /// Number of evaluations that recomputed every mobilized body, either
+  /// because there were no previous results to reuse or because the
+  /// parameters of the model changed.
+  int num_full_updates{0};
+
+  /// Total number of mobilized bodies (excluding the world) whose kinematics
+  /// were recomputed, because its generalized positions or those of one of
+  /// its ancestors changed.
+  int64_t num_nodes_updated{0};
+
+  /// Total number of mobilized bodies (excluding the world) whose kinematics
+  /// were reused from the previous evaluation.
+  int64_t num_nodes_reused{0};
+};
+
+}  // namespace multibody
+}  // namespace drake
@@ -353,6 +353,26 @@ class Mobilizer : public MultibodyElement<T> {
   // Returns `true` if `this` uses a quaternion parametrization of rotations.
   virtual bool has_quaternion_dofs() const { return false; }
 
+  // For each generalized velocity m of this mobilizer, the m-th column of the
+  // hinge matrix H_FM, taken about Mo, is constant when expressed in some
+  // intermediate frame between F and M, which moves relative to F only due to
+  // other velocities of this same mobilizer (if any). This method returns
+  // `true` iff velocity `k` moves the intermediate frame of column `m`. For
+  // instance, for a floating mobilizer the angular velocity columns are axes
+  // fixed in F through Mo, and Mo moves with the translational velocities.
+  // This defines how the hinge matrix changes with the configuration, as
+  // needed by the analytical derivatives of the dynamics, see
+  // MultibodyTree::CalcInverseDynamicsDerivatives().
+  // The default implementation returns `false`, which is correct for
+  // mobilizers with a single velocity or whose hinge matrix columns, taken
+  // about Mo, are constant in F.
+  // @pre 0 <= m < num_velocities() and 0 <= k < num_velocities().
+  virtual bool hinge_column_moves_with_velocity(int m, int k) const {
+    DRAKE_ASSERT(0 <= m && m < num_velocities());
+    DRAKE_ASSERT(0 <= k && k < num_velocities());
+    return false;
+  }
+
   // Returns the topology information for this mobilizer. Users should not
   // need to call this method since MobilizerTopology is an internal
   // bookkeeping detail.
@@ -427,6 +447,17 @@ class Mobilizer : public MultibodyElement<T> {
   virtual math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const = 0;
 
+  // Computes the across-mobilizer transform `X_FM(q)` given this mobilizer's
+  // generalized positions `q` explicitly, rather than reading them from a
+  // Context. This allows MultibodyTree to evaluate kinematics for many
+  // configurations without writing each of them into a Context.
+  // Concrete mobilizers implement CalcAcrossMobilizerTransform() in terms of
+  // this method so that both produce identical results.
+  // @param[in] q
+  //   A pointer to the num_positions() contiguous generalized positions for
+  //   this mobilizer. It must not be nullptr unless num_positions() is zero.
+  virtual math::RigidTransform<T> calc_X_FM(const T* q) const = 0;
+
   // Computes the across-mobilizer spatial velocity `V_FM(q, v)` of the
   // outboard frame M in the inboard frame F.
   // This method can be thought of as the application of the operator `H_FM(q)`
@@ -51,6 +51,11 @@ class MobilizerImpl : public Mobilizer<T> {
 
   ~MobilizerImpl() override;
 
+  // Compile-time number of generalized positions and velocities, for code
+  // that is specialized on a concrete mobilizer type.
+  static constexpr int kNumPositions = compile_time_num_positions;
+  static constexpr int kNumVelocities = compile_time_num_velocities;
+
   // Returns the number of generalized coordinates granted by this mobilizer.
   int num_positions() const final { return kNq;}
 
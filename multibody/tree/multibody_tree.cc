@@ -1,11 +1,14 @@
 #include "drake/multibody/tree/multibody_tree.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <exception>
 #include <limits>
 #include <map>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -19,11 +22,14 @@
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/tree/body_node_world.h"
 #include "drake/multibody/tree/multibody_tree-inl.h"
+#include "drake/multibody/tree/prismatic_mobilizer.h"
 #include "drake/multibody/tree/quaternion_floating_joint.h"
 #include "drake/multibody/tree/quaternion_floating_mobilizer.h"
+#include "drake/multibody/tree/revolute_mobilizer.h"
 #include "drake/multibody/tree/rigid_body.h"
 #include "drake/multibody/tree/spatial_inertia.h"
 #include "drake/multibody/tree/uniform_gravity_field_element.h"
+#include "drake/multibody/tree/weld_mobilizer.h"
 
 namespace drake {
 namespace multibody {
@@ -840,6 +846,31 @@ void MultibodyTree<T>::FinalizeInternals() {
     body_node_levels_[node_topology.level].push_back(mobod_index);
   }
 
+  // Since velocities are numbered in increasing MobodIndex order and a node's
+  // parent has a smaller MobodIndex, the parent of each velocity has a
+  // smaller index, as required by BranchInducedSparseMatrix.
+  velocity_parents_.assign(topology_.num_velocities(), -1);
+  for (MobodIndex mobod_index(1); mobod_index < topology_.num_mobods();
+       ++mobod_index) {
+    const BodyNodeTopology& node = topology_.get_body_node(mobod_index);
+    // Find the nearest inboard node with velocities, skipping welds. The
+    // world has no velocities and no parent.
+    int inboard_velocity = -1;
+    for (MobodIndex ancestor = node.parent_body_node; ancestor.is_valid();
+         ancestor = topology_.get_body_node(ancestor).parent_body_node) {
+      const BodyNodeTopology& ancestor_node = topology_.get_body_node(ancestor);
+      if (ancestor_node.num_mobilizer_velocities > 0) {
+        inboard_velocity = ancestor_node.mobilizer_velocities_start_in_v +
+                           ancestor_node.num_mobilizer_velocities - 1;
+        break;
+      }
+    }
+    for (int k = 0; k < node.num_mobilizer_velocities; ++k) {
+      const int v = node.mobilizer_velocities_start_in_v + k;
+      velocity_parents_[v] = k == 0 ? inboard_velocity : v - 1;
+    }
+  }
+
   // Creates BodyNodes:
   // This recursion order ensures that a BodyNode's parent is created before the
   // node itself, since BodyNode objects are in Depth First Traversal order.
@@ -848,6 +879,26 @@ void MultibodyTree<T>::FinalizeInternals() {
     CreateBodyNode(mobod_index);
   }
 
+  // Select a kinematics kernel for each node. The world has no mobilizer.
+  mobilizer_kernels_.assign(topology_.num_mobods(), MobilizerKernel::kGeneric);
+  for (MobodIndex mobod_index(1); mobod_index < topology_.num_mobods();
+       ++mobod_index) {
+    const Mobilizer<T>* mobilizer = &body_nodes_[mobod_index]->get_mobilizer();
+    MobilizerKernel& kernel = mobilizer_kernels_[mobod_index];
+    if (dynamic_cast<const WeldMobilizer<T>*>(mobilizer) != nullptr) {
+      kernel = MobilizerKernel::kWeld;
+    } else if (dynamic_cast<const RevoluteMobilizer<T>*>(mobilizer) !=
+               nullptr) {
+      kernel = MobilizerKernel::kRevolute;
+    } else if (dynamic_cast<const PrismaticMobilizer<T>*>(mobilizer) !=
+               nullptr) {
+      kernel = MobilizerKernel::kPrismatic;
+    } else if (dynamic_cast<const QuaternionFloatingMobilizer<T>*>(
+                   mobilizer) != nullptr) {
+      kernel = MobilizerKernel::kQuaternionFloating;
+    }
+  }
+
   FinalizeModelInstances();
 
   // For all floating bodies, route their future default poses queries through
@@ -1163,6 +1214,38 @@ void MultibodyTree<T>::CalcAllBodyPosesInWorld(
   }
 }
 
+// Note that the result is indexed by BodyIndex, not MobodIndex.
+template <typename T>
+void MultibodyTree<T>::CalcBodyPosesInWorldBatch(
+    const systems::Context<T>& context,
+    const Eigen::Ref<const MatrixX<T>>& q,
+    BodyPosesBatch<T>* X_WB_batch) const {
+  DRAKE_THROW_UNLESS(X_WB_batch != nullptr);
+  DRAKE_THROW_UNLESS(q.rows() == num_positions());
+  X_WB_batch->Resize(num_bodies(), q.cols());
+
+  // The world's pose is the identity for every configuration. It is set
+  // explicitly since Resize() leaves values untouched when sizes match.
+  auto& R_WW = X_WB_batch->get_mutable_rotations(world_index());
+  R_WW.setZero();
+  R_WW.col(0).setOnes();
+  R_WW.col(4).setOnes();
+  R_WW.col(8).setOnes();
+  X_WB_batch->get_mutable_translations(world_index()).setZero();
+
+  // Base-to-tip recursion, in lockstep for all configurations. Since the
+  // generalized positions are taken from `q`, the state in `context` is
+  // neither read nor written and no cache entry is invalidated.
+  // This skips the world, level = 0.
+  for (int level = 1; level < tree_height(); ++level) {
+    for (MobodIndex mobod_index : body_node_levels_[level]) {
+      const BodyNode<T>& node = *body_nodes_[mobod_index];
+      DRAKE_ASSERT(node.get_topology().level == level);
+      node.CalcBodyPosesInWorldBatch_BaseToTip(context, q, X_WB_batch);
+    }
+  }
+}
+
 // Note that the result is indexed by BodyIndex, not MobodIndex.
 template <typename T>
 void MultibodyTree<T>::CalcAllBodySpatialVelocitiesInWorld(
@@ -1179,25 +1262,160 @@ void MultibodyTree<T>::CalcAllBodySpatialVelocitiesInWorld(
   }
 }
 
+template <typename T>
+template <typename Calc>
+void MultibodyTree<T>::ForEachBodyNodeInLevel(int level,
+                                              const Calc& calc) const {
+  const std::vector<MobodIndex>& level_nodes = body_node_levels_[level];
+  const int num_nodes = ssize(level_nodes);
+  const int num_threads = std::min(parallelism_.num_threads(), num_nodes);
+  if constexpr (std::is_same_v<T, double>) {
+    if (num_threads > 1) {
+      // Exceptions must not escape the parallel region. We keep the first one
+      // caught and rethrow it once all nodes were processed.
+      std::exception_ptr error;
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads)
+#endif
+      for (int i = 0; i < num_nodes; ++i) {
+        try {
+          calc(level_nodes[i]);
+        } catch (...) {
+#if defined(_OPENMP)
+#pragma omp critical(MultibodyTree_ForEachBodyNodeInLevel)
+#endif
+          if (!error) error = std::current_exception();
+        }
+      }
+      if (error) std::rethrow_exception(error);
+      return;
+    }
+  }
+  for (MobodIndex mobod_index : level_nodes) {
+    calc(mobod_index);
+  }
+}
+
+template <typename T>
+template <typename Calc>
+bool MultibodyTree<T>::CallWithConcreteMobilizer(MobodIndex mobod_index,
+                                                 Calc&& calc) const {
+  const Mobilizer<T>& mobilizer = body_nodes_[mobod_index]->get_mobilizer();
+  // The downcasts were verified at Finalize().
+  switch (mobilizer_kernels_[mobod_index]) {
+    case MobilizerKernel::kGeneric:
+      return false;
+    case MobilizerKernel::kWeld:
+      calc(static_cast<const WeldMobilizer<T>&>(mobilizer));
+      return true;
+    case MobilizerKernel::kRevolute:
+      calc(static_cast<const RevoluteMobilizer<T>&>(mobilizer));
+      return true;
+    case MobilizerKernel::kPrismatic:
+      calc(static_cast<const PrismaticMobilizer<T>&>(mobilizer));
+      return true;
+    case MobilizerKernel::kQuaternionFloating:
+      calc(static_cast<const QuaternionFloatingMobilizer<T>&>(mobilizer));
+      return true;
+  }
+  DRAKE_UNREACHABLE();
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcPositionKinematicsCache(
     const systems::Context<T>& context,
     PositionKinematicsCache<T>* pc) const {
   DRAKE_DEMAND(pc != nullptr);
+  const T* qv = get_positions_and_velocities(context).data();
+
+  // In incremental mode (see set_incremental_kinematics()) a node is only
+  // updated if its mobilizer positions, or those of an ancestor, changed since
+  // the last evaluation. Changes in any numeric parameter, such as the pose of
+  // a fixed offset frame, require updating all nodes.
+  auto& incremental = pc->get_mutable_incremental_data();
+  bool is_incremental = false;
+  bool update_all = true;
+  if constexpr (std::is_same_v<T, double>) {
+    is_incremental = incremental_kinematics_;
+    if (is_incremental) {
+      int num_parameters = 0;
+      for (int i = 0; i < context.num_numeric_parameter_groups(); ++i) {
+        num_parameters += context.get_numeric_parameter(i).size();
+      }
+      bool parameters_changed = !incremental.is_valid ||
+                                incremental.parameters.size() != num_parameters;
+      incremental.parameters.resize(num_parameters);
+      int offset = 0;
+      for (int i = 0; i < context.num_numeric_parameter_groups(); ++i) {
+        const auto& parameters = context.get_numeric_parameter(i).value();
+        auto stored = incremental.parameters.segment(offset, parameters.size());
+        if (parameters_changed || stored != parameters) {
+          parameters_changed = true;
+          stored = parameters;
+        }
+        offset += parameters.size();
+      }
+      update_all = parameters_changed;
+      incremental.is_node_updated.assign(topology_.num_mobods(), 0);
+    } else {
+      // The cache contents will no longer correspond to the stored inputs.
+      incremental.is_valid = false;
+    }
+  }
 
   // With the kinematics information across mobilizers and the kinematics
   // information for each body, we are now in position to perform a base-to-tip
   // recursion to update world positions and parent to child body transforms.
   // This skips the world, level = 0.
   for (int level = 1; level < tree_height(); ++level) {
-    for (MobodIndex mobod_index : body_node_levels_[level]) {
+    ForEachBodyNodeInLevel(level, [&](MobodIndex mobod_index) {
       const BodyNode<T>& node = *body_nodes_[mobod_index];
 
       DRAKE_ASSERT(node.get_topology().level == level);
       DRAKE_ASSERT(node.index() == mobod_index);
 
-      // Update per-node kinematics.
-      node.CalcPositionKinematicsCache_BaseToTip(context, pc);
+      if constexpr (std::is_same_v<T, double>) {
+        if (is_incremental) {
+          const BodyNodeTopology& topology = node.get_topology();
+          bool changed =
+              update_all ||
+              incremental.is_node_updated[topology.parent_body_node] != 0;
+          for (int i = topology.mobilizer_positions_start;
+               !changed && i < topology.mobilizer_positions_start +
+                                   topology.num_mobilizer_positions;
+               ++i) {
+            changed = qv[i] != incremental.q[i];
+          }
+          if (!changed) return;
+          incremental.is_node_updated[mobod_index] = 1;
+        }
+      }
+
+      // Update per-node kinematics, with a kernel specialized on the
+      // mobilizer type when available.
+      const bool specialized =
+          CallWithConcreteMobilizer(mobod_index, [&](const auto& mobilizer) {
+            node.CalcPositionKinematicsCache_BaseToTip(context, mobilizer, qv,
+                                                       pc);
+          });
+      if (!specialized) node.CalcPositionKinematicsCache_BaseToTip(context, pc);
+    });
+  }
+
+  if constexpr (std::is_same_v<T, double>) {
+    if (is_incremental) {
+      incremental.q = get_positions(context);
+      incremental.is_valid = true;
+      int num_nodes_updated = 0;
+      for (uint8_t is_updated : incremental.is_node_updated) {
+        num_nodes_updated += is_updated;
+      }
+      IncrementalKinematicsStatistics& statistics = incremental.statistics;
+      ++statistics.num_evaluations;
+      if (update_all) ++statistics.num_full_updates;
+      statistics.num_nodes_updated += num_nodes_updated;
+      statistics.num_nodes_reused +=
+          topology_.num_mobods() - 1 - num_nodes_updated;
     }
   }
 }
@@ -1218,16 +1436,25 @@ void MultibodyTree<T>::CalcVelocityKinematicsCache(
 
   const std::vector<Vector6<T>>& H_PB_W_cache =
       EvalAcrossNodeJacobianWrtVExpressedInWorld(context);
+  const T* qv = get_positions_and_velocities(context).data();
 
   // Performs a base-to-tip recursion computing body velocities.
   // This skips the world, level = 0.
   for (int level = 1; level < tree_height(); ++level) {
-    for (MobodIndex mobod_index : body_node_levels_[level]) {
+    ForEachBodyNodeInLevel(level, [&](MobodIndex mobod_index) {
       const BodyNode<T>& node = *body_nodes_[mobod_index];
 
       DRAKE_ASSERT(node.get_topology().level == level);
       DRAKE_ASSERT(node.index() == mobod_index);
 
+      // Use a kernel specialized on the mobilizer type when available.
+      if (CallWithConcreteMobilizer(mobod_index, [&](const auto& mobilizer) {
+            node.CalcVelocityKinematicsCache_BaseToTip(mobilizer, qv, pc,
+                                                       H_PB_W_cache, vc);
+          })) {
+        return;
+      }
+
       // Hinge matrix for this node. H_PB_W ∈ ℝ⁶ˣⁿᵐ with nm ∈ [0; 6] the
       // number of mobilities for this node. Therefore, the return is a
       // MatrixUpTo6 since the number of columns generally changes with the
@@ -1239,7 +1466,7 @@ void MultibodyTree<T>::CalcVelocityKinematicsCache(
 
       // Update per-node kinematics.
       node.CalcVelocityKinematicsCache_BaseToTip(context, pc, H_PB_W, vc);
-    }
+    });
   }
 }
 
@@ -1559,14 +1786,6 @@ void MultibodyTree<T>::CalcInverseDynamics(
   CalcSpatialAccelerationsFromVdot(context, known_vdot, ignore_velocities,
                                    A_WB_array);
 
-  // Vector of generalized forces per mobilizer.
-  // It has zero size if no forces are applied.
-  VectorUpTo6<T> tau_applied_mobilizer(0);
-
-  // Spatial force applied on B at Bo.
-  // It is left initialized to zero if no forces are applied.
-  SpatialForce<T> Fapplied_Bo_W = SpatialForce<T>::Zero();
-
   const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
 
   const VectorX<T>& reflected_inertia = EvalReflectedInertiaCache(context);
@@ -1585,12 +1804,20 @@ void MultibodyTree<T>::CalcInverseDynamics(
   // F_BMo_W_array[world_mobod_index()] contains the total force of the bodies
   // connected to the world by a mobilizer.
   for (int level = tree_height() - 1; level >= 0; --level) {
-    for (MobodIndex mobod_index : body_node_levels_[level]) {
+    ForEachBodyNodeInLevel(level, [&](MobodIndex mobod_index) {
       const BodyNode<T>& node = *body_nodes_[mobod_index];
 
       DRAKE_ASSERT(node.get_topology().level == level);
       DRAKE_ASSERT(node.index() == mobod_index);
 
+      // Vector of generalized forces per mobilizer.
+      // It has zero size if no forces are applied.
+      VectorUpTo6<T> tau_applied_mobilizer(0);
+
+      // Spatial force applied on B at Bo.
+      // It is left initialized to zero if no forces are applied.
+      SpatialForce<T> Fapplied_Bo_W = SpatialForce<T>::Zero();
+
       // Make a copy to the total applied forces since the call to
       // CalcInverseDynamics_TipToBase() below could overwrite the entry for the
       // current body node if the input applied forces arrays are the same
@@ -1613,7 +1840,7 @@ void MultibodyTree<T>::CalcInverseDynamics(
           context, pc, spatial_inertia_in_world_cache, dynamic_bias_cache,
           *A_WB_array, Fapplied_Bo_W, tau_applied_mobilizer, F_BMo_W_array,
           tau_array);
-    }
+    });
   }
 
   // Add the effect of reflected inertias.
@@ -1623,6 +1850,268 @@ void MultibodyTree<T>::CalcInverseDynamics(
   }
 }
 
+namespace {
+
+// Helpers for CalcInverseDynamicsDerivatives(), which uses spatial vectors
+// taken about the world origin Wo and expressed in the world frame W, i.e.
+// Plücker coordinates. These are stored as 6-vectors with the rotational
+// components first, as elsewhere in Drake.
+
+// Returns the spatial motion cross product v ×ₘ m.
+template <typename T>
+Vector6<T> CrossMotion(const Vector6<T>& v, const Vector6<T>& m) {
+  Vector6<T> result;
+  result.template head<3>() =
+      v.template head<3>().cross(m.template head<3>());
+  result.template tail<3>() =
+      v.template head<3>().cross(m.template tail<3>()) +
+      v.template tail<3>().cross(m.template head<3>());
+  return result;
+}
+
+// Returns the spatial force cross product v ×f f.
+template <typename T>
+Vector6<T> CrossForce(const Vector6<T>& v, const Vector6<T>& f) {
+  Vector6<T> result;
+  result.template head<3>() =
+      v.template head<3>().cross(f.template head<3>()) +
+      v.template tail<3>().cross(f.template tail<3>());
+  result.template tail<3>() =
+      v.template head<3>().cross(f.template tail<3>());
+  return result;
+}
+
+// Shifts a spatial vector from point Bo to the world origin Wo, given the
+// position p_WoBo_W of Bo. For motion vectors the translational component is
+// the velocity of the point of the body instantaneously at Wo.
+template <typename T>
+Vector6<T> ShiftMotionToWorldOrigin(const Vector6<T>& V_Bo,
+                                    const Vector3<T>& p_WoBo_W) {
+  Vector6<T> V_Wo = V_Bo;
+  V_Wo.template tail<3>() -= V_Bo.template head<3>().cross(p_WoBo_W);
+  return V_Wo;
+}
+
+template <typename T>
+Vector6<T> ShiftForceToWorldOrigin(const Vector6<T>& F_Bo,
+                                   const Vector3<T>& p_WoBo_W) {
+  Vector6<T> F_Wo = F_Bo;
+  F_Wo.template head<3>() += p_WoBo_W.cross(F_Bo.template tail<3>());
+  return F_Wo;
+}
+
+}  // namespace
+
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamicsDerivatives(
+    const systems::Context<T>& context, const VectorX<T>& known_vdot,
+    const MultibodyForces<T>& external_forces, EigenPtr<MatrixX<T>> dtau_dqt,
+    EigenPtr<MatrixX<T>> dtau_dv) const {
+  const int nv = num_velocities();
+  const int num_mobods = topology_.num_mobods();
+  DRAKE_DEMAND(known_vdot.size() == nv);
+  DRAKE_DEMAND(external_forces.CheckHasRightSizeForModel(*this));
+  DRAKE_DEMAND(dtau_dqt != nullptr);
+  DRAKE_DEMAND(dtau_dqt->rows() == nv && dtau_dqt->cols() == nv);
+  DRAKE_DEMAND(dtau_dv != nullptr);
+  DRAKE_DEMAND(dtau_dv->rows() == nv && dtau_dv->cols() == nv);
+
+  // We differentiate the Newton-Euler recursion written in Plücker
+  // coordinates about Wo [Featherstone 2008, §5.3], where the spatial inertia
+  // I_B and the hinge matrix columns Hₘ change with the configuration only
+  // through rigid motions of the bodies:
+  //   V_B = V_P + ∑ₘ Hₘ vₘ
+  //   A_B = A_P + ∑ₘ (Hₘ v̇ₘ + Ḣₘ vₘ),  Ḣₘ = Cₘ ×ₘ Hₘ
+  //   f_B = I_B A_B + V_B ×f (I_B V_B) - Fapp_B
+  //   F_B = f_B + ∑ F_child,  τₘ = Hₘᵀ F_B
+  // where m ranges over the velocities of B's mobilizer, P is B's parent and
+  // Cₘ = V_P + ∑ⱼ Hⱼ vⱼ is the velocity of the intermediate frame in which
+  // Hₘ is constant, with j ranging over the velocities of B's mobilizer that
+  // move Hₘ. In this form, a perturbation δₖ of the configuration along
+  // velocity k displaces every body B in the subtree of k's mobilizer with
+  // the rigid motion Hₖ. Therefore their inertias change as
+  //   ∂I_B/∂δₖ⋅x = Hₖ ×f (I_B x) - I_B (Hₖ ×ₘ x),
+  // and the hinge matrix columns they carry as ∂Hₘ/∂δₖ = Hₖ ×ₘ Hₘ.
+  //
+  // - [Featherstone 2008] Featherstone, R., 2008. Rigid body dynamics
+  //                       algorithms. Springer.
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const std::vector<SpatialInertia<T>>& M_B_W_cache =
+      EvalSpatialInertiaInWorldCache(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      EvalAcrossNodeJacobianWrtVExpressedInWorld(context);
+  const Eigen::VectorBlock<const VectorX<T>> v = get_velocities(context);
+  const std::vector<SpatialForce<T>>& Fapp_Bo_W_array =
+      external_forces.body_forces();
+
+  // Per velocity data: the mobilized body it belongs to, the hinge matrix
+  // column H, its time derivative Hdot and the velocity C of the frame in
+  // which it is constant.
+  std::vector<MobodIndex> velocity_mobod(nv);
+  std::vector<Vector6<T>> H(nv);
+  std::vector<Vector6<T>> Hdot(nv);
+  std::vector<Vector6<T>> C(nv);
+  // Per body data, indexed by MobodIndex.
+  std::vector<Vector3<T>> p_WoBo_W(num_mobods, Vector3<T>::Zero());
+  std::vector<Matrix6<T>> I(num_mobods, Matrix6<T>::Zero());
+  std::vector<Vector6<T>> V(num_mobods, Vector6<T>::Zero());
+  std::vector<Vector6<T>> A(num_mobods, Vector6<T>::Zero());
+  std::vector<Vector6<T>> Fapp(num_mobods, Vector6<T>::Zero());
+  std::vector<Vector6<T>> F(num_mobods, Vector6<T>::Zero());
+
+  // Returns true if velocity k (of mobilized body B) moves the hinge matrix
+  // column of velocity m of the same body.
+  auto moves = [this, &velocity_mobod](int m, int k) {
+    const BodyNode<T>& node = *body_nodes_[velocity_mobod[m]];
+    const int start = node.velocity_start_in_v();
+    return node.get_mobilizer().hinge_column_moves_with_velocity(m - start,
+                                                                 k - start);
+  };
+
+  // Forward sweep. Since a node's parent has a smaller MobodIndex, visiting
+  // nodes in MobodIndex order is a valid base to tip recursion.
+  for (MobodIndex b(1); b < num_mobods; ++b) {
+    const BodyNode<T>& node = *body_nodes_[b];
+    const MobodIndex p = node.parent_body_node()->index();
+    const int start = node.velocity_start_in_v();
+    const int num_node_velocities = node.get_num_mobilizer_velocities();
+    p_WoBo_W[b] = pc.get_X_WB(b).translation();
+    I[b] = M_B_W_cache[b].Shift(-p_WoBo_W[b]).CopyToFullMatrix6();
+    if (!Fapp_Bo_W_array.empty()) {
+      Fapp[b] =
+          ShiftForceToWorldOrigin(Fapp_Bo_W_array[b].get_coeffs(), p_WoBo_W[b]);
+    }
+    V[b] = V[p];
+    A[b] = A[p];
+    for (int m = start; m < start + num_node_velocities; ++m) {
+      velocity_mobod[m] = b;
+      H[m] = ShiftMotionToWorldOrigin(H_PB_W_cache[m], p_WoBo_W[b]);
+    }
+    for (int m = start; m < start + num_node_velocities; ++m) {
+      C[m] = V[p];
+      for (int j = start; j < start + num_node_velocities; ++j) {
+        if (moves(m, j)) C[m] += H[j] * v(j);
+      }
+      Hdot[m] = CrossMotion(C[m], H[m]);
+      V[b] += H[m] * v(m);
+      A[b] += H[m] * known_vdot(m) + Hdot[m] * v(m);
+    }
+  }
+
+  // Backward sweep for the total spatial forces F_B.
+  for (MobodIndex b(num_mobods - 1); b > 0; --b) {
+    const Vector6<T> IV = I[b] * V[b];
+    F[b] += I[b] * A[b] + CrossForce(V[b], IV) - Fapp[b];
+    const MobodIndex p = body_nodes_[b]->parent_body_node()->index();
+    F[p] += F[b];
+  }
+
+  // Derivatives with respect to δₖ (tangent configuration directions) and
+  // vₖ. Only bodies in the subtree of k's mobilizer are affected in the
+  // forward sweep, and only those and their ancestors in the backward sweep.
+  std::vector<Vector6<T>> dH(nv);
+  std::vector<Vector6<T>> dV(num_mobods);
+  std::vector<Vector6<T>> dA(num_mobods);
+  std::vector<Vector6<T>> dF(num_mobods);
+  std::vector<bool> in_subtree(num_mobods);
+  for (int k = 0; k < nv; ++k) {
+    const MobodIndex mobod_k = velocity_mobod[k];
+    for (MobodIndex b(0); b < num_mobods; ++b) {
+      in_subtree[b] =
+          b == mobod_k ||
+          (b > mobod_k && in_subtree[body_nodes_[b]->parent_body_node()
+                                         ->index()]);
+    }
+
+    // Derivatives with respect to δₖ.
+    std::fill(dV.begin(), dV.end(), Vector6<T>::Zero());
+    std::fill(dA.begin(), dA.end(), Vector6<T>::Zero());
+    std::fill(dF.begin(), dF.end(), Vector6<T>::Zero());
+    std::fill(dH.begin(), dH.end(), Vector6<T>::Zero());
+    for (MobodIndex b = mobod_k; b < num_mobods; ++b) {
+      if (!in_subtree[b]) continue;
+      const BodyNode<T>& node = *body_nodes_[b];
+      const MobodIndex p = node.parent_body_node()->index();
+      const int start = node.velocity_start_in_v();
+      const int num_node_velocities = node.get_num_mobilizer_velocities();
+      for (int m = start; m < start + num_node_velocities; ++m) {
+        if (b != mobod_k || moves(m, k)) dH[m] = CrossMotion(H[k], H[m]);
+      }
+      dV[b] = dV[p];
+      dA[b] = dA[p];
+      for (int m = start; m < start + num_node_velocities; ++m) {
+        Vector6<T> dC = dV[p];
+        for (int j = start; j < start + num_node_velocities; ++j) {
+          if (moves(m, j)) dC += dH[j] * v(j);
+        }
+        const Vector6<T> dHdot =
+            CrossMotion(dC, H[m]) + CrossMotion(C[m], dH[m]);
+        dV[b] += dH[m] * v(m);
+        dA[b] += dH[m] * known_vdot(m) + dHdot * v(m);
+      }
+      // The derivative of I_B⋅x, for x = A_B and x = V_B.
+      auto dI_times = [&](const Vector6<T>& x) -> Vector6<T> {
+        const Vector6<T> Ix = I[b] * x;
+        return CrossForce(H[k], Ix) - I[b] * CrossMotion(H[k], x);
+      };
+      const Vector6<T> IV = I[b] * V[b];
+      const Vector6<T> dIV = dI_times(V[b]) + I[b] * dV[b];
+      dF[b] = dI_times(A[b]) + I[b] * dA[b] + CrossForce(dV[b], IV) +
+              CrossForce(V[b], dIV);
+      // Applied forces keep their world components, but their point of
+      // application Bo moves with velocity v_WBo = Hₖ(Wo) + ω × p_WoBo.
+      const Vector3<T> dp_WoBo_W =
+          H[k].template tail<3>() +
+          H[k].template head<3>().cross(p_WoBo_W[b]);
+      dF[b].template head<3>() -=
+          dp_WoBo_W.cross(Fapp[b].template tail<3>());
+    }
+    for (MobodIndex b(num_mobods - 1); b > 0; --b) {
+      const MobodIndex p = body_nodes_[b]->parent_body_node()->index();
+      dF[p] += dF[b];
+    }
+    for (int m = 0; m < nv; ++m) {
+      const MobodIndex b = velocity_mobod[m];
+      (*dtau_dqt)(m, k) = dH[m].dot(F[b]) + H[m].dot(dF[b]);
+    }
+
+    // Derivatives with respect to vₖ.
+    std::fill(dV.begin(), dV.end(), Vector6<T>::Zero());
+    std::fill(dA.begin(), dA.end(), Vector6<T>::Zero());
+    std::fill(dF.begin(), dF.end(), Vector6<T>::Zero());
+    for (MobodIndex b = mobod_k; b < num_mobods; ++b) {
+      if (!in_subtree[b]) continue;
+      const BodyNode<T>& node = *body_nodes_[b];
+      const MobodIndex p = node.parent_body_node()->index();
+      const int start = node.velocity_start_in_v();
+      const int num_node_velocities = node.get_num_mobilizer_velocities();
+      dV[b] = dV[p];
+      dA[b] = dA[p];
+      for (int m = start; m < start + num_node_velocities; ++m) {
+        Vector6<T> dC = dV[p];
+        if (b == mobod_k && moves(m, k)) dC += H[k];
+        dA[b] += CrossMotion(dC, H[m]) * v(m);
+      }
+      if (b == mobod_k) {
+        dV[b] += H[k];
+        dA[b] += Hdot[k];
+      }
+      const Vector6<T> IV = I[b] * V[b];
+      const Vector6<T> IdV = I[b] * dV[b];
+      dF[b] = I[b] * dA[b] + CrossForce(dV[b], IV) + CrossForce(V[b], IdV);
+    }
+    for (MobodIndex b(num_mobods - 1); b > 0; --b) {
+      const MobodIndex p = body_nodes_[b]->parent_body_node()->index();
+      dF[p] += dF[b];
+    }
+    for (int m = 0; m < nv; ++m) {
+      (*dtau_dv)(m, k) = H[m].dot(dF[velocity_mobod[m]]);
+    }
+  }
+  // Reflected inertias contribute Iᵣ⋅v̇ to τ, which depends on neither q nor
+  // v, and generalized applied forces are held fixed.
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcForceElementsContribution(
     const systems::Context<T>& context,
@@ -1798,12 +2287,9 @@ void MultibodyTree<T>::CalcMassMatrixViaInverseDynamics(
 }
 
 template <typename T>
-void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
-                                      EigenPtr<MatrixX<T>> M) const {
-  DRAKE_DEMAND(M != nullptr);
-  DRAKE_DEMAND(M->rows() == num_velocities());
-  DRAKE_DEMAND(M->cols() == num_velocities());
-
+template <typename AddBlock>
+void MultibodyTree<T>::CalcMassMatrixBlocks(const systems::Context<T>& context,
+                                            const AddBlock& add_block) const {
   // This method implements algorithm 9.3 in [Jain 2010]. We use slightly
   // different notation conventions:
   // - Rigid shift operators A and Φ are implemented in SpatialInertia::Shift()
@@ -1827,13 +2313,6 @@ void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
       EvalCompositeBodyInertiaInWorldCache(context);
   const std::vector<Vector6<T>>& H_PB_W_cache =
       EvalAcrossNodeJacobianWrtVExpressedInWorld(context);
-  const VectorX<T>& reflected_inertia = EvalReflectedInertiaCache(context);
-
-  // The algorithm below does not recurse zero entries and therefore these must
-  // be set a priori.
-  // In addition, we initialize diagonal entries to include the effect of rotor
-  // reflected inertia. See JointActuator::reflected_inertia().
-  (*M) = reflected_inertia.asDiagonal();
 
   // Perform tip-to-base recursion for each composite body, skipping the world.
   for (int level = tree_height() - 1; level > 0; --level) {
@@ -1879,8 +2358,8 @@ void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
       const int composite_start_in_v = composite_node.velocity_start_in_v();
 
       // Diagonal block corresponding to current node (mobod_index).
-      M->block(composite_start_in_v, composite_start_in_v, cnv, cnv) +=
-          H_CpC_W.transpose() * Fm_CCo_W;
+      add_block(composite_start_in_v, composite_start_in_v,
+                H_CpC_W.transpose() * Fm_CCo_W);
 
       // We recurse the tree inwards from C all the way to the root. We define
       // the frames:
@@ -1909,14 +2388,10 @@ void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
           const Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
               body_node->GetJacobianFromArray(H_PB_W_cache);
 
-          // Compute the corresponding bnv x cnv block.
-          const MatrixUpTo6<T> HtFm = H_PB_W.transpose() * Fm_CBo_W;
+          // Compute the corresponding cnv x bnv block.
           const int body_start_in_v = body_node->velocity_start_in_v();
-          M->block(body_start_in_v, composite_start_in_v, bnv, cnv) += HtFm;
-
-          // And copy to its symmetric block.
-          M->block(composite_start_in_v, body_start_in_v, cnv, bnv) +=
-              HtFm.transpose();
+          add_block(composite_start_in_v, body_start_in_v,
+                    Fm_CBo_W.transpose() * H_PB_W);
         }
 
         child_node = body_node;                      // Update child node Bc.
@@ -1926,6 +2401,60 @@ void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
+                                      EigenPtr<MatrixX<T>> M) const {
+  DRAKE_DEMAND(M != nullptr);
+  DRAKE_DEMAND(M->rows() == num_velocities());
+  DRAKE_DEMAND(M->cols() == num_velocities());
+
+  // The algorithm below does not recurse zero entries and therefore these must
+  // be set a priori.
+  // In addition, we initialize diagonal entries to include the effect of rotor
+  // reflected inertia. See JointActuator::reflected_inertia().
+  (*M) = EvalReflectedInertiaCache(context).asDiagonal();
+
+  CalcMassMatrixBlocks(context, [M](int C_start_in_v, int B_start_in_v,
+                                    const MatrixUpTo6<T>& M_CB) {
+    M->block(C_start_in_v, B_start_in_v, M_CB.rows(), M_CB.cols()) += M_CB;
+    // Copy to its symmetric block, unless on the diagonal.
+    if (C_start_in_v != B_start_in_v) {
+      M->block(B_start_in_v, C_start_in_v, M_CB.cols(), M_CB.rows()) +=
+          M_CB.transpose();
+    }
+  });
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcBranchInducedMassMatrix(
+    const systems::Context<T>& context,
+    BranchInducedSparseMatrix<T>* M) const {
+  DRAKE_DEMAND(M != nullptr);
+  if (M->parents() != velocity_parents_) {
+    *M = BranchInducedSparseMatrix<T>(velocity_parents_);
+  } else {
+    M->SetZero();
+  }
+
+  const VectorX<T>& reflected_inertia = EvalReflectedInertiaCache(context);
+  for (int i = 0; i < num_velocities(); ++i) {
+    (*M)(i, i) = reflected_inertia(i);
+  }
+
+  CalcMassMatrixBlocks(context, [M](int C_start_in_v, int B_start_in_v,
+                                    const MatrixUpTo6<T>& M_CB) {
+    // Only the lower triangle of the diagonal blocks is stored. Within a
+    // mobilizer, velocity i is an ancestor of velocity k iff i < k.
+    const bool is_diagonal = C_start_in_v == B_start_in_v;
+    for (int c = 0; c < M_CB.rows(); ++c) {
+      const int b_end = is_diagonal ? c + 1 : M_CB.cols();
+      for (int b = 0; b < b_end; ++b) {
+        (*M)(C_start_in_v + c, B_start_in_v + b) += M_CB(c, b);
+      }
+    }
+  });
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcBiasTerm(
     const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const {
@@ -3007,6 +3536,145 @@ void MultibodyTree<T>::CalcJacobianTranslationalVelocity(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcJacobiansSpatialVelocity(
+    const systems::Context<T>& context,
+    const JacobianWrtVariable with_respect_to,
+    const std::vector<const Frame<T>*>& frames_B,
+    const std::vector<Matrix3X<T>>& p_BoBi_B_list,
+    const Frame<T>& frame_A,
+    const Frame<T>& frame_E,
+    std::vector<MatrixX<T>>* Js_V_ABi_E_list) const {
+  DRAKE_THROW_UNLESS(Js_V_ABi_E_list != nullptr);
+  DRAKE_THROW_UNLESS(p_BoBi_B_list.size() == frames_B.size());
+  const bool is_wrt_qdot = (with_respect_to == JacobianWrtVariable::kQDot);
+  const int num_columns = is_wrt_qdot ? num_positions() : num_velocities();
+  const int num_frames = ssize(frames_B);
+  Js_V_ABi_E_list->resize(num_frames);
+
+  // For a single frame B, V_ABi_W = (Js_V_WBi_W - Js_V_WAi_W)⋅s with Ai the
+  // point of A coincident with Bi, see CalcJacobianSpatialVelocity(). The
+  // contribution of a node to Js_V_WBi_W (or Js_V_WAi_W) is only non-zero if
+  // the node is on the path from B (or A) to the world, and contributions
+  // from nodes on both paths cancel out. Therefore we first find, for each
+  // node, the frames it contributes to along with the sign of the
+  // contribution. A single sweep over the nodes then evaluates each node's
+  // across-node Jacobian (and N⁺ when s = q̇) once and shares it among all
+  // the frames.
+  const int num_mobods = topology_.num_mobods();
+  std::vector<bool> is_on_path_to_A(num_mobods, false);
+  for (MobodIndex m = frame_A.body().mobod_index(); m > world_mobod_index();
+       m = topology_.get_body_node(m).parent_body_node) {
+    is_on_path_to_A[m] = true;
+  }
+  // contributions[m] lists pairs (frame k, sign) for node m.
+  std::vector<std::vector<std::pair<int, int>>> contributions(num_mobods);
+  std::vector<bool> is_on_path_to_B(num_mobods, false);
+  std::vector<Matrix3X<T>> p_WoBi_W_list(num_frames);
+  for (int k = 0; k < num_frames; ++k) {
+    DRAKE_THROW_UNLESS(frames_B[k] != nullptr);
+    const Frame<T>& frame_B = *frames_B[k];
+    const Matrix3X<T>& p_BoBi_B = p_BoBi_B_list[k];
+    const int num_points = p_BoBi_B.cols();
+    p_WoBi_W_list[k].resize(3, num_points);
+    CalcPointsPositions(context, frame_B, p_BoBi_B, /* From frame B */
+                        world_frame(), &p_WoBi_W_list[k]);  /* To frame W */
+    (*Js_V_ABi_E_list)[k].setZero(6 * num_points, num_columns);
+
+    for (MobodIndex m = frame_B.body().mobod_index(); m > world_mobod_index();
+         m = topology_.get_body_node(m).parent_body_node) {
+      is_on_path_to_B[m] = true;
+      if (!is_on_path_to_A[m]) contributions[m].emplace_back(k, 1);
+    }
+    for (MobodIndex m = frame_A.body().mobod_index(); m > world_mobod_index();
+         m = topology_.get_body_node(m).parent_body_node) {
+      if (!is_on_path_to_B[m]) contributions[m].emplace_back(k, -1);
+    }
+    // Reset for the next frame.
+    for (MobodIndex m = frame_B.body().mobod_index(); m > world_mobod_index();
+         m = topology_.get_body_node(m).parent_body_node) {
+      is_on_path_to_B[m] = false;
+    }
+  }
+
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      EvalAcrossNodeJacobianWrtVExpressedInWorld(context);
+
+  // A statically allocated matrix with a maximum number of rows and columns.
+  Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, 0, 6, 7> Nplus;
+  // Contribution of a node to the Jacobian of a point Fp, per velocity.
+  MatrixUpTo6<T> Hv_PFp_W;
+
+  for (MobodIndex mobod_index(1); mobod_index < num_mobods; ++mobod_index) {
+    if (contributions[mobod_index].empty()) continue;
+    const BodyNode<T>& node = *body_nodes_[mobod_index];
+    const BodyNodeTopology& node_topology = node.get_topology();
+    const int mobilizer_num_velocities =
+        node_topology.num_mobilizer_velocities;
+    const int start_index =
+        is_wrt_qdot ? node_topology.mobilizer_positions_start
+                    : node_topology.mobilizer_velocities_start_in_v;
+    const int mobilizer_jacobian_ncols =
+        is_wrt_qdot ? node_topology.num_mobilizer_positions
+                    : mobilizer_num_velocities;
+    // N.B. This avoids working with zero sized Eigen blocks; see drake#17113.
+    if (mobilizer_jacobian_ncols == 0) continue;
+
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
+    const auto Hw_PB_W = H_PB_W.template topRows<3>();
+    const auto Hv_PB_W = H_PB_W.template bottomRows<3>();
+    if (is_wrt_qdot) {
+      Nplus.resize(mobilizer_num_velocities, mobilizer_jacobian_ncols);
+      node.get_mobilizer().CalcNplusMatrix(context, &Nplus);
+    }
+    const Vector3<T>& p_WoBo = pc.get_X_WB(node.index()).translation();
+
+    for (const auto& [k, sign] : contributions[mobod_index]) {
+      const Matrix3X<T>& p_WoBi_W = p_WoBi_W_list[k];
+      MatrixX<T>& Js_V_ABi_W = (*Js_V_ABi_E_list)[k];
+      for (int ipoint = 0; ipoint < p_WoBi_W.cols(); ++ipoint) {
+        auto Js_w_AB_W =
+            Js_V_ABi_W.block(6 * ipoint, start_index, 3,
+                             mobilizer_jacobian_ncols);
+        auto Js_v_ABi_W =
+            Js_V_ABi_W.block(6 * ipoint + 3, start_index, 3,
+                             mobilizer_jacobian_ncols);
+        // Shift Hv_PB_W from Bo to Fp, a point of the outboard body
+        // coincident with Bi.
+        const Vector3<T> p_BoFp_W = p_WoBi_W.col(ipoint) - p_WoBo;
+        Hv_PFp_W = Hv_PB_W + Hw_PB_W.colwise().cross(p_BoFp_W);
+        if (is_wrt_qdot && sign > 0) {
+          Js_w_AB_W.noalias() += Hw_PB_W * Nplus;
+          Js_v_ABi_W.noalias() += Hv_PFp_W * Nplus;
+        } else if (is_wrt_qdot) {
+          Js_w_AB_W.noalias() -= Hw_PB_W * Nplus;
+          Js_v_ABi_W.noalias() -= Hv_PFp_W * Nplus;
+        } else if (sign > 0) {
+          Js_w_AB_W += Hw_PB_W;
+          Js_v_ABi_W += Hv_PFp_W;
+        } else {
+          Js_w_AB_W -= Hw_PB_W;
+          Js_v_ABi_W -= Hv_PFp_W;
+        }
+      }
+    }
+  }
+
+  // Re-express in frame E if needed.
+  if (frame_E.index() != world_frame().index()) {
+    const RotationMatrix<T> R_EW =
+        CalcRelativeRotationMatrix(context, frame_E, world_frame());
+    for (MatrixX<T>& Js_V_ABi_E : *Js_V_ABi_E_list) {
+      for (int i = 0; i < Js_V_ABi_E.rows() / 3; ++i) {
+        Js_V_ABi_E.template middleRows<3>(3 * i) =
+            R_EW * Js_V_ABi_E.template middleRows<3>(3 * i);
+      }
+    }
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcJacobianAngularAndOrTranslationalVelocityInWorld(
     const systems::Context<T>& context,
@@ -3608,7 +4276,7 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
 
   // Perform tip-to-base recursion, skipping the world.
   for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (MobodIndex mobod_index : body_node_levels_[depth]) {
+    ForEachBodyNodeInLevel(depth, [&](MobodIndex mobod_index) {
       const BodyNode<T>& node = *body_nodes_[mobod_index];
 
       // Get hinge matrix and spatial inertia for this node.
@@ -3619,7 +4287,7 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
 
       node.CalcArticulatedBodyInertiaCache_TipToBase(
           context, pc, H_PB_W, M_B_W, diagonal_inertias, abic);
-    }
+    });
   }
 }
 
@@ -17,6 +17,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/pointer_cast.h"
 #include "drake/common/random.h"
 #include "drake/math/rigid_transform.h"
@@ -24,6 +25,8 @@
 #include "drake/multibody/tree/acceleration_kinematics_cache.h"
 #include "drake/multibody/tree/articulated_body_force_cache.h"
 #include "drake/multibody/tree/articulated_body_inertia_cache.h"
+#include "drake/multibody/tree/body_poses_batch.h"
+#include "drake/multibody/tree/branch_induced_sparse_matrix.h"
 #include "drake/multibody/tree/element_collection.h"
 #include "drake/multibody/tree/multibody_forces.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
@@ -584,6 +587,35 @@ class MultibodyTree {
     return topology_.forest_height();
   }
 
+  // Sets the degree of parallelism used by the level-by-level recursions in
+  // CalcPositionKinematicsCache(), CalcVelocityKinematicsCache(),
+  // CalcArticulatedBodyInertiaCache() and CalcInverseDynamics(). Body nodes
+  // at the same level only depend on nodes at other levels and therefore,
+  // when more than one thread is allowed, the nodes within a level are
+  // processed concurrently. This pays off for wide forests such as scenes
+  // with many free bodies and has no effect on the computed values. Only
+  // T = double is evaluated in parallel; other scalar types always run
+  // serially. The default is Parallelism::None().
+  void set_parallelism(Parallelism parallelism) {
+    parallelism_ = parallelism;
+  }
+
+  // Returns the parallelism set with set_parallelism().
+  Parallelism parallelism() const { return parallelism_; }
+
+  // Enables or disables incremental position kinematics. When enabled,
+  // CalcPositionKinematicsCache() remembers the generalized positions and
+  // numeric parameters used for the results already stored in the cache, and
+  // only recomputes the nodes whose mobilizer positions changed since then,
+  // along with their descendants. Results do not depend on this setting.
+  // Only T = double is updated incrementally. The default is false.
+  void set_incremental_kinematics(bool enabled) {
+    incremental_kinematics_ = enabled;
+  }
+
+  // Returns the setting from set_incremental_kinematics().
+  bool incremental_kinematics() const { return incremental_kinematics_; }
+
   // Returns a constant reference to the *world* body.
   const RigidBody<T>& world_body() const {
     // world_rigid_body_ is set in the constructor. So this assert is here only
@@ -1088,6 +1120,12 @@ class MultibodyTree {
       const systems::Context<T>& context,
       std::vector<math::RigidTransform<T>>* X_WB) const;
 
+  // See MultibodyPlant method.
+  void CalcBodyPosesInWorldBatch(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q,
+      BodyPosesBatch<T>* X_WB_batch) const;
+
   // See MultibodyPlant method.
   void CalcAllBodySpatialVelocitiesInWorld(
       const systems::Context<T>& context,
@@ -1245,6 +1283,16 @@ class MultibodyTree {
       const Frame<T>& frame_E,
       EigenPtr<MatrixX<T>> Js_v_ABi_E) const;
 
+  // See MultibodyPlant method.
+  void CalcJacobiansSpatialVelocity(
+      const systems::Context<T>& context,
+      JacobianWrtVariable with_respect_to,
+      const std::vector<const Frame<T>*>& frames_B,
+      const std::vector<Matrix3X<T>>& p_BoBi_B_list,
+      const Frame<T>& frame_A,
+      const Frame<T>& frame_E,
+      std::vector<MatrixX<T>>* Js_V_ABi_E_list) const;
+
   // See MultibodyPlant method.
   void CalcJacobianCenterOfMassTranslationalVelocity(
       const systems::Context<T>& context,
@@ -1454,6 +1502,36 @@ class MultibodyTree {
       const VectorX<T>& known_vdot,
       const MultibodyForces<T>& external_forces) const;
 
+  // Computes the partial derivatives of the generalized forces
+  // tau = CalcInverseDynamics(context, known_vdot, external_forces) with
+  // respect to the configuration and to the generalized velocities v, with
+  // known_vdot and external_forces held fixed. The applied spatial forces in
+  // external_forces keep their world frame components and remain applied at
+  // the body origins.
+  //
+  // Derivatives with respect to the configuration are taken along the
+  // tangent directions of generalized velocities. That is, column k of
+  // dtau_dqt is the derivative of tau along a path q(ε) with q(0) = q and
+  // q̇(0) = N(q)⋅eₖ, where eₖ is the k-th unit vector in ℝⁿᵛ. The derivative
+  // with respect to q itself, for any q̇ = N(q)⋅v, follows as
+  // dtau_dq = dtau_dqt⋅N⁺(q). The derivative with respect to known_vdot is
+  // the mass matrix, see CalcMassMatrix().
+  //
+  // The implementation uses forward (base to tip) and backward (tip to base)
+  // recursive sweeps of the derivatives of the Newton-Euler recursion, one for
+  // each generalized velocity, for a total cost of O(n⋅nv) with n the number
+  // of bodies. All spatial quantities are taken about the world origin so that
+  // the derivative of the hinge matrix column of velocity m with respect to
+  // velocity k is simply Hₖ ×ₘ Hₘ (the spatial motion cross product) when
+  // k moves Hₘ, see Mobilizer::hinge_column_moves_with_velocity(), and zero
+  // otherwise.
+  //
+  // @pre dtau_dqt and dtau_dv are non-null and of size nv x nv.
+  void CalcInverseDynamicsDerivatives(
+      const systems::Context<T>& context, const VectorX<T>& known_vdot,
+      const MultibodyForces<T>& external_forces,
+      EigenPtr<MatrixX<T>> dtau_dqt, EigenPtr<MatrixX<T>> dtau_dv) const;
+
   // (Advanced) Given the state of `this` %MultibodyTree in `context` and a
   // known vector of generalized accelerations `vdot`, this method computes the
   // set of generalized forces `tau` that would need to be applied at each
@@ -1615,6 +1693,21 @@ class MultibodyTree {
   void CalcMassMatrix(const systems::Context<T>& context,
                       EigenPtr<MatrixX<T>> M) const;
 
+  // See MultibodyPlant method.
+  void CalcBranchInducedMassMatrix(const systems::Context<T>& context,
+                                   BranchInducedSparseMatrix<T>* M) const;
+
+  // Returns the parent λ(i) of each generalized velocity i in the sparsity
+  // pattern of the mass matrix, see BranchInducedSparseMatrix. Within a
+  // mobilizer each velocity is the parent of the next one, and the first
+  // velocity of a mobilizer has as parent the last velocity of the nearest
+  // inboard mobilizer with velocities, or -1 if there is none.
+  // @pre Finalize() was already called on `this` tree.
+  const std::vector<int>& velocity_parents() const {
+    DRAKE_ASSERT(topology_is_valid());
+    return velocity_parents_;
+  }
+
   // See MultibodyPlant method.
   void CalcBiasTerm(
       const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const;
@@ -2295,6 +2388,8 @@ class MultibodyTree {
     tree_clone->topology_ = this->topology_;
     tree_clone->joint_to_mobilizer_ = this->joint_to_mobilizer_;
     tree_clone->discrete_state_index_ = this->discrete_state_index_;
+    tree_clone->parallelism_ = this->parallelism_;
+    tree_clone->incremental_kinematics_ = this->incremental_kinematics_;
 
     // All other internals templated on T are created with the following call to
     // FinalizeInternals().
@@ -2545,6 +2640,27 @@ class MultibodyTree {
   // Friend class to facilitate testing.
   friend class MultibodyTreeTester;
 
+  // Invokes calc(mobod_index) for each mobilized body at the given `level` of
+  // body_node_levels_. Depending on parallelism_, calls may run concurrently
+  // and in any order, and therefore `calc` must only write data owned by its
+  // own node. If any call throws, one of the exceptions is rethrown after all
+  // calls complete.
+  template <typename Calc>
+  void ForEachBodyNodeInLevel(int level, const Calc& calc) const;
+
+  // Performs the composite body algorithm that computes the mass matrix M,
+  // see CalcMassMatrix(), except for the contribution of reflected inertias.
+  // For each node C with velocities and each node B with velocities on the
+  // path from C to the root, including C itself, it invokes
+  // add_block(C_start_in_v, B_start_in_v, M_CB) with the block M_CB of size
+  // nv(C) x nv(B) of the mass matrix, where nv() denotes the number of
+  // mobilizer velocities. These are all the structurally non-zero blocks in
+  // the lower triangle (and the diagonal); the upper triangle follows from
+  // symmetry.
+  template <typename AddBlock>
+  void CalcMassMatrixBlocks(const systems::Context<T>& context,
+                            const AddBlock& add_block) const;
+
   // Helpers for getting the full qv discrete state once we know we are using
   // discrete state.
   Eigen::VectorBlock<const VectorX<T>> get_discrete_state_vector(
@@ -2877,6 +2993,12 @@ class MultibodyTree {
       const Frame<T>& frame_A,
       EigenPtr<MatrixX<T>> Js_v_ABi_W) const;
 
+  // If the mobilizer of node `mobod_index` has a specialized kernel (see
+  // mobilizer_kernels_), invokes `calc` with that mobilizer downcast to its
+  // concrete type and returns true. Otherwise returns false.
+  template <typename Calc>
+  bool CallWithConcreteMobilizer(MobodIndex mobod_index, Calc&& calc) const;
+
   // Helper method to apply forces due to damping at the joints.
   // MultibodyTree treats damping forces separately from other ForceElement
   // forces for a quick simple solution. This allows clients of MBT (namely MBP)
@@ -3065,6 +3187,30 @@ class MultibodyTree {
   // indexes in that level.
   std::vector<std::vector<MobodIndex>> body_node_levels_;
 
+  // The sparsity pattern of the mass matrix, built at Finalize().
+  // See velocity_parents().
+  std::vector<int> velocity_parents_;
+
+  // Mobilizer types with kinematics kernels specialized at compile time, see
+  // the BodyNode methods templated on the mobilizer type.
+  enum class MobilizerKernel {
+    kGeneric,  // Uses the virtual Mobilizer interface.
+    kWeld,
+    kRevolute,
+    kPrismatic,
+    kQuaternionFloating,
+  };
+
+  // The kernel used by each node, indexed by MobodIndex. Built at Finalize().
+  std::vector<MobilizerKernel> mobilizer_kernels_;
+
+  // Degree of parallelism for the level-by-level recursions.
+  // See set_parallelism().
+  Parallelism parallelism_{Parallelism::None()};
+
+  // See set_incremental_kinematics().
+  bool incremental_kinematics_{false};
+
   // Joint to Mobilizer map, of size num_joints(). For a joint with index
   // joint_index, mobilizer_index = joint_to_mobilizer_[joint_index] maps to the
   // mobilizer model of the joint, or an invalid index if the joint is modeled
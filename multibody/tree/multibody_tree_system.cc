@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "drake/common/drake_assert.h"
+#include "drake/math/linear_solve.h"
 #include "drake/multibody/tree/multibody_tree-inl.h"
 
 namespace drake {
@@ -487,6 +488,11 @@ void MultibodyTreeSystem<T>::CalcForwardDynamicsContinuous(
     AccelerationKinematicsCache<T>* ac) const {
   DRAKE_DEMAND(ac != nullptr);
 
+  if (forward_dynamics_via_mass_matrix_) {
+    CalcForwardDynamicsContinuousViaMassMatrix(context, ac);
+    return;
+  }
+
   // Collect forces from all sources and propagate tip-to-base.
   const ArticulatedBodyForceCache<T>& aba_force_cache =
       EvalArticulatedBodyForceCache(context);
@@ -497,6 +503,38 @@ void MultibodyTreeSystem<T>::CalcForwardDynamicsContinuous(
                                                    aba_force_cache, ac);
 }
 
+template <typename T>
+void MultibodyTreeSystem<T>::CalcForwardDynamicsContinuousViaMassMatrix(
+    const systems::Context<T>& context,
+    AccelerationKinematicsCache<T>* ac) const {
+  DRAKE_DEMAND(ac != nullptr);
+  const MultibodyTree<T>& tree = internal_tree();
+
+  MultibodyForces<T> forces(*this);
+
+  // Collect the same forces used by ABA, see CalcArticulatedBodyForceCache().
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const VelocityKinematicsCache<T>& vc = EvalVelocityKinematics(context);
+  tree.CalcForceElementsContribution(context, pc, vc, &forces);
+  AddInForcesContinuous(context, &forces);
+
+  // With v̇ = 0, inverse dynamics computes C(q, v)⋅v − τ, with τ the total
+  // generalized forces due to applied forces.
+  const int nv = tree.num_velocities();
+  const VectorX<T> minus_rhs =
+      tree.CalcInverseDynamics(context, VectorX<T>::Zero(nv), forces);
+
+  // M includes reflected inertias, consistent with ABA.
+  MatrixX<T> M(nv, nv);
+  tree.CalcMassMatrix(context, &M);
+  const math::LinearSolver<Eigen::LDLT, MatrixX<T>> M_ldlt(M);
+  VectorX<T>& vdot = ac->get_mutable_vdot();
+  vdot = M_ldlt.Solve(-minus_rhs);
+
+  tree.CalcSpatialAccelerationsFromVdot(context, pc, vc, vdot,
+                                        &ac->get_mutable_A_WB_pool());
+}
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
@@ -323,6 +323,20 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
     unused(context, forces);
   }
 
+  /* Selects how forward dynamics are computed in continuous mode. By default
+  the O(n) Articulated Body Algorithm (ABA) is used, which never forms the mass
+  matrix. When `via_mass_matrix` is true, the mass matrix M is instead formed
+  with the Composite Rigid Body Algorithm and factored with a dense LDLT to
+  solve M⋅v̇ = τ − C(q, v)⋅v. This has no effect in discrete mode. */
+  void set_forward_dynamics_via_mass_matrix(bool via_mass_matrix) {
+    forward_dynamics_via_mass_matrix_ = via_mass_matrix;
+  }
+
+  /* Returns the value set with set_forward_dynamics_via_mass_matrix(). */
+  bool forward_dynamics_via_mass_matrix() const {
+    return forward_dynamics_via_mass_matrix_;
+  }
+
   /* Derived class (likely MultibodyPlant) must implement this to support
   forward dynamics when in discrete mode. */
   virtual void DoCalcForwardDynamicsDiscrete(
@@ -484,10 +498,19 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
   // MultibodyPlant). Then it uses the O(n) Articulated Body Algorithm (ABA)
   // to compute accelerations. Please refer to @ref internal_forward_dynamics
   // for further details on the algorithm and implementation.
+  // If forward_dynamics_via_mass_matrix() is true, it instead forwards to
+  // CalcForwardDynamicsContinuousViaMassMatrix().
   void CalcForwardDynamicsContinuous(
       const systems::Context<T>& context,
       internal::AccelerationKinematicsCache<T>* ac) const;
 
+  // Computes continuous forward dynamics by forming the mass matrix M(q) and
+  // solving M⋅v̇ = −ID(q, v, v̇ = 0), where the inverse dynamics ID include the
+  // same applied forces used by ABA.
+  void CalcForwardDynamicsContinuousViaMassMatrix(
+      const systems::Context<T>& context,
+      internal::AccelerationKinematicsCache<T>* ac) const;
+
   // Discrete mode forward dynamics must be implemented by a derived class
   // (likely MultibodyPlant).
   void CalcForwardDynamicsDiscrete(
@@ -546,6 +569,10 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
 
   // Used to enforce "finalize once" restriction for protected-API users.
   bool already_finalized_{false};
+
+  // Selects the continuous forward dynamics algorithm.
+  // See set_forward_dynamics_via_mass_matrix().
+  bool forward_dynamics_via_mass_matrix_{false};
 };
 
 /* Access internal tree outside of MultibodyTreeSystem. */
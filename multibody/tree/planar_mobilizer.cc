@@ -117,6 +117,11 @@ math::RigidTransform<T> PlanarMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
   const auto& q = this->get_positions(context);
   DRAKE_ASSERT(q.size() == kNq);
+  return calc_X_FM(q.data());
+}
+
+template <typename T>
+math::RigidTransform<T> PlanarMobilizer<T>::calc_X_FM(const T* q) const {
   Vector3<T> X_FM_translation;
   X_FM_translation << q[0], q[1], 0.0;
   return math::RigidTransform<T>(math::RotationMatrix<T>::MakeZRotation(q[2]),
@@ -55,6 +55,14 @@ class PlanarMobilizer final : public MobilizerImpl<T, 3, 3> {
   bool can_rotate() const final    { return true; }
   bool can_translate() const final { return true; }
 
+  /* The rotation axis is F's z-axis through Mo, which moves with the
+   translations. */
+  bool hinge_column_moves_with_velocity(int m, int k) const final {
+    DRAKE_ASSERT(0 <= m && m < 3);
+    DRAKE_ASSERT(0 <= k && k < 3);
+    return m == 2 && k < 2;
+  }
+
   /* Retrieves from `context` the two translations (x, y) which describe the
    position for `this` mobilizer as documented in this class's documentation.
 
@@ -131,6 +139,10 @@ class PlanarMobilizer final : public MobilizerImpl<T, 3, 3> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const override;
 
+  /* Computes X_FM(q) for the given generalized positions `q`. See
+   Mobilizer::calc_X_FM(). */
+  math::RigidTransform<T> calc_X_FM(const T* q) const final;
+
   /* Computes the across-mobilizer velocity `V_FM(q, v)` of the outboard frame
    M measured and expressed in frame F as a function of the configuration q
    stored in `context` and of the input velocity v, formatted as described in
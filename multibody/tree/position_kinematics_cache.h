@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <limits>
 #include <vector>
 
@@ -9,6 +10,7 @@
 #include "drake/common/eigen_types.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
+#include "drake/multibody/tree/incremental_kinematics_statistics.h"
 #include "drake/multibody/tree/multibody_tree_indexes.h"
 #include "drake/multibody/tree/multibody_tree_topology.h"
 
@@ -121,6 +123,25 @@ class PositionKinematicsCache {
     return p_PoBo_W_pool_[mobod_index];
   }
 
+  // Bookkeeping used by MultibodyTree to update this cache incrementally, see
+  // MultibodyTree::set_incremental_kinematics().
+  struct IncrementalData {
+    // If true, `q` and `parameters` hold the inputs used to compute the
+    // current contents of this cache.
+    bool is_valid{false};
+    VectorX<T> q;
+    VectorX<T> parameters;
+    // Scratch indexed by MobodIndex, set to 1 for nodes updated by the last
+    // evaluation. Not std::vector<bool>, since nodes at the same level may be
+    // written concurrently.
+    std::vector<uint8_t> is_node_updated;
+    IncrementalKinematicsStatistics statistics;
+  };
+
+  const IncrementalData& incremental_data() const { return incremental_data_; }
+
+  IncrementalData& get_mutable_incremental_data() { return incremental_data_; }
+
  private:
   // Pool types:
   // Pools store entries in the same order as the mobilized bodies (BodyNodes)
@@ -175,6 +196,7 @@ class PositionKinematicsCache {
   X_PoolType X_FM_pool_;
   X_PoolType X_MB_pool_;
   Vector3PoolType p_PoBo_W_pool_;
+  IncrementalData incremental_data_;
 };
 
 }  // namespace internal
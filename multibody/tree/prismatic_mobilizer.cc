@@ -68,8 +68,7 @@ const PrismaticMobilizer<T>& PrismaticMobilizer<T>::SetTranslationRate(
 template <typename T>
 math::RigidTransform<T> PrismaticMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
-  return math::RigidTransform<T>(
-      get_translation(context) * translation_axis());
+  return calc_X_FM(&get_translation(context));
 }
 
 template <typename T>
@@ -77,7 +76,7 @@ SpatialVelocity<T> PrismaticMobilizer<T>::CalcAcrossMobilizerSpatialVelocity(
     const systems::Context<T>&,
     const Eigen::Ref<const VectorX<T>>& v) const {
   DRAKE_ASSERT(v.size() == kNv);
-  return SpatialVelocity<T>(Vector3<T>::Zero(), v[0] * translation_axis());
+  return calc_V_FM(nullptr, v.data());
 }
 
 template <typename T>
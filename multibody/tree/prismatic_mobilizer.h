@@ -112,6 +112,20 @@ class PrismaticMobilizer final : public MobilizerImpl<T, 1, 1> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const final;
 
+  // Computes X_FM(q) for the given generalized positions `q`. See
+  // Mobilizer::calc_X_FM(). Defined inline so that kernels specialized on
+  // this mobilizer type can inline it.
+  math::RigidTransform<T> calc_X_FM(const T* q) const final {
+    return math::RigidTransform<T>(q[0] * translation_axis());
+  }
+
+  // Computes V_FM(q, v) for the given generalized positions `q` and
+  // velocities `v`. Unlike CalcAcrossMobilizerSpatialVelocity(), this is not
+  // virtual and does not use dynamically sized arguments. `q` is unused.
+  SpatialVelocity<T> calc_V_FM(const T*, const T* v) const {
+    return SpatialVelocity<T>(Vector3<T>::Zero(), v[0] * translation_axis());
+  }
+
   // Computes the across-mobilizer velocity `V_FM(q, v)` of the outboard frame
   // M measured and expressed in frame F as a function of the translation taken
   // from `context` and input translational velocity `v` along this mobilizer's
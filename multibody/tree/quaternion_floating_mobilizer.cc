@@ -228,14 +228,7 @@ QuaternionFloatingMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
   const auto& q = this->get_positions(context);
   DRAKE_ASSERT(q.size() == kNq);
-
-  // The first 4 elements in q contain a quaternion, ordered as w, x, y, z.
-  // The last 3 elements in q contain position from Fo to Mo.
-  const Vector4<T> wxyz(q.template head<4>());
-  const Vector3<T> p_FM = q.template tail<3>();  // position from Fo to Mo.
-  const Eigen::Quaternion<T> quaternion_FM(wxyz(0), wxyz(1), wxyz(2), wxyz(3));
-  const math::RigidTransform<T> X_FM(quaternion_FM, p_FM);
-  return X_FM;
+  return calc_X_FM(q.data());
 }
 
 template <typename T>
@@ -62,6 +62,14 @@ class QuaternionFloatingMobilizer final : public MobilizerImpl<T, 7, 6> {
   bool can_rotate() const final    { return true; }
   bool can_translate() const final { return true; }
 
+  // The angular velocity columns are axes fixed in F through Mo, which moves
+  // with the translational velocities.
+  bool hinge_column_moves_with_velocity(int m, int k) const final {
+    DRAKE_ASSERT(0 <= m && m < 6);
+    DRAKE_ASSERT(0 <= k && k < 6);
+    return m < 3 && k >= 3;
+  }
+
   // @name Methods to get and set the state for a QuaternionFloatingMobilizer
   // @{
 
@@ -199,6 +207,26 @@ class QuaternionFloatingMobilizer final : public MobilizerImpl<T, 7, 6> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const final;
 
+  // Computes X_FM(q) for the given generalized positions `q`. See
+  // Mobilizer::calc_X_FM(). Defined inline so that kernels specialized on
+  // this mobilizer type can inline it.
+  math::RigidTransform<T> calc_X_FM(const T* q) const final {
+    // The first 4 elements in q contain a quaternion, ordered as w, x, y, z.
+    // The last 3 elements in q contain position from Fo to Mo.
+    const Eigen::Quaternion<T> quaternion_FM(q[0], q[1], q[2], q[3]);
+    const Vector3<T> p_FM(q[4], q[5], q[6]);
+    return math::RigidTransform<T>(quaternion_FM, p_FM);
+  }
+
+  // Computes V_FM(q, v) for the given generalized positions `q` and
+  // velocities `v`. Unlike CalcAcrossMobilizerSpatialVelocity(), this is not
+  // virtual and does not use dynamically sized arguments. `q` is unused.
+  SpatialVelocity<T> calc_V_FM(const T*, const T* v) const {
+    // The first 3 elements in v contain w_FM, the last 3 contain v_FM.
+    return SpatialVelocity<T>(Eigen::Map<const Vector3<T>>(v),
+                              Eigen::Map<const Vector3<T>>(v + 3));
+  }
+
   SpatialVelocity<T> CalcAcrossMobilizerSpatialVelocity(
       const systems::Context<T>& context,
       const Eigen::Ref<const VectorX<T>>& v) const final;
@@ -69,9 +69,7 @@ math::RigidTransform<T> RevoluteMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
   const auto& q = this->get_positions(context);
   DRAKE_ASSERT(q.size() == 1);
-  const Eigen::AngleAxis<T> angle_axis(q[0], axis_F_);
-  const math::RigidTransform<T> X_FM(angle_axis, Vector3<T>::Zero());
-  return X_FM;
+  return calc_X_FM(q.data());
 }
 
 template <typename T>
@@ -79,7 +77,7 @@ SpatialVelocity<T> RevoluteMobilizer<T>::CalcAcrossMobilizerSpatialVelocity(
     const systems::Context<T>&,
     const Eigen::Ref<const VectorX<T>>& v) const {
   DRAKE_ASSERT(v.size() == kNv);
-  return SpatialVelocity<T>(v[0] * axis_F_, Vector3<T>::Zero());
+  return calc_V_FM(nullptr, v.data());
 }
 
 template <typename T>
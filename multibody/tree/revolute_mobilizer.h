@@ -113,6 +113,21 @@ class RevoluteMobilizer final : public MobilizerImpl<T, 1, 1> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const override;
 
+  // Computes X_FM(q) for the given generalized positions `q`. See
+  // Mobilizer::calc_X_FM(). Defined inline so that kernels specialized on
+  // this mobilizer type can inline it.
+  math::RigidTransform<T> calc_X_FM(const T* q) const final {
+    const Eigen::AngleAxis<T> angle_axis(q[0], axis_F_);
+    return math::RigidTransform<T>(angle_axis, Vector3<T>::Zero());
+  }
+
+  // Computes V_FM(q, v) for the given generalized positions `q` and
+  // velocities `v`. Unlike CalcAcrossMobilizerSpatialVelocity(), this is not
+  // virtual and does not use dynamically sized arguments. `q` is unused.
+  SpatialVelocity<T> calc_V_FM(const T*, const T* v) const {
+    return SpatialVelocity<T>(v[0] * axis_F_, Vector3<T>::Zero());
+  }
+
   // Computes the across-mobilizer velocity `V_FM(q, v)` of the outboard frame
   // M measured and expressed in frame F as a function of the rotation angle
   // and input angular velocity `v` about this mobilizer's axis
@@ -1195,3 +1195,5 @@ struct formatter<drake::multibody::RotationalInertia<T>>
 
 DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class drake::multibody::RotationalInertia);
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF(
+    class drake::multibody::RotationalInertia);
@@ -96,7 +96,12 @@ math::RigidTransform<T> RpyBallMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
   const Eigen::Matrix<T, 3, 1>& rpy = this->get_positions(context);
   DRAKE_ASSERT(rpy.size() == kNq);
-  const math::RollPitchYaw<T> roll_pitch_yaw(rpy(0), rpy(1), rpy(2));
+  return calc_X_FM(rpy.data());
+}
+
+template <typename T>
+math::RigidTransform<T> RpyBallMobilizer<T>::calc_X_FM(const T* q) const {
+  const math::RollPitchYaw<T> roll_pitch_yaw(q[0], q[1], q[2]);
   math::RigidTransform<T> X_FM(roll_pitch_yaw, Vector3<T>::Zero());
   return X_FM;
 }
@@ -168,6 +168,10 @@ class RpyBallMobilizer final : public MobilizerImpl<T, 3, 3> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const override;
 
+  // Computes X_FM(q) for the given generalized positions `q`. See
+  // Mobilizer::calc_X_FM().
+  math::RigidTransform<T> calc_X_FM(const T* q) const final;
+
   // Computes the across-mobilizer velocity V_FM(q, v) of the outboard frame
   // M measured and expressed in frame F as a function of the roll-pitch-yaw
   // angles θ₀, θ₁, θ₂ stored in context and of the input generalized
@@ -169,9 +169,17 @@ template <typename T>
 math::RigidTransform<T>
 RpyFloatingMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
-  const auto rpy = this->get_angles(context);
-  const auto p_FM = this->get_translation(context);
-  const math::RollPitchYaw<T> roll_pitch_yaw(rpy(0), rpy(1), rpy(2));
+  const auto& q = this->get_positions(context);
+  DRAKE_ASSERT(q.size() == kNq);
+  return calc_X_FM(q.data());
+}
+
+template <typename T>
+math::RigidTransform<T> RpyFloatingMobilizer<T>::calc_X_FM(const T* q) const {
+  // The first 3 elements in q are the roll-pitch-yaw angles and the last 3
+  // elements are the position from Fo to Mo.
+  const math::RollPitchYaw<T> roll_pitch_yaw(q[0], q[1], q[2]);
+  const Vector3<T> p_FM(q[3], q[4], q[5]);
   return math::RigidTransform<T>(roll_pitch_yaw, p_FM);
 }
 
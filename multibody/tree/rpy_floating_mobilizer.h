@@ -84,6 +84,14 @@ class RpyFloatingMobilizer final : public MobilizerImpl<T, 6, 6> {
   bool can_rotate() const final    { return true; }
   bool can_translate() const final { return true; }
 
+  // The angular velocity columns are axes fixed in F through Mo, which moves
+  // with the translational velocities.
+  bool hinge_column_moves_with_velocity(int m, int k) const final {
+    DRAKE_ASSERT(0 <= m && m < 6);
+    DRAKE_ASSERT(0 <= k && k < 6);
+    return m < 3 && k >= 3;
+  }
+
   // Returns the generalized positions for this mobilizer stored in context.
   // Generalized positions q for this mobilizer are packed in exactly the
   // following order: q = [θ₀, θ₁, θ₂, px_FM, py_FM, pz_FM] that is, rpy
@@ -218,6 +226,10 @@ class RpyFloatingMobilizer final : public MobilizerImpl<T, 6, 6> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const final;
 
+  // Computes X_FM(q) for the given generalized positions `q`. See
+  // Mobilizer::calc_X_FM().
+  math::RigidTransform<T> calc_X_FM(const T* q) const final;
+
   // Computes the across-mobilizer velocity V_FM(q, v) of the outboard frame M
   // measured and expressed in frame F as a function of the configuration stored
   // in context and of the input generalized velocity v, packed as documented
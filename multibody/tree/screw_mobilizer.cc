@@ -115,6 +115,11 @@ math::RigidTransform<T> ScrewMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
   const auto& q = this->get_positions(context);
   DRAKE_ASSERT(q.size() == kNq);
+  return calc_X_FM(q.data());
+}
+
+template <typename T>
+math::RigidTransform<T> ScrewMobilizer<T>::calc_X_FM(const T* q) const {
   const Vector3<T> p_FM(axis_ *
       get_screw_translation_from_rotation(q[0], screw_pitch_));
   return math::RigidTransform<T>(Eigen::AngleAxis<T>(q[0], axis_), p_FM);
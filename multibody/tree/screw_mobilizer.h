@@ -165,6 +165,10 @@ class ScrewMobilizer final : public MobilizerImpl<T, 1, 1> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const final;
 
+  /* Computes X_FM(q) for the given generalized positions `q`. See
+   Mobilizer::calc_X_FM(). */
+  math::RigidTransform<T> calc_X_FM(const T* q) const final;
+
   /* Computes the across-mobilizer velocity `V_FM(q, v)` of the outboard frame
    M measured and expressed in frame F as a function of the configuration q
    stored in `context` and of the input velocity v, formatted as described in
@@ -586,9 +586,13 @@ DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS((
     static_cast<std::ostream&(*)(std::ostream&, const SpatialInertia<T>&)>(
         &operator<< )
 ));
+template std::ostream& operator<<(std::ostream&,
+                                  const SpatialInertia<AutoDiffUpTo16d>&);
 
 }  // namespace multibody
 }  // namespace drake
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class drake::multibody::SpatialInertia);
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF(
+    class drake::multibody::SpatialInertia);
@@ -1037,3 +1037,5 @@ struct formatter<drake::multibody::SpatialInertia<T>>
 
 DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class drake::multibody::SpatialInertia);
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF(
+    class drake::multibody::SpatialInertia);
@@ -0,0 +1,70 @@
+#include "drake/multibody/tree/body_poses_batch.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/roll_pitch_yaw.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+GTEST_TEST(BodyPosesBatchTest, Construction) {
+  const BodyPosesBatch<double> dut(3, 4);
+  EXPECT_EQ(dut.num_bodies(), 3);
+  EXPECT_EQ(dut.num_configurations(), 4);
+  for (BodyIndex b(0); b < 3; ++b) {
+    EXPECT_EQ(dut.translations(b).rows(), 4);
+    EXPECT_EQ(dut.rotations(b).rows(), 4);
+    for (int k = 0; k < 4; ++k) {
+      EXPECT_TRUE(dut.GetPose(b, k).IsExactlyIdentity());
+    }
+  }
+
+  const BodyPosesBatch<double> empty;
+  EXPECT_EQ(empty.num_bodies(), 0);
+  EXPECT_EQ(empty.num_configurations(), 0);
+}
+
+GTEST_TEST(BodyPosesBatchTest, SetAndGetPose) {
+  BodyPosesBatch<double> dut(2, 3);
+  const RigidTransformd X_WB(RollPitchYawd(0.1, -0.2, 0.3),
+                             Eigen::Vector3d(1.0, 2.0, 3.0));
+  dut.SetPose(BodyIndex(1), 2, X_WB);
+  EXPECT_TRUE(dut.GetPose(BodyIndex(1), 2).IsExactlyEqualTo(X_WB));
+  EXPECT_TRUE(dut.GetPose(BodyIndex(1), 1).IsExactlyIdentity());
+  EXPECT_TRUE(dut.GetPose(BodyIndex(0), 2).IsExactlyIdentity());
+
+  // Verify the structure-of-arrays layout.
+  EXPECT_TRUE(CompareMatrices(dut.translations(BodyIndex(1)).row(2),
+                              X_WB.translation().transpose()));
+  const Eigen::Matrix3d& R_WB = X_WB.rotation().matrix();
+  for (int j = 0; j < 9; ++j) {
+    EXPECT_EQ(dut.rotations(BodyIndex(1))(2, j), R_WB(j % 3, j / 3));
+  }
+}
+
+GTEST_TEST(BodyPosesBatchTest, Resize) {
+  BodyPosesBatch<double> dut(2, 3);
+  const RigidTransformd X_WB(Eigen::Vector3d(1.0, 2.0, 3.0));
+  dut.SetPose(BodyIndex(1), 0, X_WB);
+
+  // Same sizes leave values untouched.
+  dut.Resize(2, 3);
+  EXPECT_TRUE(dut.GetPose(BodyIndex(1), 0).IsExactlyEqualTo(X_WB));
+
+  dut.Resize(4, 5);
+  EXPECT_EQ(dut.num_bodies(), 4);
+  EXPECT_EQ(dut.num_configurations(), 5);
+  EXPECT_TRUE(dut.GetPose(BodyIndex(1), 0).IsExactlyIdentity());
+
+  EXPECT_THROW(dut.Resize(-1, 2), std::exception);
+  EXPECT_THROW(dut.Resize(1, -2), std::exception);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,155 @@
+#include "drake/multibody/tree/branch_induced_sparse_matrix.h"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+constexpr double kEpsilon = std::numeric_limits<double>::epsilon();
+
+// A forest with two trees:
+//   0 ─ 1 ─ 2      5 ─ 6
+//        └─ 3 ─ 4
+const std::vector<int> kParents{-1, 0, 1, 1, 3, -1, 5};
+
+GTEST_TEST(BranchInducedSparseMatrixTest, SparsityPattern) {
+  const BranchInducedSparseMatrix<double> dut(kParents);
+  EXPECT_EQ(dut.size(), 7);
+  EXPECT_EQ(dut.parents(), kParents);
+  EXPECT_EQ(dut.parent(4), 3);
+  EXPECT_EQ(dut.parent(5), -1);
+  EXPECT_EQ(dut.depth(0), 0);
+  EXPECT_EQ(dut.depth(4), 3);
+  EXPECT_EQ(dut.depth(6), 1);
+  // One entry per node plus one per ancestor: 1 + 2 + 3 + 3 + 4 + 1 + 2.
+  EXPECT_EQ(dut.num_stored_entries(), 16);
+
+  EXPECT_TRUE(dut.IsStored(4, 4));
+  EXPECT_TRUE(dut.IsStored(4, 3));
+  EXPECT_TRUE(dut.IsStored(4, 1));
+  EXPECT_TRUE(dut.IsStored(4, 0));
+  EXPECT_FALSE(dut.IsStored(4, 2));  // Sibling branch.
+  EXPECT_FALSE(dut.IsStored(3, 4));  // Upper triangle.
+  EXPECT_FALSE(dut.IsStored(6, 0));  // Different trees.
+
+  const BranchInducedSparseMatrix<double> empty;
+  EXPECT_EQ(empty.size(), 0);
+  EXPECT_EQ(empty.num_stored_entries(), 0);
+}
+
+GTEST_TEST(BranchInducedSparseMatrixTest, BadParents) {
+  DRAKE_EXPECT_THROWS_MESSAGE(BranchInducedSparseMatrix<double>({-1, 1}),
+                              ".*parent < i.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(BranchInducedSparseMatrix<double>({-2}),
+                              ".*-1 <= parent.*");
+}
+
+// Returns an arbitrary symmetric positive definite matrix with the sparsity
+// pattern of kParents. It is built as H = Lᵀ⋅D⋅L with L and D known, so that
+// the factorization can be verified as well.
+BranchInducedSparseMatrix<double> MakeSpdMatrix(MatrixXd* L, VectorXd* D) {
+  BranchInducedSparseMatrix<double> L_sparse(kParents);
+  const int n = L_sparse.size();
+  *D = VectorXd::LinSpaced(n, 1.0, 3.0);
+  for (int i = 0; i < n; ++i) {
+    L_sparse(i, i) = 1.0;
+    for (int j = kParents[i]; j >= 0; j = kParents[j]) {
+      L_sparse(i, j) = 0.1 * (i + 1) - 0.2 * j;
+    }
+  }
+  // MakeDenseMatrix() symmetrizes, so keep only the lower triangle.
+  *L = L_sparse.MakeDenseMatrix().triangularView<Eigen::Lower>();
+  const MatrixXd H_dense = L->transpose() * D->asDiagonal() * (*L);
+
+  BranchInducedSparseMatrix<double> H(kParents);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      if (H.IsStored(i, j)) {
+        H(i, j) = H_dense(i, j);
+      } else {
+        // The LTDL factorization causes no fill-in.
+        EXPECT_EQ(H_dense(i, j), 0.0);
+      }
+    }
+  }
+  EXPECT_TRUE(CompareMatrices(H.MakeDenseMatrix(), H_dense, 0.0));
+  return H;
+}
+
+GTEST_TEST(BranchInducedSparseMatrixTest, SetZero) {
+  MatrixXd L;
+  VectorXd D;
+  BranchInducedSparseMatrix<double> H = MakeSpdMatrix(&L, &D);
+  H.SetZero();
+  EXPECT_TRUE(
+      CompareMatrices(H.MakeDenseMatrix(), MatrixXd::Zero(7, 7), 0.0));
+}
+
+GTEST_TEST(BranchInducedLtdlFactorizationTest, FactorAndSolve) {
+  MatrixXd L;
+  VectorXd D;
+  const BranchInducedSparseMatrix<double> H = MakeSpdMatrix(&L, &D);
+  const BranchInducedLtdlFactorization<double> dut(H);
+  EXPECT_EQ(dut.size(), 7);
+
+  // Verify the factors.
+  const BranchInducedSparseMatrix<double>& LD = dut.factors();
+  for (int i = 0; i < dut.size(); ++i) {
+    EXPECT_NEAR(LD(i, i), D(i), 10 * kEpsilon);
+    for (int j = kParents[i]; j >= 0; j = kParents[j]) {
+      EXPECT_NEAR(LD(i, j), L(i, j), 10 * kEpsilon);
+    }
+  }
+
+  // Verify the solution.
+  const VectorXd b = VectorXd::LinSpaced(dut.size(), -1.0, 1.0);
+  const VectorXd x = dut.Solve(b);
+  const VectorXd x_expected = H.MakeDenseMatrix().ldlt().solve(b);
+  EXPECT_TRUE(CompareMatrices(x, x_expected, 100 * kEpsilon,
+                              MatrixCompareType::relative));
+
+  VectorXd x_in_place = b;
+  dut.SolveInPlace(&x_in_place);
+  EXPECT_TRUE(CompareMatrices(x_in_place, x, 0.0));
+}
+
+GTEST_TEST(BranchInducedLtdlFactorizationTest, Refactor) {
+  MatrixXd L;
+  VectorXd D;
+  BranchInducedSparseMatrix<double> H = MakeSpdMatrix(&L, &D);
+  BranchInducedLtdlFactorization<double> dut(H);
+
+  // Scaling H scales its inverse by the reciprocal.
+  const VectorXd b = VectorXd::LinSpaced(dut.size(), -1.0, 1.0);
+  const VectorXd x = dut.Solve(b);
+  for (int i = 0; i < H.size(); ++i) {
+    H(i, i) *= 2.0;
+    for (int j = kParents[i]; j >= 0; j = kParents[j]) H(i, j) *= 2.0;
+  }
+  dut.Factor(H);
+  EXPECT_TRUE(CompareMatrices(dut.Solve(b), 0.5 * x, 100 * kEpsilon,
+                              MatrixCompareType::relative));
+}
+
+GTEST_TEST(BranchInducedLtdlFactorizationTest, NotPositiveDefinite) {
+  BranchInducedSparseMatrix<double> H({-1, 0});
+  H(0, 0) = 1.0;
+  H(1, 1) = 1.0;
+  H(1, 0) = 2.0;
+  DRAKE_EXPECT_THROWS_MESSAGE(BranchInducedLtdlFactorization<double>(H),
+                              ".*not positive definite.*index 0.*");
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
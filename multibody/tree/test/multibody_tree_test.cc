@@ -1060,6 +1060,50 @@ TEST_F(KukaIiwaModelTests, EvalPoseAndSpatialVelocity) {
                               kTolerance, MatrixCompareType::relative));
 }
 
+// Verifies that the batched pose computation matches, configuration by
+// configuration, the poses computed through the context.
+TEST_F(KukaIiwaModelTests, CalcBodyPosesInWorldBatch) {
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+  const int kNumConfigurations = 5;
+  const int nq = tree().num_positions();
+
+  VectorX<double> q0, v0;
+  GetArbitraryNonZeroJointAnglesAndRates(&q0, &v0);
+  MatrixX<double> q_batch(nq, kNumConfigurations);
+  for (int k = 0; k < kNumConfigurations; ++k) {
+    q_batch.col(k) = (k + 1.0) / kNumConfigurations * q0 -
+                     VectorX<double>::LinSpaced(nq, 0.1 * k, 0.3 * k);
+  }
+
+  const VectorX<double> q_context = tree().get_positions(*context_);
+  BodyPosesBatch<double> X_WB_batch;
+  tree().CalcBodyPosesInWorldBatch(*context_, q_batch, &X_WB_batch);
+  ASSERT_EQ(X_WB_batch.num_bodies(), tree().num_bodies());
+  ASSERT_EQ(X_WB_batch.num_configurations(), kNumConfigurations);
+  // The state stored in the context is left untouched.
+  EXPECT_TRUE(CompareMatrices(tree().get_positions(*context_), q_context));
+
+  std::vector<RigidTransform<double>> X_WB_expected;
+  for (int k = 0; k < kNumConfigurations; ++k) {
+    tree().GetMutablePositions(context_.get()) = q_batch.col(k);
+    tree().CalcAllBodyPosesInWorld(*context_, &X_WB_expected);
+    for (BodyIndex b(0); b < tree().num_bodies(); ++b) {
+      EXPECT_TRUE(X_WB_batch.GetPose(b, k).IsNearlyEqualTo(X_WB_expected[b],
+                                                           kTolerance));
+    }
+  }
+
+  // Reusing the batch with a different number of configurations resizes it.
+  tree().CalcBodyPosesInWorldBatch(*context_, q_batch.leftCols(2),
+                                   &X_WB_batch);
+  EXPECT_EQ(X_WB_batch.num_configurations(), 2);
+
+  // The number of rows in q must match the number of positions.
+  EXPECT_THROW(tree().CalcBodyPosesInWorldBatch(
+                   *context_, q_batch.topRows(nq - 1), &X_WB_batch),
+               std::exception);
+}
+
 TEST_F(KukaIiwaModelTests, CalcJacobianSpatialVelocityA) {
   // The number of generalized positions in the Kuka iiwa robot arm model.
   const int kNumPositions = tree().num_positions();
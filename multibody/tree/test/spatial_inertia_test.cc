@@ -12,6 +12,7 @@
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
+#include "drake/math/roll_pitch_yaw.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/tree/rotational_inertia.h"
 #include "drake/multibody/tree/unit_inertia.h"
@@ -767,6 +768,35 @@ GTEST_TEST(SpatialInertia, CastToAutoDiff) {
   ASSERT_EQ(com_gradient.size(), 0);
 }
 
+// Tests that SpatialInertia<AutoDiffUpTo16d>, whose gradients are stored
+// inline, computes the same gradients as SpatialInertia<AutoDiffXd>.
+GTEST_TEST(SpatialInertia, AutoDiffUpTo16d) {
+  const Vector4<double> x(2.5, 0.1, -0.2, 0.3);  // Mass and an angle.
+  Vector4<AutoDiffUpTo16d> x_fixed;
+  math::InitializeAutoDiff(x, &x_fixed);
+  const Vector4<AutoDiffXd> x_xd = math::InitializeAutoDiff(x);
+
+  // Returns M_BQ_A, the spatial inertia of a box B about a point Q, expressed
+  // in a frame A. Both the mass of B and the orientation of A depend on x.
+  auto calc = [](const auto& xx) {
+    using T = typename std::decay_t<decltype(xx)>::Scalar;
+    const SpatialInertia<T> M_BBo_B =
+        SpatialInertia<T>::SolidBoxWithMass(xx(0), 0.1, 0.2, 0.3);
+    const math::RotationMatrix<T> R_AB(
+        math::RollPitchYaw<T>(xx(1), xx(2), xx(3)));
+    const SpatialInertia<T> M_BQ_A =
+        M_BBo_B.ReExpress(R_AB).Shift(xx.template tail<3>());
+    return M_BQ_A.CopyToFullMatrix6();
+  };
+
+  const Matrix6<AutoDiffUpTo16d> M_fixed = calc(x_fixed);
+  const Matrix6<AutoDiffXd> M_xd = calc(x_xd);
+  EXPECT_TRUE(CompareMatrices(math::ExtractValue(M_fixed),
+                              math::ExtractValue(M_xd), 0.0));
+  EXPECT_TRUE(CompareMatrices(math::ExtractGradient(M_fixed),
+                              math::ExtractGradient(M_xd), 16 * kEpsilon));
+}
+
 // Test the shift operator to write into a stream.
 GTEST_TEST(SpatialInertia, ShiftOperator) {
   const double mass = 2.5;
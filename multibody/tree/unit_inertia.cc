@@ -313,3 +313,5 @@ UnitInertia<T>::CalcPrincipalHalfLengthsAndAxesForEquivalentShape(
 
 DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     class drake::multibody::UnitInertia);
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_FIXED_SIZE_AUTODIFF(
+    class drake::multibody::UnitInertia);
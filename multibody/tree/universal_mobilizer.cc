@@ -82,6 +82,11 @@ math::RigidTransform<T> UniversalMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
   const auto& q = this->get_positions(context);
   DRAKE_ASSERT(q.size() == kNq);
+  return calc_X_FM(q.data());
+}
+
+template <typename T>
+math::RigidTransform<T> UniversalMobilizer<T>::calc_X_FM(const T* q) const {
   const T s1 = sin(q[0]);
   const T c1 = cos(q[0]);
   const T s2 = sin(q[1]);
@@ -67,6 +67,13 @@ class UniversalMobilizer final : public MobilizerImpl<T, 2, 2> {
   bool can_rotate() const final    { return true; }
   bool can_translate() const final { return false; }
 
+  // The second axis rotates with the first angle, about F's x-axis.
+  bool hinge_column_moves_with_velocity(int m, int k) const final {
+    DRAKE_ASSERT(0 <= m && m < 2);
+    DRAKE_ASSERT(0 <= k && k < 2);
+    return m == 1 && k == 0;
+  }
+
   // Retrieves from `context` the two angles, (θ₁, θ₂) which describe the state
   // for `this` mobilizer as documented in this class's documentation.
   //
@@ -109,6 +116,10 @@ class UniversalMobilizer final : public MobilizerImpl<T, 2, 2> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const override;
 
+  // Computes X_FM(q) for the given generalized positions `q`. See
+  // Mobilizer::calc_X_FM().
+  math::RigidTransform<T> calc_X_FM(const T* q) const final;
+
   // Computes the across-mobilizer velocity `V_FM(q, v)` of the outboard frame
   // M measured and expressed in frame F as a function of the angles (θ₁, θ₂)
   // stored in `context` and of the input angular rates v, formatted as
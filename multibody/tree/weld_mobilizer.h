@@ -44,6 +44,18 @@ class WeldMobilizer final : public MobilizerImpl<T, 0, 0> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const final;
 
+  // Computes X_FM(q) for the given generalized positions `q`. See
+  // Mobilizer::calc_X_FM(). Since this mobilizer has no positions, `q` is
+  // unused.
+  math::RigidTransform<T> calc_X_FM(const T*) const final {
+    return X_FM_.cast<T>();
+  }
+
+  // Computes V_FM, which is always zero for this mobilizer.
+  SpatialVelocity<T> calc_V_FM(const T*, const T*) const {
+    return SpatialVelocity<T>::Zero();
+  }
+
   // Computes the across-mobilizer velocity `V_FM` which for this mobilizer is
   // always zero since the outboard frame M is fixed to the inboard frame F.
   SpatialVelocity<T> CalcAcrossMobilizerSpatialVelocity(